@@ -0,0 +1,115 @@
+#.rst:
+# Find Draco
+# ----------
+#
+# Finds the Draco library. This module defines:
+#
+#  Draco_FOUND          - True if Draco library is found
+#  Draco::Draco         - Draco imported target
+#
+# Additionally these variables are defined for internal usage:
+#
+#  Draco_LIBRARY        - Draco library
+#  Draco_INCLUDE_DIR    - Include dir
+#
+
+
+#
+#   This file is part of Magnum.
+#
+#   Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+#               2020, 2021, 2022, 2023, 2024, 2025, 2026
+#             Vladimír Vondruš <mosra@centrum.cz>
+#
+#   Permission is hereby granted, free of charge, to any person obtaining a
+#   copy of this software and associated documentation files (the "Software"),
+#   to deal in the Software without restriction, including without limitation
+#   the rights to use, copy, modify, merge, publish, distribute, sublicense,
+#   and/or sell copies of the Software, and to permit persons to whom the
+#   Software is furnished to do so, subject to the following conditions:
+#
+#   The above copyright notice and this permission notice shall be included
+#   in all copies or substantial portions of the Software.
+#
+#   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+#   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+#   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+#   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+#   DEALINGS IN THE SOFTWARE.
+#
+
+# In case we have Draco as a CMake subproject, a draco_static or draco target
+# should be present. If not, try to find it via the installed config file, as
+# that is useful to know additional libraries to link to in case of a static
+# build.
+if(NOT TARGET draco_static AND NOT TARGET draco)
+    find_package(draco CONFIG QUIET)
+endif()
+
+# The CMake project provides a namespaced target only in the installed config
+# file, so we have to do this branching here.
+set(_DRACO_TARGET )
+set(_DRACO_SUBPROJECT )
+if(TARGET draco_static)
+    set(_DRACO_TARGET draco_static)
+    set(_DRACO_SUBPROJECT ON)
+elseif(TARGET draco)
+    set(_DRACO_TARGET draco)
+    set(_DRACO_SUBPROJECT ON)
+elseif(TARGET draco::draco)
+    set(_DRACO_TARGET draco::draco)
+endif()
+if(_DRACO_TARGET)
+    # The subproject target doesn't define any usable
+    # INTERFACE_INCLUDE_DIRECTORIES, so let's do that ourselves. The headers
+    # are in src/, the generated draco/draco_features.h is in the build root.
+    if(_DRACO_SUBPROJECT)
+        get_target_property(_DRACO_SOURCE_DIR ${_DRACO_TARGET} SOURCE_DIR)
+        get_target_property(_DRACO_BINARY_DIR ${_DRACO_TARGET} BINARY_DIR)
+        set(_DRACO_INTERFACE_INCLUDE_DIRECTORIES ${_DRACO_SOURCE_DIR}/src ${_DRACO_BINARY_DIR})
+    else()
+        get_target_property(_DRACO_INTERFACE_INCLUDE_DIRECTORIES ${_DRACO_TARGET} INTERFACE_INCLUDE_DIRECTORIES)
+    endif()
+
+    if(NOT TARGET Draco::Draco)
+        # Aliases of (global) targets are only supported in CMake 3.11, so we
+        # work around it by this. This is easier than fetching all possible
+        # properties (which are impossible to track of) and then attempting to
+        # rebuild them into a new target.
+        add_library(Draco::Draco INTERFACE IMPORTED)
+        set_target_properties(Draco::Draco PROPERTIES
+            INTERFACE_INCLUDE_DIRECTORIES "${_DRACO_INTERFACE_INCLUDE_DIRECTORIES}"
+            INTERFACE_LINK_LIBRARIES ${_DRACO_TARGET})
+    endif()
+
+    # Just to make FPHSA print some meaningful location, nothing else
+    include(FindPackageHandleStandardArgs)
+    find_package_handle_standard_args(Draco DEFAULT_MSG
+        _DRACO_INTERFACE_INCLUDE_DIRECTORIES)
+    return()
+endif()
+
+# Library
+find_library(Draco_LIBRARY NAMES draco)
+
+# Include dir
+find_path(Draco_INCLUDE_DIR
+    NAMES draco/compression/decode.h)
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(Draco DEFAULT_MSG
+    Draco_LIBRARY
+    Draco_INCLUDE_DIR)
+
+mark_as_advanced(FORCE
+    Draco_INCLUDE_DIR
+    Draco_LIBRARY)
+
+if(NOT TARGET Draco::Draco)
+    add_library(Draco::Draco UNKNOWN IMPORTED)
+    set_target_properties(Draco::Draco PROPERTIES
+        IMPORTED_LOCATION ${Draco_LIBRARY}
+        INTERFACE_INCLUDE_DIRECTORIES ${Draco_INCLUDE_DIR})
+endif()
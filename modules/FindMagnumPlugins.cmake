@@ -13,6 +13,7 @@
 # This command will not try to find any actual plugin. The plugins are:
 #
 #  AssimpImporter               - Assimp importer
+#  AstcDecImageConverter        - ASTC image decoder
 #  AstcImporter                 - ASTC importer
 #  AvifImporter                 - AVIF importer
 #  BasisImageConverter          - Basis image converter
@@ -20,6 +21,7 @@
 #  BcDecImageConverter          - BCn image decoder using bcdec
 #  DdsImporter                  - DDS importer
 #  DevIlImageImporter           - Image importer using DevIL
+#  DracoImporter                - Draco importer
 #  DrFlacAudioImporter          - FLAC audio importer using dr_flac
 #  DrMp3AudioImporter           - MP3 audio importer using dr_mp3
 #  DrWavAudioImporter           - WAV audio importer using dr_wav
@@ -177,7 +179,7 @@ mark_as_advanced(MAGNUMPLUGINS_INCLUDE_DIR)
 find_path(_MAGNUMPLUGINS_DEPENDENCY_MODULE_DIR
     NAMES
         FindAssimp.cmake FindBasisUniversal.cmake FindDevIL.cmake
-        FindFAAD2.cmake FindGlslang.cmake FindHarfBuzz.cmake
+        FindDraco.cmake FindFAAD2.cmake FindGlslang.cmake FindHarfBuzz.cmake
         FindOpenEXR.cmake FindResvg.cmake FindSpirvTools.cmake FindSpng.cmake
         FindWebP.cmake FindZstd.cmake
     PATH_SUFFIXES share/cmake/MagnumPlugins/dependencies)
@@ -198,10 +200,11 @@ endif()
 # Component distinction (listing them explicitly to avoid mistakes with finding
 # components from other repositories)
 set(_MAGNUMPLUGINS_PLUGIN_COMPONENTS
-    AssimpImporter AstcImporter AvifImporter BasisImageConverter BasisImporter
-    BcDecImageConverter DdsImporter DevIlImageImporter DrFlacAudioImporter
-    DrMp3AudioImporter DrWavAudioImporter EtcDecImageConverter
-    Faad2AudioImporter FreeTypeFont GlslangShaderConverter GltfImporter
+    AssimpImporter AstcDecImageConverter AstcImporter AvifImporter
+    BasisImageConverter BasisImporter BcDecImageConverter DdsImporter
+    DevIlImageImporter DracoImporter DrFlacAudioImporter DrMp3AudioImporter
+    DrWavAudioImporter EtcDecImageConverter Faad2AudioImporter FreeTypeFont
+    GlslangShaderConverter GltfImporter
     GltfSceneConverter HarfBuzzFont IcoImporter JpegImageConverter JpegImporter
     KtxImageConverter KtxImporter LunaSvgImporter MeshOptimizerSceneConverter
     MiniExrImageConverter OpenExrImageConverter OpenExrImporter
@@ -456,6 +459,12 @@ foreach(_component ${MagnumPlugins_FIND_COMPONENTS})
             set_property(TARGET MagnumPlugins::${_component} APPEND PROPERTY
                 INTERFACE_LINK_LIBRARIES Assimp::Assimp)
 
+        # AstcDecImageConverter plugin dependencies
+        elseif(_component STREQUAL AstcDecImageConverter)
+            find_package(Threads REQUIRED)
+            set_property(TARGET MagnumPlugins::${_component} APPEND PROPERTY
+                INTERFACE_LINK_LIBRARIES Threads::Threads)
+
         # AstcImporter has no dependencies
 
         # AvifImporter plugin dependencies
@@ -502,9 +511,19 @@ foreach(_component ${MagnumPlugins_FIND_COMPONENTS})
                 endif()
             endif()
 
-        # BcDecImageConverter has no dependencies
+        # BcDecImageConverter plugin dependencies
+        elseif(_component STREQUAL BcDecImageConverter)
+            find_package(Threads REQUIRED)
+            set_property(TARGET MagnumPlugins::${_component} APPEND PROPERTY
+                INTERFACE_LINK_LIBRARIES Threads::Threads)
+
         # CgltfImporter has no dependencies
-        # DdsImporter has no dependencies
+
+        # DdsImporter plugin dependencies
+        elseif(_component STREQUAL DdsImporter)
+            find_package(Threads REQUIRED)
+            set_property(TARGET MagnumPlugins::${_component} APPEND PROPERTY
+                INTERFACE_LINK_LIBRARIES Threads::Threads)
 
         # DevIlImageImporter plugin dependencies
         elseif(_component STREQUAL DevIlImageImporter)
@@ -512,6 +531,12 @@ foreach(_component ${MagnumPlugins_FIND_COMPONENTS})
             set_property(TARGET MagnumPlugins::${_component} APPEND PROPERTY
                 INTERFACE_LINK_LIBRARIES ${IL_LIBRARIES} ${ILU_LIBRARIES})
 
+        # DracoImporter plugin dependencies
+        elseif(_component STREQUAL DracoImporter)
+            find_package(Draco REQUIRED)
+            set_property(TARGET MagnumPlugins::${_component} APPEND PROPERTY
+                INTERFACE_LINK_LIBRARIES Draco::Draco)
+
         # DrFlacAudioImporter has no dependencies
         # DrMp3AudioImporter has no dependencies
         # DrWavAudioImporter has no dependencies
@@ -564,8 +589,17 @@ foreach(_component ${MagnumPlugins_FIND_COMPONENTS})
             set_property(TARGET MagnumPlugins::${_component} APPEND PROPERTY
                 INTERFACE_LINK_LIBRARIES Glslang::Glslang)
 
-        # GltfImporter has no dependencies
-        # GltfSceneConverter has no dependencies
+        # GltfImporter plugin dependencies
+        elseif(_component STREQUAL GltfImporter)
+            find_package(Threads REQUIRED)
+            set_property(TARGET MagnumPlugins::${_component} APPEND PROPERTY
+                INTERFACE_LINK_LIBRARIES Threads::Threads)
+
+        # GltfSceneConverter plugin dependencies
+        elseif(_component STREQUAL GltfSceneConverter)
+            find_package(Threads REQUIRED)
+            set_property(TARGET MagnumPlugins::${_component} APPEND PROPERTY
+                INTERFACE_LINK_LIBRARIES Threads::Threads)
 
         # HarfBuzzFont plugin dependencies. It additionally depends on FreeType
         # but that one should be brought in transitively by the FreeTypeFont
@@ -630,8 +664,28 @@ foreach(_component ${MagnumPlugins_FIND_COMPONENTS})
                 endif()
             endif()
 
-        # KtxImageConverter has no dependencies
-        # KtxImporter has no dependencies
+        # KtxImageConverter has an optional Zstd dependency. Include it if
+        # present, otherwise assume it's compiled without.
+        elseif(_component STREQUAL KtxImageConverter)
+            find_package(Zstd)
+            if(Zstd_FOUND)
+                set_property(TARGET MagnumPlugins::${_component} APPEND PROPERTY
+                    INTERFACE_LINK_LIBRARIES Zstd::Zstd)
+            endif()
+
+        # KtxImporter has optional Zstd and ZLIB dependencies. Include them if
+        # present, otherwise assume it's compiled without.
+        elseif(_component STREQUAL KtxImporter)
+            find_package(Zstd)
+            if(Zstd_FOUND)
+                set_property(TARGET MagnumPlugins::${_component} APPEND PROPERTY
+                    INTERFACE_LINK_LIBRARIES Zstd::Zstd)
+            endif()
+            find_package(ZLIB)
+            if(ZLIB_FOUND)
+                set_property(TARGET MagnumPlugins::${_component} APPEND PROPERTY
+                    INTERFACE_LINK_LIBRARIES ZLIB::ZLIB)
+            endif()
 
         # LunaSvgImporter plugin dependencies
         elseif(_component STREQUAL LunaSvgImporter)
@@ -649,6 +703,9 @@ foreach(_component ${MagnumPlugins_FIND_COMPONENTS})
                 set_property(TARGET MagnumPlugins::${_component} APPEND PROPERTY
                     INTERFACE_LINK_LIBRARIES meshoptimizer)
             endif()
+            find_package(Threads REQUIRED)
+            set_property(TARGET MagnumPlugins::${_component} APPEND PROPERTY
+                INTERFACE_LINK_LIBRARIES Threads::Threads)
 
         # MiniExrImageConverter has no dependencies
 
@@ -114,6 +114,7 @@ cmake .. \
     -DCMAKE_INSTALL_PREFIX=$HOME/deps \
     -DCORRADE_RC_EXECUTABLE=$HOME/deps-native/bin/corrade-rc \
     -DMAGNUM_WITH_ASSIMPIMPORTER=OFF \
+    -DMAGNUM_WITH_ASTCDECIMAGECONVERTER=ON \
     -DMAGNUM_WITH_ASTCIMPORTER=ON \
     -DMAGNUM_WITH_AVIFIMPORTER=OFF \
     -DMAGNUM_WITH_BASISIMAGECONVERTER=OFF \
@@ -122,6 +123,7 @@ cmake .. \
     -DMAGNUM_WITH_CGLTFIMPORTER=ON \
     -DMAGNUM_WITH_DDSIMPORTER=ON \
     -DMAGNUM_WITH_DEVILIMAGEIMPORTER=OFF \
+    -DMAGNUM_WITH_DRACOIMPORTER=OFF \
     -DMAGNUM_WITH_DRFLACAUDIOIMPORTER=OFF \
     -DMAGNUM_WITH_DRMP3AUDIOIMPORTER=OFF \
     -DMAGNUM_WITH_DRWAVAUDIOIMPORTER=OFF \
@@ -101,6 +101,7 @@ cmake .. ^
     -DCMAKE_INSTALL_PREFIX=%APPVEYOR_BUILD_FOLDER%/deps ^
     -DCMAKE_PREFIX_PATH=%APPVEYOR_BUILD_FOLDER%/openal;%APPVEYOR_BUILD_FOLDER%/devil ^
     -DMAGNUM_WITH_ASSIMPIMPORTER=ON ^
+    -DMAGNUM_WITH_ASTCDECIMAGECONVERTER=ON ^
     -DMAGNUM_WITH_ASTCIMPORTER=ON ^
     -DMAGNUM_WITH_AVIFIMPORTER=OFF ^
     -DMAGNUM_WITH_BASISIMAGECONVERTER=ON ^
@@ -109,6 +110,7 @@ cmake .. ^
     -DMAGNUM_WITH_CGLTFIMPORTER=ON ^
     -DMAGNUM_WITH_DDSIMPORTER=ON ^
     -DMAGNUM_WITH_DEVILIMAGEIMPORTER=ON ^
+    -DMAGNUM_WITH_DRACOIMPORTER=OFF ^
     -DMAGNUM_WITH_DRFLACAUDIOIMPORTER=ON ^
     -DMAGNUM_WITH_DRMP3AUDIOIMPORTER=ON ^
     -DMAGNUM_WITH_DRWAVAUDIOIMPORTER=ON ^
@@ -79,6 +79,7 @@ cmake .. ^
     -DCMAKE_INSTALL_PREFIX=%APPVEYOR_BUILD_FOLDER%/deps ^
     -DCMAKE_PREFIX_PATH=%APPVEYOR_BUILD_FOLDER%/openal;%APPVEYOR_BUILD_FOLDER%/libwebp;%APPVEYOR_BUILD_FOLDER%/devil;C:/Tools/vcpkg/installed/x64-windows ^
     -DMAGNUM_WITH_ASSIMPIMPORTER=%EXCEPT_MSVC2015% ^
+    -DMAGNUM_WITH_ASTCDECIMAGECONVERTER=ON ^
     -DMAGNUM_WITH_ASTCIMPORTER=ON ^
     -DMAGNUM_WITH_AVIFIMPORTER=OFF ^
     -DCMAKE_DISABLE_FIND_PACKAGE_OpenCL=%ONLY_MSVC2019% ^
@@ -88,6 +89,7 @@ cmake .. ^
     -DMAGNUM_WITH_CGLTFIMPORTER=ON ^
     -DMAGNUM_WITH_DDSIMPORTER=ON ^
     -DMAGNUM_WITH_DEVILIMAGEIMPORTER=ON ^
+    -DMAGNUM_WITH_DRACOIMPORTER=OFF ^
     -DMAGNUM_WITH_DRFLACAUDIOIMPORTER=ON ^
     -DMAGNUM_WITH_DRMP3AUDIOIMPORTER=ON ^
     -DMAGNUM_WITH_DRWAVAUDIOIMPORTER=ON ^
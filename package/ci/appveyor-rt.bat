@@ -72,6 +72,7 @@ cmake .. ^
     -DCMAKE_SYSTEM_VERSION=10.0 ^
     -DCMAKE_PREFIX_PATH=%APPVEYOR_BUILD_FOLDER%/deps ^
     -DMAGNUM_WITH_ASSIMPIMPORTER=OFF ^
+    -DMAGNUM_WITH_ASTCDECIMAGECONVERTER=ON ^
     -DMAGNUM_WITH_ASTCIMPORTER=ON ^
     -DMAGNUM_WITH_AVIFIMPORTER=OFF ^
     -DMAGNUM_WITH_BASISIMAGECONVERTER=ON ^
@@ -80,6 +81,7 @@ cmake .. ^
     -DMAGNUM_WITH_CGLTFIMPORTER=ON ^
     -DMAGNUM_WITH_DDSIMPORTER=ON ^
     -DMAGNUM_WITH_DEVILIMAGEIMPORTER=OFF ^
+    -DMAGNUM_WITH_DRACOIMPORTER=OFF ^
     -DMAGNUM_WITH_DRFLACAUDIOIMPORTER=OFF ^
     -DMAGNUM_WITH_DRMP3AUDIOIMPORTER=OFF ^
     -DMAGNUM_WITH_DRWAVAUDIOIMPORTER=OFF ^
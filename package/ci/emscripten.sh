@@ -151,6 +151,7 @@ cmake .. \
     -DMAGNUM_USE_EMSCRIPTEN_PORTS_LIBJPEG=$USE_EMSCRIPTEN_PORTS \
     -DMAGNUM_USE_EMSCRIPTEN_PORTS_LIBPNG=$USE_EMSCRIPTEN_PORTS \
     -DMAGNUM_WITH_ASSIMPIMPORTER=OFF \
+    -DMAGNUM_WITH_ASTCDECIMAGECONVERTER=ON \
     -DMAGNUM_WITH_ASTCIMPORTER=ON \
     -DMAGNUM_WITH_AVIFIMPORTER=OFF \
     -DMAGNUM_WITH_BASISIMAGECONVERTER=OFF \
@@ -159,6 +160,7 @@ cmake .. \
     -DMAGNUM_WITH_CGLTFIMPORTER=ON \
     -DMAGNUM_WITH_DDSIMPORTER=ON \
     -DMAGNUM_WITH_DEVILIMAGEIMPORTER=OFF \
+    -DMAGNUM_WITH_DRACOIMPORTER=OFF \
     -DMAGNUM_WITH_DRFLACAUDIOIMPORTER=ON \
     -DMAGNUM_WITH_DRMP3AUDIOIMPORTER=ON \
     -DMAGNUM_WITH_DRWAVAUDIOIMPORTER=ON \
@@ -101,6 +101,7 @@ cmake .. \
     -DCMAKE_CXX_FLAGS="-D_LIBCPP_REMOVE_TRANSITIVE_INCLUDES" \
     -DCORRADE_RC_EXECUTABLE=$HOME/deps-native/bin/corrade-rc \
     -DMAGNUM_WITH_ASSIMPIMPORTER=OFF \
+    -DMAGNUM_WITH_ASTCDECIMAGECONVERTER=ON \
     -DMAGNUM_WITH_ASTCIMPORTER=ON \
     -DMAGNUM_WITH_AVIFIMPORTER=OFF \
     -DMAGNUM_WITH_BASISIMAGECONVERTER=OFF \
@@ -109,6 +110,7 @@ cmake .. \
     -DMAGNUM_WITH_CGLTFIMPORTER=ON \
     -DMAGNUM_WITH_DDSIMPORTER=ON \
     -DMAGNUM_WITH_DEVILIMAGEIMPORTER=OFF \
+    -DMAGNUM_WITH_DRACOIMPORTER=OFF \
     -DMAGNUM_WITH_DRFLACAUDIOIMPORTER=ON \
     -DMAGNUM_WITH_DRMP3AUDIOIMPORTER=ON \
     -DMAGNUM_WITH_DRWAVAUDIOIMPORTER=ON \
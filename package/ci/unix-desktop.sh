@@ -56,6 +56,7 @@ cmake .. \
     -DCMAKE_BUILD_TYPE=$CONFIGURATION \
     -DCMAKE_DISABLE_FIND_PACKAGE_OpenCL=${DISABLE_OPENCL:-OFF} \
     -DMAGNUM_WITH_ASSIMPIMPORTER=ON \
+    -DMAGNUM_WITH_ASTCDECIMAGECONVERTER=ON \
     -DMAGNUM_WITH_ASTCIMPORTER=ON \
     -DMAGNUM_WITH_AVIFIMPORTER=$WITH_AVIFIMPORTER \
     -DMAGNUM_WITH_BASISIMAGECONVERTER=ON \
@@ -64,6 +65,7 @@ cmake .. \
     -DMAGNUM_WITH_CGLTFIMPORTER=$BUILD_DEPRECATED \
     -DMAGNUM_WITH_DDSIMPORTER=ON \
     -DMAGNUM_WITH_DEVILIMAGEIMPORTER=ON \
+    -DMAGNUM_WITH_DRACOIMPORTER=OFF \
     -DMAGNUM_WITH_DRFLACAUDIOIMPORTER=ON \
     -DMAGNUM_WITH_DRMP3AUDIOIMPORTER=ON \
     -DMAGNUM_WITH_DRWAVAUDIOIMPORTER=ON \
@@ -61,6 +61,7 @@ class MagnumPlugins < Formula
         # complain to Homebrew about this insane non-obvious filesystem layout.
         "-DCMAKE_INSTALL_NAME_DIR:STRING=#{lib}",
         "-DMAGNUM_WITH_ASSIMPIMPORTER=#{(build.with? 'assimp') ? 'ON' : 'OFF'}",
+        "-DMAGNUM_WITH_ASTCDECIMAGECONVERTER=ON",
         "-DMAGNUM_WITH_ASTCIMPORTER=ON",
         "-DMAGNUM_WITH_AVIFIMPORTER=#{(build.with? 'libavif') ? 'ON' : 'OFF'}",
         "-DMAGNUM_WITH_BASISIMAGECONVERTER=ON",
@@ -69,6 +70,7 @@ class MagnumPlugins < Formula
         "-DMAGNUM_WITH_CGLTFIMPORTER=ON",
         "-DMAGNUM_WITH_DDSIMPORTER=ON",
         "-DMAGNUM_WITH_DEVILIMAGEIMPORTER=#{(build.with? 'devil') ? 'ON' : 'OFF'}",
+        "-DMAGNUM_WITH_DRACOIMPORTER=OFF",
         "-DMAGNUM_WITH_DRFLACAUDIOIMPORTER=ON",
         "-DMAGNUM_WITH_DRMP3AUDIOIMPORTER=ON",
         "-DMAGNUM_WITH_DRWAVAUDIOIMPORTER=ON",
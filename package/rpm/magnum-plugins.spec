@@ -38,6 +38,7 @@ cmake ../%{name}-%{version} \
   -DBASIS_UNIVERSAL_DIR=%{_builddir}/basis_universal-1_50_0_2 \
   -DCMAKE_COLOR_DIAGNOSTICS=ON \
   -DMAGNUM_WITH_ASSIMPIMPORTER=ON \
+  -DMAGNUM_WITH_ASTCDECIMAGECONVERTER=ON \
   -DMAGNUM_WITH_ASTCIMPORTER=ON \
   -DMAGNUM_WITH_AVIFIMPORTER=ON \
   -DMAGNUM_WITH_BASISIMAGECONVERTER=ON \
@@ -45,6 +46,7 @@ cmake ../%{name}-%{version} \
   -DMAGNUM_WITH_BCDECIMAGECONVERTER=ON \
   -DMAGNUM_WITH_DDSIMPORTER=ON \
   -DMAGNUM_WITH_DEVILIMAGEIMPORTER=ON \
+  -DMAGNUM_WITH_DRACOIMPORTER=OFF \
   -DMAGNUM_WITH_DRFLACAUDIOIMPORTER=ON \
   -DMAGNUM_WITH_DRMP3AUDIOIMPORTER=ON \
   -DMAGNUM_WITH_DRWAVAUDIOIMPORTER=ON \
@@ -0,0 +1,1355 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "AstcDecImageConverter.h"
+
+#include <cstring>
+#include <thread> /* std::thread::hardware_concurrency(), sigh */
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+#include <Corrade/Utility/Debug.h>
+#include <Corrade/Utility/Move.h>
+#include <Magnum/ImageView.h>
+#include <Magnum/PixelFormat.h>
+#include <Magnum/Math/Constants.h>
+#include <Magnum/Math/Functions.h>
+#include <Magnum/Math/Packing.h>
+#include <Magnum/Math/Vector3.h>
+#include <Magnum/Trade/ImageData.h>
+
+namespace Magnum { namespace Trade {
+
+AstcDecImageConverter::AstcDecImageConverter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): AbstractImageConverter{manager, plugin} {}
+
+ImageConverterFeatures AstcDecImageConverter::doFeatures() const {
+    return ImageConverterFeature::ConvertCompressed2D|
+           ImageConverterFeature::ConvertCompressed3D;
+}
+
+namespace {
+
+/* The decoding follows the ASTC section of the Khronos Data Format
+   Specification, https://registry.khronos.org/DataFormat/specs/1.3/dataformat.1.3.html#ASTC */
+
+/* 128 bits of block data, little endian. Bits past the end read as zero,
+   which is what the integer sequence decoding expects for the last
+   incomplete trit / quint block. */
+struct BlockBits {
+    UnsignedLong data[2];
+
+    /* count is expected to be at most 32 */
+    UnsignedInt get(const UnsignedInt offset, const UnsignedInt count) const {
+        UnsignedLong value;
+        if(offset >= 128) return 0;
+        else if(offset >= 64) value = data[1] >> (offset - 64);
+        else if(offset == 0) value = data[0];
+        else value = (data[0] >> offset)|(data[1] << (64 - offset));
+        return UnsignedInt(value & ((1ull << count) - 1));
+    }
+
+    /* Returns count bits starting at offset, with everything else zero */
+    BlockBits extract(const UnsignedInt offset, const UnsignedInt count) const {
+        BlockBits out;
+        if(offset >= 64) {
+            out.data[0] = data[1] >> (offset - 64);
+            out.data[1] = 0;
+        } else if(offset == 0) {
+            out.data[0] = data[0];
+            out.data[1] = data[1];
+        } else {
+            out.data[0] = (data[0] >> offset)|(data[1] << (64 - offset));
+            out.data[1] = data[1] >> offset;
+        }
+        if(count < 64) {
+            out.data[0] &= (1ull << count) - 1;
+            out.data[1] = 0;
+        } else if(count < 128) {
+            out.data[1] &= (1ull << (count - 64)) - 1;
+        }
+        return out;
+    }
+
+    BlockBits reversed() const {
+        const auto reverse = [](UnsignedLong value) {
+            value = ((value >> 1) & 0x5555555555555555ull)|((value & 0x5555555555555555ull) << 1);
+            value = ((value >> 2) & 0x3333333333333333ull)|((value & 0x3333333333333333ull) << 2);
+            value = ((value >> 4) & 0x0f0f0f0f0f0f0f0full)|((value & 0x0f0f0f0f0f0f0f0full) << 4);
+            value = ((value >> 8) & 0x00ff00ff00ff00ffull)|((value & 0x00ff00ff00ff00ffull) << 8);
+            value = ((value >> 16) & 0x0000ffff0000ffffull)|((value & 0x0000ffff0000ffffull) << 16);
+            return (value >> 32)|(value << 32);
+        };
+        return {{reverse(data[1]), reverse(data[0])}};
+    }
+};
+
+/* Integer sequence encoding ranges, ordered by the number of levels they
+   represent -- 2, 3, 4, 5, 6, 8, 10, 12, 16, 20, 24, 32, 40, 48, 64, 80, 96,
+   128, 160, 192 and 256. Each is either pure bits, or a trit or a quint
+   combined with a (possibly zero) number of bits. */
+struct IseRange {
+    UnsignedByte bits;
+    bool trit;
+    bool quint;
+};
+constexpr IseRange IseRanges[]{
+    {1, false, false},  /* 2 */
+    {0, true, false},   /* 3 */
+    {2, false, false},  /* 4 */
+    {0, false, true},   /* 5 */
+    {1, true, false},   /* 6 */
+    {3, false, false},  /* 8 */
+    {1, false, true},   /* 10 */
+    {2, true, false},   /* 12 */
+    {4, false, false},  /* 16 */
+    {2, false, true},   /* 20 */
+    {3, true, false},   /* 24 */
+    {5, false, false},  /* 32 */
+    {3, false, true},   /* 40 */
+    {4, true, false},   /* 48 */
+    {6, false, false},  /* 64 */
+    {4, false, true},   /* 80 */
+    {5, true, false},   /* 96 */
+    {7, false, false},  /* 128 */
+    {5, false, true},   /* 160 */
+    {6, true, false},   /* 192 */
+    {8, false, false},  /* 256 */
+};
+
+UnsignedInt iseBitCount(const UnsignedInt range, const UnsignedInt count) {
+    const IseRange& r = IseRanges[range];
+    return r.bits*count +
+        (r.trit ? (8*count + 4)/5 : 0) +
+        (r.quint ? (7*count + 2)/3 : 0);
+}
+
+/* Replicates the bits of a value to fill the whole target bit count */
+UnsignedInt replicateBits(const UnsignedInt value, const UnsignedInt bits, const UnsignedInt targetBits) {
+    if(!bits) return 0;
+    UnsignedInt out = 0;
+    Int shift = targetBits - bits;
+    for(; shift > 0; shift -= bits)
+        out |= value << shift;
+    out |= value >> -shift;
+    return out & ((1u << targetBits) - 1);
+}
+
+/* Unquantizes an ISE-encoded color endpoint value to 0-255. The trit / quint
+   part is in tq, the bit part in m. */
+UnsignedInt unquantizeColor(const UnsignedInt range, const UnsignedInt tq, const UnsignedInt m) {
+    const IseRange& r = IseRanges[range];
+    if(!r.trit && !r.quint)
+        return replicateBits(m, r.bits, 8);
+
+    const UnsignedInt a = (m & 1) ? 0x1ff : 0;
+    const UnsignedInt b = (m >> 1) & 1;
+    const UnsignedInt c = (m >> 2) & 1;
+    const UnsignedInt d = (m >> 3) & 1;
+    const UnsignedInt e = (m >> 4) & 1;
+    const UnsignedInt f = (m >> 5) & 1;
+    UnsignedInt bb, cc;
+    switch(range) {
+        case 4:  /* 6 */   bb = 0; cc = 204; break;
+        case 6:  /* 10 */  bb = 0; cc = 113; break;
+        case 7:  /* 12 */  bb = b*0x116; cc = 93; break;
+        case 9:  /* 20 */  bb = b*0x10c; cc = 54; break;
+        case 10: /* 24 */  bb = c*0x10a + b*0x085; cc = 44; break;
+        case 12: /* 40 */  bb = c*0x105 + b*0x082; cc = 26; break;
+        case 13: /* 48 */  bb = d*0x104 + c*0x082 + b*0x041; cc = 22; break;
+        case 15: /* 80 */  bb = d*0x102 + c*0x081 + b*0x040; cc = 13; break;
+        case 16: /* 96 */  bb = e*0x102 + d*0x081 + c*0x040 + b*0x020; cc = 11; break;
+        case 18: /* 160 */ bb = e*0x101 + d*0x080 + c*0x040 + b*0x020; cc = 6; break;
+        case 19: /* 192 */ bb = f*0x101 + e*0x080 + d*0x040 + c*0x020 + b*0x010; cc = 5; break;
+        /* Lower ranges are never used for colors */
+        default: CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+    const UnsignedInt t = (tq*cc + bb) ^ a;
+    return (a & 0x80)|(t >> 2);
+}
+
+/* Unquantizes an ISE-encoded weight value to 0-64 */
+UnsignedInt unquantizeWeight(const UnsignedInt range, const UnsignedInt tq, const UnsignedInt m) {
+    const IseRange& r = IseRanges[range];
+    /* The 3- and 5-level ranges have no bits, map directly */
+    if(range == 1) return tq*32;
+    if(range == 3) return tq*16;
+
+    UnsignedInt out;
+    if(!r.trit && !r.quint)
+        out = replicateBits(m, r.bits, 6);
+    else {
+        const UnsignedInt a = (m & 1) ? 0x7f : 0;
+        const UnsignedInt b = (m >> 1) & 1;
+        const UnsignedInt c = (m >> 2) & 1;
+        UnsignedInt bb, cc;
+        switch(range) {
+            case 4:  /* 6 */  bb = 0; cc = 50; break;
+            case 6:  /* 10 */ bb = 0; cc = 28; break;
+            case 7:  /* 12 */ bb = b*0x45; cc = 23; break;
+            case 9:  /* 20 */ bb = b*0x42; cc = 13; break;
+            case 10: /* 24 */ bb = c*0x42 + b*0x21; cc = 11; break;
+            /* Higher ranges are never used for weights */
+            default: CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+        }
+        const UnsignedInt t = (tq*cc + bb) ^ a;
+        out = (a & 0x20)|(t >> 2);
+    }
+    return out > 32 ? out + 1 : out;
+}
+
+/* Decodes count integer-sequence-encoded values from the beginning of bits,
+   unquantizing them with given function */
+void decodeIse(const BlockBits& bits, const UnsignedInt range, const UnsignedInt count, UnsignedInt(*const unquantize)(UnsignedInt, UnsignedInt, UnsignedInt), UnsignedByte* const out) {
+    const IseRange& r = IseRanges[range];
+    UnsignedInt offset = 0;
+    const auto read = [&](const UnsignedInt count) {
+        const UnsignedInt value = bits.get(offset, count);
+        offset += count;
+        return value;
+    };
+
+    if(r.trit) for(UnsignedInt i = 0; i < count; i += 5) {
+        UnsignedInt m[5];
+        UnsignedInt t;
+        m[0] = read(r.bits);
+        t = read(2);
+        m[1] = read(r.bits);
+        t |= read(2) << 2;
+        m[2] = read(r.bits);
+        t |= read(1) << 4;
+        m[3] = read(r.bits);
+        t |= read(2) << 5;
+        m[4] = read(r.bits);
+        t |= read(1) << 7;
+
+        /* Unpack the five trits from the 8-bit value */
+        UnsignedInt c, trits[5];
+        if(((t >> 2) & 7) == 7) {
+            c = ((t >> 5) << 2)|(t & 3);
+            trits[4] = trits[3] = 2;
+        } else {
+            c = t & 0x1f;
+            if(((t >> 5) & 3) == 3) {
+                trits[4] = 2;
+                trits[3] = t >> 7;
+            } else {
+                trits[4] = t >> 7;
+                trits[3] = (t >> 5) & 3;
+            }
+        }
+        if((c & 3) == 3) {
+            trits[2] = 2;
+            trits[1] = c >> 4;
+            trits[0] = ((c >> 2) & 2)|((c >> 2) & ~(c >> 3) & 1);
+        } else if(((c >> 2) & 3) == 3) {
+            trits[2] = 2;
+            trits[1] = 2;
+            trits[0] = c & 3;
+        } else {
+            trits[2] = c >> 4;
+            trits[1] = (c >> 2) & 3;
+            trits[0] = (c & 2)|(c & ~(c >> 1) & 1);
+        }
+
+        for(UnsignedInt j = 0; j != 5 && i + j < count; ++j)
+            out[i + j] = unquantize(range, trits[j], m[j]);
+
+    } else if(r.quint) for(UnsignedInt i = 0; i < count; i += 3) {
+        UnsignedInt m[3];
+        UnsignedInt q;
+        m[0] = read(r.bits);
+        q = read(3);
+        m[1] = read(r.bits);
+        q |= read(2) << 3;
+        m[2] = read(r.bits);
+        q |= read(2) << 5;
+
+        /* Unpack the three quints from the 7-bit value */
+        UnsignedInt quints[3];
+        if(((q >> 1) & 3) == 3 && ((q >> 5) & 3) == 0) {
+            quints[2] = ((q & 1) << 2)|((q >> 4) & ~q & 1) << 1|((q >> 3) & ~q & 1);
+            quints[1] = quints[0] = 4;
+        } else {
+            UnsignedInt c;
+            if(((q >> 1) & 3) == 3) {
+                quints[2] = 4;
+                c = (((q >> 3) & 3) << 3)|((~(q >> 5) & 3) << 1)|(q & 1);
+            } else {
+                quints[2] = (q >> 5) & 3;
+                c = q & 0x1f;
+            }
+            if((c & 7) == 5) {
+                quints[1] = 4;
+                quints[0] = (c >> 3) & 3;
+            } else {
+                quints[1] = (c >> 3) & 3;
+                quints[0] = c & 7;
+            }
+        }
+
+        for(UnsignedInt j = 0; j != 3 && i + j < count; ++j)
+            out[i + j] = unquantize(range, quints[j], m[j]);
+
+    } else for(UnsignedInt i = 0; i != count; ++i)
+        out[i] = unquantize(range, 0, read(r.bits));
+}
+
+/* Weight grid size, range and plane count of a block mode */
+struct BlockMode {
+    Int gridX, gridY, gridZ;
+    UnsignedInt weightRange;
+    bool dualPlane;
+};
+
+bool decodeBlockMode2D(const UnsignedInt mode, BlockMode& out) {
+    const UnsignedInt a = (mode >> 5) & 3;
+    const UnsignedInt b = (mode >> 7) & 3;
+    UnsignedInt r;
+    bool h = mode & 0x200;
+    out.dualPlane = mode & 0x400;
+    out.gridZ = 1;
+    if(mode & 3) {
+        r = ((mode & 3) << 1)|((mode >> 4) & 1);
+        switch((mode >> 2) & 3) {
+            case 0: out.gridX = b + 4; out.gridY = a + 2; break;
+            case 1: out.gridX = b + 8; out.gridY = a + 2; break;
+            case 2: out.gridX = a + 2; out.gridY = b + 8; break;
+            case 3:
+                if(mode & 0x100) {
+                    out.gridX = (b & 1) + 2;
+                    out.gridY = a + 2;
+                } else {
+                    out.gridX = a + 2;
+                    out.gridY = (b & 1) + 6;
+                }
+                break;
+            default: CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+        }
+    } else {
+        r = ((mode >> 1) & 6)|((mode >> 4) & 1);
+        switch(b) {
+            case 0: out.gridX = 12; out.gridY = a + 2; break;
+            case 1: out.gridX = a + 2; out.gridY = 12; break;
+            case 2:
+                out.gridX = a + 6;
+                out.gridY = ((mode >> 9) & 3) + 6;
+                out.dualPlane = h = false;
+                break;
+            case 3:
+                if(a == 0) {
+                    out.gridX = 6;
+                    out.gridY = 10;
+                } else if(a == 1) {
+                    out.gridX = 10;
+                    out.gridY = 6;
+                } else return false;
+                break;
+            default: CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+        }
+    }
+
+    /* Range values 0 and 1 are reserved */
+    if(r < 2) return false;
+    out.weightRange = r - 2 + (h ? 6 : 0);
+    return true;
+}
+
+bool decodeBlockMode3D(const UnsignedInt mode, BlockMode& out) {
+    const UnsignedInt a = (mode >> 5) & 3;
+    const UnsignedInt b = (mode >> 7) & 3;
+    UnsignedInt r;
+    bool h = mode & 0x200;
+    out.dualPlane = mode & 0x400;
+    if(mode & 3) {
+        r = ((mode & 3) << 1)|((mode >> 4) & 1);
+        out.gridX = a + 2;
+        out.gridY = b + 2;
+        out.gridZ = ((mode >> 2) & 3) + 2;
+    } else {
+        r = ((mode >> 1) & 6)|((mode >> 4) & 1);
+        const UnsignedInt bb = (mode >> 9) & 3;
+        switch(b) {
+            case 0: out.gridX = 6; out.gridY = bb + 2; out.gridZ = a + 2; break;
+            case 1: out.gridX = a + 2; out.gridY = 6; out.gridZ = bb + 2; break;
+            case 2: out.gridX = a + 2; out.gridY = bb + 2; out.gridZ = 6; break;
+            case 3:
+                switch(a) {
+                    case 0: out.gridX = 6; out.gridY = 2; out.gridZ = 2; break;
+                    case 1: out.gridX = 2; out.gridY = 6; out.gridZ = 2; break;
+                    case 2: out.gridX = 2; out.gridY = 2; out.gridZ = 6; break;
+                    default: return false;
+                }
+                break;
+            default: CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+        }
+        if(b != 3) out.dualPlane = h = false;
+    }
+
+    /* Range values 0 and 1 are reserved */
+    if(r < 2) return false;
+    out.weightRange = r - 2 + (h ? 6 : 0);
+    return true;
+}
+
+/* How the decoded 16-bit channel values should be interpreted */
+enum class Channel: UnsignedByte {
+    Unorm16,    /* LDR endpoints */
+    Lns,        /* HDR endpoints, logarithmic */
+    Half        /* HDR void-extent blocks */
+};
+
+/* Decodes endpoints for given color endpoint mode, expanded to 16 bits.
+   Returns false if the mode is HDR and hdr is false. */
+bool decodeEndpoints(const UnsignedInt cem, const UnsignedByte* const v, const bool srgb, const bool hdr, UnsignedShort(&e0)[4], UnsignedShort(&e1)[4], Channel(&channels)[4]) {
+    /* HDR modes */
+    if(cem == 2 || cem == 3 || cem == 7 || cem == 11 || cem == 14 || cem == 15) {
+        if(!hdr) return false;
+
+        Int c0[4]{0, 0, 0, 0x780};
+        Int c1[4]{0, 0, 0, 0x780};
+        if(cem == 2) {
+            Int y0, y1;
+            if(v[1] >= v[0]) {
+                y0 = v[0] << 4;
+                y1 = v[1] << 4;
+            } else {
+                y0 = (v[1] << 4) + 8;
+                y1 = (v[0] << 4) - 8;
+            }
+            c0[0] = c0[1] = c0[2] = y0;
+            c1[0] = c1[1] = c1[2] = y1;
+
+        } else if(cem == 3) {
+            Int y0, y1;
+            if(v[0] & 0x80) {
+                y0 = ((v[1] & 0xe0) << 4)|((v[0] & 0x7f) << 2);
+                y1 = (v[1] & 0x1f) << 2;
+            } else {
+                y0 = ((v[1] & 0xf0) << 4)|((v[0] & 0x7f) << 1);
+                y1 = (v[1] & 0x0f) << 1;
+            }
+            y1 = Math::min(y0 + y1, 0xfff);
+            c0[0] = c0[1] = c0[2] = y0;
+            c1[0] = c1[1] = c1[2] = y1;
+
+        } else if(cem == 7) {
+            const UnsignedInt modeValue = ((v[0] & 0xc0) >> 6)|((v[1] & 0x80) >> 5)|((v[2] & 0x80) >> 4);
+            UnsignedInt majorComponent, mode;
+            if((modeValue & 0xc) != 0xc) {
+                majorComponent = modeValue >> 2;
+                mode = modeValue & 3;
+            } else if(modeValue != 0xf) {
+                majorComponent = modeValue & 3;
+                mode = 4;
+            } else {
+                majorComponent = 0;
+                mode = 5;
+            }
+
+            Int red = v[0] & 0x3f;
+            Int green = v[1] & 0x1f;
+            Int blue = v[2] & 0x1f;
+            Int scale = v[3] & 0x1f;
+            const Int bit0 = (v[1] >> 6) & 1;
+            const Int bit1 = (v[1] >> 5) & 1;
+            const Int bit2 = (v[2] >> 6) & 1;
+            const Int bit3 = (v[2] >> 5) & 1;
+            const Int bit4 = (v[3] >> 7) & 1;
+            const Int bit5 = (v[3] >> 6) & 1;
+            const Int bit6 = (v[3] >> 5) & 1;
+
+            const UnsignedInt oneHotMode = 1 << mode;
+            if(oneHotMode & 0x30) green |= bit0 << 6;
+            if(oneHotMode & 0x3a) green |= bit1 << 5;
+            if(oneHotMode & 0x30) blue |= bit2 << 6;
+            if(oneHotMode & 0x3a) blue |= bit3 << 5;
+            if(oneHotMode & 0x3d) scale |= bit6 << 5;
+            if(oneHotMode & 0x2d) scale |= bit5 << 6;
+            if(oneHotMode & 0x04) scale |= bit4 << 7;
+            if(oneHotMode & 0x3b) red |= bit4 << 6;
+            if(oneHotMode & 0x04) red |= bit3 << 6;
+            if(oneHotMode & 0x10) red |= bit5 << 7;
+            if(oneHotMode & 0x0f) red |= bit2 << 7;
+            if(oneHotMode & 0x05) red |= bit1 << 8;
+            if(oneHotMode & 0x0a) red |= bit0 << 8;
+            if(oneHotMode & 0x05) red |= bit0 << 9;
+            if(oneHotMode & 0x02) red |= bit6 << 9;
+            if(oneHotMode & 0x01) red |= bit3 << 10;
+            if(oneHotMode & 0x02) red |= bit5 << 10;
+
+            /* Expand to 12 bits */
+            constexpr UnsignedByte Shifts[]{1, 1, 2, 3, 4, 5};
+            const UnsignedInt shift = Shifts[mode];
+            red <<= shift;
+            green <<= shift;
+            blue <<= shift;
+            scale <<= shift;
+
+            /* Except for mode 5, green and blue are differences */
+            if(mode != 5) {
+                green = red - green;
+                blue = red - blue;
+            }
+
+            if(majorComponent == 1) Utility::swap(red, green);
+            else if(majorComponent == 2) Utility::swap(red, blue);
+
+            c0[0] = Math::max(red - scale, 0);
+            c0[1] = Math::max(green - scale, 0);
+            c0[2] = Math::max(blue - scale, 0);
+            c1[0] = Math::max(red, 0);
+            c1[1] = Math::max(green, 0);
+            c1[2] = Math::max(blue, 0);
+
+        } else {
+            const UnsignedInt majorComponent = ((v[4] & 0x80) >> 7)|((v[5] & 0x80) >> 6);
+            if(majorComponent == 3) {
+                c0[0] = v[0] << 4;
+                c0[1] = v[2] << 4;
+                c0[2] = (v[4] & 0x7f) << 5;
+                c1[0] = v[1] << 4;
+                c1[1] = v[3] << 4;
+                c1[2] = (v[5] & 0x7f) << 5;
+            } else {
+                const UnsignedInt mode = ((v[1] & 0x80) >> 7)|((v[2] & 0x80) >> 6)|((v[3] & 0x80) >> 5);
+                Int a = v[0]|((v[1] & 0x40) << 2);
+                Int b0 = v[2] & 0x3f;
+                Int b1 = v[3] & 0x3f;
+                Int c = v[1] & 0x3f;
+                Int d0 = v[4] & 0x7f;
+                Int d1 = v[5] & 0x7f;
+
+                const Int bit0 = (v[2] >> 6) & 1;
+                const Int bit1 = (v[3] >> 6) & 1;
+                const Int bit2 = (v[4] >> 6) & 1;
+                const Int bit3 = (v[5] >> 6) & 1;
+                const Int bit4 = (v[4] >> 5) & 1;
+                const Int bit5 = (v[5] >> 5) & 1;
+
+                const UnsignedInt oneHotMode = 1 << mode;
+                if(oneHotMode & 0xa4) a |= bit0 << 9;
+                if(oneHotMode & 0x08) a |= bit2 << 9;
+                if(oneHotMode & 0x50) a |= bit4 << 9;
+                if(oneHotMode & 0x50) a |= bit5 << 10;
+                if(oneHotMode & 0xa0) a |= bit1 << 10;
+                if(oneHotMode & 0xc0) a |= bit2 << 11;
+                if(oneHotMode & 0x04) c |= bit1 << 6;
+                if(oneHotMode & 0xe8) c |= bit3 << 6;
+                if(oneHotMode & 0x20) c |= bit2 << 7;
+                if(oneHotMode & 0x5b) {
+                    b0 |= bit0 << 6;
+                    b1 |= bit1 << 6;
+                }
+                if(oneHotMode & 0x12) {
+                    b0 |= bit2 << 7;
+                    b1 |= bit3 << 7;
+                }
+                if(oneHotMode & 0xaf) {
+                    d0 |= bit4 << 5;
+                    d1 |= bit5 << 5;
+                }
+                if(oneHotMode & 0x05) {
+                    d0 |= bit2 << 6;
+                    d1 |= bit3 << 6;
+                }
+
+                /* Sign-extend d0 and d1. The bits above the sign bit may
+                   still contain bits used for a or c in given mode, so mask
+                   them away first. */
+                constexpr UnsignedByte DBits[]{7, 6, 7, 6, 5, 6, 5, 6};
+                const Int dMask = (1 << DBits[mode]) - 1;
+                const Int dSign = 1 << (DBits[mode] - 1);
+                d0 = ((d0 & dMask) ^ dSign) - dSign;
+                d1 = ((d1 & dMask) ^ dSign) - dSign;
+
+                /* Expand to 12 bits */
+                const UnsignedInt shift = (mode >> 1) ^ 3;
+                a <<= shift;
+                b0 <<= shift;
+                b1 <<= shift;
+                c <<= shift;
+                d0 *= 1 << shift;
+                d1 *= 1 << shift;
+
+                c1[0] = Math::clamp(a, 0, 0xfff);
+                c1[1] = Math::clamp(a - b0, 0, 0xfff);
+                c1[2] = Math::clamp(a - b1, 0, 0xfff);
+                c0[0] = Math::clamp(a - c, 0, 0xfff);
+                c0[1] = Math::clamp(a - b0 - c - d0, 0, 0xfff);
+                c0[2] = Math::clamp(a - b1 - c - d1, 0, 0xfff);
+
+                if(majorComponent == 1) {
+                    Utility::swap(c0[0], c0[1]);
+                    Utility::swap(c1[0], c1[1]);
+                } else if(majorComponent == 2) {
+                    Utility::swap(c0[0], c0[2]);
+                    Utility::swap(c1[0], c1[2]);
+                }
+            }
+
+            /* LDR alpha */
+            if(cem == 14) {
+                c0[3] = v[6];
+                c1[3] = v[7];
+
+            /* HDR alpha */
+            } else if(cem == 15) {
+                const UnsignedInt selector = ((v[6] >> 7) & 1)|((v[7] >> 6) & 2);
+                Int a0 = v[6] & 0x7f;
+                Int a1 = v[7] & 0x7f;
+                if(selector == 3) {
+                    a0 <<= 5;
+                    a1 <<= 5;
+                } else {
+                    a0 |= (a1 << (selector + 1)) & 0x780;
+                    a1 &= 0x3f >> selector;
+                    a1 ^= 0x20 >> selector;
+                    a1 -= 0x20 >> selector;
+                    a0 <<= 4 - selector;
+                    a1 *= 1 << (4 - selector);
+                    a1 = Math::clamp(a1 + a0, 0, 0xfff);
+                }
+                c0[3] = a0;
+                c1[3] = a1;
+            }
+        }
+
+        /* The 12-bit values are shifted to the top of the 16-bit LNS
+           representation. LDR alpha gets expanded the same way as with the
+           LDR modes. */
+        for(std::size_t i = 0; i != 3; ++i) {
+            e0[i] = c0[i] << 4;
+            e1[i] = c1[i] << 4;
+            channels[i] = Channel::Lns;
+        }
+        if(cem == 14) {
+            e0[3] = c0[3]*257;
+            e1[3] = c1[3]*257;
+            channels[3] = Channel::Unorm16;
+        } else {
+            e0[3] = c0[3] << 4;
+            e1[3] = c1[3] << 4;
+            channels[3] = Channel::Lns;
+        }
+        return true;
+    }
+
+    /* LDR modes */
+    const auto bitTransferSigned = [](Int& a, Int& b) {
+        b >>= 1;
+        b |= a & 0x80;
+        a >>= 1;
+        a &= 0x3f;
+        if(a & 0x20) a -= 0x40;
+    };
+    const auto blueContract = [](Int(&c)[4]) {
+        c[0] = (c[0] + c[2]) >> 1;
+        c[1] = (c[1] + c[2]) >> 1;
+    };
+    Int c0[4]{0, 0, 0, 0xff};
+    Int c1[4]{0, 0, 0, 0xff};
+    switch(cem) {
+        /* Luminance, direct */
+        case 0:
+            c0[0] = c0[1] = c0[2] = v[0];
+            c1[0] = c1[1] = c1[2] = v[1];
+            break;
+        /* Luminance, base + offset */
+        case 1: {
+            const Int l0 = (v[0] >> 2)|(v[1] & 0xc0);
+            const Int l1 = Math::min(l0 + (v[1] & 0x3f), 0xff);
+            c0[0] = c0[1] = c0[2] = l0;
+            c1[0] = c1[1] = c1[2] = l1;
+        } break;
+        /* Luminance + alpha, direct */
+        case 4:
+            c0[0] = c0[1] = c0[2] = v[0];
+            c1[0] = c1[1] = c1[2] = v[1];
+            c0[3] = v[2];
+            c1[3] = v[3];
+            break;
+        /* Luminance + alpha, base + offset */
+        case 5: {
+            Int v0 = v[0], v1 = v[1], v2 = v[2], v3 = v[3];
+            bitTransferSigned(v1, v0);
+            bitTransferSigned(v3, v2);
+            c0[0] = c0[1] = c0[2] = v0;
+            c1[0] = c1[1] = c1[2] = v0 + v1;
+            c0[3] = v2;
+            c1[3] = v2 + v3;
+        } break;
+        /* RGB, base + scale, and with two additional alpha values */
+        case 6:
+        case 10:
+            c0[0] = (v[0]*v[3]) >> 8;
+            c0[1] = (v[1]*v[3]) >> 8;
+            c0[2] = (v[2]*v[3]) >> 8;
+            c1[0] = v[0];
+            c1[1] = v[1];
+            c1[2] = v[2];
+            if(cem == 10) {
+                c0[3] = v[4];
+                c1[3] = v[5];
+            }
+            break;
+        /* RGB and RGBA, direct */
+        case 8:
+        case 12: {
+            c0[0] = v[0];
+            c1[0] = v[1];
+            c0[1] = v[2];
+            c1[1] = v[3];
+            c0[2] = v[4];
+            c1[2] = v[5];
+            if(cem == 12) {
+                c0[3] = v[6];
+                c1[3] = v[7];
+            }
+            if(v[1] + v[3] + v[5] < v[0] + v[2] + v[4]) {
+                for(std::size_t i = 0; i != 4; ++i)
+                    Utility::swap(c0[i], c1[i]);
+                blueContract(c0);
+                blueContract(c1);
+            }
+        } break;
+        /* RGB and RGBA, base + offset */
+        case 9:
+        case 13: {
+            Int v0 = v[0], v1 = v[1], v2 = v[2], v3 = v[3], v4 = v[4], v5 = v[5], v6 = 0xff, v7 = 0;
+            if(cem == 13) {
+                v6 = v[6];
+                v7 = v[7];
+                bitTransferSigned(v7, v6);
+            }
+            bitTransferSigned(v1, v0);
+            bitTransferSigned(v3, v2);
+            bitTransferSigned(v5, v4);
+            c0[0] = v0;
+            c0[1] = v2;
+            c0[2] = v4;
+            c0[3] = v6;
+            c1[0] = v0 + v1;
+            c1[1] = v2 + v3;
+            c1[2] = v4 + v5;
+            c1[3] = v6 + v7;
+            if(v1 + v3 + v5 < 0) {
+                for(std::size_t i = 0; i != 4; ++i)
+                    Utility::swap(c0[i], c1[i]);
+                blueContract(c0);
+                blueContract(c1);
+            }
+        } break;
+        default: CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+
+    /* Clamp and expand to 16 bits. With sRGB, the color channels are expanded
+       such that taking the top 8 bits of an interpolated value matches the
+       sRGB-encoded value. */
+    for(std::size_t i = 0; i != 4; ++i) {
+        const Int a = Math::clamp(c0[i], 0, 0xff);
+        const Int b = Math::clamp(c1[i], 0, 0xff);
+        if(srgb && i != 3) {
+            e0[i] = (a << 8)|0x80;
+            e1[i] = (b << 8)|0x80;
+        } else {
+            e0[i] = a*257;
+            e1[i] = b*257;
+        }
+        channels[i] = Channel::Unorm16;
+    }
+    return true;
+}
+
+UnsignedInt hash52(UnsignedInt p) {
+    p ^= p >> 15;
+    p -= p << 17;
+    p += p << 7;
+    p += p << 4;
+    p ^= p >> 5;
+    p += p << 16;
+    p ^= p >> 7;
+    p ^= p >> 3;
+    p ^= p << 6;
+    p ^= p >> 17;
+    return p;
+}
+
+UnsignedInt selectPartition(Int seed, Int x, Int y, Int z, const Int partitionCount, const bool smallBlock) {
+    if(smallBlock) {
+        x <<= 1;
+        y <<= 1;
+        z <<= 1;
+    }
+    seed += (partitionCount - 1)*1024;
+    const UnsignedInt rnum = hash52(seed);
+    UnsignedByte seeds[12]{
+        UnsignedByte(rnum & 0xf),
+        UnsignedByte((rnum >> 4) & 0xf),
+        UnsignedByte((rnum >> 8) & 0xf),
+        UnsignedByte((rnum >> 12) & 0xf),
+        UnsignedByte((rnum >> 16) & 0xf),
+        UnsignedByte((rnum >> 20) & 0xf),
+        UnsignedByte((rnum >> 24) & 0xf),
+        UnsignedByte((rnum >> 28) & 0xf),
+        UnsignedByte((rnum >> 18) & 0xf),
+        UnsignedByte((rnum >> 22) & 0xf),
+        UnsignedByte((rnum >> 26) & 0xf),
+        UnsignedByte(((rnum >> 30)|(rnum << 2)) & 0xf)
+    };
+    for(UnsignedByte& i: seeds) i *= i;
+
+    Int sh1, sh2;
+    if(seed & 1) {
+        sh1 = seed & 2 ? 4 : 5;
+        sh2 = partitionCount == 3 ? 6 : 5;
+    } else {
+        sh1 = partitionCount == 3 ? 6 : 5;
+        sh2 = seed & 2 ? 4 : 5;
+    }
+    const Int sh3 = seed & 0x10 ? sh1 : sh2;
+    for(std::size_t i = 0; i != 8; i += 2) {
+        seeds[i] >>= sh1;
+        seeds[i + 1] >>= sh2;
+    }
+    for(std::size_t i = 8; i != 12; ++i)
+        seeds[i] >>= sh3;
+
+    const Int a = (seeds[0]*x + seeds[1]*y + seeds[10]*z + (rnum >> 14)) & 0x3f;
+    const Int b = (seeds[2]*x + seeds[3]*y + seeds[11]*z + (rnum >> 10)) & 0x3f;
+    const Int c = partitionCount < 3 ? 0 : (seeds[4]*x + seeds[5]*y + seeds[8]*z + (rnum >> 6)) & 0x3f;
+    const Int d = partitionCount < 4 ? 0 : (seeds[6]*x + seeds[7]*y + seeds[9]*z + (rnum >> 2)) & 0x3f;
+
+    if(a >= b && a >= c && a >= d) return 0;
+    if(b >= c && b >= d) return 1;
+    if(c >= d) return 2;
+    return 3;
+}
+
+/* Converts a 16-bit LNS value to a half-float */
+UnsignedShort lnsToHalf(const UnsignedShort value) {
+    const UnsignedInt e = value >> 11;
+    const UnsignedInt m = value & 0x7ff;
+    UnsignedInt mt;
+    if(m < 512) mt = 3*m;
+    else if(m < 1536) mt = 4*m - 512;
+    else mt = 5*m - 2048;
+    return Math::min((e << 10)|(mt >> 3), 0x7bffu);
+}
+
+/* Output pixel formats. LDR output is RGBA8, HDR output either RGBA16F or
+   RGBA32F. */
+enum class Output {
+    Ldr,
+    LdrSrgb,
+    Half,
+    Float
+};
+
+template<Output output> struct OutputTraits;
+template<> struct OutputTraits<Output::Ldr> {
+    enum: std::size_t { PixelSize = 4 };
+    static void write(char* const dst, const UnsignedShort(&value)[4], const Channel(&)[4]) {
+        /* All channels are guaranteed to be Unorm16 here */
+        for(std::size_t i = 0; i != 4; ++i)
+            dst[i] = char(value[i] >> 8);
+    }
+    static void writeError(char* const dst) {
+        /* Magenta */
+        dst[0] = dst[2] = dst[3] = char(0xff);
+        dst[1] = 0;
+    }
+};
+template<> struct OutputTraits<Output::LdrSrgb>: OutputTraits<Output::Ldr> {};
+template<> struct OutputTraits<Output::Half> {
+    enum: std::size_t { PixelSize = 8 };
+    static UnsignedShort toHalf(const UnsignedShort value, const Channel channel) {
+        switch(channel) {
+            case Channel::Unorm16:
+                return Math::packHalf(value/65535.0f);
+            case Channel::Lns:
+                return lnsToHalf(value);
+            case Channel::Half:
+                return value;
+        }
+        CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+    static void write(char* const dst, const UnsignedShort(&value)[4], const Channel(&channels)[4]) {
+        UnsignedShort out[4];
+        for(std::size_t i = 0; i != 4; ++i)
+            out[i] = toHalf(value[i], channels[i]);
+        std::memcpy(dst, out, sizeof(out));
+    }
+    static void writeError(char* const dst) {
+        /* NaN in all channels */
+        std::memset(dst, 0xff, 8);
+    }
+};
+template<> struct OutputTraits<Output::Float> {
+    enum: std::size_t { PixelSize = 16 };
+    static void write(char* const dst, const UnsignedShort(&value)[4], const Channel(&channels)[4]) {
+        Float out[4];
+        for(std::size_t i = 0; i != 4; ++i)
+            out[i] = channels[i] == Channel::Unorm16 ? value[i]/65535.0f :
+                Math::unpackHalf(OutputTraits<Output::Half>::toHalf(value[i], channels[i]));
+        std::memcpy(dst, out, sizeof(out));
+    }
+    static void writeError(char* const dst) {
+        const Float out[4]{Constants::nan(), Constants::nan(), Constants::nan(), Constants::nan()};
+        std::memcpy(dst, out, sizeof(out));
+    }
+};
+
+/* Decodes a single block into blockSize pixels at dst */
+template<Output output> void decodeBlock(const char* const block, const Vector3i& blockSize, char* const dst, const std::ptrdiff_t rowStride, const std::ptrdiff_t sliceStride) {
+    constexpr bool srgb = output == Output::LdrSrgb;
+    constexpr bool hdr = output == Output::Half || output == Output::Float;
+    constexpr std::size_t pixelSize = OutputTraits<output>::PixelSize;
+    const auto pixel = [&](const Int x, const Int y, const Int z) {
+        return dst + z*sliceStride + y*rowStride + x*pixelSize;
+    };
+    const auto error = [&]() {
+        for(Int z = 0; z != blockSize.z(); ++z)
+            for(Int y = 0; y != blockSize.y(); ++y)
+                for(Int x = 0; x != blockSize.x(); ++x)
+                    OutputTraits<output>::writeError(pixel(x, y, z));
+    };
+
+    BlockBits bits;
+    bits.data[0] = bits.data[1] = 0;
+    for(std::size_t i = 0; i != 16; ++i)
+        bits.data[i/8] |= UnsignedLong(UnsignedByte(block[i])) << (i%8)*8;
+
+    const bool is3D = blockSize.z() != 1;
+    const UnsignedInt mode = bits.get(0, 11);
+
+    /* Void-extent block, filled with a single color */
+    if((mode & 0x1ff) == 0x1fc) {
+        const bool hdrVoidExtent = mode & 0x200;
+        if(hdrVoidExtent && !hdr)
+            return error();
+
+        /* The extent coordinates are unused, but have to be valid */
+        if(!is3D) {
+            if(bits.get(10, 2) != 3) return error();
+            const UnsignedInt s0 = bits.get(12, 13), s1 = bits.get(25, 13),
+                t0 = bits.get(38, 13), t1 = bits.get(51, 13);
+            if(!(s0 == 0x1fff && s1 == 0x1fff && t0 == 0x1fff && t1 == 0x1fff) && (s0 >= s1 || t0 >= t1))
+                return error();
+        } else {
+            const UnsignedInt s0 = bits.get(10, 9), s1 = bits.get(19, 9),
+                t0 = bits.get(28, 9), t1 = bits.get(37, 9),
+                p0 = bits.get(46, 9), p1 = bits.get(55, 9);
+            if(!(s0 == 0x1ff && s1 == 0x1ff && t0 == 0x1ff && t1 == 0x1ff && p0 == 0x1ff && p1 == 0x1ff) && (s0 >= s1 || t0 >= t1 || p0 >= p1))
+                return error();
+        }
+
+        const UnsignedShort value[4]{
+            UnsignedShort(bits.get(64, 16)),
+            UnsignedShort(bits.get(80, 16)),
+            UnsignedShort(bits.get(96, 16)),
+            UnsignedShort(bits.get(112, 16))
+        };
+        const Channel channel = hdrVoidExtent ? Channel::Half : Channel::Unorm16;
+        const Channel channels[4]{channel, channel, channel, channel};
+        for(Int z = 0; z != blockSize.z(); ++z)
+            for(Int y = 0; y != blockSize.y(); ++y)
+                for(Int x = 0; x != blockSize.x(); ++x)
+                    OutputTraits<output>::write(pixel(x, y, z), value, channels);
+        return;
+    }
+
+    /* Weight grid size and quantization */
+    BlockMode blockMode;
+    if(!(is3D ? decodeBlockMode3D(mode, blockMode) : decodeBlockMode2D(mode, blockMode)) ||
+       blockMode.gridX > blockSize.x() ||
+       blockMode.gridY > blockSize.y() ||
+       blockMode.gridZ > blockSize.z())
+        return error();
+    const UnsignedInt gridSize = blockMode.gridX*blockMode.gridY*blockMode.gridZ;
+    const UnsignedInt weightCount = gridSize*(blockMode.dualPlane ? 2 : 1);
+    if(weightCount > 64) return error();
+    const UnsignedInt weightBits = iseBitCount(blockMode.weightRange, weightCount);
+    if(weightBits < 24 || weightBits > 96) return error();
+
+    /* Partitions and color endpoint modes. With multiple partitions and
+       different endpoint modes, the high bits of the mode are stored below
+       the weights. */
+    const Int partitionCount = bits.get(11, 2) + 1;
+    if(blockMode.dualPlane && partitionCount == 4) return error();
+    Int belowWeights = 128 - weightBits;
+    UnsignedInt partitionSeed = 0;
+    UnsignedInt colorBegin;
+    UnsignedInt cems[4];
+    if(partitionCount == 1) {
+        cems[0] = bits.get(13, 4);
+        colorBegin = 17;
+    } else {
+        partitionSeed = bits.get(13, 10);
+        colorBegin = 29;
+        UnsignedInt cem = bits.get(23, 6);
+        if((cem & 3) == 0) {
+            for(Int i = 0; i != partitionCount; ++i)
+                cems[i] = cem >> 2;
+        } else {
+            const UnsignedInt extraBits = 3*partitionCount - 4;
+            belowWeights -= extraBits;
+            cem |= bits.get(belowWeights, extraBits) << 6;
+            const UnsignedInt baseClass = (cem & 3) - 1;
+            for(Int i = 0; i != partitionCount; ++i)
+                cems[i] = ((baseClass + ((cem >> (2 + i)) & 1)) << 2)|((cem >> (2 + partitionCount + 2*i)) & 3);
+        }
+    }
+
+    /* Color component that uses the second weight plane */
+    Int dualPlaneComponent = -1;
+    if(blockMode.dualPlane) {
+        belowWeights -= 2;
+        dualPlaneComponent = bits.get(belowWeights, 2);
+    }
+
+    /* Color endpoint values, using the largest range that fits */
+    UnsignedInt colorValueCount = 0;
+    for(Int i = 0; i != partitionCount; ++i)
+        colorValueCount += ((cems[i] >> 2) + 1)*2;
+    const Int colorBits = belowWeights - colorBegin;
+    if(colorValueCount > 18 || colorBits < Int(13*colorValueCount + 4)/5)
+        return error();
+    UnsignedInt colorRange = 20;
+    while(iseBitCount(colorRange, colorValueCount) > UnsignedInt(colorBits))
+        --colorRange;
+    UnsignedByte colorValues[18];
+    decodeIse(bits.extract(colorBegin, colorBits), colorRange, colorValueCount, unquantizeColor, colorValues);
+
+    UnsignedShort endpoints[4][2][4];
+    Channel channels[4][4];
+    for(Int i = 0, offset = 0; i != partitionCount; ++i) {
+        if(!decodeEndpoints(cems[i], colorValues + offset, srgb, hdr, endpoints[i][0], endpoints[i][1], channels[i]))
+            return error();
+        offset += ((cems[i] >> 2) + 1)*2;
+    }
+
+    /* Weights, stored bit-reversed from the top of the block. With two
+       planes, the weights are interleaved. Have extra padding at the end as
+       the infill may access one row / slice past the end with a zero
+       factor. */
+    UnsignedByte weights[64];
+    decodeIse(bits.reversed().extract(0, weightBits), blockMode.weightRange, weightCount, unquantizeWeight, weights);
+    UnsignedByte planes[2][64 + 64]{};
+    for(UnsignedInt i = 0; i != gridSize; ++i) {
+        if(blockMode.dualPlane) {
+            planes[0][i] = weights[2*i];
+            planes[1][i] = weights[2*i + 1];
+        } else planes[0][i] = weights[i];
+    }
+
+    /* Decode each texel */
+    const Int gridX = blockMode.gridX;
+    const Int gridXY = blockMode.gridX*blockMode.gridY;
+    const Int ds = (1024 + blockSize.x()/2)/(blockSize.x() - 1);
+    const Int dt = (1024 + blockSize.y()/2)/(blockSize.y() - 1);
+    const Int dr = is3D ? (1024 + blockSize.z()/2)/(blockSize.z() - 1) : 0;
+    const bool smallBlock = blockSize.product() < 31;
+    for(Int z = 0; z != blockSize.z(); ++z) {
+        for(Int y = 0; y != blockSize.y(); ++y) {
+            for(Int x = 0; x != blockSize.x(); ++x) {
+                const UnsignedInt partition = partitionCount == 1 ? 0 :
+                    selectPartition(partitionSeed, x, y, z, partitionCount, smallBlock);
+
+                /* Infill the weight grid to the texel position, bilinearly
+                   for 2D blocks and using simplex interpolation for 3D */
+                const Int gs = (ds*x*(blockMode.gridX - 1) + 32) >> 6;
+                const Int gt = (dt*y*(blockMode.gridY - 1) + 32) >> 6;
+                const Int gr = (dr*z*(blockMode.gridZ - 1) + 32) >> 6;
+                const Int fs = gs & 0xf;
+                const Int ft = gt & 0xf;
+                const Int fr = gr & 0xf;
+                const Int v0 = (gs >> 4) + (gt >> 4)*gridX + (gr >> 4)*gridXY;
+                UnsignedInt w[2];
+                for(std::size_t plane = 0; plane != (blockMode.dualPlane ? 2 : 1); ++plane) {
+                    const UnsignedByte* const p = planes[plane] + v0;
+                    if(!is3D) {
+                        const Int w11 = (fs*ft + 8) >> 4;
+                        const Int w10 = ft - w11;
+                        const Int w01 = fs - w11;
+                        const Int w00 = 16 - fs - ft + w11;
+                        w[plane] = (p[0]*w00 + p[1]*w01 + p[gridX]*w10 + p[gridX + 1]*w11 + 8) >> 4;
+                    } else {
+                        /* Walk from the first to the last corner of the
+                           cell along the axes ordered by their fraction,
+                           largest first. The comparisons have to cover ties
+                           as well, otherwise some weights end up
+                           negative. */
+                        Int s1, s2, w0, w1, w2, w3;
+                        if(fs > ft) {
+                            if(ft > fr) {
+                                s1 = 1; s2 = gridX + 1;
+                                w0 = 16 - fs; w1 = fs - ft; w2 = ft - fr; w3 = fr;
+                            } else if(fs > fr) {
+                                s1 = 1; s2 = gridXY + 1;
+                                w0 = 16 - fs; w1 = fs - fr; w2 = fr - ft; w3 = ft;
+                            } else {
+                                s1 = gridXY; s2 = gridXY + 1;
+                                w0 = 16 - fr; w1 = fr - fs; w2 = fs - ft; w3 = ft;
+                            }
+                        } else {
+                            if(fs > fr) {
+                                s1 = gridX; s2 = gridX + 1;
+                                w0 = 16 - ft; w1 = ft - fs; w2 = fs - fr; w3 = fr;
+                            } else if(ft > fr) {
+                                s1 = gridX; s2 = gridXY + gridX;
+                                w0 = 16 - ft; w1 = ft - fr; w2 = fr - fs; w3 = fs;
+                            } else {
+                                s1 = gridXY; s2 = gridXY + gridX;
+                                w0 = 16 - fr; w1 = fr - ft; w2 = ft - fs; w3 = fs;
+                            }
+                        }
+                        w[plane] = (p[0]*w0 + p[s1]*w1 + p[s2]*w2 + p[gridXY + gridX + 1]*w3 + 8) >> 4;
+                    }
+                }
+
+                /* Interpolate the endpoints */
+                const UnsignedShort(&e0)[4] = endpoints[partition][0];
+                const UnsignedShort(&e1)[4] = endpoints[partition][1];
+                UnsignedShort value[4];
+                for(Int i = 0; i != 4; ++i) {
+                    const UnsignedInt weight = w[i == dualPlaneComponent ? 1 : 0];
+                    value[i] = (e0[i]*(64 - weight) + e1[i]*weight + 32) >> 6;
+                }
+                OutputTraits<output>::write(pixel(x, y, z), value, channels[partition]);
+            }
+        }
+    }
+}
+
+/* Decodes given range of block rows. Rows of all slices are indexed together,
+   i.e. row r is the (r % yBlocks)th row of the (r / yBlocks)th slice. */
+template<Output output> void decodeBlocks(const Containers::StridedArrayView3D<const char>& src, const Containers::StridedArrayView3D<char>& dst, const Vector3i& blockSize, const std::size_t begin, const std::size_t end) {
+    const std::size_t yBlocks = src.size()[1];
+    const std::size_t xBlocks = src.size()[2];
+    CORRADE_INTERNAL_ASSERT(dst.size()[0] == src.size()[0]*blockSize.z() &&
+                            dst.size()[1] == yBlocks*blockSize.y() &&
+                            dst.size()[2] == xBlocks*blockSize.x());
+    const std::ptrdiff_t dstSliceStride = dst.stride()[0];
+    const std::ptrdiff_t dstRowStride = dst.stride()[1];
+    for(std::size_t row = begin; row != end; ++row) {
+        const std::size_t z = row/yBlocks;
+        const std::size_t y = row%yBlocks;
+        for(std::size_t x = 0; x != xBlocks; ++x)
+            decodeBlock<output>(&src[{z, y, x}], blockSize, &dst[{z*blockSize.z(), y*blockSize.y(), x*blockSize.x()}], dstRowStride, dstSliceStride);
+    }
+}
+
+typedef void(*DecodeBlocksFunction)(const Containers::StridedArrayView3D<const char>&, const Containers::StridedArrayView3D<char>&, const Vector3i&, std::size_t, std::size_t);
+
+/* Splits the block rows into contiguous ranges, one per thread. The calling
+   thread decodes the last range, so for threadCount being 1 no threads are
+   spawned at all. Each thread writes to a disjoint set of output rows, so no
+   synchronization is needed apart from the final join. */
+void decodeBlocksParallel(const DecodeBlocksFunction decode, const Containers::StridedArrayView3D<const char>& src, const Containers::StridedArrayView3D<char>& dst, const Vector3i& blockSize, const UnsignedInt threadCount) {
+    const std::size_t rows = src.size()[0]*src.size()[1];
+    const std::size_t rangeCount = Math::min(std::size_t(threadCount), rows);
+    if(rangeCount <= 1) {
+        decode(src, dst, blockSize, 0, rows);
+        return;
+    }
+
+    const std::size_t rowsPerRange = (rows + rangeCount - 1)/rangeCount;
+    Containers::Array<std::thread> threads;
+    arrayReserve(threads, rangeCount - 1);
+    for(std::size_t begin = 0; begin < rows; begin += rowsPerRange) {
+        const std::size_t end = Math::min(begin + rowsPerRange, rows);
+        if(end == rows)
+            decode(src, dst, blockSize, begin, end);
+        else
+            arrayAppend(threads, InPlaceInit, decode, src, dst, blockSize, begin, end);
+    }
+
+    for(std::thread& thread: threads)
+        thread.join();
+}
+
+template<UnsignedInt dimensions> Containers::Optional<ImageData<dimensions>> convertInternal(const BasicCompressedImageView<dimensions>& image, const Utility::ConfigurationGroup& configuration, const ImageConverterFlags flags) {
+    const bool hdrToFloat = configuration.value<bool>("hdrToFloat");
+
+    /* Read as a signed value to catch negative values instead of having them
+       wrap around to billions of threads */
+    const Int threads = configuration.value<Int>("threads");
+    if(threads < 0) {
+        Error{} << "Trade::AstcDecImageConverter::convert(): expected threads to be zero or positive but got" << threads;
+        return {};
+    }
+
+    /* Decide on the decoding profile and target pixel format */
+    Output output;
+    switch(image.format()) {
+        #define _c(size)                                                    \
+            case CompressedPixelFormat::Astc ## size ## RGBAUnorm:          \
+                output = Output::Ldr;                                       \
+                break;                                                      \
+            case CompressedPixelFormat::Astc ## size ## RGBASrgb:           \
+                output = Output::LdrSrgb;                                   \
+                break;                                                      \
+            case CompressedPixelFormat::Astc ## size ## RGBAF:              \
+                output = hdrToFloat ? Output::Float : Output::Half;         \
+                break;
+        _c(4x4)
+        _c(5x4)
+        _c(5x5)
+        _c(6x5)
+        _c(6x6)
+        _c(8x5)
+        _c(8x6)
+        _c(8x8)
+        _c(10x5)
+        _c(10x6)
+        _c(10x8)
+        _c(10x10)
+        _c(12x10)
+        _c(12x12)
+        _c(3x3x3)
+        _c(4x3x3)
+        _c(4x4x3)
+        _c(4x4x4)
+        _c(5x4x4)
+        _c(5x5x4)
+        _c(5x5x5)
+        _c(6x5x5)
+        _c(6x6x5)
+        _c(6x6x6)
+        #undef _c
+        default:
+            Error{} << "Trade::AstcDecImageConverter::convert(): unsupported format" << image.format();
+            return {};
+    }
+
+    PixelFormat format;
+    DecodeBlocksFunction decode;
+    switch(output) {
+        case Output::Ldr:
+            format = PixelFormat::RGBA8Unorm;
+            decode = decodeBlocks<Output::Ldr>;
+            break;
+        case Output::LdrSrgb:
+            format = PixelFormat::RGBA8Srgb;
+            decode = decodeBlocks<Output::LdrSrgb>;
+            break;
+        case Output::Half:
+            format = PixelFormat::RGBA16F;
+            decode = decodeBlocks<Output::Half>;
+            break;
+        case Output::Float:
+            format = PixelFormat::RGBA32F;
+            decode = decodeBlocks<Output::Float>;
+            break;
+        default: CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+
+    /** @todo clean up once the block size is stored directly in the image */
+    const Vector3i blockSize = compressedPixelFormatBlockSize(image.format());
+    if(dimensions == 2 && blockSize.z() != 1) {
+        Error{} << "Trade::AstcDecImageConverter::convert(): can't decode a 2D image with a 3D block format" << image.format();
+        return {};
+    }
+
+    /* Allocate output data. For simplicity make them contain the full blocks
+       with an appropriate row length and image height set. That way, if the
+       actual used size isn't whole blocks, the extra unused pixels at the end
+       of each row and at/or the end of each slice are treated as padding
+       without having to do a lot of special casing in the decoding loop. For
+       2D blocks, each slice of a 3D image is a separate layer of blocks. */
+    const Vector3i size = Vector3i::pad(image.size(), 1);
+    const Vector3i blockCount = (size + blockSize - Vector3i{1})/blockSize;
+    const Vector3i sizeInWholeBlocks = blockSize*blockCount;
+    const UnsignedInt pixelSize = pixelFormatSize(format);
+    ImageData<dimensions> out{
+        /* Since the pixel size is always at least four bytes, the alignment
+           can stay at the default of 4. Image height is only relevant for 3D
+           images. */
+        PixelStorage{}
+            .setRowLength(sizeInWholeBlocks.x())
+            .setImageHeight(dimensions == 3 ? sizeInWholeBlocks.y() : 0),
+        format,
+        image.size(),
+        Containers::Array<char>{NoInit, std::size_t(pixelSize*sizeInWholeBlocks.product())},
+        image.flags()};
+
+    /* Build the source block view and destination pixel view */
+    /** @todo clean up and remove the error once there's a blocks() accessor */
+    if(image.storage() != CompressedPixelStorage{}) {
+        Error{} << "Trade::AstcDecImageConverter::convert(): non-default compressed storage is not supported";
+        return {};
+    }
+    const UnsignedInt blockDataSize = compressedPixelFormatBlockDataSize(image.format());
+    const Containers::StridedArrayView3D<const char> src{
+        image.data(),
+        {std::size_t(blockCount.z()),
+         std::size_t(blockCount.y()),
+         std::size_t(blockCount.x())},
+        {std::ptrdiff_t(blockCount.xy().product()*blockDataSize),
+         std::ptrdiff_t(blockCount.x()*blockDataSize),
+         std::ptrdiff_t(blockDataSize)}
+    };
+    /* Can't use pixels() here because the pixel view may not be whole
+       blocks */
+    const Containers::StridedArrayView3D<char> dst{
+        out.mutableData(),
+        {std::size_t(sizeInWholeBlocks.z()),
+         std::size_t(sizeInWholeBlocks.y()),
+         std::size_t(sizeInWholeBlocks.x())},
+        {std::ptrdiff_t(sizeInWholeBlocks.xy().product()*pixelSize),
+         std::ptrdiff_t(sizeInWholeBlocks.x()*pixelSize),
+         std::ptrdiff_t(pixelSize)}
+    };
+
+    /* Decode block-by-block, optionally spreading block rows across multiple
+       threads */
+    UnsignedInt threadCount = threads;
+    if(!threadCount) {
+        threadCount = std::thread::hardware_concurrency();
+        if(flags & ImageConverterFlag::Verbose)
+            Debug{} << "Trade::AstcDecImageConverter::convert(): autodetected hardware concurrency to" << threadCount << "threads";
+    }
+    decodeBlocksParallel(decode, src, dst, blockSize, threadCount);
+
+    /* GCC 4.8 needs extra help here */
+    return Containers::optional(Utility::move(out));
+}
+
+}
+
+Containers::Optional<ImageData2D> AstcDecImageConverter::doConvert(const CompressedImageView2D& image) {
+    return convertInternal(image, configuration(), flags());
+}
+
+Containers::Optional<ImageData3D> AstcDecImageConverter::doConvert(const CompressedImageView3D& image) {
+    return convertInternal(image, configuration(), flags());
+}
+
+}}
+
+CORRADE_PLUGIN_REGISTER(AstcDecImageConverter, Magnum::Trade::AstcDecImageConverter,
+    MAGNUM_TRADE_ABSTRACTIMAGECONVERTER_PLUGIN_INTERFACE)
@@ -0,0 +1,185 @@
+#ifndef Magnum_Trade_AstcDecImageConverter_h
+#define Magnum_Trade_AstcDecImageConverter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::AstcDecImageConverter
+ * @m_since_latest_{plugins}
+ */
+
+#include <Magnum/Trade/AbstractImageConverter.h>
+
+#include "MagnumPlugins/AstcDecImageConverter/configure.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_ASTCDECIMAGECONVERTER_BUILD_STATIC
+    #ifdef AstcDecImageConverter_EXPORTS
+        #define MAGNUM_ASTCDECIMAGECONVERTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_ASTCDECIMAGECONVERTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_ASTCDECIMAGECONVERTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_ASTCDECIMAGECONVERTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#else
+#define MAGNUM_ASTCDECIMAGECONVERTER_EXPORT
+#define MAGNUM_ASTCDECIMAGECONVERTER_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief ASTC-compressed image decoding
+@m_since_latest_{plugins}
+
+Decodes 2D and 3D ASTC blocks of all sizes to uncompressed RGBA, both LDR and
+HDR, using a self-contained implementation of the
+[Khronos Data Format Specification](https://registry.khronos.org/DataFormat/specs/1.3/dataformat.1.3.html#ASTC).
+Useful for example for verifying ASTC-compressed assets on systems without a
+GPU capable of sampling them. See also the @ref BcDecImageConverter and
+@ref EtcDecImageConverter plugins for decoding BCn and ETC / EAC images, and
+the @ref AstcImporter plugin for importing `*.astc` files.
+
+@section Trade-AstcDecImageConverter-usage Usage
+
+@m_class{m-note m-success}
+
+@par
+    This class is a plugin that's meant to be dynamically loaded and used
+    via the base @ref AbstractImageConverter interface. See its documentation
+    for introduction and usage examples.
+
+This plugin depends on the @ref Trade library and is built if
+`MAGNUM_WITH_ASTCDECIMAGECONVERTER` is enabled when building Magnum Plugins.
+To use as a dynamic plugin, load @cpp "AstcDecImageConverter" @ce via
+@ref Corrade::PluginManager::Manager.
+
+Additionally, if you're using Magnum as a CMake subproject, bundle the
+[magnum-plugins repository](https://github.com/mosra/magnum-plugins) and do the
+following:
+
+@code{.cmake}
+set(MAGNUM_WITH_ASTCDECIMAGECONVERTER ON CACHE BOOL "" FORCE)
+add_subdirectory(magnum-plugins EXCLUDE_FROM_ALL)
+
+# So the dynamically loaded plugin gets built implicitly
+add_dependencies(your-app MagnumPlugins::AstcDecImageConverter)
+@endcode
+
+To use as a static plugin or as a dependency of another plugin with CMake, put
+[FindMagnumPlugins.cmake](https://github.com/mosra/magnum-plugins/blob/master/modules/FindMagnumPlugins.cmake)
+into your `modules/` directory, request the `AstcDecImageConverter` component
+of the `MagnumPlugins` package and link to the
+`MagnumPlugins::AstcDecImageConverter` target:
+
+@code{.cmake}
+find_package(MagnumPlugins REQUIRED AstcDecImageConverter)
+
+# ...
+target_link_libraries(your-app PRIVATE MagnumPlugins::AstcDecImageConverter)
+@endcode
+
+See @ref building-plugins, @ref cmake-plugins and @ref plugins for more
+information.
+
+@section Trade-AstcDecImageConverter-behavior Behavior and limitations
+
+The following formats are supported:
+
+-   @ref CompressedPixelFormat::Astc4x4RGBAUnorm to
+    @relativeref{CompressedPixelFormat,Astc12x12RGBAUnorm} and
+    @relativeref{CompressedPixelFormat,Astc3x3x3RGBAUnorm} to
+    @relativeref{CompressedPixelFormat,Astc6x6x6RGBAUnorm} is decoded to
+    @ref PixelFormat::RGBA8Unorm
+-   @ref CompressedPixelFormat::Astc4x4RGBASrgb to
+    @relativeref{CompressedPixelFormat,Astc12x12RGBASrgb} and
+    @relativeref{CompressedPixelFormat,Astc3x3x3RGBASrgb} to
+    @relativeref{CompressedPixelFormat,Astc6x6x6RGBASrgb} is decoded to
+    @ref PixelFormat::RGBA8Srgb
+-   @ref CompressedPixelFormat::Astc4x4RGBAF to
+    @relativeref{CompressedPixelFormat,Astc12x12RGBAF} and
+    @relativeref{CompressedPixelFormat,Astc3x3x3RGBAF} to
+    @relativeref{CompressedPixelFormat,Astc6x6x6RGBAF} is decoded to
+    @ref PixelFormat::RGBA16F by default, and to @ref PixelFormat::RGBA32F if
+    the @cb{.ini} hdrToFloat @ce @ref Trade-AstcDecImageConverter-configuration "configuration option"
+    is enabled
+
+The `*Unorm` and `*Srgb` formats are decoded using the LDR profile, the `*F`
+formats using the HDR profile. The 8-bit output is the top 8 bits of the
+16-bit interpolated value, matching the `ASTC_decode_mode` extension with the
+`unorm8` decode mode. Blocks that are invalid, or blocks containing HDR
+endpoints in a LDR format, are decoded to the error color, which is opaque
+magenta for LDR output and NaN in all channels for HDR output.
+
+The output image always has data for whole blocks, if the actual size isn't
+whole blocks, @ref PixelStorage::setRowLength() and
+@relativeref{PixelStorage,setImageHeight()} is set to treat the extra pixels
+at the end of each row and slice as padding. Non-default
+@ref CompressedPixelStorage isn't supported in input images.
+
+Both 2D and 3D images are supported. 3D images with 2D block formats are
+treated as a list of 2D slices, which also makes it possible to decode 2D
+array and cube map (array) images in a single call, 3D block formats are
+decoded as a volume. Using a 3D block format with a 2D image isn't supported.
+Image flags, if any, are passed through unchanged.
+
+@subsection Trade-AstcDecImageConverter-behavior-multithreading Multithreading
+
+By default the blocks are decoded serially in the calling thread. Setting the
+@cb{.ini} threads @ce @ref Trade-AstcDecImageConverter-configuration "configuration option"
+to a value other than @cpp 1 @ce splits rows of blocks across the given number
+of threads, with @cpp 0 @ce meaning the value returned by
+@cpp std::thread::hardware_concurrency() @ce. Rows of all slices are
+distributed together. With @ref ImageConverterFlag::Verbose enabled, the
+plugin prints the autodetected thread count.
+
+@section Trade-AstcDecImageConverter-configuration Plugin-specific configuration
+
+It's possible to tune various conversion options through @ref configuration().
+See below for all options and their default values:
+
+@snippet MagnumPlugins/AstcDecImageConverter/AstcDecImageConverter.conf configuration_
+
+See @ref plugins-configuration for more information and an example showing how
+to edit the configuration values.
+*/
+class MAGNUM_ASTCDECIMAGECONVERTER_EXPORT AstcDecImageConverter: public AbstractImageConverter {
+    public:
+        /** @brief Plugin manager constructor */
+        explicit AstcDecImageConverter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin);
+
+    private:
+        MAGNUM_ASTCDECIMAGECONVERTER_LOCAL ImageConverterFeatures doFeatures() const override;
+
+        MAGNUM_ASTCDECIMAGECONVERTER_LOCAL Containers::Optional<ImageData2D> doConvert(const CompressedImageView2D& image) override;
+        MAGNUM_ASTCDECIMAGECONVERTER_LOCAL Containers::Optional<ImageData3D> doConvert(const CompressedImageView3D& image) override;
+};
+
+}}
+
+#endif
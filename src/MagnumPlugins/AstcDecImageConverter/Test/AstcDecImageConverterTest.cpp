@@ -0,0 +1,993 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <thread>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+#include <Corrade/Utility/Format.h>
+#include <Corrade/Utility/Path.h>
+#include <Magnum/ImageView.h>
+#include <Magnum/Math/Color.h>
+#include <Magnum/Math/Half.h>
+#include <Magnum/DebugTools/CompareImage.h>
+#include <Magnum/Trade/AbstractImageConverter.h>
+#include <Magnum/Trade/AbstractImporter.h>
+#include <Magnum/Trade/ImageData.h>
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct AstcDecImageConverterTest: TestSuite::Tester {
+    explicit AstcDecImageConverterTest();
+
+    void test();
+    void test3D();
+    void singleBlock();
+    void endpointModes();
+    void blockFeatures();
+    void threads();
+    void threadsInvalid();
+    void preserveFlags();
+
+    void unsupportedFormat();
+    void unsupportedStorage();
+    void threeDimensionalBlock2DImage();
+
+    /* Explicitly forbid system-wide plugin dependencies */
+    PluginManager::Manager<AbstractImageConverter> _manager{"nonexistent"};
+    PluginManager::Manager<AbstractImporter> _importerManager{"nonexistent"};
+};
+
+using namespace Math::Literals;
+
+const struct {
+    const char* name;
+    const char* file;
+    const char* format;
+    CompressedPixelFormat expectedCompressedFormat;
+    const char* expected;
+    PixelFormat expectedFormat;
+    Float maxThreshold, meanThreshold;
+} TestData[]{
+    /* Correspondence of the ASTC files to the uncompressed input can be seen
+       in AstcImporter/Test/convert.sh */
+    {"8x8", "8x8.astc", nullptr,
+        CompressedPixelFormat::Astc8x8RGBAUnorm,
+        "rgba-64x32.png", PixelFormat::RGBA8Unorm,
+        25.5f, 1.011f},
+    {"8x8, sRGB", "8x8.astc", "srgb",
+        CompressedPixelFormat::Astc8x8RGBASrgb,
+        "rgba-64x32.png", PixelFormat::RGBA8Srgb,
+        25.5f, 0.983f},
+    {"12x10, incomplete blocks", "12x10-incomplete-blocks.astc", nullptr,
+        CompressedPixelFormat::Astc12x10RGBAUnorm,
+        "rgba-63x27.png", PixelFormat::RGBA8Unorm,
+        36.5f, 2.514f},
+};
+
+const struct {
+    const char* name;
+    const char* file;
+    CompressedPixelFormat expectedCompressedFormat;
+    ImageFlags3D expectedFlags;
+    Vector3i expectedSize;
+    const char* expected[3];
+    Float maxThreshold, meanThreshold;
+} Test3DData[]{
+    {"3x3x3", "3x3x3.astc",
+        CompressedPixelFormat::Astc3x3x3RGBAUnorm, {}, {27, 27, 3},
+        {"rgba-27x27.png", "rgba-27x27-slice1.png", "rgba-27x27-slice2.png"},
+        55.25f, 3.355f},
+    {"12x12 array, incomplete blocks", "12x12-array-incomplete-blocks.astc",
+        CompressedPixelFormat::Astc12x12RGBAUnorm, ImageFlag3D::Array, {27, 27, 2},
+        {"rgba-27x27.png", "rgba-27x27-slice2.png", nullptr},
+        41.25f, 3.753f},
+};
+
+/* Hand-crafted 4x4 blocks, with the expected output being a single color
+   repeated for all 16 pixels */
+const struct {
+    const char* name;
+    CompressedPixelFormat format;
+    Containers::Optional<bool> hdrToFloat;
+    char block[16];
+    PixelFormat expectedFormat;
+    Color4ub expected8;
+    Vector4h expected16;
+    Vector4 expected32;
+} SingleBlockData[]{
+    {"LDR void extent",
+        CompressedPixelFormat::Astc4x4RGBAUnorm, {},
+        {'\xfc', '\xfd', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+         '\x00', '\x33', '\xff', '\x66', '\x00', '\x99', '\xff', '\xff'},
+        PixelFormat::RGBA8Unorm, {0x33, 0x66, 0x99, 0xff}, {}, {}},
+    {"HDR void extent",
+        CompressedPixelFormat::Astc4x4RGBAF, {},
+        {'\xfc', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+         '\x00', '\x3c', '\x00', '\x40', '\x00', '\x42', '\x00', '\x38'},
+        PixelFormat::RGBA16F, {}, {1.0_h, 2.0_h, 3.0_h, 0.5_h}, {}},
+    {"HDR void extent, to float",
+        CompressedPixelFormat::Astc4x4RGBAF, true,
+        {'\xfc', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+         '\x00', '\x3c', '\x00', '\x40', '\x00', '\x42', '\x00', '\x38'},
+        PixelFormat::RGBA32F, {}, {}, {1.0f, 2.0f, 3.0f, 0.5f}},
+    {"HDR void extent in a LDR format",
+        CompressedPixelFormat::Astc4x4RGBAUnorm, {},
+        {'\xfc', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff',
+         '\x00', '\x3c', '\x00', '\x40', '\x00', '\x42', '\x00', '\x38'},
+        PixelFormat::RGBA8Unorm, {0xff, 0x00, 0xff, 0xff}, {}, {}},
+    /* Single partition, 2x2 weight grid, HDR RGB direct endpoint mode (2)
+       with both endpoints equal */
+    {"HDR endpoints",
+        CompressedPixelFormat::Astc4x4RGBAF, {},
+        {'\x51', '\x40', '\x00', '\x01', '\x01', '\x00', '\x00', '\x00',
+         '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00'},
+        PixelFormat::RGBA16F, {}, {2.0_h, 2.0_h, 2.0_h, 1.0_h}, {}},
+    {"HDR endpoints, to float",
+        CompressedPixelFormat::Astc4x4RGBAF, true,
+        {'\x51', '\x40', '\x00', '\x01', '\x01', '\x00', '\x00', '\x00',
+         '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00'},
+        PixelFormat::RGBA32F, {}, {}, {2.0f, 2.0f, 2.0f, 1.0f}},
+    {"HDR endpoints in a LDR format",
+        CompressedPixelFormat::Astc4x4RGBASrgb, {},
+        {'\x51', '\x40', '\x00', '\x01', '\x01', '\x00', '\x00', '\x00',
+         '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00'},
+        PixelFormat::RGBA8Srgb, {0xff, 0x00, 0xff, 0xff}, {}, {}},
+    /* Block mode 0 is reserved */
+    {"invalid block",
+        CompressedPixelFormat::Astc4x4RGBAUnorm, {},
+        {},
+        PixelFormat::RGBA8Unorm, {0xff, 0x00, 0xff, 0xff}, {}, {}},
+    {"invalid block, HDR",
+        CompressedPixelFormat::Astc4x4RGBAF, {},
+        {},
+        /* NaN with all bits set, can't use a _h literal for that */
+        PixelFormat::RGBA16F, {}, Vector4h{Half{UnsignedShort(0xffff)}}, {}},
+};
+
+/* Single-partition 4x4 blocks with a 4x4 grid of 2-bit weights, giving 0, 21,
+   43 and 64 in each row, and the color endpoint values stored as plain 8-bit
+   numbers right after the color endpoint mode, which is in the parentheses.
+   All four rows of the output are thus the same. HDR output is compared as
+   half-float bits. The expected values were cross-checked against a separate
+   implementation of the specification. */
+const struct {
+    const char* name;
+    CompressedPixelFormat format;
+    char block[16];
+    PixelFormat expectedFormat;
+    Color4ub expected8[4];
+    Vector4us expected16[4];
+} EndpointModeData[]{
+    {"luminance, direct (0)",
+        CompressedPixelFormat::Astc4x4RGBAUnorm,
+        {'\x42', '\x00', '\x40', '\xa0', '\x01', '\x00', '\x00', '\x00',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA8Unorm,
+        {{0x20, 0x20, 0x20, 0xff}, {0x5a, 0x5a, 0x5a, 0xff},
+         {0x96, 0x96, 0x96, 0xff}, {0xd0, 0xd0, 0xd0, 0xff}}, {}},
+    {"luminance, base + offset (1)",
+        CompressedPixelFormat::Astc4x4RGBAUnorm,
+        {'\x42', '\x20', '\x34', '\x0f', '\x01', '\x00', '\x00', '\x00',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA8Unorm,
+        {{0xa6, 0xa6, 0xa6, 0xff}, {0xa8, 0xa8, 0xa8, 0xff},
+         {0xab, 0xab, 0xab, 0xff}, {0xad, 0xad, 0xad, 0xff}}, {}},
+    {"luminance, base + offset, clamped (1)",
+        CompressedPixelFormat::Astc4x4RGBAUnorm,
+        {'\x42', '\x20', '\xfc', '\xff', '\x01', '\x00', '\x00', '\x00',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA8Unorm,
+        {{0xff, 0xff, 0xff, 0xff}, {0xff, 0xff, 0xff, 0xff},
+         {0xff, 0xff, 0xff, 0xff}, {0xff, 0xff, 0xff, 0xff}}, {}},
+    {"luminance + alpha, direct (4)",
+        CompressedPixelFormat::Astc4x4RGBAUnorm,
+        {'\x42', '\x80', '\xc0', '\x21', '\x60', '\x80', '\x01', '\x00',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA8Unorm,
+        {{0xe0, 0xe0, 0xe0, 0x30}, {0x9c, 0x9c, 0x9c, 0x5f},
+         {0x54, 0x54, 0x54, 0x91}, {0x10, 0x10, 0x10, 0xc0}}, {}},
+    {"luminance + alpha, base + offset (5)",
+        CompressedPixelFormat::Astc4x4RGBAUnorm,
+        {'\x42', '\xa0', '\x80', '\x78', '\x20', '\x45', '\x01', '\x00',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA8Unorm,
+        {{0x20, 0x20, 0x20, 0xc8}, {0x2a, 0x2a, 0x2a, 0xce},
+         {0x34, 0x34, 0x34, 0xd4}, {0x3e, 0x3e, 0x3e, 0xd9}}, {}},
+    {"luminance + alpha, base + negative offset (5)",
+        CompressedPixelFormat::Astc4x4RGBAUnorm,
+        {'\x42', '\xa0', '\x02', '\x89', '\x45', '\xfc', '\x00', '\x00',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA8Unorm,
+        {{0xc0, 0xc0, 0xc0, 0x11}, {0xb6, 0xb6, 0xb6, 0x10},
+         {0xac, 0xac, 0xac, 0x10}, {0xa2, 0xa2, 0xa2, 0x10}}, {}},
+    {"RGB, base + scale (6)",
+        CompressedPixelFormat::Astc4x4RGBAUnorm,
+        {'\x42', '\xc0', '\xe0', '\x01', '\x61', '\xc0', '\x00', '\x00',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA8Unorm,
+        {{0x5a, 0x30, 0x12, 0xff}, {0x8b, 0x4a, 0x1b, 0xff},
+         {0xbf, 0x66, 0x26, 0xff}, {0xf0, 0x80, 0x30, 0xff}}, {}},
+    {"RGB, direct (8)",
+        CompressedPixelFormat::Astc4x4RGBAUnorm,
+        {'\x42', '\x00', '\x21', '\xc0', '\x81', '\x40', '\x01', '\x21',
+         '\x01', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA8Unorm,
+        {{0x10, 0x40, 0x80, 0xff}, {0x54, 0x5f, 0x85, 0xff},
+         {0x9c, 0x81, 0x8b, 0xff}, {0xe0, 0xa0, 0x90, 0xff}}, {}},
+    {"RGB, direct, blue contraction (8)",
+        CompressedPixelFormat::Astc4x4RGBAUnorm,
+        {'\x42', '\x00', '\xc1', '\x21', '\x40', '\x81', '\x20', '\x01',
+         '\x01', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA8Unorm,
+        {{0x48, 0x60, 0x80, 0xff}, {0x6d, 0x72, 0x85, 0xff},
+         {0x93, 0x86, 0x8b, 0xff}, {0xb8, 0x98, 0x90, 0xff}}, {}},
+    {"RGB, base + offset (9)",
+        CompressedPixelFormat::Astc4x4RGBAUnorm,
+        {'\x42', '\x20', '\x41', '\x4c', '\x00', '\x35', '\xc2', '\x80',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA8Unorm,
+        {{0x10, 0x40, 0x30, 0xff}, {0x16, 0x44, 0x25, 0xff},
+         {0x1c, 0x49, 0x1a, 0xff}, {0x23, 0x4d, 0x10, 0xff}}, {}},
+    {"RGB, base + offset, blue contraction (9)",
+        CompressedPixelFormat::Astc4x4RGBAUnorm,
+        {'\x42', '\x20', '\x43', '\xcc', '\x01', '\xb5', '\xc3', '\x80',
+         '\x01', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA8Unorm,
+        {{0x89, 0x9e, 0x90, 0xff}, {0x91, 0xa7, 0x9b, 0xff},
+         {0x99, 0xb0, 0xa6, 0xff}, {0xa0, 0xb8, 0xb0, 0xff}}, {}},
+    {"RGB, base + scale, two alpha (10)",
+        CompressedPixelFormat::Astc4x4RGBAUnorm,
+        {'\x42', '\x40', '\xe1', '\x01', '\x61', '\x40', '\x41', '\xc0',
+         '\x01', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA8Unorm,
+        {{0x96, 0x50, 0x1e, 0x20}, {0xb4, 0x60, 0x24, 0x5f},
+         {0xd3, 0x70, 0x2a, 0xa1}, {0xf0, 0x80, 0x30, 0xe0}}, {}},
+    {"RGBA, direct (12)",
+        CompressedPixelFormat::Astc4x4RGBAUnorm,
+        {'\x42', '\x80', '\x21', '\xc0', '\x81', '\x40', '\x01', '\x21',
+         '\xff', '\x61', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA8Unorm,
+        {{0x10, 0x40, 0x80, 0xff}, {0x54, 0x5f, 0x85, 0xbb},
+         {0x9c, 0x81, 0x8b, 0x74}, {0xe0, 0xa0, 0x90, 0x30}}, {}},
+    {"RGBA, direct, blue contraction (12)",
+        CompressedPixelFormat::Astc4x4RGBAUnorm,
+        {'\x42', '\x80', '\xc1', '\x21', '\x40', '\x81', '\x20', '\x01',
+         '\x61', '\xfe', '\x01', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA8Unorm,
+        {{0x48, 0x60, 0x80, 0xff}, {0x6d, 0x72, 0x85, 0xbb},
+         {0x93, 0x86, 0x8b, 0x74}, {0xb8, 0x98, 0x90, 0x30}}, {}},
+    {"RGBA, direct, sRGB (12)",
+        CompressedPixelFormat::Astc4x4RGBASrgb,
+        {'\x42', '\x80', '\x21', '\xc0', '\x81', '\x40', '\x01', '\x21',
+         '\xff', '\x61', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA8Srgb,
+        {{0x10, 0x40, 0x80, 0xff}, {0x54, 0x60, 0x85, 0xbb},
+         {0x9c, 0x81, 0x8b, 0x74}, {0xe0, 0xa0, 0x90, 0x30}}, {}},
+    {"RGBA, base + offset (13)",
+        CompressedPixelFormat::Astc4x4RGBAUnorm,
+        {'\x42', '\xa0', '\x41', '\x4c', '\x00', '\x35', '\xc2', '\x80',
+         '\xe2', '\x39', '\x01', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA8Unorm,
+        {{0x10, 0x40, 0x30, 0xf8}, {0x16, 0x44, 0x25, 0xfb},
+         {0x1c, 0x49, 0x1a, 0xfd}, {0x23, 0x4d, 0x10, 0xff}}, {}},
+    {"RGBA, base + offset, blue contraction (13)",
+        CompressedPixelFormat::Astc4x4RGBAUnorm,
+        {'\x42', '\xa0', '\x43', '\xcc', '\x01', '\xb5', '\xc3', '\x80',
+         '\x65', '\xb8', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA8Unorm,
+        {{0x89, 0x9e, 0x90, 0x07}, {0x91, 0xa7, 0x9b, 0x0c},
+         {0x99, 0xb0, 0xa6, 0x13}, {0xa0, 0xb8, 0xb0, 0x19}}, {}},
+    {"RGBA, direct, in a HDR format (12)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\x80', '\x21', '\xc0', '\x81', '\x40', '\x01', '\x21',
+         '\xff', '\x61', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x2c04, 0x3404, 0x3804, 0x3c00}, {0x3549, 0x35fe, 0x382e, 0x39de},
+         {0x38e3, 0x3808, 0x385a, 0x3746}, {0x3b07, 0x3905, 0x3885, 0x3206}}},
+    {"HDR luminance, large range (2)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\x40', '\x60', '\x60', '\x01', '\x00', '\x00', '\x00',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x1800, 0x1800, 0x1800, 0x3c00}, {0x2cc0, 0x2cc0, 0x2cc0, 0x3c00},
+         {0x42c0, 0x42c0, 0x42c0, 0x3c00}, {0x5800, 0x5800, 0x5800, 0x3c00}}},
+    {"HDR luminance, large range, swapped (2)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\x40', '\x60', '\x61', '\x00', '\x00', '\x00', '\x00',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x1830, 0x1830, 0x1830, 0x3c00}, {0x2cd6, 0x2cd6, 0x2cd6, 0x3c00},
+         {0x42aa, 0x42aa, 0x42aa, 0x3c00}, {0x57b0, 0x57b0, 0x57b0, 0x3c00}}},
+    {"HDR luminance, small range (3)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\x60', '\x6a', '\x6e', '\x01', '\x00', '\x00', '\x00',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x5b24, 0x5b24, 0x5b24, 0x3c00}, {0x5b52, 0x5b52, 0x5b52, 0x3c00},
+         {0x5b82, 0x5b82, 0x5b82, 0x3c00}, {0x5bb0, 0x5bb0, 0x5bb0, 0x3c00}}},
+    {"HDR luminance, small range, high precision (3)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\x60', '\x6a', '\xaf', '\x01', '\x00', '\x00', '\x00',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x6660, 0x6660, 0x6660, 0x3c00}, {0x6775, 0x6775, 0x6775, 0x3c00},
+         {0x686a, 0x686a, 0x686a, 0x3c00}, {0x6940, 0x6940, 0x6940, 0x3c00}}},
+    {"HDR RGB + scale, mode 0, red major (7)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\xe0', '\x24', '\xe4', '\x4c', '\xca', '\x00', '\x00',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x6a90, 0x6970, 0x6a30, 0x3c00}, {0x6ca9, 0x6bb3, 0x6c61, 0x3c00},
+         {0x6ed1, 0x6dae, 0x6e6e, 0x3c00}, {0x70e0, 0x7000, 0x7090, 0x3c00}}},
+    {"HDR RGB + scale, mode 0, green major (7)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\xe0', '\x12', '\x30', '\xbb', '\x2a', '\x01', '\x00',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x0980, 0x0b10, 0x0930, 0x3c00}, {0x09ee, 0x0b9a, 0x099e, 0x3c00},
+         {0x0a62, 0x0c19, 0x0a12, 0x3c00}, {0x0ad4, 0x0c6c, 0x0a80, 0x3c00}}},
+    {"HDR RGB + scale, mode 0, blue major (7)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\xe0', '\x12', '\x2c', '\xde', '\xd7', '\x00', '\x00',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x40b4, 0x4060, 0x41a0, 0x3c00}, {0x42ea, 0x4272, 0x440d, 0x3c00},
+         {0x452e, 0x44be, 0x461e, 0x3c00}, {0x4788, 0x46fc, 0x486c, 0x3c00}}},
+    {"HDR RGB + scale, mode 1, green major (7)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\xe0', '\xd8', '\x1e', '\xa7', '\x20', '\x01', '\x00',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x0c9c, 0x0d80, 0x0c6c, 0x3c00}, {0x0ce4, 0x0dd4, 0x0cab, 0x3c00},
+         {0x0d3c, 0x0e2c, 0x0cfc, 0x3c00}, {0x0d90, 0x0e80, 0x0d50, 0x3c00}}},
+    {"HDR RGB + scale, mode 2, blue major (7)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\xe0', '\x40', '\x2b', '\xe4', '\x1f', '\x00', '\x00',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x17d8, 0x1760, 0x19e0, 0x3c00}, {0x185e, 0x1816, 0x1a7d, 0x3c00},
+         {0x18e2, 0x1891, 0x1b3b, 0x3c00}, {0x1980, 0x1920, 0x1c00, 0x3c00}}},
+    {"HDR RGB + scale, mode 3, red major (7)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\xe0', '\xf2', '\x71', '\x16', '\x1c', '\x01', '\x00',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x1a80, 0x0c90, 0x1800, 0x3c00}, {0x1bdf, 0x0da6, 0x18e6, 0x3c00},
+         {0x1cda, 0x0ee0, 0x1a1a, 0x3c00}, {0x1e00, 0x1030, 0x1b60, 0x3c00}}},
+    {"HDR RGB + scale, mode 4, green major (7)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\xe0', '\xc8', '\x14', '\x3d', '\x25', '\x01', '\x00',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x2400, 0x28c0, 0x19c0, 0x3c00}, {0x26b4, 0x2bf1, 0x1cb7, 0x3c00},
+         {0x29cc, 0x2ecf, 0x2009, 0x3c00}, {0x2cc0, 0x31c0, 0x22c0, 0x3c00}}},
+    {"HDR RGB + scale, mode 5 (7)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\xe0', '\xdc', '\x35', '\x29', '\x25', '\x01', '\x00',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x5c00, 0x0800, 0x01c0, 0x3c00}, {0x61a8, 0x0da8, 0x07e2, 0x3c00},
+         {0x6812, 0x1412, 0x0dd8, 0x3c00}, {0x6dc0, 0x19c0, 0x1400, 0x3c00}}},
+    {"HDR RGB, mode 0, red major (11)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\x60', '\x19', '\x6d', '\x20', '\x20', '\x1e', '\x3c',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x1540, 0x0d80, 0x09c0, 0x3c00}, {0x19ae, 0x1343, 0x10ab, 0x3c00},
+         {0x1e52, 0x1917, 0x1815, 0x3c00}, {0x22c0, 0x1ec0, 0x1ec0, 0x3c00}}},
+    {"HDR RGB, mode 0, green major (11)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\x60', '\xe9', '\xb8', '\x98', '\x7e', '\x96', '\x5d',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x5030, 0x55c0, 0x3a80, 0x3c00}, {0x4df3, 0x5839, 0x409d, 0x3c00},
+         {0x4c09, 0x5a74, 0x46f9, 0x3c00}, {0x49c0, 0x5cc0, 0x4d00, 0x3c00}}},
+    {"HDR RGB, mode 0, blue major (11)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\x60', '\x75', '\xe5', '\x92', '\x36', '\xf4', '\x24',
+         '\x01', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x5680, 0x5100, 0x61c0, 0x3c00}, {0x5c3f, 0x54a5, 0x65da, 0x3c00},
+         {0x61ec, 0x587b, 0x6a26, 0x3c00}, {0x67b0, 0x5c30, 0x6e40, 0x3c00}}},
+    {"HDR RGB, mode 1, green major (11)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\x60', '\x15', '\xec', '\x57', '\x26', '\x86', '\x1d',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x0940, 0x34c0, 0x2c90, 0x3c00}, {0x0ded, 0x392e, 0x3214, 0x3c00},
+         {0x12d7, 0x3dd2, 0x3821, 0x3c00}, {0x17b0, 0x4240, 0x3d80, 0x3c00}}},
+    {"HDR RGB, mode 2, blue major (11)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\x60', '\xc1', '\xa3', '\xa0', '\xaf', '\x62', '\xb2',
+         '\x01', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x73d8, 0x6980, 0x71a0, 0x3c00}, {0x7559, 0x6eda, 0x74f2, 0x3c00},
+         {0x7740, 0x7480, 0x7882, 0x3c00}, {0x78e0, 0x79c0, 0x7bff, 0x3c00}}},
+    {"HDR RGB, mode 3, red major (11)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\x60', '\x29', '\x99', '\xe9', '\x23', '\xae', '\x2e',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x70c0, 0x5f88, 0x6c00, 0x3c00}, {0x713e, 0x60cf, 0x6d2f, 0x3c00},
+         {0x71c2, 0x6250, 0x6eb0, 0x3c00}, {0x7240, 0x6400, 0x7048, 0x3c00}}},
+    {"HDR RGB, mode 4, green major (11)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\x60', '\xf3', '\x64', '\x54', '\x20', '\x1f', '\x77',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x40a8, 0x4454, 0x43b0, 0x3c00}, {0x41f5, 0x4536, 0x4481, 0x3c00},
+         {0x4381, 0x4649, 0x4564, 0x3c00}, {0x44b4, 0x4774, 0x4650, 0x3c00}}},
+    {"HDR RGB, mode 5, blue major (11)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\x60', '\x4b', '\x27', '\xfd', '\x5c', '\xa5', '\xe4',
+         '\x01', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x1ae8, 0x1818, 0x1ce0, 0x3c00}, {0x1ef5, 0x1c9d, 0x2134, 0x3c00},
+         {0x233f, 0x217e, 0x25bc, 0x3c00}, {0x274c, 0x2630, 0x2a10, 0x3c00}}},
+    {"HDR RGB, mode 6, red major (11)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\x60', '\xc5', '\xc6', '\x56', '\xb1', '\x0b', '\xe0',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x27f6, 0x2638, 0x2578, 0x3c00}, {0x28bd, 0x276b, 0x2652, 0x3c00},
+         {0x29cc, 0x287d, 0x2753, 0x3c00}, {0x2ad4, 0x2978, 0x283c, 0x3c00}}},
+    {"HDR RGB, mode 7, green major (11)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\x60', '\x57', '\x38', '\x3b', '\xfd', '\x1f', '\x6f',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x1ede, 0x205a, 0x1e90, 0x3c00}, {0x1f6b, 0x2091, 0x1ec2, 0x3c00},
+         {0x1ffe, 0x20ce, 0x1f03, 0x3c00}, {0x2054, 0x2118, 0x1f42, 0x3c00}}},
+    {"HDR RGB, direct (11)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\x60', '\x43', '\x7a', '\x7f', '\xca', '\xc8', '\xd5',
+         '\x01', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x1060, 0x1f60, 0x6400, 0x3c00}, {0x29d8, 0x257c, 0x65b8, 0x3c00},
+         {0x44ae, 0x2c33, 0x6806, 0x3c00}, {0x5e40, 0x3240, 0x69c0, 0x3c00}}},
+    {"HDR RGB, mode 3, red major, clamped (11)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\x60', '\xd7', '\x54', '\x83', '\xaf', '\x4c', '\xdc',
+         '\x00', '\x00', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x0018, 0x0000, 0x0000, 0x3c00}, {0x045a, 0x0179, 0x009d, 0x3c00},
+         {0x08c7, 0x0368, 0x016e, 0x3c00}, {0x0d20, 0x0500, 0x0240, 0x3c00}}},
+    {"HDR RGB + LDR alpha (14)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\xc0', '\x29', '\x54', '\xe5', '\xcc', '\x19', '\x8f',
+         '\xc4', '\x47', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x5680, 0x5a60, 0x57c4, 0x3b17}, {0x58eb, 0x5c99, 0x59e1, 0x3920},
+         {0x5ba1, 0x5ed8, 0x5c6b, 0x3621}, {0x5de0, 0x6100, 0x5ea0, 0x3064}}},
+    {"HDR RGB + LDR alpha, direct (14)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\xc0', '\xa3', '\xdd', '\xba', '\x19', '\x8f', '\x69',
+         '\xd5', '\xf8', '\x01', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x6860, 0x6e40, 0x46c0, 0x36a7}, {0x5831, 0x60f6, 0x4093, 0x38d4},
+         {0x470d, 0x531c, 0x39fc, 0x3a67}, {0x36c0, 0x45c0, 0x3400, 0x3be8}}},
+    {"HDR RGBA, alpha mode 0 (15)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\xe0', '\x2d', '\x5d', '\x87', '\x90', '\x02', '\x4a',
+         '\xd6', '\x10', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x19c0, 0x08c0, 0x0e80, 0x3540}, {0x1d86, 0x0ca4, 0x103b, 0x3690},
+         {0x217a, 0x10ab, 0x11b1, 0x3824}, {0x2540, 0x1490, 0x1360, 0x3940}}},
+    {"HDR RGBA, alpha mode 1 (15)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\xe0', '\xbd', '\x38', '\x21', '\xa3', '\xe6', '\x41',
+         '\x60', '\xb7', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x47d8, 0x4830, 0x41e0, 0x4c00}, {0x485e, 0x4926, 0x41b6, 0x4b7c},
+         {0x48e2, 0x4a5a, 0x418a, 0x4af3}, {0x4980, 0x4bb0, 0x4160, 0x4a80}}},
+    {"HDR RGBA, alpha mode 2 (15)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\xe0', '\x07', '\xe7', '\x3d', '\x4e', '\x5b', '\x7a',
+         '\x1b', '\xe8', '\x01', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x1280, 0x143c, 0x14c0, 0x7160}, {0x13ab, 0x14ba, 0x15cc, 0x718a},
+         {0x1493, 0x1568, 0x16ed, 0x71b6}, {0x1580, 0x1610, 0x1824, 0x71e0}}},
+    {"HDR RGBA, alpha mode 3 (15)",
+        CompressedPixelFormat::Astc4x4RGBAF,
+        {'\x42', '\xe0', '\xc9', '\xca', '\xcd', '\xc9', '\x35', '\xf6',
+         '\x44', '\xcd', '\x01', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA16F,
+        {},
+        {{0x37f6, 0x35b8, 0x36c0, 0x21c0}, {0x38c1, 0x3716, 0x37fb, 0x383c},
+         {0x39d7, 0x3879, 0x38c4, 0x4f9c}, {0x3ae8, 0x39b0, 0x39c0, 0x65c0}}},
+    {"HDR RGBA in a LDR format (15)",
+        CompressedPixelFormat::Astc4x4RGBAUnorm,
+        {'\x42', '\xe0', '\x2d', '\x5d', '\x87', '\x90', '\x02', '\x4a',
+         '\xd6', '\x10', '\x00', '\x00', '\x27', '\x27', '\x27', '\x27'},
+        PixelFormat::RGBA8Unorm,
+        {{0xff, 0x00, 0xff, 0xff}, {0xff, 0x00, 0xff, 0xff},
+         {0xff, 0x00, 0xff, 0xff}, {0xff, 0x00, 0xff, 0xff}}, {}},
+};
+
+/* Blocks exercising integer sequence encoding with trits and quints, weight
+   grid infill, dual planes and partitioning, verified the same way as
+   EndpointModeData above */
+const Color4ub BlockFeaturesTritsExpected[]{
+    {0x36, 0x36, 0x36, 0x0d}, {0x48, 0x48, 0x48, 0xe2}, {0x4b, 0x4b, 0x4b, 0xe4}, {0x4c, 0x4c, 0x4c, 0xe5},
+    {0x46, 0x46, 0x46, 0xdf}, {0x49, 0x49, 0x49, 0xe2}, {0x4a, 0x4a, 0x4a, 0xe3}, {0x49, 0x49, 0x49, 0xe2},
+    {0x46, 0x46, 0x46, 0xdf}, {0x4b, 0x4b, 0x4b, 0xe4}, {0x93, 0x93, 0x93, 0x47}, {0x61, 0x61, 0x61, 0x28},
+    {0x36, 0x36, 0x36, 0x0d}, {0xb5, 0xb5, 0xb5, 0x5c}, {0xc4, 0xc4, 0xc4, 0x65}, {0x61, 0x61, 0x61, 0x28}
+};
+const Color4ub BlockFeaturesQuintsExpected[]{
+    {0x44, 0x44, 0x44, 0x7c}, {0x66, 0x7e, 0x8a, 0xff}, {0x1f, 0x1f, 0x1f, 0x69}, {0x47, 0x47, 0x47, 0x6c},
+    {0x2c, 0x37, 0x3b, 0xff}, {0x55, 0x55, 0x55, 0x6d}, {0x55, 0x55, 0x55, 0x6d}, {0x47, 0x47, 0x47, 0x6c},
+    {0x56, 0x56, 0x56, 0x80}, {0x2c, 0x2c, 0x2c, 0x6a}, {0x32, 0x32, 0x32, 0x6b}, {0x5b, 0x5b, 0x5b, 0x6e},
+    {0x47, 0x47, 0x47, 0x6c}, {0x3a, 0x3a, 0x3a, 0x6b}, {0x27, 0x27, 0x27, 0x6a}, {0x0d, 0x0d, 0x0d, 0x68}
+};
+const Color4ub BlockFeaturesDualPlaneExpected[]{
+    {0x52, 0x89, 0x64, 0x8b}, {0x4a, 0x81, 0x86, 0x94}, {0x59, 0x90, 0x7e, 0x84}, {0x60, 0x97, 0x6c, 0x7c},
+    {0x54, 0x8b, 0x6a, 0x89}, {0x4d, 0x83, 0x79, 0x91}, {0x52, 0x89, 0x80, 0x8b}, {0x55, 0x8c, 0x65, 0x88},
+    {0x57, 0x8d, 0x70, 0x86}, {0x50, 0x86, 0x69, 0x8e}, {0x4a, 0x81, 0x83, 0x94}, {0x47, 0x7d, 0x5b, 0x97},
+    {0x59, 0x90, 0x75, 0x84}, {0x52, 0x89, 0x5c, 0x8b}, {0x44, 0x79, 0x86, 0x9b}, {0x3d, 0x72, 0x54, 0xa3}
+};
+const Color4ub BlockFeaturesFourPartitionsExpected[]{
+    {0x59, 0x59, 0x59, 0xa2}, {0x1a, 0x00, 0xbf, 0xff}, {0x23, 0x23, 0x23, 0xff}, {0x15, 0x00, 0x9a, 0xff},
+    {0x54, 0x54, 0x54, 0xc7}, {0x15, 0x00, 0x9a, 0xff}, {0x23, 0x23, 0x23, 0xff}, {0x6b, 0x6b, 0x6b, 0x25},
+    {0x6b, 0x6b, 0x6b, 0x25}, {0x16, 0x00, 0xa3, 0xff}, {0x17, 0x00, 0xac, 0xff}, {0x71, 0x71, 0x71, 0x00},
+    {0x59, 0x59, 0x59, 0xa2}, {0x54, 0x54, 0x54, 0xc7}, {0x6b, 0x6b, 0x6b, 0x25}, {0x54, 0x54, 0x54, 0xc7}
+};
+const Color4ub BlockFeaturesGridSmallerThanBlockExpected[]{
+    {0x00, 0x76, 0x13, 0xff}, {0x00, 0x80, 0x15, 0xff}, {0x00, 0x59, 0x0e, 0xff}, {0x00, 0x59, 0x0e, 0xff},
+    {0x12, 0x12, 0x12, 0xf4}, {0x12, 0x12, 0x12, 0xef}, {0x00, 0xb9, 0x1e, 0xff}, {0x00, 0xbb, 0x1e, 0xff},
+    {0x00, 0x88, 0x16, 0xff}, {0x00, 0x71, 0x12, 0xff}, {0x00, 0x8a, 0x16, 0xff}, {0x12, 0x12, 0x12, 0xfb},
+    {0x00, 0xb4, 0x1d, 0xff}, {0x00, 0xcd, 0x21, 0xff}, {0x00, 0x94, 0x18, 0xff}, {0x00, 0x74, 0x13, 0xff},
+    {0x00, 0x8d, 0x17, 0xff}, {0x00, 0xd6, 0x23, 0xff}, {0x00, 0x99, 0x19, 0xff}, {0x00, 0xc8, 0x20, 0xff},
+    {0x00, 0x9e, 0x19, 0xff}, {0x00, 0x83, 0x15, 0xff}, {0x00, 0x9b, 0x19, 0xff}, {0x00, 0xd2, 0x22, 0xff},
+    {0x00, 0xa3, 0x1a, 0xff}, {0x00, 0xd2, 0x22, 0xff}, {0x00, 0xc0, 0x1f, 0xff}, {0x00, 0xc0, 0x1f, 0xff},
+    {0x00, 0xdb, 0x24, 0xff}, {0x00, 0xdb, 0x24, 0xff}
+};
+const Color4ub BlockFeaturesGrid3DExpected[]{
+    {0x39, 0xf0, 0xe0, 0x67}, {0x31, 0xe3, 0xb1, 0x3f}, {0x29, 0xd5, 0x81, 0x16}, {0x38, 0xef, 0xdc, 0x64},
+    {0x33, 0xe6, 0xbb, 0x48}, {0x2b, 0xd8, 0x8c, 0x1f}, {0x38, 0xee, 0xd7, 0x60}, {0x32, 0xe5, 0xb7, 0x44},
+    {0x2d, 0xdc, 0x97, 0x29}, {0x31, 0xe3, 0xb1, 0x3f}, {0x38, 0xef, 0xda, 0x62}, {0x30, 0xe1, 0xaa, 0x39},
+    {0x3a, 0xf2, 0xe4, 0x6b}, {0x36, 0xea, 0xca, 0x55}, {0x2e, 0xdd, 0x9b, 0x2c}, {0x39, 0xf0, 0xe0, 0x67},
+    {0x35, 0xe9, 0xc6, 0x51}, {0x2f, 0xe0, 0xa6, 0x35}, {0x29, 0xd5, 0x81, 0x16}, {0x30, 0xe1, 0xaa, 0x39},
+    {0x37, 0xed, 0xd3, 0x5c}, {0x32, 0xe4, 0xb5, 0x42}, {0x2e, 0xdd, 0x9b, 0x2c}, {0x34, 0xe8, 0xc4, 0x4f},
+    {0x3b, 0xf3, 0xe9, 0x6f}, {0x36, 0xeb, 0xcf, 0x59}, {0x32, 0xe4, 0xb5, 0x42}
+};
+const Color4ub BlockFeaturesGrid3DDualPlaneExpected[]{
+    {0xcf, 0xb1, 0xb1, 0xff}, {0xa6, 0xc6, 0xc6, 0xff}, {0x9c, 0xc6, 0xc6, 0xff}, {0xb1, 0xb1, 0xb1, 0xff},
+    {0xcf, 0xa8, 0xa8, 0xff}, {0xa6, 0xbc, 0xbc, 0xff}, {0x9c, 0xbc, 0xbc, 0xff}, {0xb1, 0xa8, 0xa8, 0xff},
+    {0xcf, 0x9c, 0x9c, 0xff}, {0xa6, 0xb1, 0xb1, 0xff}, {0x9c, 0xb1, 0xb1, 0xff}, {0xb1, 0x9c, 0x9c, 0xff},
+    {0xcf, 0x93, 0x93, 0xff}, {0xa6, 0xa8, 0xa8, 0xff}, {0x9c, 0xa8, 0xa8, 0xff}, {0xb1, 0x93, 0x93, 0xff},
+    {0xbb, 0xb1, 0xb1, 0xff}, {0xbb, 0x9c, 0x9c, 0xff}, {0xa8, 0xb9, 0xb9, 0xff}, {0xb1, 0xc6, 0xc6, 0xff},
+    {0xb1, 0xa8, 0xa8, 0xff}, {0xb1, 0xaf, 0xaf, 0xff}, {0x9e, 0xa6, 0xa6, 0xff}, {0xa8, 0xb3, 0xb3, 0xff},
+    {0xa6, 0x9c, 0x9c, 0xff}, {0xa6, 0xc6, 0xc6, 0xff}, {0x93, 0xbc, 0xbc, 0xff}, {0x9c, 0x9c, 0x9c, 0xff},
+    {0xa6, 0x93, 0x93, 0xff}, {0xa6, 0xbc, 0xbc, 0xff}, {0x93, 0xb3, 0xb3, 0xff}, {0x9c, 0x93, 0x93, 0xff},
+    {0xb1, 0xa8, 0xa8, 0xff}, {0xb1, 0xa6, 0xa6, 0xff}, {0xb1, 0x9c, 0x9c, 0xff}, {0xb1, 0xc6, 0xc6, 0xff},
+    {0xbb, 0xa8, 0xa8, 0xff}, {0xa8, 0xaf, 0xaf, 0xff}, {0xbb, 0x93, 0x93, 0xff}, {0xbb, 0xbc, 0xbc, 0xff},
+    {0xaf, 0x9c, 0x9c, 0xff}, {0x9c, 0xc6, 0xc6, 0xff}, {0xaf, 0xaa, 0xaa, 0xff}, {0xaf, 0xa6, 0xa6, 0xff},
+    {0xa6, 0x93, 0x93, 0xff}, {0x93, 0xbc, 0xbc, 0xff}, {0xa6, 0xbc, 0xbc, 0xff}, {0xa6, 0x93, 0x93, 0xff},
+    {0xb1, 0x93, 0x93, 0xff}, {0xb1, 0xa8, 0xa8, 0xff}, {0xb1, 0xb1, 0xb1, 0xff}, {0xb1, 0xb1, 0xb1, 0xff},
+    {0xbb, 0x93, 0x93, 0xff}, {0xa8, 0xb1, 0xb1, 0xff}, {0xbb, 0xa8, 0xa8, 0xff}, {0xbb, 0xa8, 0xa8, 0xff},
+    {0xc6, 0x93, 0x93, 0xff}, {0x9c, 0xbc, 0xbc, 0xff}, {0xaf, 0xb3, 0xb3, 0xff}, {0xc6, 0x9c, 0x9c, 0xff},
+    {0xcf, 0x93, 0x93, 0xff}, {0xa6, 0xbc, 0xbc, 0xff}, {0xa6, 0xbc, 0xbc, 0xff}, {0xcf, 0x93, 0x93, 0xff}
+};
+
+const struct {
+    const char* name;
+    CompressedPixelFormat format;
+    Vector3i size;
+    char block[16];
+    Containers::ArrayView<const Color4ub> expected;
+} BlockFeatureData[]{
+    {"trit weights, trit colors, 3x3 grid",
+        CompressedPixelFormat::Astc4x4RGBAUnorm, {4, 4, 1},
+        {'\xaf', '\xeb', '\xb4', '\xee', '\x82', '\x5b', '\x4e', '\x23',
+         '\xe3', '\x27', '\xce', '\x0d', '\x49', '\x7f', '\x9f', '\x9f'},
+        BlockFeaturesTritsExpected},
+    {"quint weights, quint colors",
+        CompressedPixelFormat::Astc4x4RGBAUnorm, {4, 4, 1},
+        {'\xde', '\x11', '\xb1', '\xce', '\xbb', '\x47', '\xa5', '\xd0',
+         '\x72', '\x4e', '\x3d', '\xde', '\x70', '\x67', '\x0a', '\xad'},
+        BlockFeaturesQuintsExpected},
+    {"dual plane, 4x2 grid",
+        CompressedPixelFormat::Astc4x4RGBAUnorm, {4, 4, 1},
+        {'\x13', '\x84', '\xc1', '\x98', '\x52', '\x3f', '\x79', '\x15',
+         '\xbd', '\xb5', '\xe0', '\xc4', '\xa4', '\x5e', '\x3b', '\x2b'},
+        BlockFeaturesDualPlaneExpected},
+    {"four partitions",
+        CompressedPixelFormat::Astc4x4RGBAUnorm, {4, 4, 1},
+        {'\x43', '\xb8', '\xe3', '\x4e', '\xd0', '\xa5', '\xa1', '\x18',
+         '\x31', '\xb1', '\xd8', '\xe3', '\x48', '\xca', '\x10', '\xdb'},
+        BlockFeaturesFourPartitionsExpected},
+    {"5x4 grid in a 6x5 block",
+        CompressedPixelFormat::Astc6x5RGBAUnorm, {6, 5, 1},
+        {'\xd1', '\x0a', '\x7c', '\x11', '\x8e', '\x02', '\x57', '\x44',
+         '\xa3', '\xd7', '\xa4', '\xcd', '\x9a', '\x6a', '\x0a', '\x65'},
+        BlockFeaturesGridSmallerThanBlockExpected},
+    {"2x2x2 grid in a 3x3x3 block",
+        CompressedPixelFormat::Astc3x3x3RGBAUnorm, {3, 3, 3},
+        {'\x13', '\x82', '\x4d', '\x7a', '\x9e', '\xed', '\xd9', '\xea',
+         '\x09', '\xf4', '\x6c', '\xe1', '\x74', '\xaa', '\x06', '\x5d'},
+        BlockFeaturesGrid3DExpected},
+    {"3x2x3 grid in a 4x4x4 block, dual plane",
+        CompressedPixelFormat::Astc4x4x4RGBAUnorm, {4, 4, 4},
+        {'\x35', '\x04', '\x9e', '\x27', '\x11', '\xb3', '\x73', '\x59',
+         '\xc8', '\x78', '\xad', '\x3e', '\xb9', '\x6f', '\x97', '\x83'},
+        BlockFeaturesGrid3DDualPlaneExpected},
+};
+
+const struct {
+    const char* name;
+    CompressedPixelFormat format;
+    Int threads;
+    ImageConverterFlags flags;
+} ThreadsData[]{
+    {"4x4, 2 threads", CompressedPixelFormat::Astc4x4RGBAUnorm, 2, {}},
+    {"10x6, 3 threads", CompressedPixelFormat::Astc10x6RGBASrgb, 3, {}},
+    {"3x3x3, 3 threads", CompressedPixelFormat::Astc3x3x3RGBAF, 3, {}},
+    {"12x12, more threads than block rows", CompressedPixelFormat::Astc12x12RGBAUnorm, 64, {}},
+    {"5x5, hardware concurrency", CompressedPixelFormat::Astc5x5RGBAUnorm, 0, {}},
+    {"5x5, hardware concurrency, verbose", CompressedPixelFormat::Astc5x5RGBAUnorm, 0, ImageConverterFlag::Verbose},
+};
+
+AstcDecImageConverterTest::AstcDecImageConverterTest() {
+    addInstancedTests({&AstcDecImageConverterTest::test},
+        Containers::arraySize(TestData));
+
+    addInstancedTests({&AstcDecImageConverterTest::test3D},
+        Containers::arraySize(Test3DData));
+
+    addInstancedTests({&AstcDecImageConverterTest::singleBlock},
+        Containers::arraySize(SingleBlockData));
+
+    addInstancedTests({&AstcDecImageConverterTest::endpointModes},
+        Containers::arraySize(EndpointModeData));
+
+    addInstancedTests({&AstcDecImageConverterTest::blockFeatures},
+        Containers::arraySize(BlockFeatureData));
+
+    addInstancedTests({&AstcDecImageConverterTest::threads},
+        Containers::arraySize(ThreadsData));
+
+    addTests({&AstcDecImageConverterTest::threadsInvalid,
+              &AstcDecImageConverterTest::preserveFlags,
+
+              &AstcDecImageConverterTest::unsupportedFormat,
+              &AstcDecImageConverterTest::unsupportedStorage,
+              &AstcDecImageConverterTest::threeDimensionalBlock2DImage});
+
+    /* Load the plugin directly from the build tree. Otherwise it's static and
+       already loaded. */
+    #ifdef ASTCDECIMAGECONVERTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(ASTCDECIMAGECONVERTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+    #ifdef ASTCIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_importerManager.load(ASTCIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+    #ifdef STBIMAGEIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_importerManager.load(STBIMAGEIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+}
+
+void AstcDecImageConverterTest::test() {
+    auto&& data = TestData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(_importerManager.loadState("AstcImporter") == PluginManager::LoadState::NotFound)
+        CORRADE_SKIP("AstcImporter plugin not found, cannot test conversion");
+
+    Containers::Pointer<AbstractImporter> importer = _importerManager.instantiate("AstcImporter");
+    /* The ASTC files are not with Y up but we don't want the plugin to warn,
+       instead the expected image is flipped to Y down on load */
+    /** @todo clean this up once it's possible to configure Y flipping behavior
+        via a flag */
+    importer->configuration().setValue("assumeYUpZBackward", true);
+    if(data.format)
+        importer->configuration().setValue("format", data.format);
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(ASTCIMPORTER_TEST_DIR, data.file)));
+
+    Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_VERIFY(image->isCompressed());
+    CORRADE_COMPARE(image->compressedFormat(), data.expectedCompressedFormat);
+
+    Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("AstcDecImageConverter");
+    Containers::Optional<Trade::ImageData2D> converted = converter->convert(*image);
+    CORRADE_VERIFY(converted);
+    CORRADE_VERIFY(!converted->isCompressed());
+    CORRADE_COMPARE(converted->format(), data.expectedFormat);
+    CORRADE_COMPARE(converted->size(), image->size());
+
+    if(_importerManager.loadState("StbImageImporter") == PluginManager::LoadState::NotFound)
+        CORRADE_SKIP("StbImageImporter plugin not found, cannot compare converted output");
+
+    /* Not using CompareImageToFile as we need to Y-flip the expected image
+       and override its format */
+    Containers::Pointer<AbstractImporter> expectedImporter = _importerManager.instantiate("StbImageImporter");
+    CORRADE_VERIFY(expectedImporter->openFile(Utility::Path::join(BASISIMPORTER_TEST_DIR, data.expected)));
+    Containers::Optional<Trade::ImageData2D> expectedImage = expectedImporter->image2D(0);
+    CORRADE_VERIFY(expectedImage);
+    Utility::flipInPlace<0>(expectedImage->mutablePixels());
+    CORRADE_COMPARE_WITH(*converted,
+        (ImageView2D{expectedImage->storage(), data.expectedFormat, expectedImage->size(), expectedImage->data()}),
+        (DebugTools::CompareImage{data.maxThreshold, data.meanThreshold}));
+}
+
+void AstcDecImageConverterTest::test3D() {
+    auto&& data = Test3DData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(_importerManager.loadState("AstcImporter") == PluginManager::LoadState::NotFound)
+        CORRADE_SKIP("AstcImporter plugin not found, cannot test conversion");
+
+    Containers::Pointer<AbstractImporter> importer = _importerManager.instantiate("AstcImporter");
+    /* Same as in test(), the expected slices are flipped instead. The Z
+       direction matches the order of the slices already. */
+    importer->configuration().setValue("assumeYUpZBackward", true);
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(ASTCIMPORTER_TEST_DIR, data.file)));
+
+    Containers::Optional<Trade::ImageData3D> image = importer->image3D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_VERIFY(image->isCompressed());
+    CORRADE_COMPARE(image->compressedFormat(), data.expectedCompressedFormat);
+    CORRADE_COMPARE(image->flags(), data.expectedFlags);
+    CORRADE_COMPARE(image->size(), data.expectedSize);
+
+    Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("AstcDecImageConverter");
+    Containers::Optional<Trade::ImageData3D> converted = converter->convert(*image);
+    CORRADE_VERIFY(converted);
+    CORRADE_VERIFY(!converted->isCompressed());
+    CORRADE_COMPARE(converted->format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(converted->size(), data.expectedSize);
+    CORRADE_COMPARE(converted->flags(), data.expectedFlags);
+
+    if(_importerManager.loadState("StbImageImporter") == PluginManager::LoadState::NotFound)
+        CORRADE_SKIP("StbImageImporter plugin not found, cannot compare converted output");
+
+    /* Compare each slice separately. The output contains whole blocks, so
+       the slice stride is given by the row length and image height. */
+    const std::size_t sliceSize = converted->storage().rowLength()*converted->storage().imageHeight()*4;
+    for(Int i = 0; i != data.expectedSize.z(); ++i) {
+        CORRADE_ITERATION(i);
+        Containers::Pointer<AbstractImporter> expectedImporter = _importerManager.instantiate("StbImageImporter");
+        CORRADE_VERIFY(expectedImporter->openFile(Utility::Path::join(BASISIMPORTER_TEST_DIR, data.expected[i])));
+        Containers::Optional<Trade::ImageData2D> expectedImage = expectedImporter->image2D(0);
+        CORRADE_VERIFY(expectedImage);
+        Utility::flipInPlace<0>(expectedImage->mutablePixels());
+        CORRADE_COMPARE_WITH(
+            (ImageView2D{converted->storage(), converted->format(), converted->size().xy(), converted->data().exceptPrefix(i*sliceSize)}),
+            *expectedImage,
+            (DebugTools::CompareImage{data.maxThreshold, data.meanThreshold}));
+    }
+}
+
+void AstcDecImageConverterTest::singleBlock() {
+    auto&& data = SingleBlockData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("AstcDecImageConverter");
+    if(data.hdrToFloat)
+        converter->configuration().setValue("hdrToFloat", *data.hdrToFloat);
+
+    Containers::Optional<ImageData2D> converted = converter->convert(CompressedImageView2D{data.format, {4, 4}, data.block});
+    CORRADE_VERIFY(converted);
+    CORRADE_COMPARE(converted->format(), data.expectedFormat);
+    CORRADE_COMPARE(converted->size(), (Vector2i{4, 4}));
+
+    /* Comparing the pixels bitwise so the NaN case can be checked as well.
+       The output is exactly one block, so there's no padding to skip. */
+    if(data.expectedFormat == PixelFormat::RGBA16F) {
+        Vector4us expected[16];
+        for(Vector4us& i: expected) i = {
+            data.expected16.x().data(),
+            data.expected16.y().data(),
+            data.expected16.z().data(),
+            data.expected16.w().data()};
+        CORRADE_COMPARE_AS(Containers::arrayCast<const Vector4us>(converted->data()),
+            Containers::arrayView(expected),
+            TestSuite::Compare::Container);
+    } else if(data.expectedFormat == PixelFormat::RGBA32F) {
+        Vector4 expected[16];
+        for(Vector4& i: expected) i = data.expected32;
+        CORRADE_COMPARE_AS(Containers::arrayCast<const Vector4>(converted->data()),
+            Containers::arrayView(expected),
+            TestSuite::Compare::Container);
+    } else {
+        Color4ub expected[16];
+        for(Color4ub& i: expected) i = data.expected8;
+        CORRADE_COMPARE_AS(Containers::arrayCast<const Color4ub>(converted->data()),
+            Containers::arrayView(expected),
+            TestSuite::Compare::Container);
+    }
+}
+
+void AstcDecImageConverterTest::endpointModes() {
+    auto&& data = EndpointModeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("AstcDecImageConverter");
+    Containers::Optional<ImageData2D> converted = converter->convert(CompressedImageView2D{data.format, {4, 4}, data.block});
+    CORRADE_VERIFY(converted);
+    CORRADE_COMPARE(converted->format(), data.expectedFormat);
+    CORRADE_COMPARE(converted->size(), (Vector2i{4, 4}));
+
+    for(std::size_t y = 0; y != 4; ++y) {
+        CORRADE_ITERATION(y);
+        if(data.expectedFormat == PixelFormat::RGBA16F) {
+            CORRADE_COMPARE_AS(Containers::arrayCast<const Vector4us>(converted->data()).slice(y*4, y*4 + 4),
+                Containers::arrayView(data.expected16),
+                TestSuite::Compare::Container);
+        } else {
+            CORRADE_COMPARE_AS(Containers::arrayCast<const Color4ub>(converted->data()).slice(y*4, y*4 + 4),
+                Containers::arrayView(data.expected8),
+                TestSuite::Compare::Container);
+        }
+    }
+}
+
+void AstcDecImageConverterTest::blockFeatures() {
+    auto&& data = BlockFeatureData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("AstcDecImageConverter");
+    Containers::Optional<ImageData3D> converted = converter->convert(CompressedImageView3D{data.format, data.size, data.block});
+    CORRADE_VERIFY(converted);
+    CORRADE_COMPARE(converted->format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(converted->size(), data.size);
+
+    /* The output is exactly one block, so there's no padding to skip */
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Color4ub>(converted->data()),
+        data.expected,
+        TestSuite::Compare::Container);
+}
+
+void AstcDecImageConverterTest::threads() {
+    auto&& data = ThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Blocks with arbitrary contents in two slices (or two layers of 3D
+       blocks), which gives at least 6 rows of blocks to distribute across
+       threads. A lot of the blocks will be invalid, but that's fine as the
+       error color is deterministic as well. */
+    const Vector3i blockSize = compressedPixelFormatBlockSize(data.format);
+    const Vector3i blockCount{3, 3, 2};
+    Containers::Array<char> blocks{NoInit, std::size_t(blockCount.product()*16)};
+    for(std::size_t i = 0; i != blocks.size(); ++i)
+        blocks[i] = i*37 + i/7 + 11;
+    const CompressedImageView3D image{data.format, blockSize*blockCount, blocks};
+
+    Containers::Pointer<AbstractImageConverter> serialConverter = _manager.instantiate("AstcDecImageConverter");
+    /* Single-threaded is the default */
+    CORRADE_COMPARE(serialConverter->configuration().value<Int>("threads"), 1);
+    Containers::Optional<ImageData3D> expected = serialConverter->convert(image);
+    CORRADE_VERIFY(expected);
+
+    Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("AstcDecImageConverter");
+    converter->addFlags(data.flags);
+    converter->configuration().setValue("threads", data.threads);
+
+    Containers::String out;
+    Containers::Optional<ImageData3D> converted;
+    {
+        Debug redirectOutput{&out};
+        converted = converter->convert(image);
+    }
+    CORRADE_VERIFY(converted);
+    if(data.flags & ImageConverterFlag::Verbose)
+        CORRADE_COMPARE(out, Utility::format("Trade::AstcDecImageConverter::convert(): autodetected hardware concurrency to {} threads\n", std::thread::hardware_concurrency()));
+    else
+        CORRADE_COMPARE(out, "");
+
+    /* The output should be bit-exact regardless of the thread count */
+    CORRADE_COMPARE(converted->format(), expected->format());
+    CORRADE_COMPARE(converted->size(), expected->size());
+    CORRADE_COMPARE_AS(converted->data(), expected->data(),
+        TestSuite::Compare::Container);
+}
+
+void AstcDecImageConverterTest::threadsInvalid() {
+    Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("AstcDecImageConverter");
+    converter->configuration().setValue("threads", -3);
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convert(CompressedImageView2D{CompressedPixelFormat::Astc4x4RGBAUnorm, {1, 1}, "123456789abcdef"}));
+    CORRADE_COMPARE(out, "Trade::AstcDecImageConverter::convert(): expected threads to be zero or positive but got -3\n");
+}
+
+void AstcDecImageConverterTest::preserveFlags() {
+    Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("AstcDecImageConverter");
+
+    /* Just verify that the flags don't get lost in the process. Everything
+       else is tested well enough above. */
+    Containers::Optional<ImageData2D> converted = converter->convert(CompressedImageView2D{CompressedPixelFormat::Astc4x4RGBAUnorm, {1, 1}, "yeyhey! this is!", ImageFlag2D::Array});
+    CORRADE_VERIFY(converted);
+    CORRADE_COMPARE(converted->flags(), ImageFlag2D::Array);
+}
+
+void AstcDecImageConverterTest::unsupportedFormat() {
+    Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("AstcDecImageConverter");
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convert(CompressedImageView2D{CompressedPixelFormat::Bc1RGBAUnorm, {1, 1}, "1234567"}));
+    CORRADE_COMPARE(out, "Trade::AstcDecImageConverter::convert(): unsupported format CompressedPixelFormat::Bc1RGBAUnorm\n");
+}
+
+void AstcDecImageConverterTest::unsupportedStorage() {
+    Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("AstcDecImageConverter");
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convert(CompressedImageView2D{CompressedPixelStorage{}.setCompressedBlockDataSize(16), CompressedPixelFormat::Astc4x4RGBAUnorm, {1, 1}, "123456789abcdef"}));
+    CORRADE_COMPARE(out, "Trade::AstcDecImageConverter::convert(): non-default compressed storage is not supported\n");
+}
+
+void AstcDecImageConverterTest::threeDimensionalBlock2DImage() {
+    Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("AstcDecImageConverter");
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convert(CompressedImageView2D{CompressedPixelFormat::Astc3x3x3RGBAUnorm, {1, 1}, "123456789abcdef"}));
+    CORRADE_COMPARE(out, "Trade::AstcDecImageConverter::convert(): can't decode a 2D image with a 3D block format CompressedPixelFormat::Astc3x3x3RGBAUnorm\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::AstcDecImageConverterTest)
@@ -26,23 +26,37 @@
 
 #include "BcDecImageConverter.h"
 
+#include <cstring>
+#include <thread> /* std::thread::hardware_concurrency(), sigh */
+#include <Corrade/Cpu.h>
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Utility/ConfigurationGroup.h>
+#include <Corrade/Utility/Debug.h>
 #include <Magnum/ImageView.h>
 #include <Magnum/PixelFormat.h>
+#include <Magnum/Math/Functions.h>
+#include <Magnum/Math/Vector3.h>
 #include <Magnum/Trade/ImageData.h>
 
 #define BCDEC_IMPLEMENTATION
 #include "bcdec.h"
 
+#ifdef CORRADE_ENABLE_SSE41
+#include <smmintrin.h>
+#endif
+
 namespace Magnum { namespace Trade {
 
 using namespace Containers::Literals;
 
 BcDecImageConverter::BcDecImageConverter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): AbstractImageConverter{manager, plugin} {}
 
-ImageConverterFeatures BcDecImageConverter::doFeatures() const { return ImageConverterFeature::ConvertCompressed2D; }
+ImageConverterFeatures BcDecImageConverter::doFeatures() const {
+    return ImageConverterFeature::ConvertCompressed2D|
+           ImageConverterFeature::ConvertCompressed3D;
+}
 
 namespace {
 
@@ -65,10 +79,218 @@ template<void(*decodeBlock)(const void*, void*, int, int), bool isSigned, int ty
     decodeBlock(src, dst, rowStride/typeSize, isSigned);
 }
 
+#ifdef CORRADE_ENABLE_SSE41
+/* SSE4.1 variants of the BC1, BC3, BC4 and BC5 decoders. The palette
+   calculation stays scalar, as it's just a few operations per block, but the
+   per-pixel index extraction and palette lookup for all 16 pixels of a block
+   is done at once with byte shuffles. The output is bit-exact with bcdec. */
+
+/* Same reference color calculation as in bcdec__color_block(), only the
+   index lookup is vectorized */
+CORRADE_ENABLE_SSE41 CORRADE_ALWAYS_INLINE void decodeColorBlockSse41(const char* src, __m128i(&rows)[4], const bool onlyOpaqueMode) {
+    UnsignedShort c[2];
+    std::memcpy(c, src, sizeof(c));
+    const UnsignedInt r0 = (c[0] >> 11) & 0x1f;
+    const UnsignedInt g0 = (c[0] >> 5) & 0x3f;
+    const UnsignedInt b0 = c[0] & 0x1f;
+    const UnsignedInt r1 = (c[1] >> 11) & 0x1f;
+    const UnsignedInt g1 = (c[1] >> 5) & 0x3f;
+    const UnsignedInt b1 = c[1] & 0x1f;
+
+    UnsignedInt palette[4];
+    palette[0] = 0xff000000u|(((b0*527 + 23) >> 6) << 16)|(((g0*259 + 33) >> 6) << 8)|((r0*527 + 23) >> 6);
+    palette[1] = 0xff000000u|(((b1*527 + 23) >> 6) << 16)|(((g1*259 + 33) >> 6) << 8)|((r1*527 + 23) >> 6);
+    if(c[0] > c[1] || onlyOpaqueMode) {
+        palette[2] = 0xff000000u|
+            ((((2*b0 + b1)*351 + 61) >> 7) << 16)|
+            ((((2*g0 + g1)*2763 + 1039) >> 11) << 8)|
+            (((2*r0 + r1)*351 + 61) >> 7);
+        palette[3] = 0xff000000u|
+            ((((b0 + 2*b1)*351 + 61) >> 7) << 16)|
+            ((((g0 + 2*g1)*2763 + 1039) >> 11) << 8)|
+            (((r0 + 2*r1)*351 + 61) >> 7);
+    } else {
+        palette[2] = 0xff000000u|
+            ((((b0 + b1)*1053 + 125) >> 8) << 16)|
+            ((((g0 + g1)*4145 + 1019) >> 11) << 8)|
+            (((r0 + r1)*1053 + 125) >> 8);
+        palette[3] = 0;
+    }
+    const __m128i paletteV = _mm_loadu_si128(reinterpret_cast<const __m128i*>(palette));
+
+    /* Each pixel has a 2-bit index, pixel i being at bit 2*i. Multiplying
+       shifts the index of each lane to the top two bits, from where it's
+       shifted down. The index then gets expanded to a byte shuffle mask
+       picking the four bytes of given palette color. */
+    UnsignedInt indices;
+    std::memcpy(&indices, src + 4, sizeof(indices));
+    const __m128i indicesV = _mm_set1_epi32(indices);
+    const __m128i byteOffsets = _mm_set1_epi32(0x03020100);
+    const __m128i byteMultiplier = _mm_set1_epi32(0x04040404);
+    for(UnsignedInt i = 0; i != 4; ++i) {
+        const __m128i multipliers = _mm_setr_epi32(1 << (30 - 8*i), 1 << (28 - 8*i), 1 << (26 - 8*i), 1 << (24 - 8*i));
+        const __m128i index = _mm_srli_epi32(_mm_mullo_epi32(indicesV, multipliers), 30);
+        rows[i] = _mm_shuffle_epi8(paletteV, _mm_add_epi32(_mm_mullo_epi32(index, byteMultiplier), byteOffsets));
+    }
 }
 
-Containers::Optional<ImageData2D> BcDecImageConverter::doConvert(const CompressedImageView2D& image) {
-    const bool bc6hToFloat = configuration().value<bool>("bc6hToFloat");
+/* Same palette calculation as in bcdec__smooth_alpha_block(), returns all 16
+   values of the block in a row-major order */
+CORRADE_ENABLE_SSE41 CORRADE_ALWAYS_INLINE __m128i decodeSmoothAlphaBlockSse41(const char* src) {
+    alignas(16) UnsignedByte palette[16]{};
+    const UnsignedInt a0 = UnsignedByte(src[0]);
+    const UnsignedInt a1 = UnsignedByte(src[1]);
+    palette[0] = a0;
+    palette[1] = a1;
+    if(a0 > a1) {
+        for(UnsignedInt i = 1; i != 7; ++i)
+            palette[i + 1] = ((7 - i)*a0 + i*a1 + 1)/7;
+    } else {
+        for(UnsignedInt i = 1; i != 5; ++i)
+            palette[i + 1] = ((5 - i)*a0 + i*a1 + 1)/5;
+        palette[6] = 0x00;
+        palette[7] = 0xff;
+    }
+
+    /* Pixel i has a 3-bit index at bit 3*i after the two palette bytes. Each
+       16-bit lane gets the two bytes containing the index, which is then
+       shifted to the top three bits by a multiplication and down again. The
+       last byte of the block is never crossed by an index so it's fine that
+       there's only zeros after it. */
+    const __m128i block = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src));
+    const __m128i words0 = _mm_shuffle_epi8(block, _mm_setr_epi8(
+        2, 3, 2, 3, 2, 3, 3, 4, 3, 4, 3, 4, 4, 5, 4, 5));
+    const __m128i words1 = _mm_shuffle_epi8(block, _mm_setr_epi8(
+        5, 6, 5, 6, 5, 6, 6, 7, 6, 7, 6, 7, 7, 8, 7, 8));
+    const __m128i indices0 = _mm_srli_epi16(_mm_mullo_epi16(words0, _mm_setr_epi16(
+        1 << 13, 1 << 10, 1 << 7, 1 << 12, 1 << 9, 1 << 6, 1 << 11, 1 << 8)), 13);
+    const __m128i indices1 = _mm_srli_epi16(_mm_mullo_epi16(words1, _mm_setr_epi16(
+        1 << 13, 1 << 10, 1 << 7, 1 << 12, 1 << 9, 1 << 6, 1 << 11, 1 << 8)), 13);
+    return _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(palette)), _mm_packus_epi16(indices0, indices1));
+}
+
+CORRADE_ENABLE_SSE41 void decodeBc1Sse41(const void* src, void* dst, int rowStride) {
+    __m128i rows[4];
+    decodeColorBlockSse41(static_cast<const char*>(src), rows, false);
+    char* out = static_cast<char*>(dst);
+    for(UnsignedInt i = 0; i != 4; ++i)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i*rowStride), rows[i]);
+}
+
+CORRADE_ENABLE_SSE41 void decodeBc3Sse41(const void* src, void* dst, int rowStride) {
+    __m128i rows[4];
+    decodeColorBlockSse41(static_cast<const char*>(src) + 8, rows, true);
+    const __m128i alpha = decodeSmoothAlphaBlockSse41(static_cast<const char*>(src));
+    const __m128i rgbMask = _mm_set1_epi32(0x00ffffff);
+    const __m128i alphaMasks[4]{
+        _mm_setr_epi8(-1, -1, -1,  0, -1, -1, -1,  1, -1, -1, -1,  2, -1, -1, -1,  3),
+        _mm_setr_epi8(-1, -1, -1,  4, -1, -1, -1,  5, -1, -1, -1,  6, -1, -1, -1,  7),
+        _mm_setr_epi8(-1, -1, -1,  8, -1, -1, -1,  9, -1, -1, -1, 10, -1, -1, -1, 11),
+        _mm_setr_epi8(-1, -1, -1, 12, -1, -1, -1, 13, -1, -1, -1, 14, -1, -1, -1, 15),
+    };
+    char* out = static_cast<char*>(dst);
+    for(UnsignedInt i = 0; i != 4; ++i)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i*rowStride), _mm_or_si128(_mm_and_si128(rows[i], rgbMask), _mm_shuffle_epi8(alpha, alphaMasks[i])));
+}
+
+CORRADE_ENABLE_SSE41 void decodeBc4Sse41(const void* src, void* dst, int rowStride) {
+    alignas(16) char values[16];
+    _mm_store_si128(reinterpret_cast<__m128i*>(values), decodeSmoothAlphaBlockSse41(static_cast<const char*>(src)));
+    char* out = static_cast<char*>(dst);
+    for(UnsignedInt i = 0; i != 4; ++i)
+        std::memcpy(out + i*rowStride, values + i*4, 4);
+}
+
+CORRADE_ENABLE_SSE41 void decodeBc5Sse41(const void* src, void* dst, int rowStride) {
+    const __m128i red = decodeSmoothAlphaBlockSse41(static_cast<const char*>(src));
+    const __m128i green = decodeSmoothAlphaBlockSse41(static_cast<const char*>(src) + 8);
+    const __m128i rows01 = _mm_unpacklo_epi8(red, green);
+    const __m128i rows23 = _mm_unpackhi_epi8(red, green);
+    char* out = static_cast<char*>(dst);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(out + 0*rowStride), rows01);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(out + 1*rowStride), _mm_unpackhi_epi64(rows01, rows01));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(out + 2*rowStride), rows23);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(out + 3*rowStride), _mm_unpackhi_epi64(rows23, rows23));
+}
+#endif
+
+typedef void(*DecodeBlocksFunction)(const Containers::StridedArrayView2D<const char>&, const Containers::StridedArrayView2D<char>&);
+
+/* Block decoders for formats that have a SIMD variant, picked at runtime with
+   a Corrade CPU dispatcher. The scalar variants are always present, the
+   SSE4.1 ones only if the compiler is capable of producing them. */
+DecodeBlocksFunction decodeBc1BlocksImplementation(Cpu::ScalarT) {
+    return decodeBlocks<bcdec_bc1>;
+}
+DecodeBlocksFunction decodeBc3BlocksImplementation(Cpu::ScalarT) {
+    return decodeBlocks<bcdec_bc3>;
+}
+DecodeBlocksFunction decodeBc4BlocksImplementation(Cpu::ScalarT) {
+    return decodeBlocks<bcdec_bc4>;
+}
+DecodeBlocksFunction decodeBc5BlocksImplementation(Cpu::ScalarT) {
+    return decodeBlocks<bcdec_bc5>;
+}
+
+#ifdef CORRADE_ENABLE_SSE41
+DecodeBlocksFunction decodeBc1BlocksImplementation(Cpu::Sse41T) {
+    return decodeBlocks<decodeBc1Sse41>;
+}
+DecodeBlocksFunction decodeBc3BlocksImplementation(Cpu::Sse41T) {
+    return decodeBlocks<decodeBc3Sse41>;
+}
+DecodeBlocksFunction decodeBc4BlocksImplementation(Cpu::Sse41T) {
+    return decodeBlocks<decodeBc4Sse41>;
+}
+DecodeBlocksFunction decodeBc5BlocksImplementation(Cpu::Sse41T) {
+    return decodeBlocks<decodeBc5Sse41>;
+}
+#endif
+
+CORRADE_CPU_DISPATCHER_BASE(decodeBc1BlocksImplementation)
+CORRADE_CPU_DISPATCHER_BASE(decodeBc3BlocksImplementation)
+CORRADE_CPU_DISPATCHER_BASE(decodeBc4BlocksImplementation)
+CORRADE_CPU_DISPATCHER_BASE(decodeBc5BlocksImplementation)
+
+/* Splits the block rows into contiguous ranges, one per thread. The calling
+   thread decodes the last range, so for threadCount being 1 no threads are
+   spawned at all. Each thread writes to a disjoint set of output rows, so no
+   synchronization is needed apart from the final join. */
+void decodeBlocksParallel(const DecodeBlocksFunction decode, const Containers::StridedArrayView2D<const char>& src, const Containers::StridedArrayView2D<char>& dst, const UnsignedInt threadCount) {
+    const std::size_t yBlocks = src.size()[0];
+    const std::size_t rangeCount = Math::min(std::size_t(threadCount), yBlocks);
+    if(rangeCount <= 1) {
+        decode(src, dst);
+        return;
+    }
+
+    const std::size_t yBlocksPerRange = (yBlocks + rangeCount - 1)/rangeCount;
+    Containers::Array<std::thread> threads;
+    arrayReserve(threads, rangeCount - 1);
+    for(std::size_t begin = 0; begin < yBlocks; begin += yBlocksPerRange) {
+        const std::size_t end = Math::min(begin + yBlocksPerRange, yBlocks);
+        const Containers::StridedArrayView2D<const char> srcRange = src.slice(begin, end);
+        const Containers::StridedArrayView2D<char> dstRange = dst.slice(begin*4, end*4);
+        if(end == yBlocks)
+            decode(srcRange, dstRange);
+        else
+            arrayAppend(threads, InPlaceInit, decode, srcRange, dstRange);
+    }
+
+    for(std::thread& thread: threads)
+        thread.join();
+}
+
+template<UnsignedInt dimensions> Containers::Optional<ImageData<dimensions>> convertInternal(const BasicCompressedImageView<dimensions>& image, const Utility::ConfigurationGroup& configuration, const ImageConverterFlags flags) {
+    const bool bc6hToFloat = configuration.value<bool>("bc6hToFloat");
+
+    /* Read as a signed value to catch negative values instead of having them
+       wrap around to billions of threads */
+    const Int threads = configuration.value<Int>("threads");
+    if(threads < 0) {
+        Error{} << "Trade::BcDecImageConverter::convert(): expected threads to be zero or positive but got" << threads;
+        return {};
+    }
 
     /* Decide on target pixel format */
     PixelFormat format;
@@ -110,29 +332,37 @@ Containers::Optional<ImageData2D> BcDecImageConverter::doConvert(const Compresse
             return {};
     }
 
-    /* Block size is 4x4 in all cases */
+    /* Block size is 4x4x1 in all cases */
     /** @todo clean up once the block size is stored directly in the image */
     constexpr Vector2i blockSize{4};
     CORRADE_INTERNAL_ASSERT(compressedPixelFormatBlockSize(image.format()) == (Vector3i{blockSize, 1}));
 
     /* Allocate output data. For simplicity make them contain the full 4x4
-       blocks with an appropriate row length set. That way, if the actual used
-       size isn't whole blocks, the extra unused pixels at the end of each row
-       and at/or the end of the image are treated as padding without having
-       to do a lot of special casing in the decoding loop. */
-    const Vector2i blockCount = ((image.size() + blockSize - Vector2i{1})/blockSize);
+       blocks with an appropriate row length and image height set. That way,
+       if the actual used size isn't whole blocks, the extra unused pixels at
+       the end of each row and at/or the end of each slice are treated as
+       padding without having to do a lot of special casing in the decoding
+       loop. */
+    const Vector3i size = Vector3i::pad(image.size(), 1);
+    const Vector2i blockCount = ((size.xy() + blockSize - Vector2i{1})/blockSize);
     const Vector2i sizeInWholeBlocks = blockSize*blockCount;
     const UnsignedInt pixelSize = pixelFormatSize(format);
-    Trade::ImageData2D out{
+    ImageData<dimensions> out{
         /* Since it's always 4-pixel-wide blocks, the alignment can stay at the
-           default of 4 */
-        PixelStorage{}.setRowLength(sizeInWholeBlocks.x()),
+           default of 4. Image height is only relevant for 3D images. */
+        PixelStorage{}
+            .setRowLength(sizeInWholeBlocks.x())
+            .setImageHeight(dimensions == 3 ? sizeInWholeBlocks.y() : 0),
         format,
         image.size(),
-        Containers::Array<char>{NoInit, std::size_t(pixelSize*sizeInWholeBlocks.product())},
+        Containers::Array<char>{NoInit, std::size_t(pixelSize*sizeInWholeBlocks.product()*size.z())},
         image.flags()};
 
-    /* Build the source block view and destination pixel view */
+    /* Build the source block view and destination pixel view. Slices of a 3D
+       or array image are both consecutive in memory and whole blocks, so they
+       can be treated as a single 2D image that's size.z() times taller. That
+       also allows the parallel decoding to split the work evenly regardless
+       of the slice count. */
     /** @todo clean up and remove the error once there's a blocks() accessor */
     if(image.storage() != CompressedPixelStorage{}) {
         Error{} << "Trade::BcDecImageConverter::convert(): non-default compressed storage is not supported";
@@ -141,65 +371,90 @@ Containers::Optional<ImageData2D> BcDecImageConverter::doConvert(const Compresse
     const UnsignedInt blockDataSize = compressedPixelFormatBlockDataSize(image.format());
     const Containers::StridedArrayView2D<const char> src{
         image.data(),
-        {std::size_t(blockCount.y()), std::size_t(blockCount.x())},
+        {std::size_t(blockCount.y()*size.z()), std::size_t(blockCount.x())},
         {std::ptrdiff_t(blockCount.x()*blockDataSize), std::ptrdiff_t(blockDataSize)}
     };
     /* Can't use pixels() here because the pixel view may not be whole
        blocks */
     const Containers::StridedArrayView2D<char> dst{
         out.mutableData(),
-        {std::size_t(sizeInWholeBlocks.y()),
+        {std::size_t(sizeInWholeBlocks.y()*size.z()),
          std::size_t(sizeInWholeBlocks.x())},
         {std::ptrdiff_t(sizeInWholeBlocks.x()*pixelSize),
          std::ptrdiff_t(pixelSize)}
     };
 
-    /* Decode block-by-block */
+    /* Pick the block decoding function. Formats that have a SIMD variant go
+       through a runtime CPU dispatcher, unless the SIMD paths are disabled,
+       in which case the dispatch is done for just the scalar variant. */
+    const Cpu::Features cpuFeatures = configuration.value<bool>("simd") ?
+        Cpu::runtimeFeatures() : Cpu::Features{Cpu::Scalar};
+    DecodeBlocksFunction decode;
     switch(image.format()) {
         case CompressedPixelFormat::Bc1RGBUnorm:
         case CompressedPixelFormat::Bc1RGBAUnorm:
         case CompressedPixelFormat::Bc1RGBSrgb:
         case CompressedPixelFormat::Bc1RGBASrgb:
-            decodeBlocks<bcdec_bc1>(src, dst);
+            decode = decodeBc1BlocksImplementation(cpuFeatures);
             break;
         case CompressedPixelFormat::Bc2RGBAUnorm:
         case CompressedPixelFormat::Bc2RGBASrgb:
-            decodeBlocks<bcdec_bc2>(src, dst);
+            decode = decodeBlocks<bcdec_bc2>;
             break;
         case CompressedPixelFormat::Bc3RGBAUnorm:
         case CompressedPixelFormat::Bc3RGBASrgb:
-            decodeBlocks<bcdec_bc3>(src, dst);
+            decode = decodeBc3BlocksImplementation(cpuFeatures);
             break;
         case CompressedPixelFormat::Bc4RUnorm:
         case CompressedPixelFormat::Bc4RSnorm:
-            decodeBlocks<bcdec_bc4>(src, dst);
+            decode = decodeBc4BlocksImplementation(cpuFeatures);
             break;
         case CompressedPixelFormat::Bc5RGUnorm:
         case CompressedPixelFormat::Bc5RGSnorm:
-            decodeBlocks<bcdec_bc5>(src, dst);
+            decode = decodeBc5BlocksImplementation(cpuFeatures);
             break;
         case CompressedPixelFormat::Bc6hRGBUfloat:
-            bc6hToFloat ?
-                decodeBlocks<decodeBc6hBlock<bcdec_bc6h_float, false, 4>>(src, dst) :
-                decodeBlocks<decodeBc6hBlock<bcdec_bc6h_half, false, 2>>(src, dst);
+            decode = bc6hToFloat ?
+                decodeBlocks<decodeBc6hBlock<bcdec_bc6h_float, false, 4>> :
+                decodeBlocks<decodeBc6hBlock<bcdec_bc6h_half, false, 2>>;
             break;
         case CompressedPixelFormat::Bc6hRGBSfloat:
-            bc6hToFloat ?
-                decodeBlocks<decodeBc6hBlock<bcdec_bc6h_float, true, 4>>(src, dst) :
-                decodeBlocks<decodeBc6hBlock<bcdec_bc6h_half, true, 2>>(src, dst);
+            decode = bc6hToFloat ?
+                decodeBlocks<decodeBc6hBlock<bcdec_bc6h_float, true, 4>> :
+                decodeBlocks<decodeBc6hBlock<bcdec_bc6h_half, true, 2>>;
             break;
         case CompressedPixelFormat::Bc7RGBAUnorm:
         case CompressedPixelFormat::Bc7RGBASrgb:
-            decodeBlocks<bcdec_bc7>(src, dst);
+            decode = decodeBlocks<bcdec_bc7>;
             break;
         /* Unsupported formats already handled above */
         default: CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
     }
 
+    /* Decode block-by-block, optionally spreading block rows across multiple
+       threads */
+    UnsignedInt threadCount = threads;
+    if(!threadCount) {
+        threadCount = std::thread::hardware_concurrency();
+        if(flags & ImageConverterFlag::Verbose)
+            Debug{} << "Trade::BcDecImageConverter::convert(): autodetected hardware concurrency to" << threadCount << "threads";
+    }
+    decodeBlocksParallel(decode, src, dst, threadCount);
+
     /* GCC 4.8 needs extra help here */
     return Containers::optional(Utility::move(out));
 }
 
+}
+
+Containers::Optional<ImageData2D> BcDecImageConverter::doConvert(const CompressedImageView2D& image) {
+    return convertInternal(image, configuration(), flags());
+}
+
+Containers::Optional<ImageData3D> BcDecImageConverter::doConvert(const CompressedImageView3D& image) {
+    return convertInternal(image, configuration(), flags());
+}
+
 }}
 
 CORRADE_PLUGIN_REGISTER(BcDecImageConverter, Magnum::Trade::BcDecImageConverter,
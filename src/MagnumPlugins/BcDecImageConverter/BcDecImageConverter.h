@@ -147,8 +147,30 @@ whole blocks, @ref PixelStorage::setRowLength() is set to treat the extra
 pixels at the end of each row as padding. Non-default @ref CompressedPixelStorage
 isn't supported in input images.
 
-Only 2D image conversion is supported at the moment. Image flags, if any, are
-passed through unchanged.
+Both 2D and 3D images are supported, with 3D images being treated as a list
+of 2D slices, which also makes it possible to decode 2D array and cube map
+(array) images in a single call. Image flags, if any, are passed through
+unchanged.
+
+@subsection Trade-BcDecImageConverter-behavior-multithreading Multithreading
+
+By default the blocks are decoded serially in the calling thread. Setting the
+@cb{.ini} threads @ce @ref Trade-BcDecImageConverter-configuration "configuration option"
+to a value other than @cpp 1 @ce splits rows of blocks across the given number
+of threads, with @cpp 0 @ce meaning the value returned by
+@cpp std::thread::hardware_concurrency() @ce. For 3D images the rows of all
+slices are distributed together, so the work is evenly split even if the image
+has just a few rows but many slices. With @ref ImageConverterFlag::Verbose
+enabled, the plugin prints the autodetected thread count.
+
+@subsection Trade-BcDecImageConverter-behavior-simd SIMD decoding
+
+On x86 CPUs with SSE4.1, BC1, BC3, BC4 and BC5 blocks are decoded using a
+vectorized implementation instead of the scalar code from bcdec. The variant
+is picked at runtime with a @ref CORRADE_CPU_DISPATCHER_BASE() dispatcher based
+on @ref Cpu::runtimeFeatures(). The output is bit-exact with the
+scalar implementation. The SIMD code path can be disabled with the
+@cb{.ini} simd @ce @ref Trade-BcDecImageConverter-configuration "configuration option".
 
 @section Trade-BcDecImageConverter-configuration Plugin-specific configuration
 
@@ -169,6 +191,7 @@ class MAGNUM_BCDECIMAGECONVERTER_EXPORT BcDecImageConverter: public AbstractImag
         MAGNUM_BCDECIMAGECONVERTER_LOCAL ImageConverterFeatures doFeatures() const override;
 
         MAGNUM_BCDECIMAGECONVERTER_LOCAL Containers::Optional<ImageData2D> doConvert(const CompressedImageView2D& image) override;
+        MAGNUM_BCDECIMAGECONVERTER_LOCAL Containers::Optional<ImageData3D> doConvert(const CompressedImageView3D& image) override;
 };
 
 }}
@@ -24,14 +24,19 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <thread>
+#include <Corrade/Cpu.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
 #include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/ConfigurationGroup.h>
+#include <Corrade/Utility/Format.h>
 #include <Corrade/Utility/Path.h>
 #include <Magnum/ImageView.h>
 #include <Magnum/DebugTools/CompareImage.h>
+#include <Magnum/Math/Functions.h>
 #include <Magnum/Trade/AbstractImageConverter.h>
 #include <Magnum/Trade/AbstractImporter.h>
 #include <Magnum/Trade/ImageData.h>
@@ -44,11 +49,17 @@ struct BcDecImageConverterTest: TestSuite::Tester {
     explicit BcDecImageConverterTest();
 
     void test();
+    void test3D();
+    void threads();
+    void threadsInvalid();
+    void simd();
     void preserveFlags();
 
     void unsupportedFormat();
     void unsupportedStorage();
 
+    void benchmark();
+
     /* Explicitly forbid system-wide plugin dependencies */
     PluginManager::Manager<AbstractImageConverter> _manager{"nonexistent"};
     PluginManager::Manager<AbstractImporter> _importerManager{"nonexistent"};
@@ -159,15 +170,95 @@ const struct {
         {}, {}, 3.5f, 0.41f},
 };
 
+const struct {
+    const char* name;
+    CompressedPixelFormat format;
+    Int threads;
+    ImageConverterFlags flags;
+} ThreadsData[]{
+    {"BC1, 2 threads", CompressedPixelFormat::Bc1RGBAUnorm, 2, {}},
+    {"BC4, 3 threads", CompressedPixelFormat::Bc4RUnorm, 3, {}},
+    {"BC7, more threads than block rows", CompressedPixelFormat::Bc7RGBAUnorm, 64, {}},
+    {"BC5, hardware concurrency", CompressedPixelFormat::Bc5RGUnorm, 0, {}},
+    {"BC5, hardware concurrency, verbose", CompressedPixelFormat::Bc5RGUnorm, 0, ImageConverterFlag::Verbose},
+};
+
+const struct {
+    const char* name;
+    CompressedPixelFormat format;
+    /* Offset of the two 16-bit RGB565 color endpoints in a block, -1 if the
+       format has none */
+    Int colorEndpoints;
+    /* Offsets of up to two pairs of 8-bit alpha / red / green endpoints in a
+       block, -1 if unused */
+    Int smoothEndpoints[2];
+} SimdData[]{
+    {"BC1", CompressedPixelFormat::Bc1RGBAUnorm, 0, {-1, -1}},
+    {"BC3", CompressedPixelFormat::Bc3RGBAUnorm, 8, {0, -1}},
+    {"BC4", CompressedPixelFormat::Bc4RUnorm, -1, {0, -1}},
+    {"BC5", CompressedPixelFormat::Bc5RGUnorm, -1, {0, 8}},
+};
+
+/* Rewrites a pair of consecutive little-endian endpoints so the first is
+   larger than (mode 0), smaller than (mode 1) or equal to (mode 2) the
+   second, reusing the values that were there */
+template<class T> void setEndpointOrder(char* const endpoints, const UnsignedInt mode) {
+    T a = 0, b = 0;
+    for(std::size_t i = 0; i != sizeof(T); ++i) {
+        a |= T(UnsignedByte(endpoints[i]) << 8*i);
+        b |= T(UnsignedByte(endpoints[sizeof(T) + i]) << 8*i);
+    }
+    T min = Math::min(a, b);
+    T max = Math::max(a, b);
+    if(min == max) {
+        if(max == T(~T{})) --min;
+        else ++max;
+    }
+    const T first = mode == 0 ? max : min;
+    const T second = mode == 1 ? max : min;
+    for(std::size_t i = 0; i != sizeof(T); ++i) {
+        endpoints[i] = char(first >> 8*i);
+        endpoints[sizeof(T) + i] = char(second >> 8*i);
+    }
+}
+
+const struct {
+    const char* name;
+    CompressedPixelFormat format;
+    bool simd;
+} BenchmarkData[]{
+    {"BC1, scalar", CompressedPixelFormat::Bc1RGBAUnorm, false},
+    {"BC1, SIMD", CompressedPixelFormat::Bc1RGBAUnorm, true},
+    {"BC3, scalar", CompressedPixelFormat::Bc3RGBAUnorm, false},
+    {"BC3, SIMD", CompressedPixelFormat::Bc3RGBAUnorm, true},
+    {"BC4, scalar", CompressedPixelFormat::Bc4RUnorm, false},
+    {"BC4, SIMD", CompressedPixelFormat::Bc4RUnorm, true},
+    {"BC5, scalar", CompressedPixelFormat::Bc5RGUnorm, false},
+    {"BC5, SIMD", CompressedPixelFormat::Bc5RGUnorm, true},
+};
+
 BcDecImageConverterTest::BcDecImageConverterTest() {
     addInstancedTests({&BcDecImageConverterTest::test},
         Containers::arraySize(TestData));
 
+    addTests({&BcDecImageConverterTest::test3D});
+
+    addInstancedTests({&BcDecImageConverterTest::threads},
+        Containers::arraySize(ThreadsData));
+
+    addTests({&BcDecImageConverterTest::threadsInvalid});
+
+    addInstancedTests({&BcDecImageConverterTest::simd},
+        Containers::arraySize(SimdData));
+
     addTests({&BcDecImageConverterTest::preserveFlags,
 
               &BcDecImageConverterTest::unsupportedFormat,
               &BcDecImageConverterTest::unsupportedStorage});
 
+    addInstancedBenchmarks({&BcDecImageConverterTest::benchmark}, 10,
+        Containers::arraySize(BenchmarkData));
+
     /* Load the plugin directly from the build tree. Otherwise it's static and
        already loaded. */
     #ifdef BCDECIMAGECONVERTER_PLUGIN_FILENAME
@@ -257,6 +348,143 @@ void BcDecImageConverterTest::test() {
         (DebugTools::CompareImage{data.maxThreshold, data.meanThreshold}));
 }
 
+void BcDecImageConverterTest::test3D() {
+    Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("BcDecImageConverter");
+
+    /* Three slices of 2x2 BC1 blocks with arbitrary contents, the size isn't
+       whole blocks to verify the padding is handled correctly in each
+       slice */
+    char blocks[3*2*2*8];
+    for(std::size_t i = 0; i != Containers::arraySize(blocks); ++i)
+        blocks[i] = i*37 + 11;
+
+    Containers::Optional<ImageData3D> converted = converter->convert(CompressedImageView3D{CompressedPixelFormat::Bc1RGBAUnorm, {7, 5, 3}, blocks, ImageFlag3D::Array});
+    CORRADE_VERIFY(converted);
+    CORRADE_COMPARE(converted->format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(converted->size(), (Vector3i{7, 5, 3}));
+    CORRADE_COMPARE(converted->flags(), ImageFlag3D::Array);
+
+    /* Each slice should be the same as if decoded as a 2D image alone */
+    for(std::size_t i = 0; i != 3; ++i) {
+        CORRADE_ITERATION(i);
+        Containers::Optional<ImageData2D> slice = converter->convert(CompressedImageView2D{CompressedPixelFormat::Bc1RGBAUnorm, {7, 5}, Containers::arrayView(blocks).sliceSize(i*2*2*8, 2*2*8)});
+        CORRADE_VERIFY(slice);
+        CORRADE_COMPARE_WITH(
+            (ImageView2D{converted->storage(), converted->format(), converted->size().xy(), converted->data().exceptPrefix(i*8*8*4)}),
+            *slice,
+            (DebugTools::CompareImage{0.0f, 0.0f}));
+    }
+}
+
+void BcDecImageConverterTest::threads() {
+    auto&& data = ThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* 3x10 blocks with arbitrary contents in two slices, which gives 20 rows
+       of blocks to distribute across threads */
+    const UnsignedInt blockDataSize = compressedPixelFormatBlockDataSize(data.format);
+    Containers::Array<char> blocks{NoInit, 3*10*2*blockDataSize};
+    for(std::size_t i = 0; i != blocks.size(); ++i)
+        blocks[i] = i*37 + 11;
+    const CompressedImageView3D image{data.format, {12, 40, 2}, blocks};
+
+    Containers::Pointer<AbstractImageConverter> serialConverter = _manager.instantiate("BcDecImageConverter");
+    /* Single-threaded is the default */
+    CORRADE_COMPARE(serialConverter->configuration().value<Int>("threads"), 1);
+    Containers::Optional<ImageData3D> expected = serialConverter->convert(image);
+    CORRADE_VERIFY(expected);
+
+    Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("BcDecImageConverter");
+    converter->addFlags(data.flags);
+    converter->configuration().setValue("threads", data.threads);
+
+    Containers::String out;
+    Containers::Optional<ImageData3D> converted;
+    {
+        Debug redirectOutput{&out};
+        converted = converter->convert(image);
+    }
+    CORRADE_VERIFY(converted);
+    if(data.flags & ImageConverterFlag::Verbose)
+        CORRADE_COMPARE(out, Utility::format("Trade::BcDecImageConverter::convert(): autodetected hardware concurrency to {} threads\n", std::thread::hardware_concurrency()));
+    else
+        CORRADE_COMPARE(out, "");
+
+    /* The output should be bit-exact regardless of the thread count */
+    CORRADE_COMPARE(converted->format(), expected->format());
+    CORRADE_COMPARE(converted->size(), expected->size());
+    CORRADE_COMPARE_AS(converted->data(), expected->data(),
+        TestSuite::Compare::Container);
+}
+
+void BcDecImageConverterTest::threadsInvalid() {
+    Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("BcDecImageConverter");
+    converter->configuration().setValue("threads", -3);
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convert(CompressedImageView2D{CompressedPixelFormat::Bc1RGBASrgb, {1, 1}, "1234567"}));
+    CORRADE_COMPARE(out, "Trade::BcDecImageConverter::convert(): expected threads to be zero or positive but got -3\n");
+}
+
+void BcDecImageConverterTest::simd() {
+    auto&& data = SimdData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    #ifndef CORRADE_ENABLE_SSE41
+    CORRADE_SKIP("SSE4.1 not supported by the compiler, cannot test");
+    #else
+    if(!(Cpu::runtimeFeatures() & Cpu::Sse41))
+        CORRADE_SKIP("SSE4.1 not supported by the CPU, cannot test");
+    #endif
+
+    /* 16x16 blocks with arbitrary contents, with the endpoints then
+       reordered to cycle through all modes for every block type, as a random
+       value wouldn't hit the equal case most of the time:
+
+       -    for the BC1 color endpoints, c0 > c1 selects the four-color mode
+            and c0 <= c1 the three-color mode with transparent black. The BC3
+            color block is always decoded as four-color, so there it only
+            verifies the ordering doesn't matter.
+       -    for the BC3 alpha and BC4 / BC5 red / green endpoints, e0 > e1
+            selects the mode with six interpolated values and e0 <= e1 the
+            mode with four interpolated values plus explicit 0 and 255.
+
+       Only the endpoint bytes are touched, the index bits following them
+       stay arbitrary. */
+    const UnsignedInt blockDataSize = compressedPixelFormatBlockDataSize(data.format);
+    Containers::Array<char> blocks{NoInit, 16*16*blockDataSize};
+    for(std::size_t i = 0; i != blocks.size(); ++i)
+        blocks[i] = i*37 + i/7 + 11;
+    for(std::size_t i = 0; i != 16*16; ++i) {
+        char* const block = blocks + i*blockDataSize;
+        if(data.colorEndpoints != -1)
+            setEndpointOrder<UnsignedShort>(block + data.colorEndpoints, i % 3);
+        /* Different cycle phase than for color so BC3 gets all nine
+           combinations */
+        for(const Int offset: data.smoothEndpoints)
+            if(offset != -1)
+                setEndpointOrder<UnsignedByte>(block + offset, (i/3) % 3);
+    }
+    const CompressedImageView2D image{data.format, {64, 64}, blocks};
+
+    Containers::Pointer<AbstractImageConverter> scalarConverter = _manager.instantiate("BcDecImageConverter");
+    scalarConverter->configuration().setValue("simd", false);
+    Containers::Optional<ImageData2D> expected = scalarConverter->convert(image);
+    CORRADE_VERIFY(expected);
+
+    Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("BcDecImageConverter");
+    /* SIMD is the default */
+    CORRADE_VERIFY(converter->configuration().value<bool>("simd"));
+    Containers::Optional<ImageData2D> converted = converter->convert(image);
+    CORRADE_VERIFY(converted);
+
+    /* The output should be bit-exact with the scalar implementation */
+    CORRADE_COMPARE(converted->format(), expected->format());
+    CORRADE_COMPARE_AS(converted->data(), expected->data(),
+        TestSuite::Compare::Container);
+}
+
 void BcDecImageConverterTest::preserveFlags() {
     Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("BcDecImageConverter");
 
@@ -285,6 +513,27 @@ void BcDecImageConverterTest::unsupportedStorage() {
     CORRADE_COMPARE(out, "Trade::BcDecImageConverter::convert(): non-default compressed storage is not supported\n");
 }
 
+void BcDecImageConverterTest::benchmark() {
+    auto&& data = BenchmarkData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* 1024x1024 pixels with arbitrary contents */
+    const UnsignedInt blockDataSize = compressedPixelFormatBlockDataSize(data.format);
+    Containers::Array<char> blocks{NoInit, 256*256*blockDataSize};
+    for(std::size_t i = 0; i != blocks.size(); ++i)
+        blocks[i] = i*37 + i/7 + 11;
+    const CompressedImageView2D image{data.format, {1024, 1024}, blocks};
+
+    Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("BcDecImageConverter");
+    converter->configuration().setValue("simd", data.simd);
+
+    Containers::Optional<ImageData2D> converted;
+    CORRADE_BENCHMARK(10)
+        converted = converter->convert(image);
+
+    CORRADE_VERIFY(converted);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::BcDecImageConverterTest)
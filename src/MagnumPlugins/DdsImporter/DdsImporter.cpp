@@ -27,6 +27,8 @@
 
 #include "DdsImporter.h"
 
+#include <thread> /* std::thread::hardware_concurrency(), sigh */
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Triple.h>
 #include <Corrade/Containers/StringIterable.h>
@@ -233,6 +235,9 @@ constexpr struct {
 
 struct DdsImporter::File {
     Containers::Array<char> in;
+    /* Whether the input data is owned externally and thus guaranteed to stay
+       in scope, used for zero-copy import */
+    bool inExternallyOwned;
 
     /* Size of one top-level slice. As it's used as an input for level size
        calculation, it doesn't take sliceCount into account. */
@@ -314,6 +319,7 @@ void DdsImporter::doOpenData(Containers::Array<char>&& data, const DataFlags dat
         f->in = Utility::move(data);
     else
         f->in = Containers::Array<char>{InPlaceInit, data};
+    f->inExternallyOwned = !!(dataFlags & DataFlag::ExternallyOwned);
 
     /* Read in DDS header */
     if(f->in.size() < sizeof(DdsHeader)) {
@@ -728,58 +734,83 @@ void swizzlePixels(const PixelFormat format, const Containers::ArrayView<char> d
     } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
 }
 
-void flipPixels(const BitVector2 yzFlip, const UnsignedInt pixelSize, const Vector3i& size, const Containers::ArrayView<char> data) {
-    const Containers::StridedArrayView4D<char> view{data, {
-        std::size_t(size.z()),
+/* Y-flips a single plane, i.e. a 2D slice of the image */
+void flipPixels(const UnsignedInt pixelSize, const Vector2i& size, const Containers::ArrayView<char> data) {
+    Utility::flipInPlace<0>(Containers::StridedArrayView3D<char>{data, {
         std::size_t(size.y()),
         std::size_t(size.x()),
         pixelSize
-    }};
-    if(yzFlip[0])
-        Utility::flipInPlace<1>(view);
-    if(yzFlip[1])
-        Utility::flipInPlace<0>(view);
+    }});
 }
 
-void flipBlocks(const Vector3i& size, const ImporterFlags flags, const char* messagePrefix, const BitVector2 yzFlip, const CompressedPixelFormat format, const Vector3i& blockSize, const UnsignedInt blockDataSize, const Containers::ArrayView<char> data) {
-    const Vector3i blockCount = (size + blockSize - Vector3i{1})/blockSize;
+/* Y-flips a single plane of blocks, i.e. a 2D slice of the image that's one
+   block deep */
+void flipBlocks(const Vector2i& size, const CompressedPixelFormat format, const Vector3i& blockSize, const UnsignedInt blockDataSize, const Containers::ArrayView<char> data) {
+    const Vector2i blockCount = (size + blockSize.xy() - Vector2i{1})/blockSize.xy();
     const Containers::StridedArrayView4D<char> view{data, {
-        std::size_t(blockCount.z()),
+        1,
         std::size_t(blockCount.y()),
         std::size_t(blockCount.x()),
         blockDataSize
     }};
 
-    if(yzFlip[0]) {
-        if(!(flags & ImporterFlag::Quiet) && size.y() % blockSize.y() != 0)
-            Warning{} << messagePrefix << "Y-flipping a compressed image that's not whole blocks, the result will be shifted by" << (blockSize.y() - (size.y() % blockSize.y())) << "pixels";
-
-        if(format == CompressedPixelFormat::Bc1RGBAUnorm ||
-           format == CompressedPixelFormat::Bc1RGBASrgb)
-            Math::yFlipBc1InPlace(view);
-        else if(format == CompressedPixelFormat::Bc2RGBAUnorm ||
-                format == CompressedPixelFormat::Bc2RGBASrgb)
-            Math::yFlipBc2InPlace(view);
-        else if(format == CompressedPixelFormat::Bc3RGBAUnorm ||
-                format == CompressedPixelFormat::Bc3RGBASrgb)
-            Math::yFlipBc3InPlace(view);
-        else if(format == CompressedPixelFormat::Bc4RUnorm ||
-                format == CompressedPixelFormat::Bc4RSnorm)
-            Math::yFlipBc4InPlace(view);
-        else if(format == CompressedPixelFormat::Bc5RGUnorm ||
-                format == CompressedPixelFormat::Bc5RGSnorm)
-            Math::yFlipBc5InPlace(view);
-        /* For all other -- not yet supported -- formats the yzFlip[0] bit was
-           reset so it shouldn't get here */
-        else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    if(format == CompressedPixelFormat::Bc1RGBAUnorm ||
+       format == CompressedPixelFormat::Bc1RGBASrgb)
+        Math::yFlipBc1InPlace(view);
+    else if(format == CompressedPixelFormat::Bc2RGBAUnorm ||
+            format == CompressedPixelFormat::Bc2RGBASrgb)
+        Math::yFlipBc2InPlace(view);
+    else if(format == CompressedPixelFormat::Bc3RGBAUnorm ||
+            format == CompressedPixelFormat::Bc3RGBASrgb)
+        Math::yFlipBc3InPlace(view);
+    else if(format == CompressedPixelFormat::Bc4RUnorm ||
+            format == CompressedPixelFormat::Bc4RSnorm)
+        Math::yFlipBc4InPlace(view);
+    else if(format == CompressedPixelFormat::Bc5RGUnorm ||
+            format == CompressedPixelFormat::Bc5RGSnorm)
+        Math::yFlipBc5InPlace(view);
+    /* For all other -- not yet supported -- formats the yzFlip[0] bit was
+       reset so it shouldn't get here */
+    else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+/* Splits the planes into contiguous ranges, one per thread. The calling
+   thread processes the last range, so for threadCount being 1 no threads are
+   spawned at all. Each thread writes to a disjoint set of output planes, so
+   no synchronization is needed apart from the final join. */
+template<class F> void importPlanesParallel(const F& importPlanes, const std::size_t planeCount, const UnsignedInt threadCount) {
+    const std::size_t rangeCount = Math::min(std::size_t(threadCount), planeCount);
+    if(rangeCount <= 1) {
+        importPlanes(0, planeCount);
+        return;
+    }
+
+    const std::size_t planesPerRange = (planeCount + rangeCount - 1)/rangeCount;
+    Containers::Array<std::thread> threads;
+    arrayReserve(threads, rangeCount - 1);
+    for(std::size_t begin = 0; begin < planeCount; begin += planesPerRange) {
+        const std::size_t end = Math::min(begin + planesPerRange, planeCount);
+        if(end == planeCount)
+            importPlanes(begin, end);
+        else
+            arrayAppend(threads, InPlaceInit, importPlanes, begin, end);
     }
-    if(yzFlip[1])
-        Utility::flipInPlace<0>(view);
+
+    for(std::thread& thread: threads)
+        thread.join();
 }
 
 }
 
-template<UnsignedInt dimensions> ImageData<dimensions> DdsImporter::doImage(const char* const messagePrefix, UnsignedInt, const UnsignedInt level) {
+template<UnsignedInt dimensions> Containers::Optional<ImageData<dimensions>> DdsImporter::doImage(const char* const messagePrefix, UnsignedInt, const UnsignedInt level) {
+    /* Read as a signed value to catch negative values instead of having them
+       wrap around to billions of threads */
+    const Int threads = configuration().value<Int>("threads");
+    if(threads < 0) {
+        Error{} << messagePrefix << "expected threads to be zero or positive but got" << threads;
+        return {};
+    }
+
     /* Calculate input offset, data size and image slice size */
     const Containers::Triple<std::size_t, std::size_t, Vector3i> offsetSize = _f->compressed ?
         levelOffsetSize(_f->topLevelSliceSize, _f->properties.compressed.blockSize, _f->properties.compressed.blockDataSize, level) :
@@ -792,33 +823,78 @@ template<UnsignedInt dimensions> ImageData<dimensions> DdsImporter::doImage(cons
         imageSize[dimensions - 1] = _f->sliceCount;
     }
 
-    /* Allocate image data */
-    Containers::Array<char> data{NoInit, offsetSize.second()*_f->sliceCount};
+    /* Adjust pixel storage if row size is not four byte aligned */
+    PixelStorage storage;
+    if(!_f->compressed && (imageSize.x()*_f->properties.uncompressed.pixelSize % 4 != 0))
+        storage.setAlignment(1);
 
-    /* Copy all slices */
-    for(std::size_t i = 0; i != _f->sliceCount; ++i) {
-        const std::size_t inputOffset = _f->dataOffset + i*_f->sliceSize + offsetSize.first();
-        const std::size_t outputOffset = i*offsetSize.second();
-        Utility::copy(_f->in.slice(inputOffset, inputOffset + offsetSize.second()),
-            data.slice(outputOffset, outputOffset + offsetSize.second()));
+    /* If the memory is owned externally and is thus guaranteed to stay in
+       scope, zero-copy import is requested, no swizzle or flip needs to be
+       done and all slices of given level are next to each other, reference
+       the data directly */
+    if(_f->inExternallyOwned && configuration().value<bool>("zeroCopy") &&
+       !_f->yzFlip.any() &&
+       (_f->compressed || !_f->properties.uncompressed.needsSwizzle) &&
+       (_f->sliceCount == 1 || _f->levelCount == 1))
+    {
+        const std::size_t inputOffset = _f->dataOffset + offsetSize.first();
+        const Containers::ArrayView<const char> data = _f->in.slice(inputOffset, inputOffset + offsetSize.second()*_f->sliceCount);
+        if(_f->compressed)
+            return ImageData<dimensions>{_f->properties.compressed.format, Math::Vector<dimensions, Int>::pad(imageSize), DataFlags{}, data, ImageFlag<dimensions>(UnsignedShort(_f->imageFlags))};
+        return ImageData<dimensions>{storage, _f->properties.uncompressed.format, Math::Vector<dimensions, Int>::pad(imageSize), DataFlags{}, data, ImageFlag<dimensions>(UnsignedShort(_f->imageFlags))};
     }
 
-    /* Compressed image. Flip if needed. */
-    if(_f->compressed) {
-        flipBlocks(imageSize, flags(), messagePrefix, _f->yzFlip, _f->properties.compressed.format, _f->properties.compressed.blockSize, _f->properties.compressed.blockDataSize, data);
+    if(_f->compressed && _f->yzFlip[0] && !(flags() & ImporterFlag::Quiet) && imageSize.y() % _f->properties.compressed.blockSize.y() != 0)
+        Warning{} << messagePrefix << "Y-flipping a compressed image that's not whole blocks, the result will be shifted by" << (_f->properties.compressed.blockSize.y() - (imageSize.y() % _f->properties.compressed.blockSize.y())) << "pixels";
 
-        return ImageData<dimensions>{_f->properties.compressed.format, Math::Vector<dimensions, Int>::pad(imageSize), Utility::move(data), ImageFlag<dimensions>(UnsignedShort(_f->imageFlags))};
-    }
+    /* Allocate image data */
+    Containers::Array<char> data{NoInit, offsetSize.second()*_f->sliceCount};
+
+    /* The work is split into planes, which are array layers, cube map faces
+       or, for 3D images, Z slices (or slices of blocks if compressed). Each
+       plane is copied to its final location in the output, which is where the
+       Z flip happens, and then swizzled and Y-flipped in place. As the planes
+       are independent, they can be processed in parallel. */
+    const Vector3i levelSize = offsetSize.third();
+    const std::size_t planesPerSlice = _f->compressed ?
+        (levelSize.z() + _f->properties.compressed.blockSize.z() - 1)/_f->properties.compressed.blockSize.z() :
+        levelSize.z();
+    const std::size_t planeSize = offsetSize.second()/planesPerSlice;
+    const File& f = *_f;
+    const auto importPlanes = [&f, &offsetSize, &levelSize, &data, planesPerSlice, planeSize](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            const std::size_t slice = i/planesPerSlice;
+            const std::size_t plane = i%planesPerSlice;
+            const std::size_t inputOffset = f.dataOffset + slice*f.sliceSize + offsetSize.first() + plane*planeSize;
+            const std::size_t outputOffset = slice*offsetSize.second() + (f.yzFlip[1] ? planesPerSlice - plane - 1 : plane)*planeSize;
+            const Containers::ArrayView<char> out = data.slice(outputOffset, outputOffset + planeSize);
+            Utility::copy(f.in.slice(inputOffset, inputOffset + planeSize), out);
+
+            /* Compressed image. Flip if needed. */
+            if(f.compressed) {
+                if(f.yzFlip[0])
+                    flipBlocks(levelSize.xy(), f.properties.compressed.format, f.properties.compressed.blockSize, f.properties.compressed.blockDataSize, out);
+
+            /* Uncompressed. Swizzle and flip if needed. */
+            } else {
+                if(f.properties.uncompressed.needsSwizzle)
+                    swizzlePixels(f.properties.uncompressed.format, out);
+                if(f.yzFlip[0])
+                    flipPixels(f.properties.uncompressed.pixelSize, levelSize.xy(), out);
+            }
+        }
+    };
 
-    /* Uncompressed. Swizzle and flip if needed. */
-    if(_f->properties.uncompressed.needsSwizzle)
-        swizzlePixels(_f->properties.uncompressed.format, data);
-    flipPixels(_f->yzFlip, _f->properties.uncompressed.pixelSize, imageSize, data);
+    UnsignedInt threadCount = threads;
+    if(!threadCount) {
+        threadCount = std::thread::hardware_concurrency();
+        if(flags() & ImporterFlag::Verbose)
+            Debug{} << messagePrefix << "autodetected hardware concurrency to" << threadCount << "threads";
+    }
+    importPlanesParallel(importPlanes, _f->sliceCount*planesPerSlice, threadCount);
 
-    /* Adjust pixel storage if row size is not four byte aligned */
-    PixelStorage storage;
-    if((imageSize.x()*_f->properties.uncompressed.pixelSize % 4 != 0))
-        storage.setAlignment(1);
+    if(_f->compressed)
+        return ImageData<dimensions>{_f->properties.compressed.format, Math::Vector<dimensions, Int>::pad(imageSize), Utility::move(data), ImageFlag<dimensions>(UnsignedShort(_f->imageFlags))};
 
     /** @todo expose DdsAlphaMode::Premultiplied through ImageFlags once it has
         such flag */
@@ -148,6 +148,33 @@ the size of each following level divided by 2, rounded down. Mip chains can be
 incomplete, ie. they don't have to extend all the way down to a level of size
 1x1.
 
+@subsection Trade-DdsImporter-behavior-multithreading Multithreading
+
+By default the image data are copied, swizzled and flipped serially in the
+calling thread. Setting the @cb{.ini} threads @ce
+@ref Trade-DdsImporter-configuration "configuration option" to a value other
+than @cpp 1 @ce splits the work across the given number of threads, with
+@cpp 0 @ce meaning the value returned by
+@cpp std::thread::hardware_concurrency() @ce. The work is distributed by
+array layers, cube map faces and, for 3D images, Z slices, so it's most
+beneficial for importing large array and cube map images. With
+@ref ImporterFlag::Verbose enabled, the plugin prints the autodetected thread
+count.
+
+@subsection Trade-DdsImporter-behavior-zero-copy Zero-copy import
+
+If the file is opened with @ref openMemory() and the
+@cb{.ini} zeroCopy @ce @ref Trade-DdsImporter-configuration "configuration option"
+is enabled, images that don't need any swizzling or flipping reference the
+input memory directly instead of making a copy. Such images have
+@ref ImageData::dataFlags() empty, and the memory passed to
+@ref openMemory() has to stay in scope for as long as the images are used.
+This is commonly the case for compressed formats that can't be Y-flipped or
+with @cb{.ini} assumeYUpZBackward @ce enabled. Because DDS stores all mip
+levels of a particular array layer or cube map face together, the zero-copy
+import isn't possible for array and cube map images with more than one mip
+level, and the data are copied in that case.
+
 @subsection Trade-DdsImporter-behavior-cube Cube maps
 
 Cube map faces are imported in the order +X, -X, +Y, -Y, +Z, -Z. Layered cube
@@ -263,7 +290,7 @@ class MAGNUM_DDSIMPORTER_EXPORT DdsImporter: public AbstractImporter {
         MAGNUM_DDSIMPORTER_LOCAL void doClose() override;
         MAGNUM_DDSIMPORTER_LOCAL void doOpenData(Containers::Array<char>&& data, DataFlags dataFlags) override;
 
-        template<UnsignedInt dimensions> MAGNUM_DDSIMPORTER_LOCAL ImageData<dimensions> doImage(const char* messagePrefix, UnsignedInt id, UnsignedInt level);
+        template<UnsignedInt dimensions> MAGNUM_DDSIMPORTER_LOCAL Containers::Optional<ImageData<dimensions>> doImage(const char* messagePrefix, UnsignedInt id, UnsignedInt level);
 
         MAGNUM_DDSIMPORTER_LOCAL UnsignedInt doImage1DCount() const override;
         MAGNUM_DDSIMPORTER_LOCAL UnsignedInt doImage1DLevelCount(UnsignedInt id) override;
@@ -25,6 +25,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <thread>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/String.h>
@@ -97,6 +98,10 @@ struct DdsImporterTest: TestSuite::Tester {
     void compressedFormatFlip();
     void compressedFormatFlip3D();
 
+    void threads();
+    void threadsInvalid();
+    void zeroCopy();
+
     void openMemory();
     void openTwice();
     void importTwice();
@@ -521,6 +526,55 @@ const struct {
         "dxt10-bc7-3d.dds", ImporterFlag::Verbose, true, false, false, nullptr},
 };
 
+const struct {
+    const char* name;
+    const char* filename;
+    Int threads;
+    ImporterFlags flags;
+} ThreadsData[]{
+    {"BGRA 3D, swizzle and Y + Z flip, 2 threads",
+        "bgra8unorm-3d.dds", 2, {}},
+    {"BC1 3D, Y + Z flip, 2 threads",
+        "dxt1-3d.dds", 2, {}},
+    {"BC1 cube map with mips, Y flip, 4 threads",
+        "dxt1-cube-mips.dds", 4, {}},
+    {"R8 cube map array, more threads than faces",
+        "dxt10-r8snorm-cube-array.dds", 64, {}},
+    {"RG16F 1D array with mips, hardware concurrency",
+        "dxt10-rg16f-1d-array-mips.dds", 0, {}},
+    {"RG16F 1D array with mips, hardware concurrency, verbose",
+        "dxt10-rg16f-1d-array-mips.dds", 0, ImporterFlag::Verbose},
+};
+
+const struct {
+    const char* name;
+    const char* filename;
+    UnsignedInt level;
+    Containers::Optional<bool> assumeYUpZBackward;
+    bool zeroCopy;
+} ZeroCopyData[]{
+    {"compressed, assume Y up",
+        "dxt1.dds", 0, true, true},
+    {"compressed, Y flip",
+        "dxt1.dds", 0, {}, false},
+    /* Warning about the flip not being implemented is silenced by the Quiet
+       flag */
+    {"compressed, flip not implemented",
+        "dxt10-bc7.dds", 0, {}, true},
+    {"uncompressed, assume Y up",
+        "rgb8unorm-yup.dds", 0, true, true},
+    {"uncompressed, Y flip",
+        "rgb8unorm.dds", 0, {}, false},
+    {"uncompressed, swizzle",
+        "bgr8unorm.dds", 0, true, false},
+    {"second level",
+        "dxt10-r32i-mips.dds", 1, true, true},
+    {"cube map array with a single level",
+        "dxt10-r8snorm-cube-array.dds", 0, true, true},
+    {"cube map with mips",
+        "dxt1-cube-mips.dds", 1, true, false},
+};
+
 /* Shared among all plugins that implement data copying optimizations */
 const struct {
     const char* name;
@@ -589,6 +643,14 @@ DdsImporterTest::DdsImporterTest() {
     addInstancedTests({&DdsImporterTest::compressedFormatFlip3D},
         Containers::arraySize(CompressedFormatFlip3DData));
 
+    addInstancedTests({&DdsImporterTest::threads},
+        Containers::arraySize(ThreadsData));
+
+    addTests({&DdsImporterTest::threadsInvalid});
+
+    addInstancedTests({&DdsImporterTest::zeroCopy},
+        Containers::arraySize(ZeroCopyData)*Containers::arraySize(OpenMemoryData));
+
     addInstancedTests({&DdsImporterTest::openMemory},
         Containers::arraySize(OpenMemoryData));
 
@@ -1675,6 +1737,136 @@ void DdsImporterTest::compressedFormatFlip3D() {
     }
 }
 
+void DdsImporterTest::threads() {
+    auto&& data = ThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Not assuming Y up in order to test the flipping as well. Warnings about
+       incomplete blocks being flipped are tested elsewhere. */
+    Containers::Pointer<AbstractImporter> serialImporter = _manager.instantiate("DdsImporter");
+    serialImporter->addFlags(ImporterFlag::Quiet);
+    /* Single-threaded is the default */
+    CORRADE_COMPARE(serialImporter->configuration().value<Int>("threads"), 1);
+    CORRADE_VERIFY(serialImporter->openFile(Utility::Path::join(DDSIMPORTER_TEST_DIR, data.filename)));
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    importer->addFlags(ImporterFlag::Quiet|data.flags);
+    importer->configuration().setValue("threads", data.threads);
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(DDSIMPORTER_TEST_DIR, data.filename)));
+
+    const bool is3D = importer->image3DCount();
+    const UnsignedInt levelCount = is3D ? importer->image3DLevelCount(0) : importer->image2DLevelCount(0);
+    for(UnsignedInt level = 0; level != levelCount; ++level) {
+        CORRADE_ITERATION(level);
+
+        Containers::Array<char> expected;
+        Containers::Array<char> actual;
+        Containers::String out;
+        if(is3D) {
+            Containers::Optional<ImageData3D> expectedImage = serialImporter->image3D(0, level);
+            CORRADE_VERIFY(expectedImage);
+            expected = expectedImage->release();
+
+            Debug redirectOutput{&out};
+            Containers::Optional<ImageData3D> image = importer->image3D(0, level);
+            CORRADE_VERIFY(image);
+            actual = image->release();
+        } else {
+            Containers::Optional<ImageData2D> expectedImage = serialImporter->image2D(0, level);
+            CORRADE_VERIFY(expectedImage);
+            expected = expectedImage->release();
+
+            Debug redirectOutput{&out};
+            Containers::Optional<ImageData2D> image = importer->image2D(0, level);
+            CORRADE_VERIFY(image);
+            actual = image->release();
+        }
+
+        if(data.flags & ImporterFlag::Verbose)
+            CORRADE_COMPARE(out, Utility::format("Trade::DdsImporter::image{}D(): autodetected hardware concurrency to {} threads\n", is3D ? 3 : 2, std::thread::hardware_concurrency()));
+        else
+            CORRADE_COMPARE(out, "");
+
+        /* The output should be bit-exact regardless of the thread count */
+        CORRADE_COMPARE_AS(actual, expected,
+            TestSuite::Compare::Container);
+    }
+}
+
+void DdsImporterTest::threadsInvalid() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    importer->configuration().setValue("threads", -3);
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(DDSIMPORTER_TEST_DIR, "dxt1-3d.dds")));
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->image3D(0));
+    CORRADE_COMPARE(out, "Trade::DdsImporter::image3D(): expected threads to be zero or positive but got -3\n");
+}
+
+void DdsImporterTest::zeroCopy() {
+    auto&& data = ZeroCopyData[testCaseInstanceId()/Containers::arraySize(OpenMemoryData)];
+    auto&& open = OpenMemoryData[testCaseInstanceId()%Containers::arraySize(OpenMemoryData)];
+    setTestCaseDescription(Utility::format("{}, {}", data.name, open.name));
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("DdsImporter");
+    importer->addFlags(ImporterFlag::Quiet);
+    if(data.assumeYUpZBackward)
+        importer->configuration().setValue("assumeYUpZBackward", *data.assumeYUpZBackward);
+    /* Disabled by default */
+    CORRADE_VERIFY(!importer->configuration().value<bool>("zeroCopy"));
+    importer->configuration().setValue("zeroCopy", true);
+
+    /* Import the same with zero copy disabled for comparison */
+    Containers::Pointer<AbstractImporter> copyingImporter = _manager.instantiate("DdsImporter");
+    copyingImporter->addFlags(ImporterFlag::Quiet);
+    if(data.assumeYUpZBackward)
+        copyingImporter->configuration().setValue("assumeYUpZBackward", *data.assumeYUpZBackward);
+    CORRADE_VERIFY(copyingImporter->openFile(Utility::Path::join(DDSIMPORTER_TEST_DIR, data.filename)));
+
+    Containers::Optional<Containers::Array<char>> memory = Utility::Path::read(Utility::Path::join(DDSIMPORTER_TEST_DIR, data.filename));
+    CORRADE_VERIFY(memory);
+    CORRADE_VERIFY(open.open(*importer, *memory));
+
+    DataFlags dataFlags;
+    Containers::ArrayView<const char> imageData;
+    Containers::Array<char> expectedData;
+    if(importer->image3DCount()) {
+        Containers::Optional<ImageData3D> image = importer->image3D(0, data.level);
+        Containers::Optional<ImageData3D> expected = copyingImporter->image3D(0, data.level);
+        CORRADE_VERIFY(image);
+        CORRADE_VERIFY(expected);
+        CORRADE_COMPARE(image->flags(), expected->flags());
+        dataFlags = image->dataFlags();
+        imageData = image->data();
+        expectedData = expected->release();
+    } else {
+        Containers::Optional<ImageData2D> image = importer->image2D(0, data.level);
+        Containers::Optional<ImageData2D> expected = copyingImporter->image2D(0, data.level);
+        CORRADE_VERIFY(image);
+        CORRADE_VERIFY(expected);
+        CORRADE_COMPARE(image->flags(), expected->flags());
+        CORRADE_COMPARE(image->storage().alignment(), expected->storage().alignment());
+        dataFlags = image->dataFlags();
+        imageData = image->data();
+        expectedData = expected->release();
+    }
+
+    /* Only memory passed to openMemory() is guaranteed to stay in scope and
+       thus gets referenced, the data are copied otherwise. The data views
+       stay valid after the image is destroyed in that case, so it's fine to
+       compare them here. */
+    if(data.zeroCopy && open.open == OpenMemoryData[1].open) {
+        CORRADE_COMPARE(dataFlags, DataFlags{});
+        CORRADE_VERIFY(imageData.data() >= memory->data());
+        CORRADE_VERIFY(imageData.data() + imageData.size() <= memory->end());
+        CORRADE_COMPARE_AS(imageData, expectedData,
+            TestSuite::Compare::Container);
+    } else {
+        CORRADE_COMPARE(dataFlags, DataFlag::Owned|DataFlag::Mutable);
+    }
+}
+
 void DdsImporterTest::openMemory() {
     /* compared to dxt3() uses openData() & openMemory() instead of openFile()
        to test data copying on import, and a deliberately small file */
@@ -0,0 +1,289 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DracoImporter.h"
+
+#include <cstring>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+#include <Corrade/Utility/Debug.h>
+#include <Corrade/Utility/Format.h>
+#include <Magnum/Trade/MeshData.h>
+
+#include <draco/compression/decode.h>
+#include <draco/mesh/mesh.h>
+#include <draco/point_cloud/point_cloud.h>
+
+namespace Magnum { namespace Trade {
+
+using namespace Containers::Literals;
+
+struct DracoImporter::State {
+    std::unique_ptr<draco::PointCloud> pointCloud;
+    MeshPrimitive primitive;
+    /* Name and format for each attribute in pointCloud */
+    Containers::Array<Containers::Pair<MeshAttribute, VertexFormat>> attributes;
+    /* Custom attribute names, indexed by meshAttributeCustom() */
+    Containers::Array<Containers::String> attributeNames;
+};
+
+DracoImporter::DracoImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): AbstractImporter{manager, plugin} {}
+
+DracoImporter::~DracoImporter() = default;
+
+ImporterFeatures DracoImporter::doFeatures() const { return ImporterFeature::OpenData; }
+
+bool DracoImporter::doIsOpened() const { return !!_state; }
+
+void DracoImporter::doClose() { _state = nullptr; }
+
+namespace {
+
+Containers::StringView attributeTypeName(const draco::GeometryAttribute::Type type) {
+    switch(type) {
+        case draco::GeometryAttribute::POSITION: return "POSITION"_s;
+        case draco::GeometryAttribute::NORMAL: return "NORMAL"_s;
+        case draco::GeometryAttribute::COLOR: return "COLOR"_s;
+        case draco::GeometryAttribute::TEX_COORD: return "TEX_COORD"_s;
+        /* Other types such as TANGENT, JOINTS or WEIGHTS are only present if
+           Draco is built with the transcoder enabled, treat them as generic
+           to not need to depend on that */
+        default: return "GENERIC"_s;
+    }
+}
+
+}
+
+void DracoImporter::doOpenData(Containers::Array<char>&& data, DataFlags) {
+    /* Decoding the whole file right away. There's just one mesh in it and
+       this is the only way to know whether it's valid, and the input data
+       don't need to be kept around afterwards. */
+    draco::DecoderBuffer buffer;
+    buffer.Init(data.data(), data.size());
+
+    const draco::StatusOr<draco::EncodedGeometryType> geometryType = draco::Decoder::GetEncodedGeometryType(&buffer);
+    if(!geometryType.ok()) {
+        Error{} << "Trade::DracoImporter::openData(): failed to open the file:" << geometryType.status().error_msg();
+        return;
+    }
+
+    Containers::Pointer<State> state{InPlaceInit};
+    draco::Decoder decoder;
+    if(geometryType.value() == draco::TRIANGULAR_MESH) {
+        draco::StatusOr<std::unique_ptr<draco::Mesh>> mesh = decoder.DecodeMeshFromBuffer(&buffer);
+        if(!mesh.ok()) {
+            Error{} << "Trade::DracoImporter::openData(): failed to decode the mesh:" << mesh.status().error_msg();
+            return;
+        }
+        state->pointCloud = Utility::move(mesh).value();
+        state->primitive = MeshPrimitive::Triangles;
+    } else if(geometryType.value() == draco::POINT_CLOUD) {
+        draco::StatusOr<std::unique_ptr<draco::PointCloud>> pointCloud = decoder.DecodePointCloudFromBuffer(&buffer);
+        if(!pointCloud.ok()) {
+            Error{} << "Trade::DracoImporter::openData(): failed to decode the point cloud:" << pointCloud.status().error_msg();
+            return;
+        }
+        state->pointCloud = Utility::move(pointCloud).value();
+        state->primitive = MeshPrimitive::Points;
+    } else {
+        Error{} << "Trade::DracoImporter::openData(): unsupported geometry type" << Int(geometryType.value());
+        return;
+    }
+
+    /* Decide on attribute names and formats upfront, as the custom attribute
+       name mapping has to be available before mesh() is called */
+    const bool uniqueIdAttributeNames = configuration().value<bool>("uniqueIdAttributeNames");
+    state->attributes = Containers::Array<Containers::Pair<MeshAttribute, VertexFormat>>{NoInit, std::size_t(state->pointCloud->num_attributes())};
+    for(Int i = 0; i != state->pointCloud->num_attributes(); ++i) {
+        const draco::PointAttribute& attribute = *state->pointCloud->attribute(i);
+
+        VertexFormat componentFormat;
+        switch(attribute.data_type()) {
+            case draco::DT_INT8:
+                componentFormat = VertexFormat::Byte;
+                break;
+            case draco::DT_UINT8:
+                componentFormat = VertexFormat::UnsignedByte;
+                break;
+            case draco::DT_INT16:
+                componentFormat = VertexFormat::Short;
+                break;
+            case draco::DT_UINT16:
+                componentFormat = VertexFormat::UnsignedShort;
+                break;
+            case draco::DT_INT32:
+                componentFormat = VertexFormat::Int;
+                break;
+            case draco::DT_UINT32:
+                componentFormat = VertexFormat::UnsignedInt;
+                break;
+            case draco::DT_FLOAT32:
+                componentFormat = VertexFormat::Float;
+                break;
+            default:
+                Error{} << "Trade::DracoImporter::openData(): unsupported data type" << Int(attribute.data_type()) << "of attribute" << i;
+                return;
+        }
+
+        const UnsignedInt componentCount = attribute.num_components();
+        if(componentCount < 1 || componentCount > 4) {
+            Error{} << "Trade::DracoImporter::openData(): unsupported component count" << componentCount << "of attribute" << i;
+            return;
+        }
+
+        /* Draco allows the normalized bit to be set for any type, but
+           normalization makes sense only for 8- and 16-bit integers */
+        const bool normalized = attribute.normalized() && componentFormat != VertexFormat::Float && componentFormat != VertexFormat::Int && componentFormat != VertexFormat::UnsignedInt;
+        const VertexFormat format = vertexFormat(componentFormat, componentCount, normalized);
+
+        /* Recognize builtin attributes if the format is valid for them */
+        MeshAttribute name{};
+        if(!uniqueIdAttributeNames) {
+            const bool integral32 = componentFormat == VertexFormat::Int || componentFormat == VertexFormat::UnsignedInt;
+            switch(attribute.attribute_type()) {
+                case draco::GeometryAttribute::POSITION:
+                    if((componentCount == 2 || componentCount == 3) && !integral32)
+                        name = MeshAttribute::Position;
+                    break;
+                case draco::GeometryAttribute::NORMAL:
+                    if(componentCount == 3 && (componentFormat == VertexFormat::Float || (normalized && (componentFormat == VertexFormat::Byte || componentFormat == VertexFormat::Short))))
+                        name = MeshAttribute::Normal;
+                    break;
+                case draco::GeometryAttribute::TEX_COORD:
+                    if(componentCount == 2 && !integral32)
+                        name = MeshAttribute::TextureCoordinates;
+                    break;
+                case draco::GeometryAttribute::COLOR:
+                    if((componentCount == 3 || componentCount == 4) && (componentFormat == VertexFormat::Float || (normalized && (componentFormat == VertexFormat::UnsignedByte || componentFormat == VertexFormat::UnsignedShort))))
+                        name = MeshAttribute::Color;
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        /* Otherwise map to a custom attribute, reusing the name if it was
+           already used by an earlier attribute */
+        if(name == MeshAttribute{}) {
+            const Containers::String customName = uniqueIdAttributeNames ?
+                Utility::format("{}", attribute.unique_id()) :
+                Containers::String{attributeTypeName(attribute.attribute_type())};
+            UnsignedInt customId = 0;
+            for(; customId != state->attributeNames.size(); ++customId)
+                if(state->attributeNames[customId] == customName)
+                    break;
+            if(customId == state->attributeNames.size())
+                arrayAppend(state->attributeNames, customName);
+            name = meshAttributeCustom(UnsignedShort(customId));
+        }
+
+        state->attributes[i] = {name, format};
+    }
+
+    _state = Utility::move(state);
+}
+
+UnsignedInt DracoImporter::doMeshCount() const { return 1; }
+
+Containers::Optional<MeshData> DracoImporter::doMesh(UnsignedInt, UnsignedInt) {
+    const draco::PointCloud& pointCloud = *_state->pointCloud;
+    const UnsignedInt vertexCount = pointCloud.num_points();
+
+    /* Attributes are put one after another, each aligned to four bytes */
+    std::size_t vertexDataSize = 0;
+    for(const Containers::Pair<MeshAttribute, VertexFormat>& attribute: _state->attributes)
+        vertexDataSize += 4*((vertexCount*vertexFormatSize(attribute.second()) + 3)/4);
+
+    Containers::Array<char> vertexData{ValueInit, vertexDataSize};
+    /* Cannot be NoInit because that would use a custom deleter which is
+       disallowed to avoid dangling function pointer call after the plugin is
+       unloaded */
+    Containers::Array<MeshAttributeData> attributeData{_state->attributes.size()};
+    std::size_t vertexDataOffset = 0;
+    for(std::size_t i = 0; i != _state->attributes.size(); ++i) {
+        const draco::PointAttribute& attribute = *pointCloud.attribute(Int(i));
+        const std::size_t size = vertexFormatSize(_state->attributes[i].second());
+        const Containers::ArrayView<char> out = vertexData.sliceSize(vertexDataOffset, vertexCount*size);
+
+        /* If the attribute values map 1:1 to points, copy them in a single
+           go, otherwise go through the point to value mapping */
+        if(attribute.is_mapping_identity()) {
+            if(vertexCount) Utility::copy(Containers::StridedArrayView2D<const char>{
+                {reinterpret_cast<const char*>(attribute.GetAddress(draco::AttributeValueIndex{0})), (vertexCount - 1)*std::size_t(attribute.byte_stride()) + size},
+                {vertexCount, size},
+                {attribute.byte_stride(), 1}}, Containers::StridedArrayView2D<char>{out, {vertexCount, size}});
+        } else for(UnsignedInt j = 0; j != vertexCount; ++j) {
+            std::memcpy(out.data() + j*size, attribute.GetAddress(attribute.mapped_index(draco::PointIndex{j})), size);
+        }
+
+        attributeData[i] = MeshAttributeData{_state->attributes[i].first(), _state->attributes[i].second(), Containers::StridedArrayView1D<const void>{out, vertexCount, std::ptrdiff_t(size)}};
+        vertexDataOffset += 4*((vertexCount*size + 3)/4);
+    }
+
+    /* Point clouds are non-indexed */
+    if(_state->primitive == MeshPrimitive::Points)
+        return MeshData{MeshPrimitive::Points,
+            Utility::move(vertexData), Utility::move(attributeData),
+            vertexCount, _state->pointCloud.get()};
+
+    const draco::Mesh& mesh = static_cast<const draco::Mesh&>(pointCloud);
+    Containers::Array<char> indexData{NoInit, mesh.num_faces()*3*sizeof(UnsignedInt)};
+    const Containers::ArrayView<UnsignedInt> indices = Containers::arrayCast<UnsignedInt>(indexData);
+    for(UnsignedInt i = 0; i != mesh.num_faces(); ++i) {
+        const draco::Mesh::Face& face = mesh.face(draco::FaceIndex{i});
+        for(UnsignedInt j = 0; j != 3; ++j)
+            indices[i*3 + j] = face[j].value();
+    }
+
+    const MeshIndexData meshIndices{indices};
+    return MeshData{MeshPrimitive::Triangles,
+        Utility::move(indexData), meshIndices,
+        Utility::move(vertexData), Utility::move(attributeData),
+        vertexCount, _state->pointCloud.get()};
+}
+
+MeshAttribute DracoImporter::doMeshAttributeForName(const Containers::StringView name) {
+    if(_state) for(std::size_t i = 0; i != _state->attributeNames.size(); ++i)
+        if(_state->attributeNames[i] == name)
+            return meshAttributeCustom(UnsignedShort(i));
+    return MeshAttribute{};
+}
+
+Containers::String DracoImporter::doMeshAttributeName(const MeshAttribute name) {
+    return _state && meshAttributeCustom(name) < _state->attributeNames.size() ?
+        _state->attributeNames[meshAttributeCustom(name)] : "";
+}
+
+}}
+
+CORRADE_PLUGIN_REGISTER(DracoImporter, Magnum::Trade::DracoImporter,
+    MAGNUM_TRADE_ABSTRACTIMPORTER_PLUGIN_INTERFACE)
@@ -0,0 +1,190 @@
+#ifndef Magnum_Trade_DracoImporter_h
+#define Magnum_Trade_DracoImporter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::DracoImporter
+ * @m_since_latest_{plugins}
+ */
+
+#include <Corrade/Containers/Pointer.h>
+#include <Magnum/Trade/AbstractImporter.h>
+
+#include "MagnumPlugins/DracoImporter/configure.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_DRACOIMPORTER_BUILD_STATIC
+    #ifdef DracoImporter_EXPORTS
+        #define MAGNUM_DRACOIMPORTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_DRACOIMPORTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_DRACOIMPORTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_DRACOIMPORTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#else
+#define MAGNUM_DRACOIMPORTER_EXPORT
+#define MAGNUM_DRACOIMPORTER_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Draco importer plugin
+@m_since_latest_{plugins}
+
+Imports [Draco](https://google.github.io/draco/)-compressed (`*.drc`) meshes
+and point clouds using the [Draco](https://github.com/google/draco) library.
+The plugin is also used by @ref GltfImporter to decode meshes compressed with
+the [KHR_draco_mesh_compression](https://github.com/KhronosGroup/glTF/blob/main/extensions/2.0/Khronos/KHR_draco_mesh_compression/README.md)
+extension.
+
+@m_class{m-block m-success}
+
+@thirdparty This plugin makes use of the
+    [Draco](https://github.com/google/draco) library, licensed under
+    @m_class{m-label m-success} **Apache-2.0**
+    ([license text](https://opensource.org/licenses/Apache-2.0),
+    [choosealicense.com](https://choosealicense.com/licenses/apache-2.0/)). It
+    requires attribution for public use.
+
+@section Trade-DracoImporter-usage Usage
+
+@m_class{m-note m-success}
+
+@par
+    This class is a plugin that's meant to be dynamically loaded and used
+    through the base @ref AbstractImporter interface. See its documentation for
+    introduction and usage examples.
+
+This plugin depends on the @ref Trade and [Draco](https://github.com/google/draco)
+libraries and is built if `MAGNUM_WITH_DRACOIMPORTER` is enabled when building
+Magnum Plugins. To use as a dynamic plugin, load @cpp "DracoImporter" @ce via
+@ref Corrade::PluginManager::Manager.
+
+Additionally, if you're using Magnum as a CMake subproject, bundle the
+[magnum-plugins](https://github.com/mosra/magnum-plugins) and
+[Draco](https://github.com/google/draco) repositories and do the following. If
+you want to use system-installed Draco, omit the first part and point
+`CMAKE_PREFIX_PATH` to its installation dir if necessary.
+
+@code{.cmake}
+# Disable unneeded functionality
+set(DRACO_JS_GLUE OFF CACHE BOOL "" FORCE)
+set(DRACO_TRANSCODER_SUPPORTED OFF CACHE BOOL "" FORCE)
+add_subdirectory(draco EXCLUDE_FROM_ALL)
+
+set(MAGNUM_WITH_DRACOIMPORTER ON CACHE BOOL "" FORCE)
+add_subdirectory(magnum-plugins EXCLUDE_FROM_ALL)
+
+# So the dynamically loaded plugin gets built implicitly
+add_dependencies(your-app MagnumPlugins::DracoImporter)
+@endcode
+
+To use as a static plugin or as a dependency of another plugin with CMake, put
+[FindMagnumPlugins.cmake](https://github.com/mosra/magnum-plugins/blob/master/modules/FindMagnumPlugins.cmake)
+and [FindDraco.cmake](https://github.com/mosra/magnum-plugins/blob/master/modules/FindDraco.cmake)
+into your `modules/` directory, request the `DracoImporter` component of the
+`MagnumPlugins` package and link to the `MagnumPlugins::DracoImporter` target:
+
+@code{.cmake}
+find_package(MagnumPlugins REQUIRED DracoImporter)
+
+# ...
+target_link_libraries(your-app PRIVATE MagnumPlugins::DracoImporter)
+@endcode
+
+See @ref building-plugins, @ref cmake-plugins, @ref plugins and
+@ref file-formats for more information.
+
+@section Trade-DracoImporter-behavior Behavior and limitations
+
+The file is decoded already during @ref openData(), the importer then exposes
+exactly one mesh. Draco triangle meshes are imported as indexed
+@ref MeshPrimitive::Triangles with @ref MeshIndexType::UnsignedInt indices,
+point clouds as non-indexed @ref MeshPrimitive::Points. Attributes are put into
+the vertex data in the order they're stored in the file, each in a separate
+contiguous block. Quantized attributes are dequantized by the decoder, so e.g.
+quantized positions are always imported as @ref VertexFormat::Vector3.
+
+Draco `POSITION`, `NORMAL`, `TEX_COORD` and `COLOR` attributes are imported as
+@ref MeshAttribute::Position, @relativeref{MeshAttribute,Normal},
+@relativeref{MeshAttribute,TextureCoordinates} and
+@relativeref{MeshAttribute,Color} if their type is valid for given attribute.
+Otherwise, and for `GENERIC` and other attribute types, they're imported as
+custom attributes named after the Draco attribute type. The mapping to/from a
+string can be queried using @ref meshAttributeName() and
+@ref meshAttributeForName(). Attributes with 64-bit or boolean types, or more
+than four components, cause the import to fail.
+
+If the @cb{.ini} uniqueIdAttributeNames @ce
+@ref Trade-DracoImporter-configuration "configuration option" is enabled, all
+attributes are imported as custom attributes named after their Draco unique ID
+instead, such as @cpp "0" @ce or @cpp "3" @ce. This is what @ref GltfImporter
+uses, as the KHR_draco_mesh_compression extension references the compressed
+attributes by their unique IDs and their meaning is given by the glTF file.
+
+The @ref MeshData::importerState() points to the decoded `draco::PointCloud`,
+which is a `draco::Mesh` in case of triangle meshes.
+
+@section Trade-DracoImporter-configuration Plugin-specific configuration
+
+It's possible to tune various import options through @ref configuration(). See
+below for all options and their default values:
+
+@snippet MagnumPlugins/DracoImporter/DracoImporter.conf configuration_
+
+See @ref plugins-configuration for more information and an example showing how
+to edit the configuration values.
+*/
+class MAGNUM_DRACOIMPORTER_EXPORT DracoImporter: public AbstractImporter {
+    public:
+        /** @brief Plugin manager constructor */
+        explicit DracoImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin);
+
+        ~DracoImporter();
+
+    private:
+        struct State;
+
+        MAGNUM_DRACOIMPORTER_LOCAL ImporterFeatures doFeatures() const override;
+        MAGNUM_DRACOIMPORTER_LOCAL bool doIsOpened() const override;
+        MAGNUM_DRACOIMPORTER_LOCAL void doClose() override;
+        MAGNUM_DRACOIMPORTER_LOCAL void doOpenData(Containers::Array<char>&& data, DataFlags dataFlags) override;
+
+        MAGNUM_DRACOIMPORTER_LOCAL UnsignedInt doMeshCount() const override;
+        MAGNUM_DRACOIMPORTER_LOCAL Containers::Optional<MeshData> doMesh(UnsignedInt id, UnsignedInt level) override;
+        MAGNUM_DRACOIMPORTER_LOCAL MeshAttribute doMeshAttributeForName(Containers::StringView name) override;
+        MAGNUM_DRACOIMPORTER_LOCAL Containers::String doMeshAttributeName(MeshAttribute name) override;
+
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
@@ -0,0 +1,237 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/String.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+#include <Magnum/Math/Vector3.h>
+#include <Magnum/Trade/AbstractImporter.h>
+#include <Magnum/Trade/MeshData.h>
+
+/* Draco doesn't have any encoder tool that would be commonly available, so
+   the test files are generated on the fly */
+#include <draco/compression/encode.h>
+#include <draco/mesh/mesh.h>
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct DracoImporterTest: TestSuite::Tester {
+    explicit DracoImporterTest();
+
+    void empty();
+    void invalid();
+
+    void mesh();
+    void pointCloud();
+    void uniqueIdAttributeNames();
+
+    /* Explicitly forbid system-wide plugin dependencies */
+    PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
+};
+
+const struct {
+    const char* name;
+    const char* data;
+} InvalidData[]{
+    {"wrong file signature", "DRACQ\x02\x02\x01\x01\x00\x00"},
+    {"too short header", "DRACO\x02"},
+};
+
+const Vector3 Positions[]{
+    {1.0f, 2.0f, 3.0f},
+    {-1.0f, 0.5f, 2.0f},
+    {0.0f, 0.0f, -1.0f},
+    {4.5f, -2.0f, 0.25f}
+};
+
+const Vector2us Generic[]{
+    {15, 3},
+    {22, 7},
+    {65535, 0},
+    {1, 1024}
+};
+
+/* Encodes the above as a Draco triangle mesh with two triangles or as a point
+   cloud. Using the sequential encoding and no quantization, which preserves
+   the vertex order and the exact values. */
+Containers::Array<char> encode(bool pointCloud) {
+    draco::Mesh mesh;
+    mesh.set_num_points(Containers::arraySize(Positions));
+
+    draco::GeometryAttribute position;
+    position.Init(draco::GeometryAttribute::POSITION, nullptr, 3, draco::DT_FLOAT32, false, sizeof(Vector3), 0);
+    const Int positionId = mesh.AddAttribute(position, true, Containers::arraySize(Positions));
+    draco::GeometryAttribute generic;
+    generic.Init(draco::GeometryAttribute::GENERIC, nullptr, 2, draco::DT_UINT16, false, sizeof(Vector2us), 0);
+    const Int genericId = mesh.AddAttribute(generic, true, Containers::arraySize(Generic));
+    for(UnsignedInt i = 0; i != Containers::arraySize(Positions); ++i) {
+        mesh.attribute(positionId)->SetAttributeValue(draco::AttributeValueIndex{i}, &Positions[i]);
+        mesh.attribute(genericId)->SetAttributeValue(draco::AttributeValueIndex{i}, &Generic[i]);
+    }
+
+    draco::Encoder encoder;
+    draco::EncoderBuffer buffer;
+    if(pointCloud) {
+        encoder.SetEncodingMethod(draco::POINT_CLOUD_SEQUENTIAL_ENCODING);
+        CORRADE_INTERNAL_ASSERT_OUTPUT(encoder.EncodePointCloudToBuffer(mesh, &buffer).ok());
+    } else {
+        mesh.AddFace({draco::PointIndex{0}, draco::PointIndex{1}, draco::PointIndex{2}});
+        mesh.AddFace({draco::PointIndex{2}, draco::PointIndex{1}, draco::PointIndex{3}});
+        encoder.SetEncodingMethod(draco::MESH_SEQUENTIAL_ENCODING);
+        CORRADE_INTERNAL_ASSERT_OUTPUT(encoder.EncodeMeshToBuffer(mesh, &buffer).ok());
+    }
+
+    return Containers::Array<char>{InPlaceInit, Containers::arrayView(buffer.data(), buffer.size())};
+}
+
+DracoImporterTest::DracoImporterTest() {
+    addTests({&DracoImporterTest::empty});
+
+    addInstancedTests({&DracoImporterTest::invalid},
+        Containers::arraySize(InvalidData));
+
+    addTests({&DracoImporterTest::mesh,
+              &DracoImporterTest::pointCloud,
+              &DracoImporterTest::uniqueIdAttributeNames});
+
+    /* Load the plugin directly from the build tree. Otherwise it's static and
+       already loaded. */
+    #ifdef DRACOIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(DRACOIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+}
+
+void DracoImporterTest::empty() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("DracoImporter");
+
+    Containers::String out;
+    Error redirectError{&out};
+    char a{};
+    /* Explicitly checking non-null but empty view */
+    CORRADE_VERIFY(!importer->openData({&a, 0}));
+    /* The actual message comes from Draco, check just the prefix */
+    CORRADE_COMPARE_AS(out,
+        "Trade::DracoImporter::openData(): failed to open the file: ",
+        TestSuite::Compare::StringHasPrefix);
+}
+
+void DracoImporterTest::invalid() {
+    auto&& data = InvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("DracoImporter");
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(Containers::StringView{data.data}));
+    CORRADE_COMPARE_AS(out,
+        "Trade::DracoImporter::openData(): failed to open the file: ",
+        TestSuite::Compare::StringHasPrefix);
+}
+
+void DracoImporterTest::mesh() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("DracoImporter");
+    CORRADE_VERIFY(importer->openData(encode(false)));
+    CORRADE_COMPARE(importer->meshCount(), 1);
+
+    /* The generic attribute is a custom one named after its type */
+    const MeshAttribute generic = importer->meshAttributeForName("GENERIC");
+    CORRADE_VERIFY(isMeshAttributeCustom(generic));
+    CORRADE_COMPARE(importer->meshAttributeName(generic), "GENERIC");
+
+    Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Triangles);
+    CORRADE_VERIFY(mesh->isIndexed());
+    CORRADE_COMPARE(mesh->indexType(), MeshIndexType::UnsignedInt);
+    CORRADE_COMPARE_AS(mesh->indices<UnsignedInt>(), Containers::arrayView<UnsignedInt>({
+        0, 1, 2, 2, 1, 3
+    }), TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(mesh->vertexCount(), 4);
+    CORRADE_COMPARE(mesh->attributeCount(), 2);
+    CORRADE_COMPARE(mesh->attributeName(0), MeshAttribute::Position);
+    CORRADE_COMPARE(mesh->attributeFormat(0), VertexFormat::Vector3);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(0),
+        Containers::arrayView(Positions),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(mesh->attributeName(1), generic);
+    CORRADE_COMPARE(mesh->attributeFormat(1), VertexFormat::Vector2us);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector2us>(1),
+        Containers::arrayView(Generic),
+        TestSuite::Compare::Container);
+}
+
+void DracoImporterTest::pointCloud() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("DracoImporter");
+    CORRADE_VERIFY(importer->openData(encode(true)));
+    CORRADE_COMPARE(importer->meshCount(), 1);
+
+    Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Points);
+    CORRADE_VERIFY(!mesh->isIndexed());
+    CORRADE_COMPARE(mesh->vertexCount(), 4);
+    CORRADE_COMPARE(mesh->attributeCount(), 2);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position),
+        Containers::arrayView(Positions),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector2us>(importer->meshAttributeForName("GENERIC")),
+        Containers::arrayView(Generic),
+        TestSuite::Compare::Container);
+}
+
+void DracoImporterTest::uniqueIdAttributeNames() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("DracoImporter");
+    importer->configuration().setValue("uniqueIdAttributeNames", true);
+    CORRADE_VERIFY(importer->openData(encode(false)));
+
+    /* All attributes are custom, including the position */
+    const MeshAttribute position = importer->meshAttributeForName("0");
+    const MeshAttribute generic = importer->meshAttributeForName("1");
+    CORRADE_VERIFY(isMeshAttributeCustom(position));
+    CORRADE_VERIFY(isMeshAttributeCustom(generic));
+    CORRADE_COMPARE(importer->meshAttributeForName("GENERIC"), MeshAttribute{});
+
+    Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_VERIFY(!mesh->hasAttribute(MeshAttribute::Position));
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(position),
+        Containers::arrayView(Positions),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector2us>(generic),
+        Containers::arrayView(Generic),
+        TestSuite::Compare::Container);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::DracoImporterTest)
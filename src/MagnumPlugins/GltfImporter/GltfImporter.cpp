@@ -30,7 +30,10 @@
 #include "GltfImporter.h"
 
 #include <algorithm> /* std::sort(), std::unique() */
+#include <atomic>
 #include <cctype>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/ArrayTuple.h>
@@ -38,6 +41,7 @@
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/Pointer.h>
 #include <Corrade/Containers/Reference.h>
 #include <Corrade/Containers/StaticArray.h>
 #include <Corrade/Containers/StridedBitArrayView.h>
@@ -46,6 +50,7 @@
 #include <Corrade/Containers/StringStlHash.h>
 #include <Corrade/Containers/StringView.h>
 #include <Corrade/Containers/Triple.h>
+#include <Corrade/PluginManager/Manager.h>
 #include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/ConfigurationGroup.h>
 #include <Corrade/Utility/Format.h>
@@ -59,6 +64,7 @@
 #include <Magnum/Math/FunctionsBatch.h>
 #include <Magnum/Math/Matrix3.h>
 #include <Magnum/Math/Matrix4.h>
+#include <Magnum/Math/PackingBatch.h>
 #include <Magnum/Math/Quaternion.h>
 #include <Magnum/Trade/AnimationData.h>
 #include <Magnum/Trade/CameraData.h>
@@ -137,7 +143,20 @@ bool isBuiltinMeshAttribute(Utility::ConfigurationGroup& configuration, const Co
 struct GltfImporter::BufferView {
     Containers::ArrayView<const char> data;
     UnsignedInt stride; /* 0 if not strided */
-    UnsignedInt buffer; /* points into _d->buffers */
+    /* Points into _d->buffers. For views compressed with
+       EXT_meshopt_compression it's the buffer count plus the view ID, with
+       data pointing into _d->decodedBufferViews, so such views are never
+       treated as sharing a buffer with anything else. */
+    UnsignedInt buffer;
+};
+
+struct GltfImporter::ImageSource {
+    /* Decoded base64 payload, if the image is a data URI */
+    Containers::Optional<Containers::Array<char>> data;
+    /* Embedded image data, pointing either to the above or into a buffer */
+    Containers::ArrayView<const void> view;
+    /* Full path to an external image file, empty if the image is embedded */
+    Containers::String filename;
 };
 
 struct GltfImporter::Accessor {
@@ -158,6 +177,32 @@ struct GltfImporter::Accessor {
     Containers::StridedArrayView2D<const char> sparseValues;
 };
 
+struct GltfImporter::Primitive {
+    struct Attribute {
+        /* Attribute name in the file, a view on the JSON input */
+        Containers::StringView gltfName;
+        UnsignedInt accessorId;
+        /* Format is adapted for joint IDs and weights, which become array
+           attributes, the rest is the same as in _d->accessors */
+        Accessor accessor;
+        MeshAttribute name;
+        UnsignedShort arraySize;
+        Int morphTargetId;
+    };
+
+    MeshPrimitive mode;
+    /* Only remembered here, decoded by doMesh() once it's known that some
+       accessor actually needs the compressed data */
+    Containers::Optional<Utility::JsonToken> dracoCompression;
+    /* Sorted by morph target ID and name, with duplicates removed */
+    Containers::Array<Attribute> attributes;
+    UnsignedInt vertexCount;
+    /* Set if the primitive is indexed */
+    Containers::Optional<Accessor> indices;
+    UnsignedInt indicesId;
+    MeshIndexType indexType;
+};
+
 namespace {
     struct Sampler {
         SamplerFilter minificationFilter;
@@ -165,6 +210,14 @@ namespace {
         SamplerMipmap mipmap;
         Math::Vector3<SamplerWrapping> wrapping;
     };
+
+    /* Levels of an image decoded upfront by GltfImporter::prefetchImages().
+       Only one of the arrays is non-empty, depending on whether the image is
+       2D or 3D. Both are empty if the image wasn't prefetched. */
+    struct PrefetchedImage {
+        Containers::Array<Containers::Optional<ImageData2D>> levels2D;
+        Containers::Array<Containers::Optional<ImageData3D>> levels3D;
+    };
 }
 
 struct GltfImporter::Document {
@@ -209,10 +262,19 @@ struct GltfImporter::Document {
        is empty and has no URI or it's the implicit buffer of a *.glb, it's
        NullOpt as well. */
     Containers::Array<Containers::Optional<Containers::Array<char>>> buffers;
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    /* Files mapped with the mapExternalBuffers option enabled, with the
+       buffers above being non-owning views on these */
+    Containers::Array<Containers::Array<const char, Utility::Path::MapDeleter>> mappedFiles;
+    #endif
     /* Parsed and validated buffer views. Same as with buffers, if any of these
        failed to validate, it'll stay a NullOpt, meaning the same failure
        message will be printed next time it's accessed. */
     Containers::Array<Containers::Optional<BufferView>> bufferViews;
+    /* Decoded data of buffer views compressed with EXT_meshopt_compression,
+       referenced from bufferViews. Empty for views that aren't compressed or
+       weren't parsed yet. */
+    Containers::Array<Containers::Array<char>> decodedBufferViews;
     /* Parsed and validated accessors. Same as with buffers and buffer views,
        if any of these failed to validate, it'll stay a NullOpt, meaning the
        same failure message will be printed next time it's accessed.
@@ -283,6 +345,16 @@ struct GltfImporter::Document {
        STL guarantees iterator stability, i.e. the strings don't get moved
        anywhere even with SSO */
     Containers::Array<Containers::Triple<Containers::StringView, SceneFieldType, SceneFieldFlags>> sceneFieldNamesTypesFlags;
+    /* ID of the first of three consecutive custom scene fields for
+       EXT_mesh_gpu_instancing translation, rotation and scaling, or
+       ~UnsignedInt{} if the extension isn't used */
+    UnsignedInt meshGpuInstancingSceneFields = ~UnsignedInt{};
+    /* Whether EXT_mesh_gpu_instancing is listed in extensionsUsed and whether
+       the above custom scene fields were discovered already. With the
+       lazySceneFieldDiscovery option enabled the discovery happens only once
+       scene fields are first needed. */
+    bool meshGpuInstancingUsed = false;
+    bool sceneFieldsDiscovered = false;
     Containers::Array<Containers::StringView> meshAttributeNames{InPlaceInit, {
         #ifdef MAGNUM_BUILD_DEPRECATED
         "JOINTS"_s,
@@ -307,16 +379,32 @@ struct GltfImporter::Document {
     Containers::Array<Containers::Pair<std::size_t, Containers::Reference<const Utility::JsonTokenData>>> gltfMeshPrimitiveMap;
     Containers::Array<std::size_t> meshSizeOffsets;
 
+    /* Mesh IDs parsed from the meshBatch option. If non-empty, an additional
+       mesh with ID gltfMeshPrimitiveMap.size() is reported, containing all
+       these meshes batched together. The ranges are filled on every import
+       of that mesh and are what its importerState() points to. */
+    Containers::Array<UnsignedInt> meshBatchIds;
+    Containers::Array<MeshBatchRange> meshBatchRanges;
+
     /* If a file contains texture coordinates that are not floats or normalized
        in the 0-1, the textureCoordinateYFlipInMaterial option is enabled
        implicitly as we can't perform Y-flip directly on the data. */
     bool textureCoordinateYFlipInMaterial = false;
 
-    UnsignedInt imageImporterId = ~UnsignedInt{};
-    Containers::Optional<AnyImageImporter> imageImporter;
+    /* Recently used image importers, most recent first, with at most
+       imageImporterCacheSize items. A null importer means the import for
+       given ID failed. */
+    Containers::Array<Containers::Pair<UnsignedInt, Containers::Pointer<AnyImageImporter>>> imageImporters;
+    std::size_t imageImporterCacheHits = 0;
+    std::size_t imageImporterCacheMisses = 0;
+
+    /* Images decoded by prefetchImages(), indexed by glTF image ID. Empty if
+       nothing was prefetched yet. A level is released when it's retrieved
+       through image2D() or image3D(). */
+    Containers::Array<PrefetchedImage> prefetchedImages;
 };
 
-Containers::Optional<Containers::Array<char>> GltfImporter::loadUri(const char* const errorPrefix, const Containers::StringView uri) {
+Containers::Optional<Containers::Array<char>> GltfImporter::loadUri(const char* const errorPrefix, const Containers::StringView uri, const bool map) {
     if(isDataUri(uri)) {
         /* Data URI with base64 payload according to RFC 2397:
            data:[<mediatype>][;base64],<data> */
@@ -359,6 +447,24 @@ Containers::Optional<Containers::Array<char>> GltfImporter::loadUri(const char*
 
         const Containers::String fullPath = Utility::Path::join(Utility::Path::path(*_d->filename), *decodedUri);
 
+        /* If mapping is requested, keep the mapping alive until the file is
+           closed and return a non-owning view on it. On platforms that don't
+           support mapping the file is read instead. */
+        #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+        if(map) {
+            if(Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> data = Utility::Path::mapRead(fullPath)) {
+                const Containers::ArrayView<const char> view = *data;
+                arrayAppend(_d->mappedFiles, Utility::move(*data));
+                return Containers::Array<char>{const_cast<char*>(view.data()), view.size(), [](char*, std::size_t){}};
+            }
+
+            Error{} << errorPrefix << "error opening" << fullPath;
+            return {};
+        }
+        #else
+        static_cast<void>(map);
+        #endif
+
         if(Containers::Optional<Containers::Array<char>> data = Utility::Path::read(fullPath))
             return data;
 
@@ -394,7 +500,7 @@ Containers::Optional<Containers::ArrayView<const char>> GltfImporter::parseBuffe
             Error{} << errorPrefix << "buffer" << bufferId << "has invalid uri property";
             return {};
         }
-        if(!(storage = loadUri(errorPrefix, gltfBufferUri->asString())))
+        if(!(storage = loadUri(errorPrefix, gltfBufferUri->asString(), configuration().value<bool>("mapExternalBuffers"))))
             return {};
         view = *storage;
     } else {
@@ -442,12 +548,6 @@ Containers::Optional<GltfImporter::BufferView> GltfImporter::parseBufferView(con
         return {};
     }
 
-    /* Get the buffer early and continue only if that doesn't fail. This also
-       checks that the buffer ID is in bounds. */
-    Containers::Optional<Containers::ArrayView<const char>> buffer = parseBuffer(errorPrefix, gltfBufferId->asUnsignedInt());
-    if(!buffer)
-        return {};
-
     /* Byte offset is optional, defaulting to 0 */
     const Utility::JsonIterator gltfByteOffset = gltfBufferView.find("byteOffset"_s);
     if(gltfByteOffset && !_d->gltf->parseSize(*gltfByteOffset)) {
@@ -470,6 +570,36 @@ Containers::Optional<GltfImporter::BufferView> GltfImporter::parseBufferView(con
         return {};
     }
 
+    /* If the view is compressed with EXT_meshopt_compression, the buffer it
+       references is just a fallback that may not even have any data, so the
+       compressed data is decoded instead */
+    if(const Utility::JsonIterator gltfExtensions = gltfBufferView.find("extensions"_s)) {
+        if(!_d->gltf->parseObject(*gltfExtensions)) {
+            Error{} << errorPrefix << "buffer view" << bufferViewId << "has invalid extensions property";
+            return {};
+        }
+
+        if(const Utility::JsonIterator gltfMeshoptCompression = gltfExtensions->find("EXT_meshopt_compression"_s)) {
+            Containers::Optional<Containers::ArrayView<const char>> decoded = parseMeshoptCompressedBufferView(errorPrefix, bufferViewId, *gltfMeshoptCompression, gltfByteLength->asSize());
+            if(!decoded)
+                return {};
+
+            /* The decoded data aren't in any buffer, use a buffer ID that
+               isn't shared with any other view so mesh import doesn't attempt
+               to merge its ranges with data from other buffers */
+            storage.emplace(*decoded,
+                gltfByteStride ? gltfByteStride->asUnsignedInt() : 0,
+                UnsignedInt(_d->gltfBuffers.size() + bufferViewId));
+            return storage;
+        }
+    }
+
+    /* Get the buffer and continue only if that doesn't fail. This also checks
+       that the buffer ID is in bounds. */
+    Containers::Optional<Containers::ArrayView<const char>> buffer = parseBuffer(errorPrefix, gltfBufferId->asUnsignedInt());
+    if(!buffer)
+        return {};
+
     const std::size_t offset = gltfByteOffset ? gltfByteOffset->asSize() : 0;
     const std::size_t requiredBufferSize = offset + gltfByteLength->asSize();
     if(buffer->size() < requiredBufferSize) {
@@ -487,6 +617,154 @@ Containers::Optional<GltfImporter::BufferView> GltfImporter::parseBufferView(con
     return storage;
 }
 
+Containers::Optional<Containers::ArrayView<const char>> GltfImporter::parseMeshoptCompressedBufferView(const char* const errorPrefix, const UnsignedInt bufferViewId, const Utility::JsonToken gltfMeshoptCompression, const std::size_t byteLength) {
+    if(!_d->gltf->parseObject(gltfMeshoptCompression)) {
+        Error{} << errorPrefix << "buffer view" << bufferViewId << "has invalid EXT_meshopt_compression extension";
+        return {};
+    }
+
+    const Utility::JsonIterator gltfBufferId = gltfMeshoptCompression.find("buffer"_s);
+    if(!gltfBufferId || !_d->gltf->parseUnsignedInt(*gltfBufferId)) {
+        Error{} << errorPrefix << "buffer view" << bufferViewId << "has missing or invalid EXT_meshopt_compression buffer property";
+        return {};
+    }
+
+    /* Byte offset is optional, defaulting to 0 */
+    const Utility::JsonIterator gltfByteOffset = gltfMeshoptCompression.find("byteOffset"_s);
+    if(gltfByteOffset && !_d->gltf->parseSize(*gltfByteOffset)) {
+        Error{} << errorPrefix << "buffer view" << bufferViewId << "has invalid EXT_meshopt_compression byteOffset property";
+        return {};
+    }
+
+    const Utility::JsonIterator gltfByteLength = gltfMeshoptCompression.find("byteLength"_s);
+    if(!gltfByteLength || !_d->gltf->parseSize(*gltfByteLength)) {
+        Error{} << errorPrefix << "buffer view" << bufferViewId << "has missing or invalid EXT_meshopt_compression byteLength property";
+        return {};
+    }
+
+    /* Unlike with the buffer view itself, byte stride and count are
+       mandatory */
+    const Utility::JsonIterator gltfByteStride = gltfMeshoptCompression.find("byteStride"_s);
+    if(!gltfByteStride || !_d->gltf->parseUnsignedInt(*gltfByteStride)) {
+        Error{} << errorPrefix << "buffer view" << bufferViewId << "has missing or invalid EXT_meshopt_compression byteStride property";
+        return {};
+    }
+
+    const Utility::JsonIterator gltfCount = gltfMeshoptCompression.find("count"_s);
+    if(!gltfCount || !_d->gltf->parseSize(*gltfCount)) {
+        Error{} << errorPrefix << "buffer view" << bufferViewId << "has missing or invalid EXT_meshopt_compression count property";
+        return {};
+    }
+
+    const Utility::JsonIterator gltfMode = gltfMeshoptCompression.find("mode"_s);
+    if(!gltfMode || !_d->gltf->parseString(*gltfMode)) {
+        Error{} << errorPrefix << "buffer view" << bufferViewId << "has missing or invalid EXT_meshopt_compression mode property";
+        return {};
+    }
+
+    /* Filter is optional, defaulting to NONE */
+    const Utility::JsonIterator gltfFilter = gltfMeshoptCompression.find("filter"_s);
+    if(gltfFilter && !_d->gltf->parseString(*gltfFilter)) {
+        Error{} << errorPrefix << "buffer view" << bufferViewId << "has invalid EXT_meshopt_compression filter property";
+        return {};
+    }
+
+    /* Validate the mode and filter against the stride. The decoders assert on
+       these so it has to be done before. */
+    const Containers::StringView mode = gltfMode->asString();
+    const Containers::StringView filter = gltfFilter ? gltfFilter->asString() : "NONE"_s;
+    const UnsignedInt stride = gltfByteStride->asUnsignedInt();
+    const std::size_t count = gltfCount->asSize();
+    if(mode == "ATTRIBUTES"_s) {
+        if(stride % 4 || stride == 0 || stride > 256) {
+            Error{} << errorPrefix << "buffer view" << bufferViewId << "has invalid EXT_meshopt_compression byteStride" << stride << "for ATTRIBUTES, expected a multiple of 4 between 4 and 256";
+            return {};
+        }
+    } else if(mode == "TRIANGLES"_s || mode == "INDICES"_s) {
+        if(stride != 2 && stride != 4) {
+            Error{} << errorPrefix << "buffer view" << bufferViewId << "has invalid EXT_meshopt_compression byteStride" << stride << "for" << mode << Debug::nospace << ", expected 2 or 4";
+            return {};
+        }
+        if(mode == "TRIANGLES"_s && count % 3) {
+            Error{} << errorPrefix << "buffer view" << bufferViewId << "has invalid EXT_meshopt_compression count" << count << "for TRIANGLES, expected a multiple of 3";
+            return {};
+        }
+    } else {
+        Error{} << errorPrefix << "buffer view" << bufferViewId << "has unrecognized EXT_meshopt_compression mode" << mode;
+        return {};
+    }
+
+    if(filter != "NONE"_s) {
+        if(mode != "ATTRIBUTES"_s) {
+            Error{} << errorPrefix << "buffer view" << bufferViewId << "has EXT_meshopt_compression filter" << filter << "but mode" << mode;
+            return {};
+        }
+        if(filter == "OCTAHEDRAL"_s) {
+            if(stride != 4 && stride != 8) {
+                Error{} << errorPrefix << "buffer view" << bufferViewId << "has invalid EXT_meshopt_compression byteStride" << stride << "for OCTAHEDRAL filter, expected 4 or 8";
+                return {};
+            }
+        } else if(filter == "QUATERNION"_s) {
+            if(stride != 8) {
+                Error{} << errorPrefix << "buffer view" << bufferViewId << "has invalid EXT_meshopt_compression byteStride" << stride << "for QUATERNION filter, expected 8";
+                return {};
+            }
+        } else if(filter != "EXPONENTIAL"_s) {
+            Error{} << errorPrefix << "buffer view" << bufferViewId << "has unrecognized EXT_meshopt_compression filter" << filter;
+            return {};
+        }
+    }
+
+    if(count*stride != byteLength) {
+        Error{} << errorPrefix << "buffer view" << bufferViewId << "has EXT_meshopt_compression count" << count << "and byteStride" << stride << "but byteLength" << byteLength;
+        return {};
+    }
+
+    /* Get the buffer with compressed data and continue only if that doesn't
+       fail. This also checks that the buffer ID is in bounds. */
+    Containers::Optional<Containers::ArrayView<const char>> buffer = parseBuffer(errorPrefix, gltfBufferId->asUnsignedInt());
+    if(!buffer)
+        return {};
+
+    const std::size_t offset = gltfByteOffset ? gltfByteOffset->asSize() : 0;
+    const std::size_t requiredBufferSize = offset + gltfByteLength->asSize();
+    if(buffer->size() < requiredBufferSize) {
+        Error{} << errorPrefix << "buffer view" << bufferViewId << "needs" << requiredBufferSize << "bytes but EXT_meshopt_compression buffer" << gltfBufferId->asUnsignedInt() << "has only" << buffer->size();
+        return {};
+    }
+
+    /* The decoders write whole 16- or 32-bit values, relying on the default
+       allocator being suitably aligned for those */
+    Containers::Array<char>& decoded = _d->decodedBufferViews[bufferViewId];
+    decoded = Containers::Array<char>{NoInit, byteLength};
+    const Containers::ArrayView<const char> compressed = buffer->slice(offset, requiredBufferSize);
+    bool decodeSucceeded;
+    if(mode == "ATTRIBUTES"_s)
+        decodeSucceeded = decodeMeshoptAttributes(compressed, count, stride, decoded);
+    else if(mode == "TRIANGLES"_s)
+        decodeSucceeded = decodeMeshoptTriangles(compressed, count, stride, decoded);
+    else if(mode == "INDICES"_s)
+        decodeSucceeded = decodeMeshoptIndices(compressed, count, stride, decoded);
+    else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    if(!decodeSucceeded) {
+        decoded = nullptr;
+        Error{} << errorPrefix << "buffer view" << bufferViewId << "has invalid EXT_meshopt_compression" << mode << "data";
+        return {};
+    }
+
+    if(filter == "OCTAHEDRAL"_s) {
+        if(stride == 4)
+            decodeMeshoptFilterOctahedral<Byte>(decoded);
+        else
+            decodeMeshoptFilterOctahedral<Short>(decoded);
+    } else if(filter == "QUATERNION"_s)
+        decodeMeshoptFilterQuaternion(decoded);
+    else if(filter == "EXPONENTIAL"_s)
+        decodeMeshoptFilterExponential(decoded);
+
+    return Containers::ArrayView<const char>{decoded};
+}
+
 Containers::Optional<GltfImporter::Accessor> GltfImporter::parseAccessor(const char* const errorPrefix, const UnsignedInt accessorId) {
     if(accessorId >= _d->gltfAccessors.size()) {
         Error{} << errorPrefix << "accessor index" << accessorId << "out of range for" << _d->gltfAccessors.size() << "accessors";
@@ -906,8 +1184,8 @@ bool isRecognized2DTextureExtension(Containers::StringView name) {
         name == "EXT_texture_webp"_s;
 }
 
-/* Used by doOpenData() but it's recursive and so it can't be a local lambda */
-bool discoverSceneExtraFields(Utility::Json& gltf, std::unordered_map<Containers::String, SceneField>& sceneFieldsForName, Containers::Array<Containers::Triple<Containers::StringView, SceneFieldType, SceneFieldFlags>>& sceneFieldNamesTypesFlags, const Utility::ConfigurationGroup* const customSceneFieldTypeConfiguration, UnsignedInt nodeI, const Containers::StringView key, Utility::JsonToken gltfExtraValue) {
+/* Used by discoverSceneFields() but it's recursive and so it can't be a local lambda */
+bool discoverSceneExtraFields(const char* const errorPrefix, Utility::Json& gltf, std::unordered_map<Containers::String, SceneField>& sceneFieldsForName, Containers::Array<Containers::Triple<Containers::StringView, SceneFieldType, SceneFieldFlags>>& sceneFieldNamesTypesFlags, const Utility::ConfigurationGroup* const customSceneFieldTypeConfiguration, UnsignedInt nodeI, const Containers::StringView key, Utility::JsonToken gltfExtraValue) {
     /* If the value is an object, recurse into it. The field name will then be
        all object keys concatenated with dots. */
     if(gltfExtraValue.type() == Utility::JsonToken::Type::Object) {
@@ -916,13 +1194,13 @@ bool discoverSceneExtraFields(Utility::Json& gltf, std::unordered_map<Containers
            it'd still print a message to the output which would imply an error
            was silently ignored, which is not any better. */
         if(!gltf.parseObject(gltfExtraValue)) {
-            Error{} << "Trade::GltfImporter::openData(): invalid node" << nodeI << "extras property";
+            Error{} << errorPrefix << "invalid node" << nodeI << "extras property";
             return false;
         }
 
         for(const Utility::JsonObjectItem gltfNestedExtra: gltfExtraValue.asObject()) {
             if(!discoverSceneExtraFields(
-                gltf, sceneFieldsForName, sceneFieldNamesTypesFlags,
+                errorPrefix, gltf, sceneFieldsForName, sceneFieldNamesTypesFlags,
                 customSceneFieldTypeConfiguration,
                 nodeI, "."_s.join({key, gltfNestedExtra.key()}), gltfNestedExtra.value())
             )
@@ -988,7 +1266,7 @@ bool discoverSceneExtraFields(Utility::Json& gltf, std::unordered_map<Containers
         else {
             /* I expect the type set to grow significantly over time, thus
                listing them all in the error message doesn't scale */
-            Error{} << "Trade::GltfImporter::openData(): invalid type" << typeString << "specified for custom scene field" << key;
+            Error{} << errorPrefix << "invalid type" << typeString << "specified for custom scene field" << key;
             return false;
         }
 
@@ -1005,12 +1283,46 @@ bool discoverSceneExtraFields(Utility::Json& gltf, std::unordered_map<Containers
     return true;
 }
 
+/* Parses a whitespace-separated list of IDs in given configuration option
+   during file opening, checking that they're all less than count. Parsing
+   manually as std::strtoul() would need a null-terminated string and accepts
+   signs and leading whitespace. */
+Containers::Optional<Containers::Array<UnsignedInt>> parseConfigurationIds(const Utility::ConfigurationGroup& configuration, const Containers::StringView option, const std::size_t count, const char* const countName) {
+    const Containers::Array<Containers::StringView> values = configuration.value<Containers::StringView>(option).splitOnWhitespaceWithoutEmptyParts();
+    Containers::Array<UnsignedInt> ids{NoInit, values.size()};
+    for(std::size_t i = 0; i != values.size(); ++i) {
+        std::size_t id = 0;
+        for(const char c: values[i]) {
+            if(c < '0' || c > '9') {
+                Error{} << "Trade::GltfImporter::openData(): invalid" << option << "ID" << values[i];
+                return {};
+            }
+            /* Stop accumulating once out of range to avoid an overflow, but
+               still check the remaining characters */
+            if(id < count)
+                id = id*10 + (c - '0');
+        }
+        if(id >= count) {
+            Error{} << "Trade::GltfImporter::openData():" << option << "ID" << values[i] << "out of range for" << count << countName;
+            return {};
+        }
+        ids[i] = id;
+    }
+
+    return ids;
+}
+
 }
 
 void GltfImporter::doOpenData(Containers::Array<char>&& data, const DataFlags dataFlags) {
     if(!_d)
         _d.reset(new Document);
 
+    /* The image importer cache statistics are for the currently opened file,
+       reset them even if the opening fails */
+    configuration().setValue("imageImporterCacheHits", 0);
+    configuration().setValue("imageImporterCacheMisses", 0);
+
     /* Copy file content. Take over the existing array or copy the data if we
        can't. We need to keep the data around as JSON tokens are views onto it
        and also for the GLB binary chunk. */
@@ -1126,7 +1438,9 @@ void GltfImporter::doOpenData(Containers::Array<char>&& data, const DataFlags da
     }
 
     /* Check used extensions for any experimental feature that's off by
-       default and hint at it */
+       default and hint at it. Remember also whether instancing is used, for
+       which custom scene fields get registered below. */
+    bool meshGpuInstancingUsed = false;
     if(const Utility::JsonIterator gltfExtensionsUsed = gltf->root().find("extensionsUsed"_s)) {
         if(!gltf->parseArray(*gltfExtensionsUsed)) {
             Error{} << "Trade::GltfImporter::openData(): invalid extensionsUsed property";
@@ -1141,6 +1455,8 @@ void GltfImporter::doOpenData(Containers::Array<char>&& data, const DataFlags da
 
             if(!(flags() & ImporterFlag::Quiet) && gltfExtension.value().asString() == "KHR_texture_ktx"_s && !configuration().value<bool>("experimentalKhrTextureKtx"))
                 Warning{} << "Trade::GltfImporter::openData(): used extension KHR_texture_ktx is experimental, enable experimentalKhrTextureKtx to use it";
+            if(gltfExtension.value().asString() == "EXT_mesh_gpu_instancing"_s)
+                meshGpuInstancingUsed = true;
         }
     }
 
@@ -1158,6 +1474,7 @@ void GltfImporter::doOpenData(Containers::Array<char>&& data, const DataFlags da
 
         Containers::Array<Containers::StringView> supportedExtensions;
         arrayAppend(supportedExtensions, {
+            "KHR_draco_mesh_compression"_s,
             "KHR_lights_punctual"_s,
             "KHR_materials_clearcoat"_s,
             "KHR_materials_pbrSpecularGlossiness"_s,
@@ -1167,6 +1484,8 @@ void GltfImporter::doOpenData(Containers::Array<char>&& data, const DataFlags da
             "KHR_texture_transform"_s,
             "GOOGLE_texture_basis"_s,
             "MSFT_texture_dds"_s,
+            "EXT_mesh_gpu_instancing"_s,
+            "EXT_meshopt_compression"_s,
             "EXT_texture_astc"_s,
             "EXT_texture_webp"_s
         });
@@ -1397,29 +1716,13 @@ void GltfImporter::doOpenData(Containers::Array<char>&& data, const DataFlags da
     }
 
     /* Go through all nodes and collect names of extra properties for custom
-       scene fields */
-    for(std::size_t i = 0; i != _d->gltfNodes.size(); ++i) {
-        const Utility::JsonToken gltfNode{*gltf, _d->gltfNodes[i].first()};
-        const Utility::JsonIterator gltfExtras = gltfNode.find("extras"_s);
-        /* Silently skip also if extras isn't an object -- the error will be
-           printed when importing the actual scene containing this node */
-        if(!gltfExtras || gltfExtras->type() != Utility::JsonToken::Type::Object)
-            continue;
-        /* However if the object fails to parse because it has invalid keys
-           (i.e., invalid Unicode escapes), fail the whole import. If we
-           wouldn't, it'd still print a message to the output which would imply
-           an error was silently ignored, which is not any better. */
-        if(!gltf->parseObject(*gltfExtras)) {
-            Error{} << "Trade::GltfImporter::openData(): invalid node" << i << "extras property";
+       scene fields, unless it's deferred to the first time scene fields are
+       needed */
+    _d->meshGpuInstancingUsed = meshGpuInstancingUsed;
+    if(!configuration().value<bool>("lazySceneFieldDiscovery")) {
+        if(!discoverSceneFields("Trade::GltfImporter::openData():", *gltf))
             return;
-        }
-
-        /* The process is recursive so it has to be an external function */
-        const Utility::ConfigurationGroup* customSceneFieldTypeConfiguration = configuration().group("customSceneFieldTypes");
-        for(const Utility::JsonObjectItem gltfExtra: gltfExtras->asObject()) {
-            if(!discoverSceneExtraFields(*gltf, _d->sceneFieldsForName, _d->sceneFieldNamesTypesFlags, customSceneFieldTypeConfiguration, i, gltfExtra.key(), gltfExtra.value()))
-                return;
-        }
+        _d->sceneFieldsDiscovered = true;
     }
 
     /* Treat meshes with multiple primitives as separate meshes. Each mesh gets
@@ -1730,16 +2033,58 @@ void GltfImporter::doOpenData(Containers::Array<char>&& data, const DataFlags da
         }
     }
 
+    /* Parse the mesh batch IDs, as we can't fail in doMeshCount() */
+    {
+        Containers::Optional<Containers::Array<UnsignedInt>> meshBatchIds = parseConfigurationIds(configuration(), "meshBatch"_s, _d->gltfMeshPrimitiveMap.size(), "meshes");
+        if(!meshBatchIds)
+            return;
+        _d->meshBatchRanges = Containers::Array<MeshBatchRange>{ValueInit, meshBatchIds->size()};
+        _d->meshBatchIds = *Utility::move(meshBatchIds);
+    }
+
+    /* Parse the image IDs to prefetch. The actual prefetch is done only once
+       everything else is parsed below. */
+    Containers::Optional<Containers::Array<UnsignedInt>> prefetchImage2DIds = parseConfigurationIds(configuration(), "prefetchImage2DIds"_s, _d->image2DCount, "2D images");
+    if(!prefetchImage2DIds)
+        return;
+    Containers::Optional<Containers::Array<UnsignedInt>> prefetchImage3DIds = parseConfigurationIds(configuration(), "prefetchImage3DIds"_s, _d->gltfImages.size() - _d->image2DCount, "3D images");
+    if(!prefetchImage3DIds)
+        return;
+    const bool prefetchImages = configuration().value<bool>("prefetchImages") || !prefetchImage2DIds->isEmpty() || !prefetchImage3DIds->isEmpty();
+
+    /* Check the prefetch thread count here already so a bad value fails the
+       import instead of being silently ignored like other prefetch errors */
+    if(prefetchImages && configuration().value<Int>("prefetchThreads") < 0) {
+        Error{} << "Trade::GltfImporter::openData(): expected prefetchThreads to be zero or positive but got" << configuration().value<Int>("prefetchThreads");
+        return;
+    }
+
     /* All good, save the parsed state */
     _d->gltf = Utility::move(gltf);
 
     /* Allocate storage for parsed buffers, buffer views and accessors */
     _d->buffers = Containers::Array<Containers::Optional<Containers::Array<char>>>{_d->gltfBuffers.size()};
     _d->bufferViews = Containers::Array<Containers::Optional<BufferView>>{_d->gltfBufferViews.size()};
+    _d->decodedBufferViews = Containers::Array<Containers::Array<char>>{_d->gltfBufferViews.size()};
     _d->accessors = Containers::Array<Containers::Optional<Accessor>>{_d->gltfAccessors.size()};
     _d->samplers = Containers::Array<Containers::Optional<Sampler>>{_d->gltfSamplers.size()};
 
     /* Name maps are lazy-loaded because these might not be needed every time */
+
+    /* Decode all or selected images upfront if desired */
+    if(configuration().value<bool>("prefetchImages") && !_d->gltfImages.isEmpty()) {
+        Containers::Array<UnsignedInt> ids{NoInit, _d->gltfImages.size()};
+        for(std::size_t i = 0; i != ids.size(); ++i)
+            ids[i] = i;
+        prefetchImagesInternal("Trade::GltfImporter::openData():", ids);
+    } else if(prefetchImages) {
+        Containers::Array<UnsignedInt> ids{NoInit, prefetchImage2DIds->size() + prefetchImage3DIds->size()};
+        for(std::size_t i = 0; i != prefetchImage2DIds->size(); ++i)
+            ids[i] = _d->imagesByDimension[(*prefetchImage2DIds)[i]];
+        for(std::size_t i = 0; i != prefetchImage3DIds->size(); ++i)
+            ids[prefetchImage2DIds->size() + i] = _d->imagesByDimension[_d->image2DCount + (*prefetchImage3DIds)[i]];
+        prefetchImagesInternal("Trade::GltfImporter::openData():", ids);
+    }
 }
 
 UnsignedInt GltfImporter::doAnimationCount() const {
@@ -2547,6 +2892,20 @@ Containers::String GltfImporter::doSceneName(const UnsignedInt id) {
 
 namespace {
 
+/* Used by doScene() to copy EXT_mesh_gpu_instancing attributes. The format is
+   checked to be a float or a normalized 8- or 16-bit signed type with `size`
+   components already. */
+template<UnsignedInt size> void copyInstanceAttribute(const Containers::StridedArrayView2D<const char>& src, const VertexFormat format, const Containers::StridedArrayView2D<Float>& dst) {
+    const VertexFormat componentFormat = vertexFormatComponentFormat(format);
+    if(componentFormat == VertexFormat::Float)
+        Utility::copy(Containers::arrayCast<2, const Float>(Containers::arrayCast<1, const Math::Vector<size, Float>>(src)), dst);
+    else if(componentFormat == VertexFormat::Byte)
+        Math::unpackInto(Containers::arrayCast<2, const Byte>(Containers::arrayCast<1, const Math::Vector<size, Byte>>(src)), dst);
+    else if(componentFormat == VertexFormat::Short)
+        Math::unpackInto(Containers::arrayCast<2, const Short>(Containers::arrayCast<1, const Math::Vector<size, Short>>(src)), dst);
+    else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
 /* Used by doScene() but it's recursive and so it can't be a local lambda */
 void parseSceneExtraFields(Utility::Json& gltf, const ImporterFlags flags, const std::unordered_map<Containers::String, SceneField>& sceneFieldsForName, const Containers::ArrayView<const Containers::Triple<Containers::StringView, SceneFieldType, SceneFieldFlags>> sceneFieldNamesTypesFlags, const Containers::ArrayView<UnsignedInt> extraMappingOffsets, const Containers::ArrayView<UnsignedInt> extraDataOffsets, const Containers::ArrayView<UnsignedInt> extraBitOffsets, const Containers::ArrayView<UnsignedInt> extraStringOffsets, const UnsignedInt nodeI, const Containers::StringView key, const Utility::JsonToken gltfExtraValue) {
     /* If the value is an object, recurse into it. The field name will then be
@@ -2792,7 +3151,94 @@ void collectSceneExtraFields(const std::unordered_map<Containers::String, SceneF
 
 }
 
+bool GltfImporter::discoverSceneFields(const char* const errorPrefix, Utility::Json& gltf) {
+    for(std::size_t i = 0; i != _d->gltfNodes.size(); ++i) {
+        const Utility::JsonToken gltfNode{gltf, _d->gltfNodes[i].first()};
+        const Utility::JsonIterator gltfExtras = gltfNode.find("extras"_s);
+        /* Silently skip also if extras isn't an object -- the error will be
+           printed when importing the actual scene containing this node */
+        if(!gltfExtras || gltfExtras->type() != Utility::JsonToken::Type::Object)
+            continue;
+        /* However if the object fails to parse because it has invalid keys
+           (i.e., invalid Unicode escapes), fail the whole import. If we
+           wouldn't, it'd still print a message to the output which would imply
+           an error was silently ignored, which is not any better. */
+        if(!gltf.parseObject(*gltfExtras)) {
+            Error{} << errorPrefix << "invalid node" << i << "extras property";
+            return false;
+        }
+
+        /* The process is recursive so it has to be an external function */
+        const Utility::ConfigurationGroup* customSceneFieldTypeConfiguration = configuration().group("customSceneFieldTypes");
+        for(const Utility::JsonObjectItem gltfExtra: gltfExtras->asObject()) {
+            if(!discoverSceneExtraFields(errorPrefix, gltf, _d->sceneFieldsForName, _d->sceneFieldNamesTypesFlags, customSceneFieldTypeConfiguration, i, gltfExtra.key(), gltfExtra.value()))
+                return false;
+        }
+    }
+
+    /* Register custom scene fields for EXT_mesh_gpu_instancing. Done after
+       extras so the IDs of fields coming from extras are the same regardless
+       of whether the extension is used. If the names are already taken by
+       extras, the extras win and instances are not imported. */
+    if(_d->meshGpuInstancingUsed) {
+        const Containers::StringView names[]{
+            "instanceTranslation"_s,
+            "instanceRotation"_s,
+            "instanceScaling"_s
+        };
+        bool collision = false;
+        for(const Containers::StringView name: names) {
+            if(_d->sceneFieldsForName.find(name) != _d->sceneFieldsForName.end()) {
+                if(!(flags() & ImporterFlag::Quiet))
+                    Warning{} << errorPrefix << "node extras property" << name << "conflicts with EXT_mesh_gpu_instancing, instances won't be imported";
+                collision = true;
+                break;
+            }
+        }
+
+        if(!collision) {
+            _d->meshGpuInstancingSceneFields = _d->sceneFieldNamesTypesFlags.size();
+            const SceneFieldType types[]{
+                SceneFieldType::Vector3,
+                SceneFieldType::Quaternion,
+                SceneFieldType::Vector3
+            };
+            for(std::size_t i = 0; i != Containers::arraySize(names); ++i) {
+                const auto inserted = _d->sceneFieldsForName.emplace(names[i], sceneFieldCustom(_d->sceneFieldNamesTypesFlags.size()));
+                CORRADE_INTERNAL_ASSERT(inserted.second);
+                arrayAppend(_d->sceneFieldNamesTypesFlags, InPlaceInit,
+                    inserted.first->first, types[i], SceneFieldFlag::MultiEntry);
+            }
+        }
+    }
+
+    return true;
+}
+
+bool GltfImporter::ensureSceneFieldsDiscovered(const char* const errorPrefix) {
+    if(_d->sceneFieldsDiscovered)
+        return true;
+
+    /* If the discovery fails, discard what was found so far so the next
+       attempt starts from scratch and prints the error again, instead of
+       continuing with a partially populated state */
+    if(!discoverSceneFields(errorPrefix, *_d->gltf)) {
+        _d->sceneFieldsForName.clear();
+        _d->sceneFieldNamesTypesFlags = {};
+        _d->meshGpuInstancingSceneFields = ~UnsignedInt{};
+        return false;
+    }
+
+    _d->sceneFieldsDiscovered = true;
+    return true;
+}
+
 Containers::Optional<SceneData> GltfImporter::doScene(UnsignedInt id) {
+    /* If lazySceneFieldDiscovery is enabled, custom fields from node extras
+       were not discovered in doOpenData() yet */
+    if(!ensureSceneFieldsDiscovered("Trade::GltfImporter::scene():"))
+        return {};
+
     const Utility::JsonToken gltfScene{*_d->gltf, _d->gltfScenes[id].first()};
 
     /* Gather all top-level nodes belonging to a scene and recursively populate
@@ -2851,6 +3297,12 @@ Containers::Optional<SceneData> GltfImporter::doScene(UnsignedInt id) {
     UnsignedInt lightCount = 0;
     UnsignedInt cameraCount = 0;
     UnsignedInt skinCount = 0;
+    /* EXT_mesh_gpu_instancing instances. All three fields share the same
+       mapping, so only check which of them are present. */
+    UnsignedInt instanceCount = 0;
+    bool hasInstanceTranslations = false;
+    bool hasInstanceRotations = false;
+    bool hasInstanceScalings = false;
     /* Separate counter for every recognized extra field. Mappings are put into
        `extraMappingOffsets`, number and string fields are put into
        `extraDataOffsets`, bit fields into `extraBitOffsets` and string data
@@ -2981,6 +3433,92 @@ Containers::Optional<SceneData> GltfImporter::doScene(UnsignedInt id) {
 
                 ++lightCount;
             }
+
+            /* Instancing. Ignored if the custom fields couldn't be registered
+               due to a name collision, a warning was printed in openData()
+               already. The accessors get parsed and validated here, their
+               data are copied in the second pass. */
+            const Utility::JsonIterator gltfMeshGpuInstancing = gltfExtensions->find("EXT_mesh_gpu_instancing"_s);
+            if(gltfMeshGpuInstancing && _d->meshGpuInstancingSceneFields != ~UnsignedInt{}) {
+                if(!_d->gltf->parseObject(*gltfMeshGpuInstancing)) {
+                    Error{} << "Trade::GltfImporter::scene(): invalid node" << i << "EXT_mesh_gpu_instancing extension";
+                    return {};
+                }
+
+                const Utility::JsonIterator gltfInstanceAttributes = gltfMeshGpuInstancing->find("attributes"_s);
+                if(!gltfInstanceAttributes || !_d->gltf->parseObject(*gltfInstanceAttributes)) {
+                    Error{} << "Trade::GltfImporter::scene(): missing or invalid EXT_mesh_gpu_instancing attributes property of node" << i;
+                    return {};
+                }
+
+                Containers::Optional<std::size_t> nodeInstanceCount;
+                for(const Utility::JsonObjectItem gltfInstanceAttribute: gltfInstanceAttributes->asObject()) {
+                    const Containers::StringView name = gltfInstanceAttribute.key();
+                    const bool isTranslation = name == "TRANSLATION"_s;
+                    const bool isRotation = name == "ROTATION"_s;
+                    const bool isScaling = name == "SCALE"_s;
+                    if(!isTranslation && !isRotation && !isScaling) {
+                        if(!(flags() & ImporterFlag::Quiet))
+                            Warning{} << "Trade::GltfImporter::scene(): unsupported EXT_mesh_gpu_instancing attribute" << name << "in node" << i << Debug::nospace << ", skipping";
+                        continue;
+                    }
+
+                    if(!_d->gltf->parseUnsignedInt(gltfInstanceAttribute.value())) {
+                        Error{} << "Trade::GltfImporter::scene(): invalid EXT_mesh_gpu_instancing" << name << "attribute of node" << i;
+                        return {};
+                    }
+
+                    const UnsignedInt accessorId = gltfInstanceAttribute.value().asUnsignedInt();
+                    const Containers::Optional<Accessor> accessor = parseAccessor("Trade::GltfImporter::scene():", accessorId);
+                    if(!accessor)
+                        return {};
+
+                    /* Same as with skins, there's no technical reason these
+                       couldn't work, just no practical use case */
+                    if(accessor->bufferView == ~UnsignedInt{}) {
+                        Error{} << "Trade::GltfImporter::scene(): accessor" << accessorId << "has no buffer view, which is unsupported";
+                        return {};
+                    }
+                    if(accessor->sparseValues.data()) {
+                        Error{} << "Trade::GltfImporter::scene(): accessor" << accessorId << "is using sparse storage, which is unsupported";
+                        return {};
+                    }
+
+                    /* Float or normalized quantized types, as allowed by the
+                       extension */
+                    if((isRotation &&
+                        accessor->format != VertexFormat::Vector4 &&
+                        accessor->format != VertexFormat::Vector4bNormalized &&
+                        accessor->format != VertexFormat::Vector4sNormalized) ||
+                       (!isRotation &&
+                        accessor->format != VertexFormat::Vector3 &&
+                        accessor->format != VertexFormat::Vector3bNormalized &&
+                        accessor->format != VertexFormat::Vector3sNormalized))
+                    {
+                        /* Since we're abusing VertexFormat for all formats,
+                           print just the enum value without the prefix to
+                           avoid confusion */
+                        Error{} << "Trade::GltfImporter::scene(): unsupported EXT_mesh_gpu_instancing" << name << "format" << Debug::packed << accessor->format << "in node" << i;
+                        return {};
+                    }
+
+                    if(nodeInstanceCount && *nodeInstanceCount != accessor->data.size()[0]) {
+                        Error{} << "Trade::GltfImporter::scene(): mismatched EXT_mesh_gpu_instancing attribute count in node" << i << Debug::nospace << ", expected" << *nodeInstanceCount << "but got" << accessor->data.size()[0];
+                        return {};
+                    }
+                    nodeInstanceCount = accessor->data.size()[0];
+
+                    if(isTranslation)
+                        hasInstanceTranslations = true;
+                    else if(isRotation)
+                        hasInstanceRotations = true;
+                    else if(isScaling)
+                        hasInstanceScalings = true;
+                }
+
+                if(nodeInstanceCount)
+                    instanceCount += *nodeInstanceCount;
+            }
         }
 
         /* Extras. If it's an object, it was already parsed during initial
@@ -3057,6 +3595,10 @@ Containers::Optional<SceneData> GltfImporter::doScene(UnsignedInt id) {
     Containers::ArrayView<UnsignedInt> cameras;
     Containers::ArrayView<UnsignedInt> skinObjects;
     Containers::ArrayView<UnsignedInt> skins;
+    Containers::ArrayView<UnsignedInt> instanceObjects;
+    Containers::ArrayView<Vector3> instanceTranslations;
+    Containers::ArrayView<Quaternion> instanceRotations;
+    Containers::ArrayView<Vector3> instanceScalings;
     Containers::ArrayView<UnsignedInt> extraMappings;
     Containers::MutableStringView extrasStrings;
     /* This gets later cast to extrasFloat and extrasInt */
@@ -3085,6 +3627,10 @@ Containers::Optional<SceneData> GltfImporter::doScene(UnsignedInt id) {
         {NoInit, cameraCount, cameras},
         {NoInit, skinCount, skinObjects},
         {NoInit, skinCount, skins},
+        {NoInit, instanceCount, instanceObjects},
+        {NoInit, hasInstanceTranslations ? instanceCount : 0, instanceTranslations},
+        {NoInit, hasInstanceRotations ? instanceCount : 0, instanceRotations},
+        {NoInit, hasInstanceScalings ? instanceCount : 0, instanceScalings},
         {NoInit, extraMappingCount, extraMappings},
         {NoInit, extraStringSize, extrasStrings},
         {NoInit, extraDataCount, extrasUnsignedInt},
@@ -3109,6 +3655,7 @@ Containers::Optional<SceneData> GltfImporter::doScene(UnsignedInt id) {
     std::size_t lightOffset = 0;
     std::size_t cameraOffset = 0;
     std::size_t skinOffset = 0;
+    std::size_t instanceOffset = 0;
     for(std::size_t i = 0; i != objects.size(); ++i) {
         const UnsignedInt nodeI = objects[i];
         const Utility::JsonToken gltfNode{*_d->gltf, _d->gltfNodes[nodeI].first()};
@@ -3242,6 +3789,55 @@ Containers::Optional<SceneData> GltfImporter::doScene(UnsignedInt id) {
                 lights[lightOffset] = (*gltfKhrLightsPunctual)["light"_s].asUnsignedInt();
                 ++lightOffset;
             }
+
+            /* Populate instances. Parsing, format and count checks done in
+               the previous pass already, the accessors are cached. The data
+               are copied (or unpacked, if quantized) as a whole, with no
+               per-instance processing. */
+            const Utility::JsonIterator gltfMeshGpuInstancing = gltfExtensions->find("EXT_mesh_gpu_instancing"_s);
+            if(gltfMeshGpuInstancing && _d->meshGpuInstancingSceneFields != ~UnsignedInt{}) {
+                std::size_t nodeInstanceCount = 0;
+                bool nodeHasTranslations = false;
+                bool nodeHasRotations = false;
+                bool nodeHasScalings = false;
+                for(const Utility::JsonObjectItem gltfInstanceAttribute: (*gltfMeshGpuInstancing)["attributes"_s].asObject()) {
+                    const Containers::StringView name = gltfInstanceAttribute.key();
+                    if(name != "TRANSLATION"_s &&
+                       name != "ROTATION"_s &&
+                       name != "SCALE"_s)
+                        continue;
+
+                    const Accessor& accessor = *_d->accessors[gltfInstanceAttribute.value().asUnsignedInt()];
+                    nodeInstanceCount = accessor.data.size()[0];
+                    if(name == "TRANSLATION"_s) {
+                        copyInstanceAttribute<3>(accessor.data, accessor.format, Containers::arrayCast<2, Float>(Containers::stridedArrayView(instanceTranslations.sliceSize(instanceOffset, nodeInstanceCount))));
+                        nodeHasTranslations = true;
+                    } else if(name == "ROTATION"_s) {
+                        /* glTF also uses the XYZW order */
+                        copyInstanceAttribute<4>(accessor.data, accessor.format, Containers::arrayCast<2, Float>(Containers::stridedArrayView(instanceRotations.sliceSize(instanceOffset, nodeInstanceCount))));
+                        nodeHasRotations = true;
+                    } else if(name == "SCALE"_s) {
+                        copyInstanceAttribute<3>(accessor.data, accessor.format, Containers::arrayCast<2, Float>(Containers::stridedArrayView(instanceScalings.sliceSize(instanceOffset, nodeInstanceCount))));
+                        nodeHasScalings = true;
+                    }
+                }
+
+                /* Fill defaults for fields that other nodes have but this one
+                   doesn't */
+                if(hasInstanceTranslations && !nodeHasTranslations)
+                    for(Vector3& translation: instanceTranslations.sliceSize(instanceOffset, nodeInstanceCount))
+                        translation = Vector3{};
+                if(hasInstanceRotations && !nodeHasRotations)
+                    for(Quaternion& rotation: instanceRotations.sliceSize(instanceOffset, nodeInstanceCount))
+                        rotation = Quaternion{};
+                if(hasInstanceScalings && !nodeHasScalings)
+                    for(Vector3& scaling: instanceScalings.sliceSize(instanceOffset, nodeInstanceCount))
+                        scaling = Vector3{1.0f};
+
+                for(UnsignedInt& object: instanceObjects.sliceSize(instanceOffset, nodeInstanceCount))
+                    object = nodeI;
+                instanceOffset += nodeInstanceCount;
+            }
         }
 
         /* Extras. Types were checked in the previous pass already, so just
@@ -3261,7 +3857,8 @@ Containers::Optional<SceneData> GltfImporter::doScene(UnsignedInt id) {
         meshMaterialOffset == meshMaterialObjects.size() &&
         lightOffset == lightObjects.size() &&
         cameraOffset == cameraObjects.size() &&
-        skinOffset == skinObjects.size());
+        skinOffset == skinObjects.size() &&
+        instanceOffset == instanceObjects.size());
 
     /* Put everything together. For simplicity the imported data could always
        have all fields present, with some being empty, but this gives less
@@ -3311,6 +3908,21 @@ Containers::Optional<SceneData> GltfImporter::doScene(UnsignedInt id) {
         SceneField::Skin, skinObjects, skins
     });
 
+    /* Instances from EXT_mesh_gpu_instancing. A node can have any number of
+       them, so they're all MultiEntry. */
+    if(hasInstanceTranslations) arrayAppend(fields, SceneFieldData{
+        sceneFieldCustom(_d->meshGpuInstancingSceneFields + 0),
+        instanceObjects, instanceTranslations, SceneFieldFlag::MultiEntry
+    });
+    if(hasInstanceRotations) arrayAppend(fields, SceneFieldData{
+        sceneFieldCustom(_d->meshGpuInstancingSceneFields + 1),
+        instanceObjects, instanceRotations, SceneFieldFlag::MultiEntry
+    });
+    if(hasInstanceScalings) arrayAppend(fields, SceneFieldData{
+        sceneFieldCustom(_d->meshGpuInstancingSceneFields + 2),
+        instanceObjects, instanceScalings, SceneFieldFlag::MultiEntry
+    });
+
     /* Extras. At this point, `extraOffsets[i]` to `extraOffsets[i + 1]` is the
        range of data for extra field sceneFieldCustom(i). Add it if it's
        non-empty. */
@@ -3353,11 +3965,19 @@ Containers::Optional<SceneData> GltfImporter::doScene(UnsignedInt id) {
 }
 
 SceneField GltfImporter::doSceneFieldForName(const Containers::StringView name) {
-    return _d ? _d->sceneFieldsForName[name] : SceneField{};
+    /* The file might not be opened yet (or anymore) */
+    if(!_d || !_d->gltf || !ensureSceneFieldsDiscovered("Trade::GltfImporter::sceneFieldForName():"))
+        return {};
+
+    return _d->sceneFieldsForName[name];
 }
 
 Containers::String GltfImporter::doSceneFieldName(const SceneField name) {
-    return _d && sceneFieldCustom(name) < _d->sceneFieldNamesTypesFlags.size() ?
+    /* The file might not be opened yet (or anymore) */
+    if(!_d || !_d->gltf || !ensureSceneFieldsDiscovered("Trade::GltfImporter::sceneFieldName():"))
+        return {};
+
+    return sceneFieldCustom(name) < _d->sceneFieldNamesTypesFlags.size() ?
         _d->sceneFieldNamesTypesFlags[sceneFieldCustom(name)].first() : ""_s;
 }
 
@@ -3473,7 +4093,8 @@ Containers::Optional<SkinData3D> GltfImporter::doSkin3D(const UnsignedInt id) {
 }
 
 UnsignedInt GltfImporter::doMeshCount() const {
-    return _d->gltfMeshPrimitiveMap.size();
+    /* The batch configured via the meshBatch option, if any, is last */
+    return _d->gltfMeshPrimitiveMap.size() + (_d->meshBatchIds.isEmpty() ? 0 : 1);
 }
 
 Int GltfImporter::doMeshForName(const Containers::StringView name) {
@@ -3496,6 +4117,10 @@ Int GltfImporter::doMeshForName(const Containers::StringView name) {
 }
 
 Containers::String GltfImporter::doMeshName(const UnsignedInt id) {
+    /* The mesh batch is unnamed */
+    if(id == _d->gltfMeshPrimitiveMap.size())
+        return {};
+
     /* This returns the same name for all multi-primitive mesh duplicates */
     return _d->gltfMeshes[_d->gltfMeshPrimitiveMap[id].first()].second();
 }
@@ -3521,13 +4146,74 @@ template<class T, class F, class G> std::size_t stableSortRemoveDuplicatesToPref
     return std::unique(reversed.begin(), reversed.end(), equalComparator) - reversed.begin();
 }
 
+/* Flips the Y coordinate of texture coordinates in given format. Formats
+   allowed only by KHR_mesh_quantization are left as-is. */
+void flipTextureCoordinatesY(const VertexFormat format, const Containers::StridedArrayView1D<char>& data) {
+    if(format == VertexFormat::Vector2)
+        for(auto& c: Containers::arrayCast<Vector2>(data))
+            c.y() = 1.0f - c.y();
+    else if(format == VertexFormat::Vector2ubNormalized)
+        for(auto& c: Containers::arrayCast<Vector2ub>(data))
+            c.y() = 255 - c.y();
+    else if(format == VertexFormat::Vector2usNormalized)
+        for(auto& c: Containers::arrayCast<Vector2us>(data))
+            c.y() = 65535 - c.y();
+    /* For these it's always done in the material texture transform as
+       we can't do a 1 - y flip like above. These are allowed only by
+       the KHR_mesh_quantization formats and in that case the texture
+       transform should be always present. */
+    /* LCOV_EXCL_START */
+    else if(format != VertexFormat::Vector2bNormalized &&
+            format != VertexFormat::Vector2sNormalized &&
+            format != VertexFormat::Vector2ub &&
+            format != VertexFormat::Vector2b &&
+            format != VertexFormat::Vector2us &&
+            format != VertexFormat::Vector2s)
+        CORRADE_INTERNAL_ASSERT_UNREACHABLE();
+    /* LCOV_EXCL_STOP */
 }
 
-Containers::Optional<MeshData> GltfImporter::doMesh(const UnsignedInt id, UnsignedInt) {
+template<class T> bool copyDracoIndicesInto(const Containers::ArrayView<const UnsignedInt> in, const Containers::ArrayView<char> out) {
+    const Containers::ArrayView<T> outT = Containers::arrayCast<T>(out);
+    for(std::size_t i = 0; i != in.size(); ++i) {
+        if(in[i] > T(~T{})) {
+            Error{} << "Trade::GltfImporter::mesh(): KHR_draco_mesh_compression index" << in[i] << "doesn't fit into" << meshIndexTypeFor<T>();
+            return false;
+        }
+        outT[i] = T(in[i]);
+    }
+    return true;
+}
+
+bool copyDracoIndices(const Containers::ArrayView<const UnsignedInt> in, const MeshIndexType type, const Containers::ArrayView<char> out) {
+    if(type == MeshIndexType::UnsignedByte)
+        return copyDracoIndicesInto<UnsignedByte>(in, out);
+    if(type == MeshIndexType::UnsignedShort)
+        return copyDracoIndicesInto<UnsignedShort>(in, out);
+    if(type == MeshIndexType::UnsignedInt) {
+        Utility::copy(in, Containers::arrayCast<UnsignedInt>(out));
+        return true;
+    }
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+/* Used by meshBatchInternal() to convert indices to 32-bit and offset them to
+   the concatenated vertex data at the same time */
+template<class T> void copyIndicesWithOffset(const Containers::StridedArrayView2D<const char>& in, const Containers::ArrayView<UnsignedInt> out, const UnsignedInt offset) {
+    const Containers::StridedArrayView1D<const T> inT = Containers::arrayCast<1, const T>(in);
+    CORRADE_INTERNAL_ASSERT(inT.size() == out.size());
+    for(std::size_t i = 0; i != inT.size(); ++i)
+        out[i] = inT[i] + offset;
+}
+
+}
+
+Containers::Optional<GltfImporter::Primitive> GltfImporter::parsePrimitive(const UnsignedInt id) {
     const Utility::JsonToken gltfPrimitive{*_d->gltf, _d->gltfMeshPrimitiveMap[id].second()};
+    Primitive primitive;
 
     /* Primitive is optional, defaulting to triangles */
-    MeshPrimitive primitive = MeshPrimitive::Triangles;
+    primitive.mode = MeshPrimitive::Triangles;
     if(const Utility::JsonIterator gltfMode = gltfPrimitive.find("mode"_s)) {
         if(!_d->gltf->parseUnsignedInt(*gltfMode)) {
             Error{} << "Trade::GltfImporter::mesh(): invalid primitive mode property";
@@ -3535,25 +4221,25 @@ Containers::Optional<MeshData> GltfImporter::doMesh(const UnsignedInt id, Unsign
         }
         switch(gltfMode->asUnsignedInt()) {
             case Implementation::GltfModePoints:
-                primitive = MeshPrimitive::Points;
+                primitive.mode = MeshPrimitive::Points;
                 break;
             case Implementation::GltfModeLines:
-                primitive = MeshPrimitive::Lines;
+                primitive.mode = MeshPrimitive::Lines;
                 break;
             case Implementation::GltfModeLineLoop:
-                primitive = MeshPrimitive::LineLoop;
+                primitive.mode = MeshPrimitive::LineLoop;
                 break;
             case Implementation::GltfModeLineStrip:
-                primitive = MeshPrimitive::LineStrip;
+                primitive.mode = MeshPrimitive::LineStrip;
                 break;
             case Implementation::GltfModeTriangles:
-                primitive = MeshPrimitive::Triangles;
+                primitive.mode = MeshPrimitive::Triangles;
                 break;
             case Implementation::GltfModeTriangleStrip:
-                primitive = MeshPrimitive::TriangleStrip;
+                primitive.mode = MeshPrimitive::TriangleStrip;
                 break;
             case Implementation::GltfModeTriangleFan:
-                primitive = MeshPrimitive::TriangleFan;
+                primitive.mode = MeshPrimitive::TriangleFan;
                 break;
             default:
                 Error{} << "Trade::GltfImporter::mesh(): unrecognized primitive" << gltfMode->asUnsignedInt();
@@ -3561,14 +4247,33 @@ Containers::Optional<MeshData> GltfImporter::doMesh(const UnsignedInt id, Unsign
         }
     }
 
-    /* Attributes. Not storing Utility::JsonTokenData& as this is just a
-       temporary container so twice the size doesn't matter and creating a
-       JsonToken on-the-fly in the hot std::sort() loop doesn't make sense
-       perf-wise. */
-    struct Attribute {
-        Containers::StringView name;
-        Utility::JsonToken value;
-        Int morphTargetId;
+    /* Extensions. A KHR_draco_mesh_compression object is only remembered
+       here, it's decoded in doMesh() only once it's known that some accessor
+       actually needs the compressed data. */
+    if(const Utility::JsonIterator gltfExtensions = gltfPrimitive.find("extensions"_s)) {
+        if(!_d->gltf->parseObject(*gltfExtensions)) {
+            Error{} << "Trade::GltfImporter::mesh(): invalid primitive extensions property";
+            return {};
+        }
+
+        if(const Utility::JsonIterator gltfDraco = gltfExtensions->find("KHR_draco_mesh_compression"_s)) {
+            if(!_d->gltf->parseObject(*gltfDraco)) {
+                Error{} << "Trade::GltfImporter::mesh(): invalid KHR_draco_mesh_compression extension";
+                return {};
+            }
+
+            primitive.dracoCompression = *gltfDraco;
+        }
+    }
+
+    /* Attributes. Not storing Utility::JsonTokenData& as this is just a
+       temporary container so twice the size doesn't matter and creating a
+       JsonToken on-the-fly in the hot std::sort() loop doesn't make sense
+       perf-wise. */
+    struct Attribute {
+        Containers::StringView name;
+        Utility::JsonToken value;
+        Int morphTargetId;
     };
     Containers::Array<Attribute> attributeOrder;
     if(const Utility::JsonIterator gltfAttributes = gltfPrimitive.find("attributes"_s)) {
@@ -3647,36 +4352,15 @@ Containers::Optional<MeshData> GltfImporter::doMesh(const UnsignedInt id, Unsign
     /** @todo use suffix() once it takes suffix size and not prefix size */
     const Containers::ArrayView<const Attribute> uniqueAttributeOrder = attributeOrder.exceptPrefix(attributeOrder.size() - uniqueAttributeCount);
 
-    /* Buffer ranges spanning all attributes. After collecting them for all
-       attributes they get sorted by `buffer` and `begin` to allow overlapping
-       ranges to be merged together. While it would be *theoretically* enough
-       to sort by just `begin` to discover overlapping ranges, the buffers can
-       get allocated in arbitrary order, causing the output to not be
-       deterministic. By sorting by the `buffer` index first we ensure
-       consistent ordering regardless of allocator used or the level of memory
-       fragmentation. */
-    struct BufferRange {
-        UnsignedInt attribute;
-        UnsignedInt buffer;
-        const char *begin, *end;
-    };
-    Containers::Array<BufferRange> bufferRanges{NoInit, uniqueAttributeCount};
-
-    /* Gather all (whitelisted) attributes and the total buffer range spanning
-       them */
-    UnsignedInt vertexCount = 0;
-    UnsignedInt attributeId = 0;
+    /* Gather all (whitelisted) attributes and the vertex count */
+    primitive.attributes = Containers::Array<Primitive::Attribute>{uniqueAttributeCount};
+    primitive.vertexCount = 0;
     UnsignedInt jointIdAttributeCount = 0;
     UnsignedInt weightAttributeCount = 0;
     Containers::Pair<Containers::StringView, Int> lastNumberedAttribute;
-    /* Cannot be NoInit because that would use a custom deleter which is
-       disallowed to avoid dangling function pointer call after the plugin is
-       unloaded :( */
-    Containers::Array<MeshAttributeData> attributeData{uniqueAttributeCount};
-    #ifdef MAGNUM_BUILD_DEPRECATED
-    UnsignedInt compatibilitySkinningAttributeCount = 0;
-    #endif
-    for(const Attribute& attribute: uniqueAttributeOrder) {
+    for(std::size_t i = 0; i != uniqueAttributeOrder.size(); ++i) {
+        const Attribute& attribute = uniqueAttributeOrder[i];
+
         /* Extract base name and number from builtin glTF numbered attributes,
            use the whole name otherwise */
         Containers::StringView baseAttributeName;
@@ -3866,17 +4550,113 @@ Containers::Optional<MeshData> GltfImporter::doMesh(const UnsignedInt id, Unsign
         }
 
         /* Remember vertex count and ensure all accessors have the same */
-        if(attributeId == 0) {
-            vertexCount = accessor->data.size()[0];
-        } else if(accessor->data.size()[0] != vertexCount) {
+        if(i == 0) {
+            primitive.vertexCount = accessor->data.size()[0];
+        } else if(accessor->data.size()[0] != primitive.vertexCount) {
             Error e;
             e << "Trade::GltfImporter::mesh(): mismatched vertex count for attribute" << attribute.name;
             if(attribute.morphTargetId != -1)
                 e << "in morph target" << attribute.morphTargetId;
-            e << Debug::nospace << ", expected" << vertexCount << "but got" << accessor->data.size()[0];
+            e << Debug::nospace << ", expected" << primitive.vertexCount << "but got" << accessor->data.size()[0];
+            return {};
+        }
+
+        primitive.attributes[i] = Primitive::Attribute{attribute.name, attribute.value.asUnsignedInt(), *accessor, name, arraySize, attribute.morphTargetId};
+    }
+
+    /* 3.7.2.1 (Geometry § Meshes § Overview) says "[count] MUST be non-zero",
+       but we allow also none unless the strict option is enabled. Not printing
+       a warning if the strict option is disabled as Magnum can handle the
+       vertex-less MeshData just fine. */
+    if(!primitive.vertexCount && configuration().value<bool>("strict")) {
+        Error{} << "Trade::GltfImporter::mesh(): strict mode enabled, disallowing a mesh with no vertices";
+        return {};
+    }
+
+    /* 3.7.3.3 (Geometry § Skins § Skinned mesh attributes) says "For a given
+       primitive, the number of JOINTS_n attribute sets MUST be equal to the
+       number of WEIGHTS_n attribute sets". Which aligns well with the
+       assertion that's in MeshData itself. */
+    if(jointIdAttributeCount != weightAttributeCount) {
+        Error{} << "Trade::GltfImporter::mesh(): the mesh has" << jointIdAttributeCount << "JOINTS_n attributes but" << weightAttributeCount << "WEIGHTS_n attributes";
+        return {};
+    }
+
+    /* Indices. Bounds check is done in parseAccessor() below, no need to do
+       it here again. */
+    if(const Utility::JsonIterator gltfIndices = gltfPrimitive.find("indices"_s)) {
+        if(!_d->gltf->parseUnsignedInt(*gltfIndices)) {
+            Error{} << "Trade::GltfImporter::mesh(): invalid indices property";
+            return {};
+        }
+
+        Containers::Optional<Accessor> accessor = parseAccessor("Trade::GltfImporter::mesh():", gltfIndices->asUnsignedInt());
+        if(!accessor)
+            return {};
+
+        if(accessor->format == VertexFormat::UnsignedByte)
+            primitive.indexType = MeshIndexType::UnsignedByte;
+        else if(accessor->format == VertexFormat::UnsignedShort)
+            primitive.indexType = MeshIndexType::UnsignedShort;
+        else if(accessor->format == VertexFormat::UnsignedInt)
+            primitive.indexType = MeshIndexType::UnsignedInt;
+        else {
+            /* Since we're abusing VertexFormat for all formats, print just the
+               enum value without the prefix to avoid cofusion */
+            Error{} << "Trade::GltfImporter::mesh(): unsupported index type" << Debug::packed << accessor->format;
             return {};
         }
 
+        primitive.indices = *accessor;
+        primitive.indicesId = gltfIndices->asUnsignedInt();
+    }
+
+    /* GCC 4.8 needs extra help here */
+    return Containers::optional(Utility::move(primitive));
+}
+
+Containers::Optional<MeshData> GltfImporter::doMesh(const UnsignedInt id, UnsignedInt) {
+    /* The mesh batch configured via the meshBatch option */
+    if(id == _d->gltfMeshPrimitiveMap.size())
+        return meshBatchInternal("Trade::GltfImporter::mesh():", _d->meshBatchIds, _d->meshBatchRanges, _d->meshBatchRanges.data());
+
+    const Utility::JsonToken gltfPrimitive{*_d->gltf, _d->gltfMeshPrimitiveMap[id].second()};
+
+    /* Primitive mode, attributes and indices, with all accessors parsed and
+       validated */
+    const Containers::Optional<Primitive> primitive = parsePrimitive(id);
+    if(!primitive)
+        return {};
+    const Containers::ArrayView<const Primitive::Attribute> attributes = primitive->attributes;
+
+    /* Buffer ranges spanning all attributes. After collecting them for all
+       attributes they get sorted by `buffer` and `begin` to allow overlapping
+       ranges to be merged together. While it would be *theoretically* enough
+       to sort by just `begin` to discover overlapping ranges, the buffers can
+       get allocated in arbitrary order, causing the output to not be
+       deterministic. By sorting by the `buffer` index first we ensure
+       consistent ordering regardless of allocator used or the level of memory
+       fragmentation. */
+    struct BufferRange {
+        UnsignedInt attribute;
+        UnsignedInt buffer;
+        const char *begin, *end;
+    };
+    Containers::Array<BufferRange> bufferRanges{NoInit, attributes.size()};
+
+    /* Gather the total buffer range spanning all attributes */
+    const UnsignedInt vertexCount = primitive->vertexCount;
+    UnsignedInt attributeId = 0;
+    /* Cannot be NoInit because that would use a custom deleter which is
+       disallowed to avoid dangling function pointer call after the plugin is
+       unloaded :( */
+    Containers::Array<MeshAttributeData> attributeData{attributes.size()};
+    #ifdef MAGNUM_BUILD_DEPRECATED
+    UnsignedInt compatibilitySkinningAttributeCount = 0;
+    #endif
+    for(const Primitive::Attribute& attribute: attributes) {
+        const Accessor& accessor = attribute.accessor;
+
         /* If the accessor has no backing view or is sparse, use a special
            buffer ID that puts it at the very end when sorted below, i.e. not
            overlapping with any other buffer range. Make the attribute view
@@ -3903,7 +4683,7 @@ Containers::Optional<MeshData> GltfImporter::doMesh(const UnsignedInt id, Unsign
            used as well. And if not, feel free to use MeshTools::interleave()
            to get rid of the unused data.  */
         Containers::StridedArrayView2D<const char> data;
-        if(accessor->bufferView == ~UnsignedInt{} || accessor->sparseValues.data()) {
+        if(accessor.bufferView == ~UnsignedInt{} || accessor.sparseValues.data()) {
             /* The pointer is nullptr to indicate there's no buffer view to
                directly copy from -- even if there would be, it likely has to
                get deinterleaved */
@@ -3911,10 +4691,10 @@ Containers::Optional<MeshData> GltfImporter::doMesh(const UnsignedInt id, Unsign
                 attributeId,
                 ~UnsignedInt{},
                 nullptr,
-                reinterpret_cast<const char*>(vertexCount*accessor->data.size()[1])
+                reinterpret_cast<const char*>(vertexCount*accessor.data.size()[1])
             };
             /* The attribute data view then matches the buffer range exactly */
-            data = Containers::StridedArrayView2D<const char>{{nullptr, vertexCount*accessor->data.size()[1]}, {vertexCount, accessor->data.size()[1]}};
+            data = Containers::StridedArrayView2D<const char>{{nullptr, vertexCount*accessor.data.size()[1]}, {vertexCount, accessor.data.size()[1]}};
 
         /* For non-sparse accessors backed by buffer views remember the buffer
            index and memory range the attribute is in. Cannot take just the
@@ -3923,29 +4703,29 @@ Containers::Optional<MeshData> GltfImporter::doMesh(const UnsignedInt id, Unsign
            Sample Assets), thus have to take exactly the range the accessor
            spans.*/
         } else {
-            const char* const attributeDataBegin = static_cast<const char*>(accessor->data.data());
+            const char* const attributeDataBegin = static_cast<const char*>(accessor.data.data());
             bufferRanges[attributeId] = {
                 attributeId,
-                _d->bufferViews[accessor->bufferView]->buffer,
+                _d->bufferViews[accessor.bufferView]->buffer,
                 attributeDataBegin,
                 /* Unless there are no vertices, from the last vertex we take
                    just the size the actual format spans, which is provided in
                    the second dimension of the data view */
-                attributeDataBegin + (vertexCount ? (vertexCount - 1)*accessor->data.stride()[0] + accessor->data.size()[1] : 0),
+                attributeDataBegin + (vertexCount ? (vertexCount - 1)*accessor.data.stride()[0] + accessor.data.size()[1] : 0),
             };
-            data = accessor->data;
+            data = accessor.data;
         }
 
         /** @todo Check that accessor stride >= vertexFormatSize(format)? */
 
         /* Fill in an attribute. Points to the input data, will be patched to
            the output data once we know where it's allocated. */
-        attributeData[attributeId] = MeshAttributeData{name, accessor->format, data, arraySize, attribute.morphTargetId};
+        attributeData[attributeId] = MeshAttributeData{attribute.name, accessor.format, data, attribute.arraySize, attribute.morphTargetId};
 
         /* For backwards compatibility we'll insert also a custom "JOINTS" /
            "WEIGHTS" attributes below, count how many of them we'll need */
         #ifdef MAGNUM_BUILD_DEPRECATED
-        if((name == MeshAttribute::JointIds || name == MeshAttribute::Weights) && configuration().value<bool>("compatibilitySkinningAttributes"))
+        if((attribute.name == MeshAttribute::JointIds || attribute.name == MeshAttribute::Weights) && configuration().value<bool>("compatibilitySkinningAttributes"))
             ++compatibilitySkinningAttributeCount;
         #endif
 
@@ -3955,24 +4735,6 @@ Containers::Optional<MeshData> GltfImporter::doMesh(const UnsignedInt id, Unsign
     /* Verify we really filled all attributes */
     CORRADE_INTERNAL_ASSERT(attributeId == attributeData.size());
 
-    /* 3.7.2.1 (Geometry § Meshes § Overview) says "[count] MUST be non-zero",
-       but we allow also none unless the strict option is enabled. Not printing
-       a warning if the strict option is disabled as Magnum can handle the
-       vertex-less MeshData just fine. */
-    if(!vertexCount && configuration().value<bool>("strict")) {
-        Error{} << "Trade::GltfImporter::mesh(): strict mode enabled, disallowing a mesh with no vertices";
-        return {};
-    }
-
-    /* 3.7.3.3 (Geometry § Skins § Skinned mesh attributes) says "For a given
-       primitive, the number of JOINTS_n attribute sets MUST be equal to the
-       number of WEIGHTS_n attribute sets". Which aligns well with the
-       assertion that's in MeshData itself. */
-    if(jointIdAttributeCount != weightAttributeCount) {
-        Error{} << "Trade::GltfImporter::mesh(): the mesh has" << jointIdAttributeCount << "JOINTS_n attributes but" << weightAttributeCount << "WEIGHTS_n attributes";
-        return {};
-    }
-
     /* Sort buffer ranges by their begin pointer, which then allows merging
        ones that overlap in a single pass afterwards. No need to use
        std::stable_sort() because if two accessors begin at the same memory,
@@ -4059,7 +4821,7 @@ Containers::Optional<MeshData> GltfImporter::doMesh(const UnsignedInt id, Unsign
 
             /* If the attribute has no backing buffer view, zero-init its
                memory */
-            if(!_d->accessors[uniqueAttributeOrder[bufferRanges[i].attribute].value.asUnsignedInt()]->data.data())
+            if(!attributes[bufferRanges[i].attribute].accessor.data.data())
                 std::memset(vertexData.sliceSize(vertexDataOffset, size), 0, size);
 
             /* Otherwise, if it isn't sparse, signalled by `begin` being null,
@@ -4123,12 +4885,12 @@ Containers::Optional<MeshData> GltfImporter::doMesh(const UnsignedInt id, Unsign
        rangeToCopyFrom */
     CORRADE_INTERNAL_ASSERT(bufferRanges.isEmpty() || vertexDataOffset + 4*(std::size_t(bufferRanges[rangeToCopyFrom].end - bufferRanges[rangeToCopyFrom].begin + 3)/4) == vertexDataSize);
 
-    /* Fill in sparse accessors. The original uniqueAttributeOrder contains
-       accessor IDs which we can use to decide whether the accessor is sparse
-       or not. */
-    CORRADE_INTERNAL_ASSERT(attributeData.size() == uniqueAttributeOrder.size());
+    /* Fill in sparse accessors. The parsed primitive attributes contain the
+       accessors which we can use to decide whether the accessor is sparse or
+       not. */
+    CORRADE_INTERNAL_ASSERT(attributeData.size() == attributes.size());
     for(std::size_t i = 0; i != attributeData.size(); ++i) {
-        const Accessor& accessor = *_d->accessors[uniqueAttributeOrder[i].value.asUnsignedInt()];
+        const Accessor& accessor = attributes[i].accessor;
         if(!accessor.sparseValues.data())
             continue;
 
@@ -4152,16 +4914,122 @@ Containers::Optional<MeshData> GltfImporter::doMesh(const UnsignedInt id, Unsign
            if they're out of range. Fail in that case. */
         bool success;
         if(accessor.sparseIndices.size()[1] == 4)
-            success = applySparseAccessor("Trade::GltfImporter::mesh():", uniqueAttributeOrder[i].value.asUnsignedInt(), Containers::arrayCast<1, const UnsignedInt>(accessor.sparseIndices), accessor.sparseValues, data);
+            success = applySparseAccessor("Trade::GltfImporter::mesh():", attributes[i].accessorId, Containers::arrayCast<1, const UnsignedInt>(accessor.sparseIndices), accessor.sparseValues, data);
         else if(accessor.sparseIndices.size()[1] == 2)
-            success = applySparseAccessor("Trade::GltfImporter::mesh():", uniqueAttributeOrder[i].value.asUnsignedInt(), Containers::arrayCast<1, const UnsignedShort>(accessor.sparseIndices), accessor.sparseValues, data);
+            success = applySparseAccessor("Trade::GltfImporter::mesh():", attributes[i].accessorId, Containers::arrayCast<1, const UnsignedShort>(accessor.sparseIndices), accessor.sparseValues, data);
         else if(accessor.sparseIndices.size()[1] == 1)
-            success = applySparseAccessor("Trade::GltfImporter::mesh():", uniqueAttributeOrder[i].value.asUnsignedInt(), Containers::arrayCast<1, const UnsignedByte>(accessor.sparseIndices), accessor.sparseValues, data);
+            success = applySparseAccessor("Trade::GltfImporter::mesh():", attributes[i].accessorId, Containers::arrayCast<1, const UnsignedByte>(accessor.sparseIndices), accessor.sparseValues, data);
         else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
         if(!success)
             return {};
     }
 
+    /* Fill in attributes compressed with KHR_draco_mesh_compression. Their
+       accessors have no buffer view and thus were zero-filled above. If an
+       accessor referenced by the extension has a buffer view, it's an
+       uncompressed fallback that was already copied above, and if all of them
+       are, the compressed data don't get decoded at all. Indices are filled
+       further below. */
+    Containers::Pointer<AbstractImporter> dracoImporter;
+    Containers::Optional<MeshData> dracoMesh;
+    bool useDracoCompression = false;
+    if(primitive->dracoCompression) {
+        const Utility::JsonIterator gltfDracoAttributes = primitive->dracoCompression->find("attributes"_s);
+        if(!gltfDracoAttributes || !_d->gltf->parseObject(*gltfDracoAttributes)) {
+            Error{} << "Trade::GltfImporter::mesh(): missing or invalid KHR_draco_mesh_compression attributes property";
+            return {};
+        }
+
+        /* Find out whether the compressed data are used at all, i.e. if any
+           accessor referenced by the extension or the index accessor has no
+           fallback buffer view */
+        for(const Primitive::Attribute& attribute: attributes) {
+            if(attribute.morphTargetId != -1)
+                continue;
+
+            const Utility::JsonIterator gltfDracoAttribute = gltfDracoAttributes->find(attribute.gltfName);
+            if(!gltfDracoAttribute)
+                continue;
+            if(!_d->gltf->parseUnsignedInt(*gltfDracoAttribute)) {
+                Error{} << "Trade::GltfImporter::mesh(): invalid KHR_draco_mesh_compression attribute" << attribute.gltfName;
+                return {};
+            }
+
+            if(attribute.accessor.bufferView == ~UnsignedInt{})
+                useDracoCompression = true;
+        }
+        if(primitive->indices && primitive->indices->bufferView == ~UnsignedInt{})
+            useDracoCompression = true;
+
+        /* Vertices decoded by Draco are in an order that's unrelated to the
+           uncompressed data, so if the compressed data are used, everything
+           has to come from them. Checking this upfront to not decode the data
+           only to fail afterwards. */
+        if(useDracoCompression) {
+            for(const Primitive::Attribute& attribute: attributes) {
+                if(attribute.morphTargetId != -1) {
+                    Error{} << "Trade::GltfImporter::mesh(): KHR_draco_mesh_compression can't be combined with morph target attribute" << attribute.gltfName;
+                    return {};
+                }
+                if(!gltfDracoAttributes->find(attribute.gltfName) || attribute.accessor.bufferView != ~UnsignedInt{}) {
+                    Error{} << "Trade::GltfImporter::mesh(): KHR_draco_mesh_compression can't be combined with uncompressed attribute" << attribute.gltfName;
+                    return {};
+                }
+            }
+            if(primitive->indices && primitive->indices->bufferView != ~UnsignedInt{}) {
+                Error{} << "Trade::GltfImporter::mesh(): KHR_draco_mesh_compression can't be combined with uncompressed indices";
+                return {};
+            }
+        }
+    }
+    if(useDracoCompression) {
+        const Utility::JsonToken gltfDracoAttributes = *primitive->dracoCompression->find("attributes"_s);
+        for(std::size_t i = 0; i != attributes.size(); ++i) {
+            /* All attributes are compressed and parsed, as checked above */
+            const Primitive::Attribute& attribute = attributes[i];
+            const Utility::JsonToken gltfDracoAttribute = *gltfDracoAttributes.find(attribute.gltfName);
+            /* Taking the cached accessor and not the one in the attribute as
+               that one has the format adapted for array attributes */
+            const Accessor& accessor = *_d->accessors[attribute.accessorId];
+
+            if(!dracoMesh && !(dracoMesh = decodeDracoCompressedPrimitive(*primitive->dracoCompression, dracoImporter)))
+                return {};
+
+            /* DracoImporter is told to name the attributes after their unique
+               IDs, which is what the extension references */
+            const MeshAttribute dracoAttributeName = dracoImporter->meshAttributeForName(Utility::format("{}", gltfDracoAttribute.asUnsignedInt()));
+            if(dracoAttributeName == MeshAttribute{}) {
+                Error{} << "Trade::GltfImporter::mesh(): KHR_draco_mesh_compression attribute" << attribute.gltfName << "references Draco attribute" << gltfDracoAttribute.asUnsignedInt() << "that isn't in the compressed data";
+                return {};
+            }
+
+            if(dracoMesh->vertexCount() != vertexCount) {
+                Error{} << "Trade::GltfImporter::mesh(): expected" << vertexCount << "vertices in KHR_draco_mesh_compression data but got" << dracoMesh->vertexCount();
+                return {};
+            }
+
+            /* The accessor, which has the original glTF format, has to match
+               what Draco decoded, except for the normalization which is
+               decided by the accessor alone. */
+            const UnsignedInt dracoAttributeId = dracoMesh->attributeId(dracoAttributeName);
+            const VertexFormat dracoFormat = dracoMesh->attributeFormat(dracoAttributeId);
+            if(vertexFormatComponentFormat(dracoFormat) != vertexFormatComponentFormat(accessor.format) ||
+               vertexFormatSize(dracoFormat) != vertexFormatSize(accessor.format)) {
+                Error{} << "Trade::GltfImporter::mesh(): KHR_draco_mesh_compression attribute" << attribute.gltfName << "was decoded as" << Debug::packed << dracoFormat << "but the accessor is" << Debug::packed << accessor.format;
+                return {};
+            }
+
+            /* Turn the attribute view mutable. See a similar case above for
+               why the extra stride is added. */
+            /** @todo some arrayConstCast, ugh? */
+            Containers::StridedArrayView2D<char> data{{vertexData, vertexData.size() + attributeData[i].stride()},
+                const_cast<char*>(static_cast<const char*>(attributeData[i].data().data())),
+                {vertexCount, accessor.data.size()[1]},
+                {attributeData[i].stride(), 1}};
+            Utility::copy(dracoMesh->attribute(dracoAttributeId), data);
+        }
+    }
+
     /* For backwards compatibility insert custom "JOINTS" and "WEIGHTS"
        attributes which are a Vector4<T> instead of T[4]. The attribute array
        has to remain with the default deleter, so allocate a new one with extra
@@ -4217,87 +5085,61 @@ Containers::Optional<MeshData> GltfImporter::doMesh(const UnsignedInt id, Unsign
             attributeData[i].data().size(),
             attributeData[i].stride()};
 
-        if(attributeData[i].format() == VertexFormat::Vector2)
-            for(auto& c: Containers::arrayCast<Vector2>(data))
-                c.y() = 1.0f - c.y();
-        else if(attributeData[i].format() == VertexFormat::Vector2ubNormalized)
-            for(auto& c: Containers::arrayCast<Vector2ub>(data))
-                c.y() = 255 - c.y();
-        else if(attributeData[i].format() == VertexFormat::Vector2usNormalized)
-            for(auto& c: Containers::arrayCast<Vector2us>(data))
-                c.y() = 65535 - c.y();
-        /* For these it's always done in the material texture transform as
-           we can't do a 1 - y flip like above. These are allowed only by
-           the KHR_mesh_quantization formats and in that case the texture
-           transform should be always present. */
-        /* LCOV_EXCL_START */
-        else if(attributeData[i].format() != VertexFormat::Vector2bNormalized &&
-                attributeData[i].format() != VertexFormat::Vector2sNormalized &&
-                attributeData[i].format() != VertexFormat::Vector2ub &&
-                attributeData[i].format() != VertexFormat::Vector2b &&
-                attributeData[i].format() != VertexFormat::Vector2us &&
-                attributeData[i].format() != VertexFormat::Vector2s)
-            CORRADE_INTERNAL_ASSERT_UNREACHABLE();
-        /* LCOV_EXCL_STOP */
+        flipTextureCoordinatesY(attributeData[i].format(), data);
     }
 
     /* Indices */
     MeshIndexData indices;
     Containers::Array<char> indexData;
-    if(const Utility::JsonIterator gltfIndices = gltfPrimitive.find("indices"_s)) {
-        if(!_d->gltf->parseUnsignedInt(*gltfIndices)) {
-            Error{} << "Trade::GltfImporter::mesh(): invalid indices property";
-            return {};
-        }
-        /* Bounds check is done in parseAccessor() below, no need to do it
-           here again */
-
-        Containers::Optional<Accessor> accessor = parseAccessor("Trade::GltfImporter::mesh():", gltfIndices->asUnsignedInt());
-        if(!accessor)
-            return {};
-
-        MeshIndexType type;
-        if(accessor->format == VertexFormat::UnsignedByte)
-            type = MeshIndexType::UnsignedByte;
-        else if(accessor->format == VertexFormat::UnsignedShort)
-            type = MeshIndexType::UnsignedShort;
-        else if(accessor->format == VertexFormat::UnsignedInt)
-            type = MeshIndexType::UnsignedInt;
-        else {
-            /* Since we're abusing VertexFormat for all formats, print just the
-               enum value without the prefix to avoid cofusion */
-            Error{} << "Trade::GltfImporter::mesh(): unsupported index type" << Debug::packed << accessor->format;
-            return {};
-        }
+    if(primitive->indices) {
+        const Accessor& accessor = *primitive->indices;
+        const MeshIndexType type = primitive->indexType;
 
         /* If the indices have no backing buffer view, zero-init the memory.
            Like with attributes, the accessor should have index count and index
            type size encoded in the (nullptr) data view. */
-        if(accessor->bufferView == ~UnsignedInt{}) {
-            indexData = Containers::Array<char>{ValueInit, accessor->data.size()[0]*accessor->data.size()[1]};
+        if(accessor.bufferView == ~UnsignedInt{}) {
+            indexData = Containers::Array<char>{ValueInit, accessor.data.size()[0]*accessor.data.size()[1]};
+
+            /* If the primitive is compressed with KHR_draco_mesh_compression,
+               the indices are in the compressed data */
+            if(useDracoCompression) {
+                if(!dracoMesh && !(dracoMesh = decodeDracoCompressedPrimitive(*primitive->dracoCompression, dracoImporter)))
+                    return {};
+
+                const UnsignedInt dracoIndexCount = dracoMesh->isIndexed() ? dracoMesh->indexCount() : 0;
+                if(dracoIndexCount != accessor.data.size()[0]) {
+                    Error{} << "Trade::GltfImporter::mesh(): expected" << accessor.data.size()[0] << "indices in KHR_draco_mesh_compression data but got" << dracoIndexCount;
+                    return {};
+                }
+
+                const Containers::Array<UnsignedInt> dracoIndices = dracoMesh->indicesAsArray();
+                if(!copyDracoIndices(dracoIndices, type, indexData))
+                    return {};
+            }
 
         /* Otherwise it's expected to be contiguous, copy the data over */
         } else {
-            if(!accessor->data.isContiguous()) {
-                Error{} << "Trade::GltfImporter::mesh(): index buffer view" << accessor->bufferView << "is not contiguous";
+            if(!accessor.data.isContiguous()) {
+                Error{} << "Trade::GltfImporter::mesh(): index buffer view" << accessor.bufferView << "is not contiguous";
                 return {};
             }
 
-            indexData = Containers::Array<char>{InPlaceInit, accessor->data.asContiguous()};
+            indexData = Containers::Array<char>{InPlaceInit, accessor.data.asContiguous()};
         }
 
         /* If the accessor is sparse, fill it in. Like with attributes, the
            copy operation also checks the index values and prints a message if
            they're out of range. Fail in that case. */
-        if(accessor->sparseValues.data()) {
+        if(accessor.sparseValues.data()) {
             bool success;
-            const Containers::StridedArrayView2D<char> indexData2D{indexData, accessor->data.size()};
-            if(accessor->sparseIndices.size()[1] == 4)
-                success = applySparseAccessor("Trade::GltfImporter::mesh():", gltfIndices->asUnsignedInt(), Containers::arrayCast<1, const UnsignedInt>(accessor->sparseIndices), accessor->sparseValues, indexData2D);
-            else if(accessor->sparseIndices.size()[1] == 2)
-                success = applySparseAccessor("Trade::GltfImporter::mesh():", gltfIndices->asUnsignedInt(), Containers::arrayCast<1, const UnsignedShort>(accessor->sparseIndices), accessor->sparseValues, indexData2D);
-            else if(accessor->sparseIndices.size()[1] == 1)
-                success = applySparseAccessor("Trade::GltfImporter::mesh():", gltfIndices->asUnsignedInt(), Containers::arrayCast<1, const UnsignedByte>(accessor->sparseIndices), accessor->sparseValues, indexData2D);
+            const Containers::StridedArrayView2D<char> indexData2D{indexData, accessor.data.size()};
+            if(accessor.sparseIndices.size()[1] == 4)
+                success = applySparseAccessor("Trade::GltfImporter::mesh():", primitive->indicesId, Containers::arrayCast<1, const UnsignedInt>(accessor.sparseIndices), accessor.sparseValues, indexData2D);
+            else if(accessor.sparseIndices.size()[1] == 2)
+                success = applySparseAccessor("Trade::GltfImporter::mesh():", primitive->indicesId, Containers::arrayCast<1, const UnsignedShort>(accessor.sparseIndices), accessor.sparseValues, indexData2D);
+            else if(accessor.sparseIndices.size()[1] == 1)
+                success = applySparseAccessor("Trade::GltfImporter::mesh():", primitive->indicesId, Containers::arrayCast<1, const UnsignedByte>(accessor.sparseIndices), accessor.sparseValues, indexData2D);
             else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
             if(!success)
                 return {};
@@ -4306,17 +5148,58 @@ Containers::Optional<MeshData> GltfImporter::doMesh(const UnsignedInt id, Unsign
         indices = MeshIndexData{type, indexData};
     }
 
+    /* Vertices in an indexed Draco mesh are in an order that's only
+       meaningful together with the indices */
+    if(dracoMesh && dracoMesh->isIndexed() && !indices.data().data()) {
+        Error{} << "Trade::GltfImporter::mesh(): KHR_draco_mesh_compression data are indexed but the primitive has no indices";
+        return {};
+    }
+
     /* If we have an index-less attribute-less mesh, glTF has no way to supply
        a vertex count, so return 0 */
     if(!indices.data().size() && !attributeData.size())
-        return MeshData{primitive, 0};
+        return MeshData{primitive->mode, 0};
 
-    return MeshData{primitive,
+    return MeshData{primitive->mode,
         Utility::move(indexData), indices,
         Utility::move(vertexData), Utility::move(attributeData),
         vertexCount, &gltfPrimitive.token()};
 }
 
+Containers::Optional<MeshData> GltfImporter::decodeDracoCompressedPrimitive(const Utility::JsonToken gltfDracoCompression, Containers::Pointer<AbstractImporter>& dracoImporter) {
+    const Utility::JsonIterator gltfBufferViewId = gltfDracoCompression.find("bufferView"_s);
+    if(!gltfBufferViewId || !_d->gltf->parseUnsignedInt(*gltfBufferViewId)) {
+        Error{} << "Trade::GltfImporter::mesh(): missing or invalid KHR_draco_mesh_compression bufferView property";
+        return {};
+    }
+
+    /* Get the buffer view and continue only if that doesn't fail. This also
+       checks that the buffer view ID is in bounds. */
+    Containers::Optional<BufferView> bufferView = parseBufferView("Trade::GltfImporter::mesh():", gltfBufferViewId->asUnsignedInt());
+    if(!bufferView)
+        return {};
+
+    constexpr Containers::StringView plugin = "DracoImporter"_s;
+    /** @todo remove the !manager() once manager-less instantiation is
+        removed */
+    if(!manager() || !(manager()->load(plugin) & PluginManager::LoadState::Loaded)) {
+        Error{} << "Trade::GltfImporter::mesh(): can't forward KHR_draco_mesh_compression data to DracoImporter";
+        return {};
+    }
+
+    /* Instantiate the plugin, propagate flags. The attributes are referenced
+       by their unique IDs, so make DracoImporter name them that way. */
+    dracoImporter = static_cast<PluginManager::Manager<AbstractImporter>*>(manager())->instantiate(plugin);
+    dracoImporter->setFlags(flags());
+    dracoImporter->configuration().setValue("uniqueIdAttributeNames", true);
+
+    /* Error output should be printed by the plugin itself */
+    if(!dracoImporter->openData(bufferView->data))
+        return {};
+
+    return dracoImporter->mesh(0);
+}
+
 MeshAttribute GltfImporter::doMeshAttributeForName(const Containers::StringView name) {
     return _d ? _d->meshAttributesForName[name] : MeshAttribute{};
 }
@@ -4326,6 +5209,261 @@ Containers::String GltfImporter::doMeshAttributeName(const MeshAttribute name) {
         _d->meshAttributeNames[meshAttributeCustom(name)] : ""_s;
 }
 
+Containers::Optional<MeshData> GltfImporter::meshBatch(const Containers::ArrayView<const UnsignedInt> ids, const Containers::ArrayView<MeshBatchRange> ranges) {
+    CORRADE_ASSERT(isOpened(),
+        "Trade::GltfImporter::meshBatch(): no file opened", {});
+    CORRADE_ASSERT(!ids.isEmpty(),
+        "Trade::GltfImporter::meshBatch(): expected at least one mesh", {});
+    CORRADE_ASSERT(ranges.size() == ids.size(),
+        "Trade::GltfImporter::meshBatch(): expected" << ids.size() << "ranges but got" << ranges.size(), {});
+    #ifndef CORRADE_NO_ASSERT
+    /* The mesh batch configured via the meshBatch option isn't allowed here,
+       it'd recurse */
+    for(const UnsignedInt id: ids)
+        CORRADE_ASSERT(id < _d->gltfMeshPrimitiveMap.size(),
+            "Trade::GltfImporter::meshBatch(): index" << id << "out of range for" << _d->gltfMeshPrimitiveMap.size() << "entries", {});
+    #endif
+
+    return meshBatchInternal("Trade::GltfImporter::meshBatch():", ids, ranges, nullptr);
+}
+
+Containers::Optional<MeshData> GltfImporter::meshBatchInternal(const char* const messagePrefix, const Containers::ArrayView<const UnsignedInt> ids, const Containers::ArrayView<MeshBatchRange> ranges, const void* const importerState) {
+    /* Parse all primitives first. That validates them and gives the total
+       vertex and index count just from the accessor counts, without touching
+       any data, so the output can be allocated upfront. */
+    Containers::Array<Primitive> primitives{ids.size()};
+    UnsignedInt vertexCount = 0;
+    UnsignedInt indexCount = 0;
+    for(std::size_t i = 0; i != ids.size(); ++i) {
+        /* Error message printed by parsePrimitive() already */
+        Containers::Optional<Primitive> primitive = parsePrimitive(ids[i]);
+        if(!primitive)
+            return {};
+
+        if(i == 0) {
+            if(primitive->mode != MeshPrimitive::Points &&
+               primitive->mode != MeshPrimitive::Lines &&
+               primitive->mode != MeshPrimitive::Triangles) {
+                Error{} << messagePrefix << "can't batch meshes with" << primitive->mode;
+                return {};
+            }
+
+        } else {
+            if(primitive->mode != primitives[0].mode) {
+                Error{} << messagePrefix << "expected" << primitives[0].mode << "but mesh" << ids[i] << "is" << primitive->mode;
+                return {};
+            }
+
+            bool layoutMatches = primitive->attributes.size() == primitives[0].attributes.size();
+            for(std::size_t j = 0; layoutMatches && j != primitive->attributes.size(); ++j) {
+                const Primitive::Attribute& a = primitive->attributes[j];
+                const Primitive::Attribute& b = primitives[0].attributes[j];
+                layoutMatches =
+                    a.name == b.name &&
+                    a.accessor.format == b.accessor.format &&
+                    a.arraySize == b.arraySize &&
+                    a.morphTargetId == b.morphTargetId;
+            }
+            if(!layoutMatches) {
+                Error{} << messagePrefix << "mesh" << ids[i] << "has a different attribute layout than mesh" << ids[0];
+                return {};
+            }
+        }
+
+        /* Non-indexed meshes get a trivial index buffer */
+        const UnsignedInt meshIndexCount = primitive->indices ? UnsignedInt(primitive->indices->data.size()[0]) : primitive->vertexCount;
+        ranges[i] = MeshBatchRange{indexCount, meshIndexCount, vertexCount, primitive->vertexCount};
+        vertexCount += primitive->vertexCount;
+        indexCount += meshIndexCount;
+        primitives[i] = *Utility::move(primitive);
+    }
+
+    /* Interleaved layout of the output, taken from the first mesh. The
+       accessor element size is the same as the format size times the array
+       size. */
+    const Containers::ArrayView<const Primitive::Attribute> layout = primitives[0].attributes;
+    Containers::Array<std::size_t> attributeOffsets{NoInit, layout.size()};
+    std::size_t stride = 0;
+    for(std::size_t i = 0; i != layout.size(); ++i) {
+        attributeOffsets[i] = stride;
+        stride += layout[i].accessor.data.size()[1];
+    }
+
+    Containers::Array<char> vertexData{NoInit, vertexCount*stride};
+    Containers::Array<char> indexData{NoInit, indexCount*sizeof(UnsignedInt)};
+    const Containers::ArrayView<UnsignedInt> indices = Containers::arrayCast<UnsignedInt>(indexData);
+
+    /* Decode each mesh directly into its range of the output */
+    for(std::size_t i = 0; i != primitives.size(); ++i) {
+        const Primitive& primitive = primitives[i];
+        const MeshBatchRange& range = ranges[i];
+        const Containers::ArrayView<char> vertices = vertexData.sliceSize(range.vertexOffset*stride, range.vertexCount*stride);
+        const Containers::ArrayView<UnsignedInt> meshIndices = indices.sliceSize(range.indexOffset, range.indexCount);
+
+        /* Primitives with KHR_draco_mesh_compression have to be decoded by
+           DracoImporter into a temporary mesh first anyway, so they go through
+           the full mesh() import and get copied from there. All validation
+           including matching vertex and index counts is done in there. */
+        if(primitive.dracoCompression) {
+            /* Error message printed by mesh() already */
+            const Containers::Optional<MeshData> mesh = this->mesh(ids[i]);
+            if(!mesh)
+                return {};
+
+            /* Compatibility skinning attributes, if any, are at the end and
+               thus not copied */
+            for(std::size_t j = 0; j != layout.size(); ++j)
+                Utility::copy(mesh->attribute(j), Containers::StridedArrayView2D<char>{vertices,
+                    vertices.data() + attributeOffsets[j],
+                    {range.vertexCount, layout[j].accessor.data.size()[1]},
+                    {std::ptrdiff_t(stride), 1}});
+
+            if(mesh->isIndexed()) {
+                mesh->indicesInto(meshIndices);
+                for(UnsignedInt& index: meshIndices)
+                    index += range.vertexOffset;
+            } else for(UnsignedInt j = 0; j != range.indexCount; ++j)
+                meshIndices[j] = range.vertexOffset + j;
+
+            continue;
+        }
+
+        for(std::size_t j = 0; j != layout.size(); ++j) {
+            const Primitive::Attribute& attribute = primitive.attributes[j];
+            const Accessor& accessor = attribute.accessor;
+            const Containers::StridedArrayView2D<char> out{vertices,
+                vertices.data() + attributeOffsets[j],
+                {range.vertexCount, accessor.data.size()[1]},
+                {std::ptrdiff_t(stride), 1}};
+
+            /* Accessors with no backing buffer view are zero-filled, otherwise
+               the data are copied. Sparse accessors are patched on top of
+               either. */
+            if(accessor.data.data())
+                Utility::copy(accessor.data, out);
+            else for(const Containers::StridedArrayView1D<char> vertex: out)
+                std::memset(vertex.data(), 0, vertex.size());
+
+            if(accessor.sparseValues.data()) {
+                bool success;
+                if(accessor.sparseIndices.size()[1] == 4)
+                    success = applySparseAccessor("Trade::GltfImporter::mesh():", attribute.accessorId, Containers::arrayCast<1, const UnsignedInt>(accessor.sparseIndices), accessor.sparseValues, out);
+                else if(accessor.sparseIndices.size()[1] == 2)
+                    success = applySparseAccessor("Trade::GltfImporter::mesh():", attribute.accessorId, Containers::arrayCast<1, const UnsignedShort>(accessor.sparseIndices), accessor.sparseValues, out);
+                else if(accessor.sparseIndices.size()[1] == 1)
+                    success = applySparseAccessor("Trade::GltfImporter::mesh():", attribute.accessorId, Containers::arrayCast<1, const UnsignedByte>(accessor.sparseIndices), accessor.sparseValues, out);
+                else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+                if(!success)
+                    return {};
+            }
+
+            /* Flip Y axis of texture coordinates, unless it's done in the
+               material instead */
+            if(attribute.name == MeshAttribute::TextureCoordinates && !_d->textureCoordinateYFlipInMaterial)
+                flipTextureCoordinatesY(accessor.format, Containers::StridedArrayView1D<char>{vertices,
+                    vertices.data() + attributeOffsets[j],
+                    range.vertexCount, std::ptrdiff_t(stride)});
+        }
+
+        /* Non-indexed mesh, generate trivial indices */
+        if(!primitive.indices) {
+            for(UnsignedInt j = 0; j != range.indexCount; ++j)
+                meshIndices[j] = range.vertexOffset + j;
+            continue;
+        }
+
+        /* Indices with no backing buffer view or sparse indices have to be
+           materialized first, which is done in a temporary array of the
+           original type. Otherwise they're widened and offset directly from
+           the input, which is expected to be contiguous like in mesh(). */
+        const Accessor& accessor = *primitive.indices;
+        Containers::StridedArrayView2D<const char> indexInput = accessor.data;
+        Containers::Array<char> materializedIndices;
+        if(accessor.data.data() && !accessor.data.isContiguous()) {
+            Error{} << "Trade::GltfImporter::mesh(): index buffer view" << accessor.bufferView << "is not contiguous";
+            return {};
+        }
+        if(!accessor.data.data() || accessor.sparseValues.data()) {
+            materializedIndices = Containers::Array<char>{ValueInit, accessor.data.size()[0]*accessor.data.size()[1]};
+            const Containers::StridedArrayView2D<char> materializedIndices2D{materializedIndices, accessor.data.size()};
+            if(accessor.data.data())
+                Utility::copy(accessor.data, materializedIndices2D);
+
+            if(accessor.sparseValues.data()) {
+                bool success;
+                if(accessor.sparseIndices.size()[1] == 4)
+                    success = applySparseAccessor("Trade::GltfImporter::mesh():", primitive.indicesId, Containers::arrayCast<1, const UnsignedInt>(accessor.sparseIndices), accessor.sparseValues, materializedIndices2D);
+                else if(accessor.sparseIndices.size()[1] == 2)
+                    success = applySparseAccessor("Trade::GltfImporter::mesh():", primitive.indicesId, Containers::arrayCast<1, const UnsignedShort>(accessor.sparseIndices), accessor.sparseValues, materializedIndices2D);
+                else if(accessor.sparseIndices.size()[1] == 1)
+                    success = applySparseAccessor("Trade::GltfImporter::mesh():", primitive.indicesId, Containers::arrayCast<1, const UnsignedByte>(accessor.sparseIndices), accessor.sparseValues, materializedIndices2D);
+                else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+                if(!success)
+                    return {};
+            }
+
+            indexInput = materializedIndices2D;
+        }
+
+        if(primitive.indexType == MeshIndexType::UnsignedByte)
+            copyIndicesWithOffset<UnsignedByte>(indexInput, meshIndices, range.vertexOffset);
+        else if(primitive.indexType == MeshIndexType::UnsignedShort)
+            copyIndicesWithOffset<UnsignedShort>(indexInput, meshIndices, range.vertexOffset);
+        else if(primitive.indexType == MeshIndexType::UnsignedInt)
+            copyIndicesWithOffset<UnsignedInt>(indexInput, meshIndices, range.vertexOffset);
+        else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+
+    /* For backwards compatibility mesh() adds also custom "JOINTS" and
+       "WEIGHTS" attributes aliasing the builtin ones, count how many of them
+       will be needed to do the same here */
+    std::size_t attributeCount = layout.size();
+    #ifdef MAGNUM_BUILD_DEPRECATED
+    if(configuration().value<bool>("compatibilitySkinningAttributes")) {
+        for(const Primitive::Attribute& attribute: layout)
+            if(attribute.name == MeshAttribute::JointIds || attribute.name == MeshAttribute::Weights)
+                ++attributeCount;
+    }
+    #endif
+
+    /* Cannot be NoInit because that would use a custom deleter which is
+       disallowed to avoid dangling function pointer call after the plugin is
+       unloaded */
+    Containers::Array<MeshAttributeData> attributeData{attributeCount};
+    for(std::size_t i = 0; i != layout.size(); ++i) {
+        const Primitive::Attribute& attribute = layout[i];
+        attributeData[i] = MeshAttributeData{attribute.name, attribute.accessor.format,
+            Containers::StridedArrayView1D<const void>{vertexData,
+                vertexData.data() + attributeOffsets[i],
+                vertexCount, std::ptrdiff_t(stride)},
+            attribute.arraySize, attribute.morphTargetId};
+    }
+
+    #ifdef MAGNUM_BUILD_DEPRECATED
+    std::size_t attributeId = layout.size();
+    for(std::size_t i = 0; attributeId != attributeCount && i != layout.size(); ++i) {
+        const MeshAttributeData& attribute = attributeData[i];
+        MeshAttribute name;
+        if(attribute.name() == MeshAttribute::JointIds)
+            name = _d->meshAttributesForName.at("JOINTS"_s);
+        else if(attribute.name() == MeshAttribute::Weights)
+            name = _d->meshAttributesForName.at("WEIGHTS"_s);
+        else continue;
+
+        /* The builtin attribute name is replaced with a custom one, format
+           array size becomes number of vector components */
+        attributeData[attributeId++] = MeshAttributeData{name, vertexFormat(attribute.format(), attribute.arraySize(), isVertexFormatNormalized(attribute.format())), attribute.data(), 0, attribute.morphTargetId()};
+    }
+    CORRADE_INTERNAL_ASSERT(attributeId == attributeCount);
+    #endif
+
+    const MeshIndexData indexDataView{MeshIndexType::UnsignedInt, indexData};
+    return MeshData{primitives[0].mode,
+        Utility::move(indexData), indexDataView,
+        Utility::move(vertexData), Utility::move(attributeData),
+        vertexCount, importerState};
+}
+
 UnsignedInt GltfImporter::doMaterialCount() const {
     return _d->gltfMaterials.size();
 }
@@ -5541,26 +6679,7 @@ Containers::Optional<TextureData> GltfImporter::doTexture(const UnsignedInt id)
         mipmap, wrapping, image, &gltfTexture.token()};
 }
 
-AbstractImporter* GltfImporter::setupOrReuseImporterForImage(const char* const errorPrefix, const UnsignedInt id, const UnsignedInt expectedDimensions) {
-    /* Looking for the same ID, so reuse an importer populated before. If the
-       previous attempt failed, the importer is not set, so return nullptr in
-       that case. Going through everything below again would not change the
-       outcome anyway, only spam the output with redundant messages. */
-    if(_d->imageImporterId == id)
-        return _d->imageImporter ? &*_d->imageImporter : nullptr;
-
-    /* Otherwise reset the importer and remember the new ID. If the import
-       fails, the importer will stay unset, but the ID will be updated so the
-       next round can again just return nullptr above instead of going through
-       the doomed-to-fail process again. */
-    _d->imageImporter = Containers::NullOpt;
-    _d->imageImporterId = id;
-
-    AnyImageImporter importer{*manager()};
-    importer.setFlags(flags());
-    if(fileCallback())
-        importer.setFileCallback(fileCallback(), fileCallbackUserData());
-
+Containers::Optional<GltfImporter::ImageSource> GltfImporter::parseImageSource(const char* const errorPrefix, const UnsignedInt id) {
     const Utility::JsonToken gltfImage{*_d->gltf, _d->gltfImages[id].first()};
 
     const Utility::JsonIterator gltfUri = gltfImage.find("uri"_s);
@@ -5581,17 +6700,16 @@ AbstractImporter* GltfImporter::setupOrReuseImporterForImage(const char* const e
         return {};
     }
 
-    /* Load embedded image. Can either be a buffer view or a base64 payload.
+    ImageSource source;
+
+    /* Embedded image. Can either be a buffer view or a base64 payload.
        Buffers are kept in memory until the importer closes but decoded base64
-       data is freed after opening the image. */
+       data is owned by the returned instance. */
     if(!gltfUri || isDataUri(gltfUri->asString())) {
-        Containers::Optional<Containers::Array<char>> imageData;
-        Containers::ArrayView<const void> imageView;
-
         if(gltfUri) {
-            if(!(imageData = loadUri(errorPrefix, gltfUri->asString())))
+            if(!(source.data = loadUri(errorPrefix, gltfUri->asString())))
                 return {};
-            imageView = *imageData;
+            source.view = *source.data;
 
         } else if(gltfBufferView) {
             const Containers::Optional<BufferView> bufferView = parseBufferView(errorPrefix, gltfBufferView->asUnsignedInt());
@@ -5606,27 +6724,30 @@ AbstractImporter* GltfImporter::setupOrReuseImporterForImage(const char* const e
                 return {};
             }
 
-            imageView = bufferView->data;
+            source.view = bufferView->data;
 
         } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
 
-        if(!importer.openData(imageView))
-            return nullptr;
-        return &_d->imageImporter.emplace(Utility::move(importer));
+        return Utility::move(source);
     }
 
-    /* Load external image */
+    /* External image */
     if(!_d->filename && !fileCallback()) {
         Error{} << errorPrefix << "external images can be imported only when opening files from the filesystem or if a file callback is present";
-        return nullptr;
+        return {};
     }
 
     const Containers::Optional<Containers::String> decodedUri = decodeUri(errorPrefix, gltfUri->asString());
     if(!decodedUri)
-        return nullptr;
-    if(!importer.openFile(Utility::Path::join(_d->filename ? Utility::Path::path(*_d->filename) : Containers::StringView{}, *decodedUri)))
-        return nullptr;
+        return {};
+
+    source.filename = Utility::Path::join(_d->filename ? Utility::Path::path(*_d->filename) : Containers::StringView{}, *decodedUri);
+    return Utility::move(source);
+}
 
+namespace {
+
+bool checkImageCount(const char* const errorPrefix, AbstractImporter& importer, const UnsignedInt expectedDimensions) {
     UnsignedInt expectedDimensionsImageCount;
     const char* expectedDimensionsString;
     if(expectedDimensions == 2) {
@@ -5638,10 +6759,326 @@ AbstractImporter* GltfImporter::setupOrReuseImporterForImage(const char* const e
     } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
     if(expectedDimensionsImageCount != 1) {
         Error{} << errorPrefix << "expected exactly one" << expectedDimensionsString << "image in an image file but got" << expectedDimensionsImageCount;
+        return false;
+    }
+
+    return true;
+}
+
+/* Picks an importer plugin based on the file signature for image formats
+   that can appear in a glTF file, the same way AnyImageImporter would. Used
+   by prefetchImagesInternal() to instantiate the plugin directly, so only the
+   instantiation has to be serialized and not the whole opening. Returns an
+   empty view for unrecognized data, in which case AnyImageImporter is used
+   instead. */
+Containers::StringView imageImporterForData(const Containers::StringView data) {
+    if(data.hasPrefix("\x89PNG\x0d\x0a\x1a\x0a"_s))
+        return "PngImporter"_s;
+    if(data.hasPrefix("\xff\xd8\xff"_s))
+        return "JpegImporter"_s;
+    if(data.hasPrefix("\xabKTX 20\xbb\x0d\x0a\x1a\x0a"_s))
+        return "KtxImporter"_s;
+    if(data.hasPrefix("DDS "_s))
+        return "DdsImporter"_s;
+    if(data.hasPrefix("sB"_s))
+        return "BasisImporter"_s;
+    if(data.size() >= 12 && data.hasPrefix("RIFF"_s) && data.slice(8, 12) == "WEBP"_s)
+        return "WebPImporter"_s;
+    return {};
+}
+
+}
+
+AbstractImporter* GltfImporter::setupOrReuseImporterForImage(const char* const errorPrefix, const UnsignedInt id, const UnsignedInt expectedDimensions) {
+    /* Looking for the same ID among the recently used importers, so reuse an
+       importer populated before, moving it to the front. If the previous
+       attempt failed, the importer is not set, so return nullptr in that
+       case. Going through everything below again would not change the
+       outcome anyway, only spam the output with redundant messages. */
+    for(std::size_t i = 0; i != _d->imageImporters.size(); ++i) {
+        if(_d->imageImporters[i].first() != id)
+            continue;
+
+        for(std::size_t j = i; j != 0; --j)
+            Utility::swap(_d->imageImporters[j], _d->imageImporters[j - 1]);
+        ++_d->imageImporterCacheHits;
+        configuration().setValue("imageImporterCacheHits", _d->imageImporterCacheHits);
+        return _d->imageImporters[0].second().get();
+    }
+
+    /* Otherwise evict the least recently used importers to make room for a
+       new one and remember the new ID at the front. If the import fails, the
+       importer will stay unset, but the ID will be recorded so the next round
+       can again just return nullptr above instead of going through the
+       doomed-to-fail process again. The cache size is queried every time so
+       it can be changed even while a file is opened. */
+    ++_d->imageImporterCacheMisses;
+    configuration().setValue("imageImporterCacheMisses", _d->imageImporterCacheMisses);
+    const std::size_t cacheSize = Math::max(configuration().value<std::size_t>("imageImporterCacheSize"), std::size_t{1});
+    if(_d->imageImporters.size() >= cacheSize)
+        arrayRemoveSuffix(_d->imageImporters, _d->imageImporters.size() - cacheSize + 1);
+    arrayAppend(_d->imageImporters, InPlaceInit, id, nullptr);
+    for(std::size_t j = _d->imageImporters.size() - 1; j != 0; --j)
+        Utility::swap(_d->imageImporters[j], _d->imageImporters[j - 1]);
+
+    const Containers::Optional<ImageSource> source = parseImageSource(errorPrefix, id);
+    if(!source)
         return nullptr;
+
+    Containers::Pointer<AnyImageImporter> importer{InPlaceInit, *manager()};
+    importer->setFlags(flags());
+    if(fileCallback())
+        importer->setFileCallback(fileCallback(), fileCallbackUserData());
+
+    /* Embedded image, the decoded base64 data (if any) is freed after opening
+       the image */
+    if(!source->filename) {
+        if(!importer->openData(source->view))
+            return nullptr;
+
+    /* External image */
+    } else {
+        if(!importer->openFile(source->filename))
+            return nullptr;
+        if(!checkImageCount(errorPrefix, *importer, expectedDimensions))
+            return nullptr;
     }
 
-    return &_d->imageImporter.emplace(Utility::move(importer));
+    return (_d->imageImporters[0].second() = Utility::move(importer)).get();
+}
+
+std::size_t GltfImporter::imageImporterCacheHits() const {
+    CORRADE_ASSERT(isOpened(), "Trade::GltfImporter::imageImporterCacheHits(): no file opened", {});
+    return _d->imageImporterCacheHits;
+}
+
+std::size_t GltfImporter::imageImporterCacheMisses() const {
+    CORRADE_ASSERT(isOpened(), "Trade::GltfImporter::imageImporterCacheMisses(): no file opened", {});
+    return _d->imageImporterCacheMisses;
+}
+
+void GltfImporter::prefetchImagesInternal(const char* const messagePrefix, const Containers::ArrayView<const UnsignedInt> gltfImageIds) {
+    /** @todo remove once the manager-less constructor is gone */
+    #ifdef MAGNUM_BUILD_DEPRECATED
+    CORRADE_ASSERT(manager(), messagePrefix << "the plugin must be instantiated with access to plugin manager in order to load images", );
+    #endif
+
+    const Int prefetchThreads = configuration().value<Int>("prefetchThreads");
+    if(prefetchThreads < 0) {
+        Error{} << messagePrefix << "expected prefetchThreads to be zero or positive but got" << prefetchThreads;
+        return;
+    }
+
+    if(_d->prefetchedImages.isEmpty())
+        _d->prefetchedImages = Containers::Array<PrefetchedImage>{_d->gltfImages.size()};
+
+    struct Job {
+        UnsignedInt id;
+        UnsignedInt dimensions;
+        ImageSource source;
+        /* External file contents, loaded upfront on the calling thread */
+        Containers::Array<char> fileData;
+        PrefetchedImage result;
+        /* Captured verbose and warning output of the import, replayed on the
+           calling thread once done */
+        Containers::String output;
+        Containers::String warningOutput;
+    };
+    Containers::Array<Job> jobs;
+
+    /* Parse the image references and load external files here, as neither the
+       JSON parsing, lazy buffer loading nor the user-provided file callbacks
+       are safe to call from multiple threads. Errors are not printed here ---
+       if anything fails, the image is left for the regular import path in
+       image2D() / image3D(), which will print them instead. */
+    {
+        Containers::String errorOutput;
+        Error redirectError{&errorOutput};
+        for(const UnsignedInt id: gltfImageIds) {
+            PrefetchedImage& prefetched = _d->prefetchedImages[id];
+            if(!prefetched.levels2D.isEmpty() || !prefetched.levels3D.isEmpty())
+                continue;
+
+            Containers::Optional<ImageSource> source = parseImageSource(messagePrefix, id);
+            if(!source)
+                continue;
+
+            Containers::Array<char> fileData;
+            if(source->filename) {
+                if(fileCallback()) {
+                    const Containers::Optional<Containers::ArrayView<const char>> view = fileCallback()(source->filename, InputFileCallbackPolicy::LoadTemporary, fileCallbackUserData());
+                    if(view)
+                        fileData = Containers::Array<char>{InPlaceInit, *view};
+                    fileCallback()(source->filename, InputFileCallbackPolicy::Close, fileCallbackUserData());
+                    if(!view)
+                        continue;
+                } else {
+                    Containers::Optional<Containers::Array<char>> data = Utility::Path::read(source->filename);
+                    if(!data)
+                        continue;
+                    fileData = *Utility::move(data);
+                }
+            }
+
+            Job& job = arrayAppend(jobs, InPlaceInit);
+            job.id = id;
+            job.dimensions = _d->imageByDimensionForGltfImage[id] < _d->image2DCount ? 2 : 3;
+            job.source = *Utility::move(source);
+            job.fileData = Utility::move(fileData);
+        }
+    }
+
+    if(jobs.isEmpty())
+        return;
+
+    /* The plugin manager isn't thread-safe, so instantiation and destruction
+       of the image importer plugins is serialized. In order to not serialize
+       the opening as well, the importer plugin is picked based on the file
+       signature here and instantiated directly, only unrecognized data go
+       through AnyImageImporter, which instantiates the plugin inside
+       openData() / openFile() and thus has to be opened with the lock held.
+       Opening and decoding is done on the worker thread in both cases, as
+       some importers such as StbImageImporter set thread-local decoding
+       state when opening. */
+    std::mutex managerMutex;
+    std::atomic<std::size_t> nextJob{0};
+    auto prefetch = [&]() {
+        for(std::size_t i; (i = nextJob++) < jobs.size(); ) {
+            Job& job = jobs[i];
+
+            Containers::String errorOutput;
+            Debug redirectOutput{&job.output};
+            Warning redirectWarning{&job.warningOutput};
+            Error redirectError{&errorOutput};
+
+            const Containers::ArrayView<const char> data = job.source.filename ? Containers::arrayView(job.fileData) : job.source.view;
+            const Containers::StringView plugin = imageImporterForData(data);
+
+            Containers::Pointer<AbstractImporter> importer;
+            bool opened;
+            if(plugin) {
+                {
+                    std::lock_guard<std::mutex> lock{managerMutex};
+                    importer = manager()->loadAndInstantiate(plugin);
+                }
+                if(importer) {
+                    importer->setFlags(flags());
+                    opened = importer->openData(data);
+                } else opened = false;
+            } else {
+                std::lock_guard<std::mutex> lock{managerMutex};
+                Containers::Pointer<AnyImageImporter> anyImporter{InPlaceInit, *manager()};
+                anyImporter->setFlags(flags());
+                if(job.source.filename) {
+                    /* Supply the file loaded upfront instead of going to the
+                       filesystem or the user file callback. Not using
+                       openData() in order to have the image type detected
+                       from the filename the same way as in the regular import
+                       path. */
+                    anyImporter->setFileCallback([](const std::string&, const InputFileCallbackPolicy policy, Job& job) -> Containers::Optional<Containers::ArrayView<const char>> {
+                        if(policy == InputFileCallbackPolicy::Close)
+                            return {};
+                        return Containers::ArrayView<const char>{job.fileData};
+                    }, job);
+                    opened = anyImporter->openFile(job.source.filename);
+                } else opened = anyImporter->openData(job.source.view);
+                importer = Utility::move(anyImporter);
+            }
+
+            /* Unlike in the regular import path, the image count is checked
+               for embedded images as well, as the prefetch should fail
+               gracefully instead of asserting in a worker thread */
+            opened = opened && checkImageCount(messagePrefix, *importer, job.dimensions);
+
+            if(opened && job.dimensions == 2) {
+                job.result.levels2D = Containers::Array<Containers::Optional<ImageData2D>>{importer->image2DLevelCount(0)};
+                for(UnsignedInt level = 0; level != job.result.levels2D.size(); ++level) {
+                    if(!(job.result.levels2D[level] = importer->image2D(0, level))) {
+                        job.result.levels2D = nullptr;
+                        break;
+                    }
+                }
+            } else if(opened && job.dimensions == 3) {
+                job.result.levels3D = Containers::Array<Containers::Optional<ImageData3D>>{importer->image3DLevelCount(0)};
+                for(UnsignedInt level = 0; level != job.result.levels3D.size(); ++level) {
+                    if(!(job.result.levels3D[level] = importer->image3D(0, level))) {
+                        job.result.levels3D = nullptr;
+                        break;
+                    }
+                }
+            }
+
+            /* The plugin instance unregisters itself from the manager on
+               destruction, so that has to be serialized as well */
+            std::lock_guard<std::mutex> lock{managerMutex};
+            importer = nullptr;
+        }
+    };
+
+    UnsignedInt threadCount = prefetchThreads;
+    if(!threadCount) {
+        threadCount = std::thread::hardware_concurrency();
+        if(flags() & ImporterFlag::Verbose)
+            Debug{} << messagePrefix << "autodetected hardware concurrency to" << threadCount << "threads";
+    }
+
+    /* Run the last worker on the calling thread */
+    const std::size_t workerCount = Math::max(Math::min(std::size_t(threadCount), jobs.size()), std::size_t{1});
+    Containers::Array<std::thread> threads;
+    arrayReserve(threads, workerCount - 1);
+    for(std::size_t i = 0; i != workerCount - 1; ++i)
+        arrayAppend(threads, InPlaceInit, prefetch);
+    prefetch();
+    for(std::thread& thread: threads)
+        thread.join();
+
+    /* Save the successfully decoded images, replaying their output. Failed
+       images are left for the regular import path, which will print the
+       errors again. */
+    for(Job& job: jobs) {
+        if(job.result.levels2D.isEmpty() && job.result.levels3D.isEmpty())
+            continue;
+
+        if(job.output)
+            Debug{Debug::Flag::NoNewlineAtTheEnd} << job.output;
+        if(job.warningOutput)
+            Warning{Debug::Flag::NoNewlineAtTheEnd} << job.warningOutput;
+        _d->prefetchedImages[job.id] = Utility::move(job.result);
+    }
+}
+
+void GltfImporter::prefetchImages() {
+    CORRADE_ASSERT(isOpened(), "Trade::GltfImporter::prefetchImages(): no file opened", );
+
+    Containers::Array<UnsignedInt> ids{NoInit, _d->gltfImages.size()};
+    for(std::size_t i = 0; i != ids.size(); ++i)
+        ids[i] = i;
+    prefetchImagesInternal("Trade::GltfImporter::prefetchImages():", ids);
+}
+
+void GltfImporter::prefetchImages2D(const Containers::ArrayView<const UnsignedInt> ids) {
+    CORRADE_ASSERT(isOpened(), "Trade::GltfImporter::prefetchImages2D(): no file opened", );
+
+    Containers::Array<UnsignedInt> gltfIds{NoInit, ids.size()};
+    for(std::size_t i = 0; i != ids.size(); ++i) {
+        CORRADE_ASSERT(ids[i] < _d->image2DCount,
+            "Trade::GltfImporter::prefetchImages2D(): index" << ids[i] << "out of range for" << _d->image2DCount << "entries", );
+        gltfIds[i] = _d->imagesByDimension[ids[i]];
+    }
+    prefetchImagesInternal("Trade::GltfImporter::prefetchImages2D():", gltfIds);
+}
+
+void GltfImporter::prefetchImages3D(const Containers::ArrayView<const UnsignedInt> ids) {
+    CORRADE_ASSERT(isOpened(), "Trade::GltfImporter::prefetchImages3D(): no file opened", );
+
+    const std::size_t image3DCount = _d->imagesByDimension.size() - _d->image2DCount;
+    Containers::Array<UnsignedInt> gltfIds{NoInit, ids.size()};
+    for(std::size_t i = 0; i != ids.size(); ++i) {
+        CORRADE_ASSERT(ids[i] < image3DCount,
+            "Trade::GltfImporter::prefetchImages3D(): index" << ids[i] << "out of range for" << image3DCount << "entries", );
+        gltfIds[i] = _d->imagesByDimension[_d->image2DCount + ids[i]];
+    }
+    prefetchImagesInternal("Trade::GltfImporter::prefetchImages3D():", gltfIds);
 }
 
 UnsignedInt GltfImporter::doImage2DCount() const {
@@ -5671,6 +7108,10 @@ UnsignedInt GltfImporter::doImage2DLevelCount(const UnsignedInt id) {
     CORRADE_ASSERT(manager(), "Trade::GltfImporter::image2DLevelCount(): the plugin must be instantiated with access to plugin manager in order to open image files", {});
     #endif
 
+    /* If the image was prefetched, the level count is known already */
+    if(!_d->prefetchedImages.isEmpty() && !_d->prefetchedImages[_d->imagesByDimension[id]].levels2D.isEmpty())
+        return _d->prefetchedImages[_d->imagesByDimension[id]].levels2D.size();
+
     AbstractImporter* importer = setupOrReuseImporterForImage("Trade::GltfImporter::image2DLevelCount():", _d->imagesByDimension[id], 2);
     /* image2DLevelCount() isn't supposed to fail (image2D() is, instead), so
        report 1 on failure and expect image2D() to fail later */
@@ -5686,14 +7127,23 @@ Containers::Optional<ImageData2D> GltfImporter::doImage2D(const UnsignedInt id,
     CORRADE_ASSERT(manager(), "Trade::GltfImporter::image2D(): the plugin must be instantiated with access to plugin manager in order to load images", {});
     #endif
 
-    AbstractImporter* importer = setupOrReuseImporterForImage("Trade::GltfImporter::image2D():", _d->imagesByDimension[id], 2);
-    if(!importer)
-        return {};
+    /* If the image level was prefetched and not retrieved yet, release it.
+       Otherwise go through the importer. */
+    Containers::Optional<ImageData2D> imageData;
+    const Containers::ArrayView<Containers::Optional<ImageData2D>> prefetchedLevels = _d->prefetchedImages.isEmpty() ? nullptr : Containers::arrayView(_d->prefetchedImages[_d->imagesByDimension[id]].levels2D);
+    if(!prefetchedLevels.isEmpty() && prefetchedLevels[level]) {
+        imageData = Utility::move(prefetchedLevels[level]);
+        prefetchedLevels[level] = Containers::NullOpt;
+    } else {
+        AbstractImporter* importer = setupOrReuseImporterForImage("Trade::GltfImporter::image2D():", _d->imagesByDimension[id], 2);
+        if(!importer)
+            return {};
+
+        if(!(imageData = importer->image2D(0, level)))
+            return Containers::NullOpt;
+    }
 
     /* Include a pointer to the glTF image in the result */
-    Containers::Optional<ImageData2D> imageData = importer->image2D(0, level);
-    if(!imageData)
-        return Containers::NullOpt;
     return ImageData2D{Utility::move(*imageData), &*_d->gltfImages[id].first()};
 }
 
@@ -5724,6 +7174,10 @@ UnsignedInt GltfImporter::doImage3DLevelCount(const UnsignedInt id) {
     CORRADE_ASSERT(manager(), "Trade::GltfImporter::image3DLevelCount(): the plugin must be instantiated with access to plugin manager in order to open image files", {});
     #endif
 
+    /* If the image was prefetched, the level count is known already */
+    if(!_d->prefetchedImages.isEmpty() && !_d->prefetchedImages[_d->imagesByDimension[_d->image2DCount + id]].levels3D.isEmpty())
+        return _d->prefetchedImages[_d->imagesByDimension[_d->image2DCount + id]].levels3D.size();
+
     AbstractImporter* importer = setupOrReuseImporterForImage("Trade::GltfImporter::image3DLevelCount():", _d->imagesByDimension[_d->image2DCount + id], 3);
     /* image3DLevelCount() isn't supposed to fail (image3D() is, instead), so
        report 1 on failure and expect image3D() to fail later */
@@ -5739,6 +7193,15 @@ Containers::Optional<ImageData3D> GltfImporter::doImage3D(const UnsignedInt id,
     CORRADE_ASSERT(manager(), "Trade::GltfImporter::image3D(): the plugin must be instantiated with access to plugin manager in order to load images", {});
     #endif
 
+    /* If the image level was prefetched and not retrieved yet, release it.
+       Otherwise go through the importer. */
+    const Containers::ArrayView<Containers::Optional<ImageData3D>> prefetchedLevels = _d->prefetchedImages.isEmpty() ? nullptr : Containers::arrayView(_d->prefetchedImages[_d->imagesByDimension[_d->image2DCount + id]].levels3D);
+    if(!prefetchedLevels.isEmpty() && prefetchedLevels[level]) {
+        Containers::Optional<ImageData3D> imageData = Utility::move(prefetchedLevels[level]);
+        prefetchedLevels[level] = Containers::NullOpt;
+        return imageData;
+    }
+
     AbstractImporter* importer = setupOrReuseImporterForImage("Trade::GltfImporter::image3D():", _d->imagesByDimension[_d->image2DCount + id], 3);
     if(!importer)
         return {};
@@ -118,6 +118,16 @@ the importer instance. In case of images, the files are loaded on-demand inside
 @ref InputFileCallbackPolicy::Close is emitted right after the file is fully
 read.
 
+If no file callback is set, external buffer files are by default read into
+memory as a whole the first time they're accessed. With the
+@cb{.ini} mapExternalBuffers @ce
+@ref Trade-GltfImporter-configuration "configuration option" enabled, they're
+memory-mapped with @relativeref{Corrade,Utility::Path::mapRead()} instead,
+which means only the parts of a potentially huge buffer that are actually
+accessed by imported data get loaded from the disk. The mapping stays alive
+until the file is closed. On platforms without memory mapping support the
+option is ignored.
+
 The content of the global [extensionsRequired](https://www.khronos.org/registry/glTF/specs/2.0/glTF-2.0.html#specifying-extensions)
 array is checked against all extensions supported by the plugin. If a glTF file
 requires an unknown extension, the import will fail. This behaviour can be
@@ -191,11 +201,35 @@ importer plugins the importer delegates to.
     names for nested keys being separated with dots. Other value types,
     heterogeneous arrays and values that don't have a consistent type for given
     key across all nodes are ignored with a warning.
+-   Discovering the custom fields means going through `extras` of all nodes,
+    which can take a significant portion of the opening time for files with
+    millions of nodes. If the @cb{.ini} lazySceneFieldDiscovery @ce
+    @ref Trade-GltfImporter-configuration "configuration option" is enabled,
+    the discovery is deferred to the first @ref scene(),
+    @ref sceneFieldName() or @ref sceneFieldForName() call instead. Errors
+    such as invalid `extras` keys are then reported by these functions
+    instead of making the file opening fail.
+-   If the file uses the [EXT_mesh_gpu_instancing](https://github.com/KhronosGroup/glTF/blob/main/extensions/2.0/Vendor/EXT_mesh_gpu_instancing/README.md)
+    extension, custom scene fields named @cpp "instanceTranslation" @ce (of
+    type @ref SceneFieldType::Vector3), @cpp "instanceRotation" @ce (of type
+    @ref SceneFieldType::Quaternion) and @cpp "instanceScaling" @ce (of type
+    @ref SceneFieldType::Vector3) are registered after all fields coming from
+    node `extras`. Each instance is an entry of given field in the node the
+    instances belong to, no new objects are created for them. The fields are
+    present only if at least one node in the scene has given attribute, nodes
+    that lack an attribute other nodes have get the default translation,
+    rotation or scaling. Float and normalized 8- and 16-bit attributes are
+    supported, quantized data are unpacked to floats. Instance rotations are
+    not renormalized. Custom per-instance attributes are ignored with a
+    warning, accessors with no buffer views and sparse accessors are not
+    supported. If node `extras` already contain fields with the same names,
+    the instances are not imported and a warning is printed.
 -   @ref SceneField::Mesh and @ref SceneField::MeshMaterial fields are always
     marked with @ref SceneFieldFlag::MultiEntry. No other builtin fields can
     have multiple entries for a single object. Node `extras` that were parsed
-    from an array are also marked with @ref SceneFieldFlag::MultiEntry in order
-    to unambiguously distinguish them from non-array values.
+    from an array and the `EXT_mesh_gpu_instancing` fields are also marked with
+    @ref SceneFieldFlag::MultiEntry in order to unambiguously distinguish them
+    from non-array values.
 
 @subsection Trade-GltfImporter-behavior-animations Animation and skin import
 
@@ -356,6 +390,70 @@ left in the vertex data array even if not referenced. Again you can use
 Index accessors with no backing buffer views and sparse index accessors are
 supported as well.
 
+@subsection Trade-GltfImporter-behavior-meshes-batch Batch mesh import
+
+Files with thousands of small primitives can be imported with
+@ref meshBatch() into a single mesh with one interleaved vertex buffer and one
+index buffer, with the index and vertex range of each input mesh recorded in
+a @ref MeshBatchRange. The ranges can be directly used for multi-draw, the
+indices are already offset to the concatenated vertex data. All meshes in a
+batch have to have the same primitive and the same attribute names, formats,
+array sizes and morph target IDs in the same order, which is the case for
+primitives exported with the same attribute layout. The total vertex and index
+count is calculated upfront from the accessor counts, and the accessors of each
+mesh, including sparse ones and ones without a buffer view, are then decoded
+directly into the output, without importing each mesh separately first. The
+exception are primitives with
+@ref Trade-GltfImporter-behavior-meshes-draco "Draco compression", which are
+decoded through @ref mesh() into a temporary mesh and copied from there. The
+@ref MeshData::importerState() of the batch is @cpp nullptr @ce.
+
+As @ref meshBatch() is a plugin-specific API, it's only available with the
+plugin linked statically. Through the generic @ref AbstractImporter interface,
+a batch can be requested by setting the @cb{.ini} meshBatch @ce
+@ref Trade-GltfImporter-configuration "configuration option" to a
+whitespace-separated list of mesh IDs before opening a file. The batch is then
+exposed as an additional unnamed mesh with ID equal to the count of meshes in
+the file, i.e. the last one in @ref meshCount(), and its
+@ref MeshData::importerState() points to an array of @ref MeshBatchRange
+with one item for each ID in the option, in the same order. The ranges are
+valid until the file is closed. Opening a file fails if any of the IDs isn't
+a number or is out of range for the meshes in the file.
+
+@subsection Trade-GltfImporter-behavior-meshes-meshopt Meshopt compression
+
+Buffer views compressed with the [EXT_meshopt_compression](https://github.com/KhronosGroup/glTF/blob/main/extensions/2.0/Vendor/EXT_meshopt_compression/README.md)
+extension are decoded with a builtin decoder, with no external dependency. All
+three modes --- @cpp "ATTRIBUTES" @ce, @cpp "TRIANGLES" @ce and
+@cpp "INDICES" @ce --- and all three filters --- @cpp "OCTAHEDRAL" @ce,
+@cpp "QUATERNION" @ce and @cpp "EXPONENTIAL" @ce --- are supported. The
+buffer the view references is treated as a fallback and is never loaded, so it
+doesn't need to have any URI.
+
+A compressed buffer view is decoded the first time a mesh accessing it is
+imported and the decoded data stay cached until the file is closed, so
+subsequent meshes sharing the same buffer view don't decode it again. Each
+decoded view is treated as a separate buffer when copying used buffer ranges
+into the imported vertex data. Invalid or truncated compressed data cause the
+import to fail.
+
+@subsection Trade-GltfImporter-behavior-meshes-draco Draco compression
+
+Mesh primitives compressed with the [KHR_draco_mesh_compression](https://github.com/KhronosGroup/glTF/blob/main/extensions/2.0/Khronos/KHR_draco_mesh_compression/README.md)
+extension are decoded by delegating to @ref DracoImporter, which thus needs to
+be available to the plugin manager. The compressed data are decoded only if
+some accessor referenced by the extension or the index accessor has no buffer
+view --- accessors that have one are an uncompressed fallback and are imported
+as-is, without the @ref DracoImporter plugin being needed at all. As the
+vertex order of the decoded data is unrelated to the fallback, it's not
+possible to combine the two --- if the compressed data are used, all
+attributes and indices of the primitive have to come from them, and the
+primitive can't have any morph targets. The decoded attributes are
+expected to have the same vertex count and the same component type and count
+as the accessors referencing them, and the decoded indices have to fit into
+the index accessor type. @ref MeshData::importerState() points to the glTF
+primitive also in this case.
+
 @subsection Trade-GltfImporter-behavior-materials Material import
 
 -   If present, builtin [metallic/roughness](https://www.khronos.org/registry/glTF/specs/2.0/glTF-2.0.html#metallic-roughness-material) material is imported,
@@ -489,6 +587,72 @@ multiple extensions, the image referenced by the first recognized extension
 appearing in the file will be picked, others ignored.</li>
 </ul>
 
+@subsubsection Trade-GltfImporter-behavior-textures-cache Image importer caching
+
+Images are imported by delegating to @ref AnyImageImporter, which is opened
+with the image data when given image or its level count is first queried. The
+importer keeps a cache of recently opened image importers so alternating
+access to several images, such as when importing all levels of multiple
+images, doesn't need to reopen and reparse the files each time. The cache has
+space for one importer by default, which is enough for importing images and
+their levels one after another. Access patterns that interleave several images
+can make use of a larger cache by increasing the
+@cb{.ini} imageImporterCacheSize @ce
+@ref Trade-GltfImporter-configuration "configuration option", at the cost of
+keeping more image files in memory. The least recently used importer is
+closed when the cache is full. Failed image imports are cached as well, in
+order to not print the same error messages repeatedly.
+
+To help with tuning the cache size, the @cb{.ini} imageImporterCacheHits @ce
+and @cb{.ini} imageImporterCacheMisses @ce configuration options are updated
+after each image and image level count query with how many times an already
+opened importer was reused and how many times a new one had to be opened
+since the file was opened. If the plugin is linked statically, the same is
+returned from @ref imageImporterCacheHits() and
+@ref imageImporterCacheMisses().
+
+@subsubsection Trade-GltfImporter-behavior-textures-prefetch Parallel image decoding
+
+By default, images are decoded one by one on the calling thread when requested
+through @ref image2D() or @ref image3D(). For files with many images, all
+images can be decoded upfront in parallel by enabling the
+@cb{.ini} prefetchImages @ce
+@ref Trade-GltfImporter-configuration "configuration option" before opening a
+file. To decode just a subset of the images, list their IDs in the
+@cb{.ini} prefetchImage2DIds @ce and @cb{.ini} prefetchImage3DIds @ce options
+instead, in which case the opening fails if any of the IDs is out of range.
+If the plugin is linked statically, the same can be done on an already opened
+file by calling @ref prefetchImages(), @ref prefetchImages2D() or
+@ref prefetchImages3D(). The decoding is spread across the
+count of threads given by the @cb{.ini} prefetchThreads @ce option, which
+defaults to the hardware concurrency. Decoded image levels are kept in memory
+until they're retrieved through @ref image2D() or @ref image3D(), each level
+is returned from the prefetched data just once, subsequent calls decode it
+again.
+
+Parsing of the glTF image references and loading of external image files
+including calls to @ref setFileCallback() "file callbacks" is done on the
+calling thread, only the actual image import happens in the worker threads.
+Because the plugin manager isn't thread-safe, instantiation and destruction of
+the image importer plugins is serialized. To allow the images to be opened and
+decoded in parallel, the importer plugin is picked directly based on the file
+signature for PNG, JPEG, KTX2, DDS, Basis and WebP files instead of going
+through @ref AnyImageImporter. Other files are opened through
+@ref AnyImageImporter, which however means their opening is serialized as
+well. Verbose and warning output produced by the image importers is printed
+on the calling thread once all images are decoded. Images that fail to decode
+aren't prefetched and their errors aren't printed, the regular import path in
+@ref image2D() and @ref image3D() prints them instead.
+
+The prefetch doesn't go through the
+@ref Trade-GltfImporter-behavior-textures-cache "image importer cache" ---
+the importers used for decoding are destroyed once all levels of given image
+are decoded and retrieving a prefetched level or level count isn't counted
+in the @cb{.ini} imageImporterCacheHits @ce or
+@cb{.ini} imageImporterCacheMisses @ce statistics. Once a
+prefetched level is retrieved, subsequent calls for the same level go through
+the cache as usual.
+
 @subsubsection Trade-GltfImporter-behavior-textures-array 2D array texture support
 
 If the @cb{.ini} experimentalKhrTextureKtx @ce
@@ -614,11 +778,118 @@ class MAGNUM_GLTFIMPORTER_EXPORT GltfImporter: public AbstractImporter {
             return static_cast<const Utility::Json*>(AbstractImporter::importerState());
         }
 
+        /**
+         * @brief Image importer cache hit count
+         * @m_since_latest_{plugins}
+         *
+         * Count of image and image level count queries since the file was
+         * opened that reused an already opened image importer. Expects that
+         * a file is opened. The same value is available in the
+         * @cb{.ini} imageImporterCacheHits @ce
+         * @ref Trade-GltfImporter-configuration "configuration option",
+         * which is accessible also if the plugin is loaded dynamically. See
+         * @ref Trade-GltfImporter-behavior-textures-cache for more
+         * information.
+         * @see @ref imageImporterCacheMisses()
+         */
+        std::size_t imageImporterCacheHits() const;
+
+        /**
+         * @brief Image importer cache miss count
+         * @m_since_latest_{plugins}
+         *
+         * Count of image and image level count queries since the file was
+         * opened that had to open a new image importer. Expects that a file
+         * is opened. The same value is available in the
+         * @cb{.ini} imageImporterCacheMisses @ce
+         * @ref Trade-GltfImporter-configuration "configuration option",
+         * which is accessible also if the plugin is loaded dynamically. See
+         * @ref Trade-GltfImporter-behavior-textures-cache for more
+         * information.
+         * @see @ref imageImporterCacheHits()
+         */
+        std::size_t imageImporterCacheMisses() const;
+
+        /**
+         * @brief Decode all images upfront
+         * @m_since_latest_{plugins}
+         *
+         * Decodes all levels of all 2D and 3D images in the file in parallel
+         * and keeps them until retrieved through @ref image2D() or
+         * @ref image3D(). Expects that a file is opened. See
+         * @ref Trade-GltfImporter-behavior-textures-prefetch for more
+         * information.
+         * @see @ref prefetchImages2D(), @ref prefetchImages3D()
+         */
+        void prefetchImages();
+
+        /**
+         * @brief Decode given 2D images upfront
+         * @m_since_latest_{plugins}
+         *
+         * Like @ref prefetchImages(), but decodes just 2D images of given
+         * IDs. Expects that a file is opened and all IDs are less than
+         * @ref image2DCount().
+         */
+        void prefetchImages2D(Containers::ArrayView<const UnsignedInt> ids);
+
+        /**
+         * @brief Decode given 3D images upfront
+         * @m_since_latest_{plugins}
+         *
+         * Like @ref prefetchImages(), but decodes just 3D images of given
+         * IDs. Expects that a file is opened and all IDs are less than
+         * @ref image3DCount().
+         */
+        void prefetchImages3D(Containers::ArrayView<const UnsignedInt> ids);
+
+        /**
+         * @brief Range of a mesh in a batch
+         * @m_since_latest_{plugins}
+         *
+         * @see @ref meshBatch()
+         */
+        struct MeshBatchRange {
+            /** @brief Offset of the first index */
+            UnsignedInt indexOffset;
+            /** @brief Index count */
+            UnsignedInt indexCount;
+            /** @brief Offset of the first vertex */
+            UnsignedInt vertexOffset;
+            /** @brief Vertex count */
+            UnsignedInt vertexCount;
+        };
+
+        /**
+         * @brief Import multiple meshes into a single mesh
+         * @m_since_latest_{plugins}
+         *
+         * Imports meshes of given IDs and concatenates them into a single
+         * mesh with interleaved vertex data and @ref MeshIndexType::UnsignedInt
+         * indices, writing the index and vertex range of each mesh into
+         * @p ranges. The indices are offset to point to the concatenated
+         * vertex data, non-indexed meshes get trivial indices generated. See
+         * @ref Trade-GltfImporter-behavior-meshes-batch for more information.
+         *
+         * Expects that a file is opened, @p ids is not empty, all IDs are
+         * less than @ref meshCount() and don't refer to the batch configured
+         * via the @cb{.ini} meshBatch @ce
+         * @ref Trade-GltfImporter-configuration "configuration option", and
+         * @p ranges has the same size as
+         * @p ids. Prints a message to @relativeref{Magnum,Error} and returns
+         * @relativeref{Corrade,Containers::NullOpt} if any of the meshes
+         * fails to import, if their primitive or attribute layout doesn't
+         * match or if the primitive is a strip, loop or fan.
+         */
+        Containers::Optional<MeshData> meshBatch(Containers::ArrayView<const UnsignedInt> ids, Containers::ArrayView<MeshBatchRange> ranges);
+
     private:
         struct Document;
         /* Returned by internal APIs below, thus have to be declared here */
         struct BufferView;
         struct Accessor;
+        struct Primitive;
+        struct ImageSource;
 
         MAGNUM_GLTFIMPORTER_LOCAL ImporterFeatures doFeatures() const override;
 
@@ -649,6 +920,8 @@ class MAGNUM_GLTFIMPORTER_EXPORT GltfImporter: public AbstractImporter {
         MAGNUM_GLTFIMPORTER_LOCAL Int doSceneForName(Containers::StringView name) override;
         MAGNUM_GLTFIMPORTER_LOCAL Containers::String doSceneName(UnsignedInt id) override;
         MAGNUM_GLTFIMPORTER_LOCAL Containers::Optional<SceneData> doScene(UnsignedInt id) override;
+        MAGNUM_GLTFIMPORTER_LOCAL bool discoverSceneFields(const char* errorPrefix, Utility::Json& gltf);
+        MAGNUM_GLTFIMPORTER_LOCAL bool ensureSceneFieldsDiscovered(const char* errorPrefix);
         MAGNUM_GLTFIMPORTER_LOCAL SceneField doSceneFieldForName(Containers::StringView name) override;
         MAGNUM_GLTFIMPORTER_LOCAL Containers::String doSceneFieldName(SceneField name) override;
 
@@ -664,9 +937,11 @@ class MAGNUM_GLTFIMPORTER_EXPORT GltfImporter: public AbstractImporter {
         MAGNUM_GLTFIMPORTER_LOCAL UnsignedInt doMeshCount() const override;
         MAGNUM_GLTFIMPORTER_LOCAL Int doMeshForName(Containers::StringView name) override;
         MAGNUM_GLTFIMPORTER_LOCAL Containers::String doMeshName(UnsignedInt id) override;
+        MAGNUM_GLTFIMPORTER_LOCAL Containers::Optional<Primitive> parsePrimitive(UnsignedInt id);
         MAGNUM_GLTFIMPORTER_LOCAL Containers::Optional<MeshData> doMesh(UnsignedInt id, UnsignedInt level) override;
         MAGNUM_GLTFIMPORTER_LOCAL MeshAttribute doMeshAttributeForName(Containers::StringView name) override;
         MAGNUM_GLTFIMPORTER_LOCAL Containers::String doMeshAttributeName(MeshAttribute name) override;
+        MAGNUM_GLTFIMPORTER_LOCAL Containers::Optional<MeshData> meshBatchInternal(const char* messagePrefix, Containers::ArrayView<const UnsignedInt> ids, Containers::ArrayView<MeshBatchRange> ranges, const void* importerState);
 
         MAGNUM_GLTFIMPORTER_LOCAL UnsignedInt doMaterialCount() const override;
         MAGNUM_GLTFIMPORTER_LOCAL Int doMaterialForName(Containers::StringView name) override;
@@ -678,7 +953,9 @@ class MAGNUM_GLTFIMPORTER_EXPORT GltfImporter: public AbstractImporter {
         MAGNUM_GLTFIMPORTER_LOCAL Containers::String doTextureName(UnsignedInt id) override;
         MAGNUM_GLTFIMPORTER_LOCAL Containers::Optional<TextureData> doTexture(UnsignedInt id) override;
 
+        MAGNUM_GLTFIMPORTER_LOCAL Containers::Optional<ImageSource> parseImageSource(const char* errorPrefix, UnsignedInt id);
         MAGNUM_GLTFIMPORTER_LOCAL AbstractImporter* setupOrReuseImporterForImage(const char* errorPrefix, UnsignedInt id, UnsignedInt expectedDimensions);
+        MAGNUM_GLTFIMPORTER_LOCAL void prefetchImagesInternal(const char* messagePrefix, Containers::ArrayView<const UnsignedInt> gltfImageIds);
 
         MAGNUM_GLTFIMPORTER_LOCAL UnsignedInt doImage2DCount() const override;
         MAGNUM_GLTFIMPORTER_LOCAL UnsignedInt doImage2DLevelCount(UnsignedInt id) override;
@@ -692,10 +969,12 @@ class MAGNUM_GLTFIMPORTER_EXPORT GltfImporter: public AbstractImporter {
         MAGNUM_GLTFIMPORTER_LOCAL Containers::String doImage3DName(UnsignedInt id) override;
         MAGNUM_GLTFIMPORTER_LOCAL Containers::Optional<ImageData3D> doImage3D(UnsignedInt id, UnsignedInt level) override;
 
-        MAGNUM_GLTFIMPORTER_LOCAL Containers::Optional<Containers::Array<char>> loadUri(const char* errorPrefix, Containers::StringView uri);
+        MAGNUM_GLTFIMPORTER_LOCAL Containers::Optional<Containers::Array<char>> loadUri(const char* errorPrefix, Containers::StringView uri, bool map = false);
         MAGNUM_GLTFIMPORTER_LOCAL Containers::Optional<Containers::ArrayView<const char>> parseBuffer(const char* const errorPrefix, UnsignedInt id);
         MAGNUM_GLTFIMPORTER_LOCAL Containers::Optional<BufferView> parseBufferView(const char* errorPrefix, UnsignedInt bufferViewId);
+        MAGNUM_GLTFIMPORTER_LOCAL Containers::Optional<Containers::ArrayView<const char>> parseMeshoptCompressedBufferView(const char* errorPrefix, UnsignedInt bufferViewId, Utility::JsonToken gltfMeshoptCompression, std::size_t byteLength);
         MAGNUM_GLTFIMPORTER_LOCAL Containers::Optional<Accessor> parseAccessor(const char* const errorPrefix, UnsignedInt accessorId);
+        MAGNUM_GLTFIMPORTER_LOCAL Containers::Optional<MeshData> decodeDracoCompressedPrimitive(Utility::JsonToken gltfDracoCompression, Containers::Pointer<AbstractImporter>& dracoImporter);
         MAGNUM_GLTFIMPORTER_LOCAL bool materialTexture(Utility::JsonToken gltfTexture, Containers::Array<MaterialAttributeData>& attributes, Containers::StringView attribute, Containers::StringView extraAttributePrefix, bool warningOnly = false);
         MAGNUM_GLTFIMPORTER_LOCAL bool materialTexture(Utility::JsonToken gltfTexture, Containers::Array<MaterialAttributeData>& attributes, Containers::StringView attribute, bool warningOnly = false);
 
@@ -24,7 +24,9 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/StringView.h>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
 #include <Corrade/Utility/Format.h>
 
 #include "MagnumPlugins/GltfImporter/decode.h"
@@ -40,6 +42,15 @@ struct GltfImporterDecodeTest: TestSuite::Tester {
     void base64();
     void base64Padding();
     void base64Invalid();
+
+    void meshoptAttributes();
+    void meshoptAttributesMultipleBlocks();
+    void meshoptTriangles();
+    void meshoptIndices();
+    void meshoptInvalid();
+    void meshoptFilterOctahedral();
+    void meshoptFilterQuaternion();
+    void meshoptFilterExponential();
 };
 
 using namespace Containers::Literals;
@@ -125,6 +136,77 @@ const struct {
         "invalid Base64 padding bytes ay\xff"}
 };
 
+enum class MeshoptMode {
+    Attributes,
+    Triangles,
+    Indices
+};
+
+const struct {
+    const char* name;
+    MeshoptMode mode;
+    std::size_t count, stride;
+    Containers::StringView input;
+} MeshoptInvalidData[]{
+    /* A valid stream of a single four-byte vertex is "\xa0", four zero block
+       headers, 28 bytes of tail padding and the vertex itself */
+    {"attributes, invalid header", MeshoptMode::Attributes, 1, 4,
+        "\xa1" "\x00\x00\x00\x00"
+        "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        "\x01\x02\x03\x04"_s},
+    {"attributes, too short for the tail", MeshoptMode::Attributes, 1, 4,
+        "\xa0"
+        "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        "\x01\x02\x03\x04"_s},
+    {"attributes, block data missing", MeshoptMode::Attributes, 1, 4,
+        "\xa0"
+        "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        "\x01\x02\x03\x04"_s},
+    {"attributes, packed deltas missing", MeshoptMode::Attributes, 1, 4,
+        "\xa0" "\x03"
+        "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        "\x01\x02\x03\x04"_s},
+    {"attributes, data after the end", MeshoptMode::Attributes, 1, 4,
+        "\xa0" "\x00\x00\x00\x00" "\x00"
+        "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        "\x01\x02\x03\x04"_s},
+    /* A valid stream of a single triangle with three new vertices is "\xe1",
+       "\xf0" referencing the first auxiliary code and the 16-byte auxiliary
+       code table */
+    {"triangles, invalid header", MeshoptMode::Triangles, 3, 2,
+        "\xd1" "\xf0"
+        "\x00\x76\x87\x56\x67\x78\xa9\x86\x65\x89\x68\x98\x01\x69\x00\x00"_s},
+    {"triangles, unsupported version", MeshoptMode::Triangles, 3, 2,
+        "\xe2" "\xf0"
+        "\x00\x76\x87\x56\x67\x78\xa9\x86\x65\x89\x68\x98\x01\x69\x00\x00"_s},
+    {"triangles, too short", MeshoptMode::Triangles, 3, 2,
+        "\xe1" "\xf0"
+        "\x00\x76\x87\x56\x67\x78\xa9\x86\x65\x89\x68\x98\x01\x69\x00"_s},
+    {"triangles, auxiliary data missing", MeshoptMode::Triangles, 3, 2,
+        "\xe1" "\xfe"
+        "\x00\x76\x87\x56\x67\x78\xa9\x86\x65\x89\x68\x98\x01\x69\x00\x00"_s},
+    {"triangles, data after the end", MeshoptMode::Triangles, 3, 4,
+        "\xe1" "\xf0" "\x00"
+        "\x00\x76\x87\x56\x67\x78\xa9\x86\x65\x89\x68\x98\x01\x69\x00\x00"_s},
+    /* A valid stream of a single zero index is "\xd1", "\x00" and four bytes
+       of padding */
+    {"indices, invalid header", MeshoptMode::Indices, 1, 4,
+        "\xe1" "\x00" "\x00\x00\x00\x00"_s},
+    {"indices, unsupported version", MeshoptMode::Indices, 1, 4,
+        "\xd2" "\x00" "\x00\x00\x00\x00"_s},
+    {"indices, too short", MeshoptMode::Indices, 2, 4,
+        "\xd1" "\x00" "\x00\x00\x00\x00"_s},
+    {"indices, truncated", MeshoptMode::Indices, 2, 2,
+        "\xd1" "\x80\x80" "\x00\x00\x00\x00"_s},
+    {"indices, data after the end", MeshoptMode::Indices, 1, 2,
+        "\xd1" "\x00\x00" "\x00\x00\x00\x00"_s},
+};
+
 GltfImporterDecodeTest::GltfImporterDecodeTest() {
     addTests({&GltfImporterDecodeTest::uri});
 
@@ -138,6 +220,18 @@ GltfImporterDecodeTest::GltfImporterDecodeTest() {
 
     addInstancedTests({&GltfImporterDecodeTest::base64Invalid},
         Containers::arraySize(Base64InvalidData));
+
+    addTests({&GltfImporterDecodeTest::meshoptAttributes,
+              &GltfImporterDecodeTest::meshoptAttributesMultipleBlocks,
+              &GltfImporterDecodeTest::meshoptTriangles,
+              &GltfImporterDecodeTest::meshoptIndices});
+
+    addInstancedTests({&GltfImporterDecodeTest::meshoptInvalid},
+        Containers::arraySize(MeshoptInvalidData));
+
+    addTests({&GltfImporterDecodeTest::meshoptFilterOctahedral,
+              &GltfImporterDecodeTest::meshoptFilterQuaternion,
+              &GltfImporterDecodeTest::meshoptFilterExponential});
 }
 
 void GltfImporterDecodeTest::uri() {
@@ -234,6 +328,222 @@ void GltfImporterDecodeTest::base64Invalid() {
     CORRADE_COMPARE(out, Utility::format("foo(): {}\n", data.message));
 }
 
+
+void GltfImporterDecodeTest::meshoptAttributes() {
+    /* Twenty 8-byte vertices, produced by an encoder following the reference
+       implementation. The data is picked to use all four group encodings:
+       zero deltas, 2-bit and 4-bit deltas with and without extra bytes and
+       raw bytes. */
+    const UnsignedByte input[]{
+        0xa0, 0x05, 0x2a, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x06, 0x04,
+        0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0xff, 0x00, 0x00, 0x00, 0x04,
+        0x04, 0x04, 0x04, 0x05, 0x15, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00,
+        0x00, 0x07, 0x00, 0x6d, 0xf6, 0x6a, 0x5e, 0x35, 0x2b, 0xd7, 0x19, 0x29,
+        0xe3, 0x06, 0x4f, 0xfb, 0x52, 0x51, 0xff, 0x00, 0x00, 0x00, 0xf4, 0x80,
+        0x32, 0x62, 0x00, 0x07, 0x00, 0x02, 0x06, 0x0a, 0x0e, 0x12, 0x16, 0x1a,
+        0x1e, 0x22, 0x26, 0x2a, 0x2e, 0x32, 0x36, 0x3a, 0xff, 0x00, 0x00, 0x00,
+        0x3e, 0x42, 0x46, 0x4a, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x64, 0x07, 0x79, 0x00, 0x00, 0x00
+    };
+    const UnsignedByte expected[]{
+        0x00, 0x00, 0x64, 0x07, 0x79, 0x00, 0x00, 0x00,
+        0x01, 0x02, 0x63, 0x07, 0x42, 0x00, 0x01, 0x00,
+        0x02, 0x04, 0x62, 0x07, 0xbd, 0x00, 0x04, 0x00,
+        0x03, 0x06, 0x61, 0x07, 0xf2, 0x00, 0x09, 0x00,
+        0x04, 0x08, 0x60, 0x07, 0x21, 0x00, 0x10, 0x00,
+        0x05, 0x0a, 0x5f, 0x07, 0x06, 0x00, 0x19, 0x00,
+        0x06, 0x0c, 0x5e, 0x07, 0xf0, 0x00, 0x24, 0x00,
+        0x07, 0x0e, 0x5d, 0x07, 0x84, 0x00, 0x31, 0x00,
+        0x08, 0x10, 0x5c, 0x07, 0x77, 0x00, 0x40, 0x00,
+        0x09, 0x12, 0x5b, 0x07, 0x62, 0x00, 0x51, 0x00,
+        0x0a, 0x14, 0x5a, 0x07, 0xf0, 0x00, 0x64, 0x00,
+        0x0b, 0x16, 0x59, 0x07, 0xf3, 0x00, 0x79, 0x00,
+        0x0c, 0x18, 0x58, 0x07, 0xcb, 0x00, 0x90, 0x00,
+        0x0d, 0x1a, 0x57, 0x07, 0x4d, 0x00, 0xa9, 0x00,
+        0x0e, 0x1c, 0x56, 0x07, 0x76, 0x00, 0xc4, 0x00,
+        0x0f, 0x1e, 0x55, 0x07, 0x4d, 0x00, 0xe1, 0x00,
+        0x10, 0x20, 0x54, 0x07, 0xc7, 0x00, 0x00, 0x00,
+        0x11, 0x22, 0x53, 0x07, 0x07, 0x00, 0x21, 0x00,
+        0x12, 0x24, 0x52, 0x07, 0x20, 0x00, 0x44, 0xc8,
+        0x13, 0x26, 0x51, 0x07, 0x51, 0x00, 0x69, 0xc8
+    };
+
+    UnsignedByte out[20*8];
+    CORRADE_VERIFY(decodeMeshoptAttributes(Containers::arrayCast<const char>(Containers::arrayView(input)), 20, 8, Containers::arrayCast<char>(Containers::arrayView(out))));
+    CORRADE_COMPARE_AS(Containers::arrayView(out),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void GltfImporterDecodeTest::meshoptAttributesMultipleBlocks() {
+    /* With a 256-byte stride, a block has 32 vertices, so 40 vertices are
+       split into two. All deltas are zero, so each block is just one zero
+       group header per byte, followed by the tail with the base vertex. */
+    Containers::Array<char> input{ValueInit, 1 + 2*256 + 256};
+    input[0] = '\xa0';
+    for(std::size_t i = 0; i != 256; ++i)
+        input[1 + 2*256 + i] = char(i*3);
+
+    Containers::Array<char> out{NoInit, 40*256};
+    CORRADE_VERIFY(decodeMeshoptAttributes(input, 40, 256, out));
+    for(std::size_t i = 0; i != 40; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_AS(out.sliceSize(i*256, 256),
+            input.exceptPrefix(1 + 2*256),
+            TestSuite::Compare::Container);
+    }
+
+    /* One block header less is not enough */
+    CORRADE_VERIFY(!decodeMeshoptAttributes(input.exceptSuffix(1), 40, 256, out));
+}
+
+void GltfImporterDecodeTest::meshoptTriangles() {
+    /* Produced by an encoder following the reference implementation, using
+       all triangle codes -- a new triangle from the auxiliary code table,
+       triangles sharing an edge with a new vertex and a vertex from the
+       FIFO, as well as explicitly encoded auxiliary codes and indices */
+    const UnsignedByte input[]{
+        0xe1, 0xf0, 0x10, 0x00, 0x10, 0xf0, 0xff, 0x14, 0xfe, 0xff, 0xc8, 0x01,
+        0xc8, 0x01, 0xc8, 0x01, 0xbc, 0x00, 0x76, 0x87, 0x56, 0x67, 0x78, 0xa9,
+        0x86, 0x65, 0x89, 0x68, 0x98, 0x01, 0x69, 0x00, 0x00
+    };
+    /* The last triangle is rotated compared to what was encoded, which is
+       allowed */
+    const UnsignedInt expected[]{
+        0, 1, 2, 2, 1, 3, 2, 3, 4, 4, 3, 5, 6, 7, 8, 100, 200, 300, 300, 200, 7,
+        9, 1, 0
+    };
+
+    {
+        UnsignedInt out[24];
+        CORRADE_VERIFY(decodeMeshoptTriangles(Containers::arrayCast<const char>(Containers::arrayView(input)), 24, 4, Containers::arrayCast<char>(Containers::arrayView(out))));
+        CORRADE_COMPARE_AS(Containers::arrayView(out),
+            Containers::arrayView(expected),
+            TestSuite::Compare::Container);
+    } {
+        UnsignedShort out[24];
+        CORRADE_VERIFY(decodeMeshoptTriangles(Containers::arrayCast<const char>(Containers::arrayView(input)), 24, 2, Containers::arrayCast<char>(Containers::arrayView(out))));
+        for(std::size_t i = 0; i != 24; ++i) {
+            CORRADE_ITERATION(i);
+            CORRADE_COMPARE(out[i], expected[i]);
+        }
+    }
+}
+
+void GltfImporterDecodeTest::meshoptIndices() {
+    /* Produced by an encoder following the reference implementation,
+       alternating between two sequences, with a large jump in the middle */
+    const UnsignedByte input[]{
+        0xd1, 0x00, 0x04, 0x04, 0x04, 0x84, 0x03, 0x11, 0x04, 0x05, 0xac, 0x88,
+        0x11, 0x05, 0x0f, 0x00, 0x00, 0x00, 0x00
+    };
+    const UnsignedInt expected[]{
+        0, 1, 2, 3, 100, 4, 101, 5, 70000, 6, 2
+    };
+
+    UnsignedInt out[11];
+    CORRADE_VERIFY(decodeMeshoptIndices(Containers::arrayCast<const char>(Containers::arrayView(input)), 11, 4, Containers::arrayCast<char>(Containers::arrayView(out))));
+    CORRADE_COMPARE_AS(Containers::arrayView(out),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void GltfImporterDecodeTest::meshoptInvalid() {
+    auto&& data = MeshoptInvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<char> out{ValueInit, data.count*data.stride};
+    bool result;
+    if(data.mode == MeshoptMode::Attributes)
+        result = decodeMeshoptAttributes(data.input, data.count, data.stride, out);
+    else if(data.mode == MeshoptMode::Triangles)
+        result = decodeMeshoptTriangles(data.input, data.count, data.stride, out);
+    else if(data.mode == MeshoptMode::Indices)
+        result = decodeMeshoptIndices(data.input, data.count, data.stride, out);
+    else CORRADE_INTERNAL_ASSERT_UNREACHABLE();
+    CORRADE_VERIFY(!result);
+}
+
+void GltfImporterDecodeTest::meshoptFilterOctahedral() {
+    /* 8-bit. The fourth component is left untouched. */
+    {
+        Byte data[]{
+            0, 0, 127, 5,
+            127, 0, 127, 12,
+            42, 42, 127, 0,
+            -42, 42, 127, 1,
+            127, 127, 127, 3
+        };
+        decodeMeshoptFilterOctahedral<Byte>(Containers::arrayCast<char>(Containers::arrayView(data)));
+        CORRADE_COMPARE_AS(Containers::arrayView(data), Containers::arrayView<Byte>({
+            0, 0, 127, 5,
+            127, 0, 0, 12,
+            73, 73, 74, 0,
+            -73, 73, 74, 1,
+            0, 0, -127, 3
+        }), TestSuite::Compare::Container);
+
+    /* 16-bit */
+    } {
+        Short data[]{
+            0, 0, 32767, 5,
+            32767, 32767, 32767, 7,
+            10000, -20000, 32767, -3
+        };
+        decodeMeshoptFilterOctahedral<Short>(Containers::arrayCast<char>(Containers::arrayView(data)));
+        CORRADE_COMPARE_AS(Containers::arrayView(data), Containers::arrayView<Short>({
+            0, 0, 32767, 5,
+            0, 0, -32767, 7,
+            14543, -29086, 4024, -3
+        }), TestSuite::Compare::Container);
+    }
+}
+
+void GltfImporterDecodeTest::meshoptFilterQuaternion() {
+    Short data[]{
+        /* Identity, with W being the largest component */
+        0, 0, 0, 32767,
+        /* Identity, with X being the largest component */
+        0, 0, 0, 32764,
+        /* Largest component is Y */
+        16384, 0, 0, 32765,
+        /* Largest component is X again, with all other components
+           non-zero */
+        8000, -8000, 8000, 32764
+    };
+    decodeMeshoptFilterQuaternion(Containers::arrayCast<char>(Containers::arrayView(data)));
+    CORRADE_COMPARE_AS(Containers::arrayView(data), Containers::arrayView<Short>({
+        0, 0, 0, 32767,
+        32767, 0, 0, 0,
+        0, 30651, 11585, 0,
+        31268, 5657, -5657, 5657
+    }), TestSuite::Compare::Container);
+}
+
+void GltfImporterDecodeTest::meshoptFilterExponential() {
+    /* 24-bit signed mantissa in the low bits, 8-bit signed exponent in the
+       high bits */
+    UnsignedInt data[]{
+        0xff000003u,    /* 3*2^-1 */
+        0x04ffffffu,    /* -1*2^4 */
+        0x00000000u,
+        0xf6003039u,    /* 12345*2^-10 */
+        0x00800000u,    /* -8388608*2^0 */
+        0x00000001u     /* 1*2^0 */
+    };
+    decodeMeshoptFilterExponential(Containers::arrayCast<char>(Containers::arrayView(data)));
+    CORRADE_COMPARE_AS(Containers::arrayCast<Float>(Containers::arrayView(data)), Containers::arrayView<Float>({
+        1.5f,
+        -16.0f,
+        0.0f,
+        12.0556640625f,
+        -8388608.0f,
+        1.0f
+    }), TestSuite::Compare::Container);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::GltfImporterDecodeTest)
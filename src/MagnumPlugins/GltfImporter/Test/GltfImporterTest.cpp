@@ -27,10 +27,12 @@
 */
 
 #include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/StaticArray.h>
 #include <Corrade/Containers/StridedBitArrayView.h>
+#include <Corrade/Containers/String.h>
 #include <Corrade/Containers/StringIterable.h>
 #include <Corrade/Containers/Triple.h>
 #include <Corrade/PluginManager/PluginMetadata.h>
@@ -38,6 +40,7 @@
 #include <Corrade/TestSuite/Compare/Container.h>
 #include <Corrade/TestSuite/Compare/Numeric.h>
 #include <Corrade/TestSuite/Compare/String.h>
+#include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/ConfigurationGroup.h>
 #include <Corrade/Utility/DebugStl.h> /** @todo remove once Configuration and file callbacks are std::string-free */
 #include <Corrade/Utility/Format.h>
@@ -78,6 +81,19 @@
 
 #include "configure.h"
 
+/* Draco doesn't have any encoder tool that would be commonly available, so
+   the KHR_draco_mesh_compression test data are generated on the fly */
+#ifdef MAGNUM_WITH_DRACOIMPORTER
+#include <draco/compression/encode.h>
+#include <draco/mesh/mesh.h>
+#endif
+
+/* Plugin-specific APIs can be called only if the plugin is linked in
+   statically */
+#ifndef GLTFIMPORTER_PLUGIN_FILENAME
+#include "MagnumPlugins/GltfImporter/GltfImporter.h"
+#endif
+
 namespace Magnum { namespace Trade { namespace Test { namespace {
 
 struct GltfImporterTest: TestSuite::Tester {
@@ -91,6 +107,7 @@ struct GltfImporterTest: TestSuite::Tester {
     void openExternalDataNoPathNoCallback();
     void openExternalDataTooLong();
     void openExternalDataTooShort();
+    void openExternalDataMapped();
     void openExternalDataInvalidUri();
 
     void requiredExtensions();
@@ -130,6 +147,11 @@ struct GltfImporterTest: TestSuite::Tester {
     void sceneTransformationQuaternionNormalizationDisabled();
     void sceneCustomFields();
     void sceneCustomFieldsInvalidConfiguration();
+    void sceneCustomFieldsLazyDiscovery();
+    void sceneCustomFieldsLazyDiscoveryInvalid();
+    void sceneMeshGpuInstancing();
+    void sceneMeshGpuInstancingInvalid();
+    void sceneMeshGpuInstancingExtrasCollision();
 
     void skin();
     void skinInvalid();
@@ -154,10 +176,20 @@ struct GltfImporterTest: TestSuite::Tester {
     void meshSizeNotMultipleOfStride();
     void meshBuffers();
     void meshSparseAccessors();
+    void meshMeshoptCompression();
+    void meshDracoCompression();
+    void meshDracoCompressionFallback();
+    void meshBatch();
+    void meshBatchOption();
+    void meshBatchSparse();
+    void meshBatchInvalid();
+    void meshBatchOptionInvalid();
     void meshInvalidWholeFile();
     void meshInvalid();
     void meshInvalidBufferNotFound();
     void meshInvalidSparseIndices();
+    void meshInvalidMeshoptCompression();
+    void meshInvalidDracoCompression();
 
     void materialPbrMetallicRoughness();
     void materialPbrSpecularGlossiness();
@@ -190,6 +222,13 @@ struct GltfImporterTest: TestSuite::Tester {
     void imageInvalid();
     void imageInvalidNotFound();
     void imagePropagateImporterFlags();
+    void imageImporterCache();
+    void imagePrefetch();
+    void imagePrefetchInvalid();
+    void imagePrefetchInvalidThreadCount();
+    void imagePrefetchIds2D();
+    void imagePrefetchIds3D();
+    void imagePrefetchIdsInvalid();
 
     void experimentalKhrTextureKtx2D();
     void experimentalKhrTextureKtx2DArray();
@@ -216,6 +255,8 @@ struct GltfImporterTest: TestSuite::Tester {
     void openTwice();
     void importTwice();
 
+    void benchmarkOpenManyNodes();
+
     /* Needs to load AnyImageImporter from a system-wide location */
     PluginManager::Manager<AbstractImporter> _manager;
 };
@@ -764,6 +805,34 @@ const struct {
         "Trade::GltfImporter::skin3D(): invalid inverseBindMatrices property\n"},
 };
 
+const struct {
+    TestSuite::TestCaseDescriptionSourceLocation name;
+    const char* message;
+} SceneMeshGpuInstancingInvalidData[]{
+    {"invalid extension",
+        "Utility::Json::parseObject(): expected an object, got Utility::JsonToken::Type::Number at {}:49:36\n"
+        "Trade::GltfImporter::scene(): invalid node 0 EXT_mesh_gpu_instancing extension\n"},
+    {"missing attributes",
+        "missing or invalid EXT_mesh_gpu_instancing attributes property of node 1"},
+    {"invalid attribute",
+        "Utility::Json::parseUnsignedInt(): too large integer literal -1 at {}:61:28\n"
+        "Trade::GltfImporter::scene(): invalid EXT_mesh_gpu_instancing TRANSLATION attribute of node 2\n"},
+    {"accessor out of range",
+        "accessor index 5 out of range for 5 accessors"},
+    /* Full accessor checks are tested inside mesh-invalid.gltf, this only
+       verifies the errors are propagated correctly */
+    {"accessor with no buffer view",
+        "accessor 3 has no buffer view, which is unsupported"},
+    {"sparse accessor",
+        "accessor 4 is using sparse storage, which is unsupported"},
+    {"unsupported translation format",
+        "unsupported EXT_mesh_gpu_instancing TRANSLATION format Vector4 in node 6"},
+    {"unsupported rotation format",
+        "unsupported EXT_mesh_gpu_instancing ROTATION format Vector3 in node 7"},
+    {"mismatched attribute count",
+        "mismatched EXT_mesh_gpu_instancing attribute count in node 8, expected 3 but got 2"},
+};
+
 const struct {
     const char* name;
     Containers::Optional<bool> strict;
@@ -1191,6 +1260,106 @@ const struct {
     {"indices, 32-bit sparse indices", "sparse accessor 5 index 67000 out of range for 67000 elements"},
 };
 
+const struct {
+    const char* name;
+    UnsignedInt ids[2];
+    std::size_t idCount;
+    const char* option;
+    const char* message;
+} MeshBatchInvalidData[]{
+    {"different layout", {0, 3}, 2, "0 3",
+        "mesh 3 has a different attribute layout than mesh 0"},
+    {"different primitive", {0, 5}, 2, "0 5",
+        "expected MeshPrimitive::Triangles but mesh 5 is MeshPrimitive::Lines"},
+    {"strip", {4}, 1, "4",
+        "can't batch meshes with MeshPrimitive::TriangleStrip"},
+};
+
+const struct {
+    const char* name;
+    const char* option;
+    const char* message;
+} MeshBatchOptionInvalidData[]{
+    {"not a number", "0 1x 2",
+        "invalid meshBatch ID 1x"},
+    {"negative", "-1",
+        "invalid meshBatch ID -1"},
+    {"out of range", "0 6",
+        "meshBatch ID 6 out of range for 6 meshes"},
+    {"out of range, overflow", "1 184467440737095516160",
+        "meshBatch ID 184467440737095516160 out of range for 6 meshes"},
+};
+
+const struct {
+    const char* name;
+    const char* message;
+} MeshInvalidDracoCompressionData[]{
+    {"invalid extensions",
+        "invalid primitive extensions property"},
+    {"invalid extension",
+        "invalid KHR_draco_mesh_compression extension"},
+    {"missing attributes",
+        "missing or invalid KHR_draco_mesh_compression attributes property"},
+    {"invalid attribute",
+        "invalid KHR_draco_mesh_compression attribute POSITION"},
+    {"missing buffer view",
+        "missing or invalid KHR_draco_mesh_compression bufferView property"},
+    {"buffer view out of range",
+        "buffer view index 1 out of range for 1 buffer views"},
+    {"uncompressed attribute",
+        "KHR_draco_mesh_compression can't be combined with uncompressed attribute NORMAL"},
+    {"attribute with a fallback",
+        "KHR_draco_mesh_compression can't be combined with uncompressed attribute NORMAL"},
+    {"morph target attribute",
+        "KHR_draco_mesh_compression can't be combined with morph target attribute POSITION"},
+    {"uncompressed indices",
+        "KHR_draco_mesh_compression can't be combined with uncompressed indices"},
+};
+
+const struct {
+    const char* name;
+    const char* message;
+} MeshInvalidMeshoptCompressionData[]{
+    {"missing buffer",
+        "buffer view 0 has missing or invalid EXT_meshopt_compression buffer property"},
+    {"missing byteLength",
+        "buffer view 1 has missing or invalid EXT_meshopt_compression byteLength property"},
+    {"missing byteStride",
+        "buffer view 2 has missing or invalid EXT_meshopt_compression byteStride property"},
+    {"missing count",
+        "buffer view 3 has missing or invalid EXT_meshopt_compression count property"},
+    {"missing mode",
+        "buffer view 4 has missing or invalid EXT_meshopt_compression mode property"},
+    {"unrecognized mode",
+        "buffer view 5 has unrecognized EXT_meshopt_compression mode POINTS"},
+    {"attributes stride not a multiple of 4",
+        "buffer view 6 has invalid EXT_meshopt_compression byteStride 6 for ATTRIBUTES, expected a multiple of 4 between 4 and 256"},
+    {"attributes stride too large",
+        "buffer view 7 has invalid EXT_meshopt_compression byteStride 260 for ATTRIBUTES, expected a multiple of 4 between 4 and 256"},
+    {"triangles stride",
+        "buffer view 8 has invalid EXT_meshopt_compression byteStride 1 for TRIANGLES, expected 2 or 4"},
+    {"triangles count not a multiple of 3",
+        "buffer view 9 has invalid EXT_meshopt_compression count 4 for TRIANGLES, expected a multiple of 3"},
+    {"indices stride",
+        "buffer view 10 has invalid EXT_meshopt_compression byteStride 8 for INDICES, expected 2 or 4"},
+    {"filter for indices",
+        "buffer view 11 has EXT_meshopt_compression filter OCTAHEDRAL but mode INDICES"},
+    {"octahedral stride",
+        "buffer view 12 has invalid EXT_meshopt_compression byteStride 12 for OCTAHEDRAL filter, expected 4 or 8"},
+    {"quaternion stride",
+        "buffer view 13 has invalid EXT_meshopt_compression byteStride 4 for QUATERNION filter, expected 8"},
+    {"unrecognized filter",
+        "buffer view 14 has unrecognized EXT_meshopt_compression filter LINEAR"},
+    {"count and stride not matching byteLength",
+        "buffer view 15 has EXT_meshopt_compression count 2 and byteStride 2 but byteLength 6"},
+    {"buffer out of range",
+        "buffer index 2 out of range for 2 buffers"},
+    {"compressed range out of range",
+        "buffer view 17 needs 9 bytes but EXT_meshopt_compression buffer 0 has only 8"},
+    {"invalid data",
+        "buffer view 18 has invalid EXT_meshopt_compression TRIANGLES data"},
+};
+
 constexpr struct {
     const char* name;
     const char* message;
@@ -1620,6 +1789,49 @@ const struct {
     {"buffer not found", "Trade::GltfImporter::image2D(): error opening /nonexistent.bin"}
 };
 
+const struct {
+    const char* name;
+    Containers::Optional<Int> cacheSize;
+    std::size_t expectedLoadCount;
+    std::size_t expectedHitCount;
+} ImageImporterCacheData[]{
+    {"default", {}, 4, 1},
+    {"zero, treated as one", 0, 4, 1},
+    {"two", 2, 2, 3},
+    {"three", 3, 2, 3},
+};
+
+constexpr struct {
+    const char* name;
+    const char* suffix;
+    UnsignedInt threads;
+    std::size_t expectedLoadCountPrefetched;
+    std::size_t expectedLoadCount;
+} ImagePrefetchData[]{
+    {"external", ".gltf", 1, 2, 3},
+    {"external, two threads", ".gltf", 2, 2, 3},
+    {"external binary, all threads", ".glb", 0, 2, 3},
+    {"buffer, two threads", "-buffer.gltf", 2, 0, 0},
+    {"embedded, two threads", "-embedded.gltf", 2, 0, 0},
+    {"embedded binary buffer, two threads", "-buffer-embedded.glb", 2, 0, 0},
+};
+
+const struct {
+    const char* name;
+    const char* option;
+    const char* value;
+    const char* message;
+} ImagePrefetchIdsInvalidData[]{
+    {"invalid 2D ID", "prefetchImage2DIds", "0 1x",
+        "invalid prefetchImage2DIds ID 1x"},
+    {"negative 2D ID", "prefetchImage2DIds", "-1",
+        "invalid prefetchImage2DIds ID -1"},
+    {"2D ID out of range", "prefetchImage2DIds", "1 2",
+        "prefetchImage2DIds ID 2 out of range for 2 2D images"},
+    {"3D ID out of range", "prefetchImage3DIds", "0",
+        "prefetchImage3DIds ID 0 out of range for 0 3D images"},
+};
+
 const struct {
     const char* name;
     const char* file;
@@ -1720,6 +1932,14 @@ const struct {
     }},
 };
 
+const struct {
+    const char* name;
+    bool lazySceneFieldDiscovery;
+} BenchmarkOpenManyNodesData[]{
+    {"", false},
+    {"lazy scene field discovery", true},
+};
+
 GltfImporterTest::GltfImporterTest() {
     addInstancedTests({&GltfImporterTest::open},
                       Containers::arraySize(SingleFileData));
@@ -1743,6 +1963,8 @@ GltfImporterTest::GltfImporterTest() {
     addInstancedTests({&GltfImporterTest::openExternalDataTooShort},
         Containers::arraySize(MultiFileData));
 
+    addTests({&GltfImporterTest::openExternalDataMapped});
+
     addInstancedTests({&GltfImporterTest::openExternalDataInvalidUri},
                       Containers::arraySize(InvalidUriData));
 
@@ -1810,7 +2032,17 @@ GltfImporterTest::GltfImporterTest() {
     addInstancedTests({&GltfImporterTest::sceneCustomFields},
         Containers::arraySize(QuietData));
 
-    addTests({&GltfImporterTest::sceneCustomFieldsInvalidConfiguration});
+    addTests({&GltfImporterTest::sceneCustomFieldsInvalidConfiguration,
+              &GltfImporterTest::sceneCustomFieldsLazyDiscovery,
+              &GltfImporterTest::sceneCustomFieldsLazyDiscoveryInvalid});
+
+    addInstancedTests({&GltfImporterTest::sceneMeshGpuInstancing},
+        Containers::arraySize(QuietData));
+
+    addInstancedTests({&GltfImporterTest::sceneMeshGpuInstancingInvalid},
+        Containers::arraySize(SceneMeshGpuInstancingInvalidData));
+
+    addTests({&GltfImporterTest::sceneMeshGpuInstancingExtrasCollision});
 
     addInstancedTests({&GltfImporterTest::skin},
         Containers::arraySize(MultiFileData));
@@ -1869,6 +2101,19 @@ GltfImporterTest::GltfImporterTest() {
     addInstancedTests({&GltfImporterTest::meshSparseAccessors},
         Containers::arraySize(MeshSparseAccessorsData));
 
+    addTests({&GltfImporterTest::meshMeshoptCompression,
+              &GltfImporterTest::meshDracoCompression,
+              &GltfImporterTest::meshDracoCompressionFallback,
+              &GltfImporterTest::meshBatch,
+              &GltfImporterTest::meshBatchOption,
+              &GltfImporterTest::meshBatchSparse});
+
+    addInstancedTests({&GltfImporterTest::meshBatchInvalid},
+        Containers::arraySize(MeshBatchInvalidData));
+
+    addInstancedTests({&GltfImporterTest::meshBatchOptionInvalid},
+        Containers::arraySize(MeshBatchOptionInvalidData));
+
     addInstancedTests({&GltfImporterTest::meshInvalidWholeFile},
         Containers::arraySize(MeshInvalidWholeFileData));
 
@@ -1881,6 +2126,12 @@ GltfImporterTest::GltfImporterTest() {
     addInstancedTests({&GltfImporterTest::meshInvalidSparseIndices},
         Containers::arraySize(MeshInvalidSparseIndicesData));
 
+    addInstancedTests({&GltfImporterTest::meshInvalidMeshoptCompression},
+        Containers::arraySize(MeshInvalidMeshoptCompressionData));
+
+    addInstancedTests({&GltfImporterTest::meshInvalidDracoCompression},
+        Containers::arraySize(MeshInvalidDracoCompressionData));
+
     addTests({&GltfImporterTest::materialPbrMetallicRoughness,
               &GltfImporterTest::materialPbrSpecularGlossiness,
               &GltfImporterTest::materialCommon,
@@ -1939,6 +2190,22 @@ GltfImporterTest::GltfImporterTest() {
 
     addTests({&GltfImporterTest::imagePropagateImporterFlags});
 
+    addInstancedTests({&GltfImporterTest::imageImporterCache},
+        Containers::arraySize(ImageImporterCacheData));
+
+    addInstancedTests({&GltfImporterTest::imagePrefetch},
+        Containers::arraySize(ImagePrefetchData));
+
+    addInstancedTests({&GltfImporterTest::imagePrefetchInvalid},
+        Containers::arraySize(ImageInvalidNotFoundData));
+
+    addTests({&GltfImporterTest::imagePrefetchInvalidThreadCount,
+              &GltfImporterTest::imagePrefetchIds2D,
+              &GltfImporterTest::imagePrefetchIds3D});
+
+    addInstancedTests({&GltfImporterTest::imagePrefetchIdsInvalid},
+        Containers::arraySize(ImagePrefetchIdsInvalidData));
+
     addTests({&GltfImporterTest::experimentalKhrTextureKtx2D,
               &GltfImporterTest::experimentalKhrTextureKtx2DArray,
               &GltfImporterTest::experimentalKhrTextureKtxPhongFallback});
@@ -1979,6 +2246,9 @@ GltfImporterTest::GltfImporterTest() {
     addTests({&GltfImporterTest::openTwice,
               &GltfImporterTest::importTwice});
 
+    addInstancedBenchmarks({&GltfImporterTest::benchmarkOpenManyNodes}, 1,
+        Containers::arraySize(BenchmarkOpenManyNodesData));
+
     /* Load the plugin directly from the build tree. Otherwise it's static and
        already loaded. It also pulls in the AnyImageImporter dependency. */
     #ifdef GLTFIMPORTER_PLUGIN_FILENAME
@@ -2002,6 +2272,9 @@ GltfImporterTest::GltfImporterTest() {
     #ifdef STBIMAGEIMPORTER_PLUGIN_FILENAME
     CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(STBIMAGEIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
     #endif
+    #ifdef DRACOIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(DRACOIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
 }
 
 void GltfImporterTest::open() {
@@ -2223,6 +2496,37 @@ void GltfImporterTest::openExternalDataTooShort() {
     CORRADE_COMPARE(out, "Trade::GltfImporter::mesh(): buffer 0 is too short, expected 24 bytes but got 12\n");
 }
 
+void GltfImporterTest::openExternalDataMapped() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
+    importer->configuration().setValue("mapExternalBuffers", true);
+
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(GLTFIMPORTER_TEST_DIR, "mesh.gltf")));
+
+    /* The data are the same as in mesh(), just coming from a mapped file */
+    Containers::Optional<Trade::MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_VERIFY(mesh->isIndexed());
+    CORRADE_COMPARE(mesh->indexType(), MeshIndexType::UnsignedByte);
+    CORRADE_COMPARE_AS(mesh->indices<UnsignedByte>(),
+        Containers::arrayView<UnsignedByte>({0, 1, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(mesh->attributeCount(), 5);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {1.5f, -1.0f, -0.5f},
+            {-0.5f, 2.5f, 0.75f},
+            {-2.0f, 1.0f, 0.3f}
+        }), TestSuite::Compare::Container);
+
+    /* Size checks are done on the mapped data as well */
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(GLTFIMPORTER_TEST_DIR, "buffer-invalid-short-size.gltf")));
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->mesh(0));
+    CORRADE_COMPARE(out, "Trade::GltfImporter::mesh(): buffer 0 is too short, expected 24 bytes but got 12\n");
+}
+
 void GltfImporterTest::openExternalDataInvalidUri() {
     auto&& data = InvalidUriData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
@@ -4081,6 +4385,198 @@ void GltfImporterTest::sceneCustomFieldsInvalidConfiguration() {
     CORRADE_COMPARE(out, "Trade::GltfImporter::openData(): invalid type Vector2ui specified for custom scene field offset\n");
 }
 
+void GltfImporterTest::sceneCustomFieldsLazyDiscovery() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
+    importer->setFlags(ImporterFlag::Quiet);
+    importer->configuration().setValue("lazySceneFieldDiscovery", true);
+
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(GLTFIMPORTER_TEST_DIR, "scene-custom-fields.gltf")));
+
+    /* As the discovery didn't happen yet, the type override is still taken
+       into account even if set after opening the file */
+    importer->configuration().group("customSceneFieldTypes")->addValue("offset", "Int");
+
+    /* Importing a scene triggers the discovery. The field IDs are the same as
+       in the non-lazy case tested in sceneCustomFields() above. */
+    Containers::Optional<SceneData> scene = importer->scene(0);
+    CORRADE_VERIFY(scene);
+
+    SceneField sceneFieldRadius = importer->sceneFieldForName("radius");
+    SceneField sceneFieldOffset = importer->sceneFieldForName("offset");
+    CORRADE_COMPARE(sceneFieldRadius, sceneFieldCustom(1));
+    CORRADE_COMPARE(sceneFieldOffset, sceneFieldCustom(2));
+    CORRADE_COMPARE(importer->sceneFieldName(sceneFieldRadius), "radius");
+    CORRADE_COMPARE(importer->sceneFieldName(sceneFieldOffset), "offset");
+
+    CORRADE_VERIFY(scene->hasField(sceneFieldRadius));
+    CORRADE_COMPARE(scene->fieldType(sceneFieldRadius), SceneFieldType::Float);
+    CORRADE_COMPARE_AS(scene->mapping<UnsignedInt>(sceneFieldRadius),
+        Containers::arrayView({5u, 5u, 12u}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene->field<Float>(sceneFieldRadius), Containers::arrayView({
+        5.25f, 3.5f, 0.5f
+    }), TestSuite::Compare::Container);
+
+    CORRADE_VERIFY(scene->hasField(sceneFieldOffset));
+    CORRADE_COMPARE(scene->fieldType(sceneFieldOffset), SceneFieldType::Int);
+}
+
+void GltfImporterTest::sceneCustomFieldsLazyDiscoveryInvalid() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
+    importer->configuration().setValue("lazySceneFieldDiscovery", true);
+
+    /* Opening succeeds as the extras aren't looked at yet */
+    Containers::String filename = Utility::Path::join(GLTFIMPORTER_TEST_DIR, "scene-invalid-extras-property.gltf");
+    CORRADE_VERIFY(importer->openFile(filename));
+
+    /* The failure is reported each time the fields are needed, not just the
+       first time */
+    Containers::String out;
+    {
+        Error redirectError{&out};
+        CORRADE_COMPARE(importer->sceneFieldForName("radius"), SceneField{});
+        CORRADE_COMPARE(importer->sceneFieldName(sceneFieldCustom(0)), "");
+    }
+    CORRADE_COMPARE_AS(out, Utility::format(
+        "Utility::Json::parseObject(): invalid unicode escape sequence \\uhh at {0}:9:10\n"
+        "Trade::GltfImporter::sceneFieldForName(): invalid node 1 extras property\n"
+        "Utility::Json::parseObject(): invalid unicode escape sequence \\uhh at {0}:9:10\n"
+        "Trade::GltfImporter::sceneFieldName(): invalid node 1 extras property\n", filename),
+        TestSuite::Compare::String);
+}
+
+void GltfImporterTest::sceneMeshGpuInstancing() {
+    auto&& data = QuietData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
+    importer->setFlags(data.flags);
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(GLTFIMPORTER_TEST_DIR, "scene-mesh-gpu-instancing.gltf")));
+    CORRADE_COMPARE(importer->sceneCount(), 1);
+
+    /* The instancing fields are registered after fields from extras */
+    CORRADE_COMPARE(importer->sceneFieldForName("radius"), sceneFieldCustom(0));
+    SceneField sceneFieldInstanceTranslation = importer->sceneFieldForName("instanceTranslation");
+    SceneField sceneFieldInstanceRotation = importer->sceneFieldForName("instanceRotation");
+    SceneField sceneFieldInstanceScaling = importer->sceneFieldForName("instanceScaling");
+    CORRADE_COMPARE(sceneFieldInstanceTranslation, sceneFieldCustom(1));
+    CORRADE_COMPARE(sceneFieldInstanceRotation, sceneFieldCustom(2));
+    CORRADE_COMPARE(sceneFieldInstanceScaling, sceneFieldCustom(3));
+    CORRADE_COMPARE(importer->sceneFieldName(sceneFieldCustom(2)), "instanceRotation");
+
+    Containers::Optional<SceneData> scene;
+    Containers::String out;
+    {
+        Warning redirectWarning{&out};
+        scene = importer->scene(0);
+    }
+    CORRADE_VERIFY(scene);
+    if(data.quiet)
+        CORRADE_COMPARE(out, "");
+    else
+        CORRADE_COMPARE(out, "Trade::GltfImporter::scene(): unsupported EXT_mesh_gpu_instancing attribute _ID in node 1, skipping\n");
+
+    /* No new objects are created for the instances */
+    CORRADE_COMPARE(scene->mappingBound(), 3);
+    CORRADE_COMPARE(scene->fieldSize(SceneField::Parent), 3);
+
+    CORRADE_VERIFY(scene->hasField(sceneFieldInstanceTranslation));
+    CORRADE_COMPARE(scene->fieldType(sceneFieldInstanceTranslation), SceneFieldType::Vector3);
+    CORRADE_COMPARE(scene->fieldFlags(sceneFieldInstanceTranslation), SceneFieldFlag::MultiEntry);
+    CORRADE_COMPARE_AS(scene->mapping<UnsignedInt>(sceneFieldInstanceTranslation),
+        Containers::arrayView({0u, 0u, 0u, 1u, 1u}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene->field<Vector3>(sceneFieldInstanceTranslation), Containers::arrayView<Vector3>({
+        {1.0f, 2.0f, 3.0f},
+        {4.0f, 5.0f, 6.0f},
+        {7.0f, 8.0f, 9.0f},
+        {1.0f, 0.0f, -1.0f}, /* Unpacked from bytes */
+        {0.0f, 1.0f, 0.0f},
+    }), TestSuite::Compare::Container);
+
+    /* Node 1 has no rotations, so it gets identities */
+    CORRADE_VERIFY(scene->hasField(sceneFieldInstanceRotation));
+    CORRADE_COMPARE(scene->fieldType(sceneFieldInstanceRotation), SceneFieldType::Quaternion);
+    CORRADE_COMPARE(scene->fieldFlags(sceneFieldInstanceRotation), SceneFieldFlag::MultiEntry);
+    CORRADE_COMPARE_AS(scene->mapping<UnsignedInt>(sceneFieldInstanceRotation),
+        Containers::arrayView({0u, 0u, 0u, 1u, 1u}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene->field<Quaternion>(sceneFieldInstanceRotation), Containers::arrayView<Quaternion>({
+        {}, /* Unpacked from shorts */
+        {{1.0f, 0.0f, 0.0f}, 0.0f},
+        {{0.0f, -1.0f, 0.0f}, 0.0f},
+        {},
+        {}
+    }), TestSuite::Compare::Container);
+
+    /* Node 0 has no scaling, so it gets ones */
+    CORRADE_VERIFY(scene->hasField(sceneFieldInstanceScaling));
+    CORRADE_COMPARE(scene->fieldType(sceneFieldInstanceScaling), SceneFieldType::Vector3);
+    CORRADE_COMPARE(scene->fieldFlags(sceneFieldInstanceScaling), SceneFieldFlag::MultiEntry);
+    CORRADE_COMPARE_AS(scene->field<Vector3>(sceneFieldInstanceScaling), Containers::arrayView<Vector3>({
+        Vector3{1.0f},
+        Vector3{1.0f},
+        Vector3{1.0f},
+        {2.0f, 2.0f, 2.0f},
+        {0.5f, 1.0f, 1.5f},
+    }), TestSuite::Compare::Container);
+
+    /* The node without instancing has just the extras field */
+    CORRADE_VERIFY(scene->hasField(sceneFieldCustom(0)));
+    CORRADE_COMPARE_AS(scene->mapping<UnsignedInt>(sceneFieldCustom(0)),
+        Containers::arrayView({2u}),
+        TestSuite::Compare::Container);
+}
+
+void GltfImporterTest::sceneMeshGpuInstancingInvalid() {
+    auto&& data = SceneMeshGpuInstancingInvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::String filename = Utility::Path::join(GLTFIMPORTER_TEST_DIR, "scene-mesh-gpu-instancing-invalid.gltf");
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
+    CORRADE_VERIFY(importer->openFile(filename));
+
+    /* Check we didn't forget to test anything */
+    CORRADE_COMPARE(Containers::arraySize(SceneMeshGpuInstancingInvalidData), importer->sceneCount());
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->scene(data.name));
+    /* If the message ends with a newline, it's the whole output including a
+       potential placeholder for the filename, otherwise just the sentence
+       without any placeholder */
+    if(Containers::StringView{data.message}.hasSuffix('\n'))
+        CORRADE_COMPARE_AS(out,
+            Utility::format(data.message, filename),
+            TestSuite::Compare::String);
+    else
+        CORRADE_COMPARE_AS(out,
+            Utility::format("Trade::GltfImporter::scene(): {}\n", data.message),
+            TestSuite::Compare::String);
+}
+
+void GltfImporterTest::sceneMeshGpuInstancingExtrasCollision() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
+
+    Containers::String out;
+    {
+        Warning redirectWarning{&out};
+        CORRADE_VERIFY(importer->openFile(Utility::Path::join(GLTFIMPORTER_TEST_DIR, "scene-mesh-gpu-instancing-extras-collision.gltf")));
+    }
+    CORRADE_COMPARE(out, "Trade::GltfImporter::openData(): node extras property instanceRotation conflicts with EXT_mesh_gpu_instancing, instances won't be imported\n");
+
+    /* The extras field keeps the name, no other fields are registered */
+    CORRADE_COMPARE(importer->sceneFieldForName("instanceRotation"), sceneFieldCustom(0));
+    CORRADE_COMPARE(importer->sceneFieldForName("instanceTranslation"), SceneField{});
+
+    /* The scene imports, just without the instances */
+    Containers::Optional<SceneData> scene = importer->scene(0);
+    CORRADE_VERIFY(scene);
+    CORRADE_COMPARE(scene->fieldCount(), 4);
+    CORRADE_VERIFY(scene->hasField(sceneFieldCustom(0)));
+}
+
 void GltfImporterTest::skin() {
     auto&& data = MultiFileData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
@@ -6038,57 +6534,455 @@ void GltfImporterTest::meshSparseAccessors() {
     }
 }
 
-void GltfImporterTest::meshInvalidWholeFile() {
-    auto&& data = MeshInvalidWholeFileData[testCaseInstanceId()];
-    setTestCaseDescription(data.name);
-
-    Containers::String filename = Utility::Path::join(GLTFIMPORTER_TEST_DIR, data.file);
-
+void GltfImporterTest::meshMeshoptCompression() {
+    /* Disable Y-flipping to have the texture coordinates match the decoded
+       data directly */
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
+    importer->configuration().setValue("textureCoordinateYFlipInMaterial", true);
 
-    Containers::String out;
-    Error redirectError{&out};
-    CORRADE_VERIFY(!importer->openFile(filename));
-    /* If the message ends with a newline, it's the whole output including a
-       potential placeholder for the filename, otherwise just the sentence
-       without any placeholder */
-    if(Containers::StringView{data.message}.hasSuffix('\n'))
-        CORRADE_COMPARE_AS(out,
-            Utility::format(data.message, filename),
-            TestSuite::Compare::String);
-    else
-        CORRADE_COMPARE_AS(out,
-            Utility::format("Trade::GltfImporter::openData(): {}\n", data.message),
-            TestSuite::Compare::String);
-}
+    /* The fallback buffer has no URI, so if it would be accessed instead of
+       the compressed data, it'd fail */
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(GLTFIMPORTER_TEST_DIR, "mesh-meshopt.gltf")));
+    CORRADE_COMPARE(importer->meshCount(), 2);
 
-void GltfImporterTest::meshInvalid() {
-    auto&& data = MeshInvalidData[testCaseInstanceId()];
-    setTestCaseDescription(data.name);
+    {
+        Containers::Optional<Trade::MeshData> mesh = importer->mesh("Triangles");
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Triangles);
 
-    Containers::String filename = Utility::Path::join(GLTFIMPORTER_TEST_DIR, "mesh-invalid.gltf");
+        /* TRIANGLES mode */
+        CORRADE_VERIFY(mesh->isIndexed());
+        CORRADE_COMPARE(mesh->indexType(), MeshIndexType::UnsignedShort);
+        CORRADE_COMPARE_AS(mesh->indices<UnsignedShort>(),
+            Containers::arrayView<UnsignedShort>({0, 1, 2, 2, 1, 3}),
+            TestSuite::Compare::Container);
 
-    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
-    CORRADE_VERIFY(importer->openFile(filename));
+        /* Each attribute is in a different decoded buffer view, which should
+           be handled correctly when merging the vertex data ranges */
+        CORRADE_COMPARE(mesh->attributeCount(), 3);
 
-    /* Check we didn't forget to test anything */
-    CORRADE_COMPARE(Containers::arraySize(MeshInvalidData), importer->meshCount());
+        /* ATTRIBUTES mode without a filter */
+        CORRADE_COMPARE(mesh->attributeFormat(MeshAttribute::Position), VertexFormat::Vector3);
+        CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position),
+            Containers::arrayView<Vector3>({
+                {1.0f, 2.0f, 3.0f},
+                {-1.0f, 0.5f, 2.0f},
+                {0.0f, 0.0f, -1.0f},
+                {4.5f, -2.0f, 0.25f}
+            }), TestSuite::Compare::Container);
 
-    Containers::String out;
-    Error redirectError{&out};
-    CORRADE_VERIFY(!importer->mesh(data.name));
-    /* If the message ends with a newline, it's the whole output including a
-       potential placeholder for the filename, otherwise just the sentence
-       without any placeholder */
-    if(Containers::StringView{data.message}.hasSuffix('\n'))
-        CORRADE_COMPARE_AS(out,
-            Utility::format(data.message, filename),
-            TestSuite::Compare::String);
-    else
-        CORRADE_COMPARE_AS(out,
-            Utility::format("Trade::GltfImporter::mesh(): {}\n", data.message),
-            TestSuite::Compare::String);
-}
+        /* ATTRIBUTES mode with the OCTAHEDRAL filter */
+        CORRADE_COMPARE(mesh->attributeFormat(MeshAttribute::Normal), VertexFormat::Vector3bNormalized);
+        CORRADE_COMPARE(mesh->attributeStride(MeshAttribute::Normal), 4);
+        CORRADE_COMPARE_AS(mesh->attribute<Vector3b>(MeshAttribute::Normal),
+            Containers::arrayView<Vector3b>({
+                {0, 0, 127},
+                {127, 0, 0},
+                {-73, 73, 74},
+                {0, 0, -127}
+            }), TestSuite::Compare::Container);
+
+        /* ATTRIBUTES mode with the EXPONENTIAL filter */
+        CORRADE_COMPARE(mesh->attributeFormat(MeshAttribute::TextureCoordinates), VertexFormat::Vector2);
+        CORRADE_COMPARE_AS(mesh->attribute<Vector2>(MeshAttribute::TextureCoordinates),
+            Containers::arrayView<Vector2>({
+                {1.0f, 0.5f},
+                {0.75f, 0.0f},
+                {0.25f, 0.625f},
+                {2.0f, -0.5f}
+            }), TestSuite::Compare::Container);
+    } {
+        /* Shares the position buffer view with the above, which is decoded
+           just once */
+        Containers::Optional<Trade::MeshData> mesh = importer->mesh("Lines");
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Lines);
+
+        /* INDICES mode */
+        CORRADE_VERIFY(mesh->isIndexed());
+        CORRADE_COMPARE(mesh->indexType(), MeshIndexType::UnsignedInt);
+        CORRADE_COMPARE_AS(mesh->indices<UnsignedInt>(),
+            Containers::arrayView<UnsignedInt>({3, 0, 1, 2}),
+            TestSuite::Compare::Container);
+
+        CORRADE_COMPARE(mesh->attributeCount(), 1);
+        CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position),
+            Containers::arrayView<Vector3>({
+                {1.0f, 2.0f, 3.0f},
+                {-1.0f, 0.5f, 2.0f},
+                {0.0f, 0.0f, -1.0f},
+                {4.5f, -2.0f, 0.25f}
+            }), TestSuite::Compare::Container);
+    }
+}
+
+void GltfImporterTest::meshDracoCompression() {
+    #ifndef MAGNUM_WITH_DRACOIMPORTER
+    CORRADE_SKIP("DracoImporter not enabled, can't generate test data");
+    #else
+    if(_manager.loadState("DracoImporter") == PluginManager::LoadState::NotFound)
+        CORRADE_SKIP("DracoImporter plugin not found, cannot test");
+
+    const Vector3 positions[]{
+        {1.0f, 2.0f, 3.0f},
+        {-1.0f, 0.5f, 2.0f},
+        {0.0f, 0.0f, -1.0f},
+        {4.5f, -2.0f, 0.25f}
+    };
+    const Vector2us generic[]{
+        {15, 3},
+        {22, 7},
+        {65535, 0},
+        {1, 1024}
+    };
+
+    /* Draco attribute unique IDs are the same as the attribute IDs, i.e. 0
+       for the position and 1 for the generic attribute. The sequential
+       encoding without quantization preserves the vertex order and the exact
+       values. */
+    draco::Mesh dracoMesh;
+    dracoMesh.set_num_points(Containers::arraySize(positions));
+    draco::GeometryAttribute dracoPosition;
+    dracoPosition.Init(draco::GeometryAttribute::POSITION, nullptr, 3, draco::DT_FLOAT32, false, sizeof(Vector3), 0);
+    const Int positionId = dracoMesh.AddAttribute(dracoPosition, true, Containers::arraySize(positions));
+    draco::GeometryAttribute dracoGeneric;
+    dracoGeneric.Init(draco::GeometryAttribute::GENERIC, nullptr, 2, draco::DT_UINT16, false, sizeof(Vector2us), 0);
+    const Int genericId = dracoMesh.AddAttribute(dracoGeneric, true, Containers::arraySize(generic));
+    for(UnsignedInt i = 0; i != Containers::arraySize(positions); ++i) {
+        dracoMesh.attribute(positionId)->SetAttributeValue(draco::AttributeValueIndex{i}, &positions[i]);
+        dracoMesh.attribute(genericId)->SetAttributeValue(draco::AttributeValueIndex{i}, &generic[i]);
+    }
+    dracoMesh.AddFace({draco::PointIndex{0}, draco::PointIndex{1}, draco::PointIndex{2}});
+    dracoMesh.AddFace({draco::PointIndex{2}, draco::PointIndex{1}, draco::PointIndex{3}});
+
+    draco::Encoder encoder;
+    encoder.SetEncodingMethod(draco::MESH_SEQUENTIAL_ENCODING);
+    draco::EncoderBuffer encoded;
+    CORRADE_VERIFY(encoder.EncodeMeshToBuffer(dracoMesh, &encoded).ok());
+
+    /* The glTF file has a fixed buffer size, pad the encoded data to it. The
+       decoder ignores the trailing zeros. */
+    CORRADE_COMPARE_AS(encoded.size(), std::size_t{256},
+        TestSuite::Compare::LessOrEqual);
+    Containers::Array<char> buffer{ValueInit, 256};
+    Utility::copy(Containers::arrayView(encoded.data(), encoded.size()), buffer.prefix(encoded.size()));
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
+    importer->setFileCallback([](const std::string&, InputFileCallbackPolicy, Containers::Array<char>& buffer)
+            -> Containers::Optional<Containers::ArrayView<const char>>
+        {
+            return Containers::ArrayView<const char>{buffer};
+        }, buffer);
+
+    /* All accessors are without a buffer view, so everything is taken from
+       the compressed data */
+    CORRADE_VERIFY(importer->openData(R"({
+        "asset": {"version": "2.0"},
+        "extensionsUsed": ["KHR_draco_mesh_compression"],
+        "extensionsRequired": ["KHR_draco_mesh_compression"],
+        "accessors": [
+            {"componentType": 5126, "count": 4, "type": "VEC3"},
+            {"componentType": 5123, "count": 4, "type": "VEC2"},
+            {"componentType": 5123, "count": 6, "type": "SCALAR"}
+        ],
+        "buffers": [
+            {"byteLength": 256, "uri": "draco.bin"}
+        ],
+        "bufferViews": [
+            {"buffer": 0, "byteLength": 256}
+        ],
+        "meshes": [{
+            "primitives": [{
+                "attributes": {"POSITION": 0, "_GENERIC": 1},
+                "indices": 2,
+                "extensions": {
+                    "KHR_draco_mesh_compression": {
+                        "bufferView": 0,
+                        "attributes": {"POSITION": 0, "_GENERIC": 1}
+                    }
+                }
+            }]
+        }]
+    })"_s));
+
+    const MeshAttribute customGeneric = importer->meshAttributeForName("_GENERIC");
+    CORRADE_VERIFY(isMeshAttributeCustom(customGeneric));
+
+    Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Triangles);
+    CORRADE_VERIFY(mesh->isIndexed());
+    CORRADE_COMPARE(mesh->indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE_AS(mesh->indices<UnsignedShort>(), Containers::arrayView<UnsignedShort>({
+        0, 1, 2, 2, 1, 3
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(mesh->vertexCount(), 4);
+    CORRADE_COMPARE(mesh->attributeCount(), 2);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position),
+        Containers::arrayView(positions),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector2us>(customGeneric),
+        Containers::arrayView(generic),
+        TestSuite::Compare::Container);
+    #endif
+}
+
+void GltfImporterTest::meshDracoCompressionFallback() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
+
+    /* All accessors referenced by the extension have an uncompressed fallback,
+       so the compressed data are never decoded and DracoImporter isn't
+       needed. The buffer with the compressed data has no URI, so if it would
+       be accessed, it'd fail. */
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(GLTFIMPORTER_TEST_DIR, "mesh-draco-fallback.gltf")));
+    CORRADE_COMPARE(importer->meshCount(), 1);
+
+    Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Triangles);
+    CORRADE_VERIFY(mesh->isIndexed());
+    CORRADE_COMPARE(mesh->indexType(), MeshIndexType::UnsignedByte);
+    CORRADE_COMPARE_AS(mesh->indices<UnsignedByte>(), Containers::arrayView<UnsignedByte>({
+        2, 1, 0
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(mesh->attributeCount(), 1);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position), Containers::arrayView<Vector3>({
+        {1.0f, 2.0f, 3.0f},
+        {4.0f, 5.0f, 6.0f},
+        {7.0f, 8.0f, 9.0f}
+    }), TestSuite::Compare::Container);
+}
+
+void GltfImporterTest::meshBatch() {
+    #ifdef GLTFIMPORTER_PLUGIN_FILENAME
+    CORRADE_SKIP("GltfImporter::meshBatch() can be called only if the plugin is built as static");
+    #else
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(GLTFIMPORTER_TEST_DIR, "mesh-batch.gltf")));
+    CORRADE_COMPARE(importer->meshCount(), 6);
+
+    GltfImporter::MeshBatchRange ranges[3];
+    Containers::Optional<MeshData> mesh = static_cast<GltfImporter&>(*importer).meshBatch({0, 1, 2}, ranges);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Triangles);
+    CORRADE_VERIFY(!mesh->importerState());
+
+    /* Indices of each mesh are offset to the concatenated vertices, the
+       non-indexed mesh gets trivial indices */
+    CORRADE_VERIFY(mesh->isIndexed());
+    CORRADE_COMPARE(mesh->indexType(), MeshIndexType::UnsignedInt);
+    CORRADE_COMPARE_AS(mesh->indices<UnsignedInt>(), Containers::arrayView<UnsignedInt>({
+        0, 1, 2,
+        3, 4, 5, 5, 6, 3,
+        7, 8, 9
+    }), TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(ranges[0].indexOffset, 0);
+    CORRADE_COMPARE(ranges[0].indexCount, 3);
+    CORRADE_COMPARE(ranges[0].vertexOffset, 0);
+    CORRADE_COMPARE(ranges[0].vertexCount, 3);
+    CORRADE_COMPARE(ranges[1].indexOffset, 3);
+    CORRADE_COMPARE(ranges[1].indexCount, 6);
+    CORRADE_COMPARE(ranges[1].vertexOffset, 3);
+    CORRADE_COMPARE(ranges[1].vertexCount, 4);
+    CORRADE_COMPARE(ranges[2].indexOffset, 9);
+    CORRADE_COMPARE(ranges[2].indexCount, 3);
+    CORRADE_COMPARE(ranges[2].vertexOffset, 7);
+    CORRADE_COMPARE(ranges[2].vertexCount, 3);
+
+    /* The attributes are interleaved */
+    CORRADE_COMPARE(mesh->vertexCount(), 10);
+    CORRADE_COMPARE(mesh->attributeCount(), 2);
+    CORRADE_COMPARE(mesh->attributeStride(MeshAttribute::Position), 24);
+    CORRADE_COMPARE(mesh->attributeStride(MeshAttribute::Normal), 24);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position), Containers::arrayView<Vector3>({
+        {0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f},
+        {2.0f, 0.0f, 0.0f}, {3.0f, 0.0f, 0.0f}, {3.0f, 1.0f, 0.0f}, {2.0f, 1.0f, 0.0f},
+        {4.0f, 0.0f, 0.0f}, {5.0f, 0.0f, 0.0f}, {4.0f, 1.0f, 0.0f}
+    }), TestSuite::Compare::Container);
+    for(const Vector3& normal: mesh->attribute<Vector3>(MeshAttribute::Normal))
+        CORRADE_COMPARE(normal, Vector3::zAxis());
+    #endif
+}
+
+void GltfImporterTest::meshBatchOption() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
+    /* Arbitrary whitespace should be allowed */
+    importer->configuration().setValue("meshBatch", " 0  1\t2 ");
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(GLTFIMPORTER_TEST_DIR, "mesh-batch.gltf")));
+
+    /* The batch is added as an extra unnamed mesh at the end, the original
+       meshes are still available */
+    CORRADE_COMPARE(importer->meshCount(), 7);
+    CORRADE_COMPARE(importer->meshName(6), "");
+    CORRADE_VERIFY(importer->mesh(0));
+
+    Containers::Optional<MeshData> mesh = importer->mesh(6);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Triangles);
+    CORRADE_VERIFY(mesh->isIndexed());
+    CORRADE_COMPARE(mesh->indexType(), MeshIndexType::UnsignedInt);
+    CORRADE_COMPARE_AS(mesh->indices<UnsignedInt>(), Containers::arrayView<UnsignedInt>({
+        0, 1, 2,
+        3, 4, 5, 5, 6, 3,
+        7, 8, 9
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(mesh->vertexCount(), 10);
+    CORRADE_COMPARE(mesh->attributeCount(), 2);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position), Containers::arrayView<Vector3>({
+        {0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f},
+        {2.0f, 0.0f, 0.0f}, {3.0f, 0.0f, 0.0f}, {3.0f, 1.0f, 0.0f}, {2.0f, 1.0f, 0.0f},
+        {4.0f, 0.0f, 0.0f}, {5.0f, 0.0f, 0.0f}, {4.0f, 1.0f, 0.0f}
+    }), TestSuite::Compare::Container);
+
+    /* The importer state points to the ranges, one for each listed ID. The
+       GltfImporter::MeshBatchRange type isn't available without linking to
+       the plugin, so it's checked as four integers per mesh. */
+    CORRADE_VERIFY(mesh->importerState());
+    CORRADE_COMPARE_AS(Containers::arrayView(static_cast<const UnsignedInt*>(mesh->importerState()), 3*4), Containers::arrayView<UnsignedInt>({
+        0, 3, 0, 3,
+        3, 6, 3, 4,
+        9, 3, 7, 3
+    }), TestSuite::Compare::Container);
+}
+
+void GltfImporterTest::meshBatchSparse() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
+    importer->configuration().setValue("meshBatch", "0 1");
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(GLTFIMPORTER_TEST_DIR, "mesh-batch-sparse.gltf")));
+    CORRADE_COMPARE(importer->meshCount(), 3);
+
+    /* The accessors are decoded directly into the batch, so sparse accessors
+       and accessors without buffer views have to be handled there as well,
+       and texture coordinates Y-flipped the same way as with mesh() */
+    Containers::Optional<MeshData> mesh = importer->mesh(2);
+    CORRADE_VERIFY(mesh);
+    CORRADE_VERIFY(mesh->isIndexed());
+    CORRADE_COMPARE(mesh->indexType(), MeshIndexType::UnsignedInt);
+    CORRADE_COMPARE_AS(mesh->indices<UnsignedInt>(), Containers::arrayView<UnsignedInt>({
+        0, 1, 2,
+        3, 4, 5, 3, 6, 3
+    }), TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(mesh->vertexCount(), 7);
+    CORRADE_COMPARE(mesh->attributeCount(), 2);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position), Containers::arrayView<Vector3>({
+        {0.0f, 0.0f, 0.0f}, {5.0f, 5.0f, 5.0f}, {0.0f, 1.0f, 0.0f},
+        {7.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 7.0f, 0.0f}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector2>(MeshAttribute::TextureCoordinates), Containers::arrayView<Vector2>({
+        {0.0f, 1.0f}, {1.0f, 1.0f}, {0.0f, 0.0f},
+        {0.0f, 1.0f}, {1.0f, 1.0f}, {1.0f, 0.0f}, {0.0f, 0.0f}
+    }), TestSuite::Compare::Container);
+
+    /* Should be the same as importing the meshes one by one */
+    for(UnsignedInt i = 0; i != 2; ++i) {
+        CORRADE_ITERATION(i);
+        Containers::Optional<MeshData> single = importer->mesh(i);
+        CORRADE_VERIFY(single);
+        const UnsignedInt vertexOffset = i == 0 ? 0 : 3;
+        CORRADE_COMPARE_AS(single->attribute<Vector3>(MeshAttribute::Position),
+            mesh->attribute<Vector3>(MeshAttribute::Position).sliceSize(vertexOffset, single->vertexCount()),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(single->attribute<Vector2>(MeshAttribute::TextureCoordinates),
+            mesh->attribute<Vector2>(MeshAttribute::TextureCoordinates).sliceSize(vertexOffset, single->vertexCount()),
+            TestSuite::Compare::Container);
+    }
+}
+
+void GltfImporterTest::meshBatchInvalid() {
+    auto&& data = MeshBatchInvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
+    importer->configuration().setValue("meshBatch", data.option);
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(GLTFIMPORTER_TEST_DIR, "mesh-batch.gltf")));
+    CORRADE_COMPARE(importer->meshCount(), 7);
+
+    /* Through the generic interface */
+    {
+        Containers::String out;
+        Error redirectError{&out};
+        CORRADE_VERIFY(!importer->mesh(6));
+        CORRADE_COMPARE(out, Utility::format("Trade::GltfImporter::mesh(): {}\n", data.message));
+    }
+
+    /* Through the plugin-specific API */
+    #ifdef GLTFIMPORTER_PLUGIN_FILENAME
+    CORRADE_SKIP("GltfImporter::meshBatch() can be called only if the plugin is built as static");
+    #else
+    GltfImporter::MeshBatchRange ranges[2];
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!static_cast<GltfImporter&>(*importer).meshBatch(Containers::arrayView(data.ids).prefix(data.idCount), Containers::arrayView(ranges).prefix(data.idCount)));
+    CORRADE_COMPARE(out, Utility::format("Trade::GltfImporter::meshBatch(): {}\n", data.message));
+    #endif
+}
+
+void GltfImporterTest::meshBatchOptionInvalid() {
+    auto&& data = MeshBatchOptionInvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
+    importer->configuration().setValue("meshBatch", data.option);
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openFile(Utility::Path::join(GLTFIMPORTER_TEST_DIR, "mesh-batch.gltf")));
+    CORRADE_COMPARE(out, Utility::format("Trade::GltfImporter::openData(): {}\n", data.message));
+}
+
+void GltfImporterTest::meshInvalidWholeFile() {
+    auto&& data = MeshInvalidWholeFileData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::String filename = Utility::Path::join(GLTFIMPORTER_TEST_DIR, data.file);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openFile(filename));
+    /* If the message ends with a newline, it's the whole output including a
+       potential placeholder for the filename, otherwise just the sentence
+       without any placeholder */
+    if(Containers::StringView{data.message}.hasSuffix('\n'))
+        CORRADE_COMPARE_AS(out,
+            Utility::format(data.message, filename),
+            TestSuite::Compare::String);
+    else
+        CORRADE_COMPARE_AS(out,
+            Utility::format("Trade::GltfImporter::openData(): {}\n", data.message),
+            TestSuite::Compare::String);
+}
+
+void GltfImporterTest::meshInvalid() {
+    auto&& data = MeshInvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::String filename = Utility::Path::join(GLTFIMPORTER_TEST_DIR, "mesh-invalid.gltf");
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
+    CORRADE_VERIFY(importer->openFile(filename));
+
+    /* Check we didn't forget to test anything */
+    CORRADE_COMPARE(Containers::arraySize(MeshInvalidData), importer->meshCount());
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->mesh(data.name));
+    /* If the message ends with a newline, it's the whole output including a
+       potential placeholder for the filename, otherwise just the sentence
+       without any placeholder */
+    if(Containers::StringView{data.message}.hasSuffix('\n'))
+        CORRADE_COMPARE_AS(out,
+            Utility::format(data.message, filename),
+            TestSuite::Compare::String);
+    else
+        CORRADE_COMPARE_AS(out,
+            Utility::format("Trade::GltfImporter::mesh(): {}\n", data.message),
+            TestSuite::Compare::String);
+}
 
 void GltfImporterTest::meshInvalidBufferNotFound() {
     auto&& data = MeshInvalidBufferNotFoundData[testCaseInstanceId()];
@@ -6125,6 +7019,38 @@ void GltfImporterTest::meshInvalidSparseIndices() {
     CORRADE_COMPARE(out, Utility::format("Trade::GltfImporter::mesh(): {}\n", data.message));
 }
 
+void GltfImporterTest::meshInvalidMeshoptCompression() {
+    auto&& data = MeshInvalidMeshoptCompressionData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(GLTFIMPORTER_TEST_DIR, "mesh-meshopt-invalid.gltf")));
+
+    /* Check we didn't forget to test anything */
+    CORRADE_COMPARE(importer->meshCount(), Containers::arraySize(MeshInvalidMeshoptCompressionData));
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->mesh(data.name));
+    CORRADE_COMPARE(out, Utility::format("Trade::GltfImporter::mesh(): {}\n", data.message));
+}
+
+void GltfImporterTest::meshInvalidDracoCompression() {
+    auto&& data = MeshInvalidDracoCompressionData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(GLTFIMPORTER_TEST_DIR, "mesh-draco-invalid.gltf")));
+
+    /* Check we didn't forget to test anything */
+    CORRADE_COMPARE(importer->meshCount(), Containers::arraySize(MeshInvalidDracoCompressionData));
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->mesh(data.name));
+    CORRADE_COMPARE(out, Utility::format("Trade::GltfImporter::mesh(): {}\n", data.message));
+}
+
 void GltfImporterTest::materialPbrMetallicRoughness() {
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
 
@@ -7683,6 +8609,331 @@ void GltfImporterTest::imagePropagateImporterFlags() {
         "Trade::AnyImageImporter::openFile(): using PngImporter (provided by StbImageImporter)\n");
 }
 
+void GltfImporterTest::imageImporterCache() {
+    auto&& data = ImageImporterCacheData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(_manager.loadState("PngImporter") == PluginManager::LoadState::NotFound)
+        CORRADE_SKIP("PngImporter plugin not found, cannot test");
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
+    if(data.cacheSize)
+        importer->configuration().setValue("imageImporterCacheSize", *data.cacheSize);
+
+    /* Count how many times the image file gets loaded. Both images in the
+       file reference the same file, so just a single counter is enough. */
+    struct CallbackData {
+        std::size_t loadCount{};
+        Containers::Optional<Containers::Array<char>> file;
+    } callbackData;
+    importer->setFileCallback([](const std::string& filename, InputFileCallbackPolicy policy, CallbackData& callbackData)
+            -> Containers::Optional<Containers::ArrayView<const char>>
+        {
+            if(policy == InputFileCallbackPolicy::Close)
+                return {};
+
+            ++callbackData.loadCount;
+            callbackData.file = Utility::Path::read(Utility::Path::join(GLTFIMPORTER_TEST_DIR, filename));
+            if(!callbackData.file)
+                return {};
+            return Containers::arrayView(*callbackData.file);
+        }, callbackData);
+
+    /* Prevent the file callback being used for the main glTF content */
+    Containers::Optional<Containers::Array<char>> content = Utility::Path::read(Utility::Path::join(GLTFIMPORTER_TEST_DIR, "image.gltf"));
+    CORRADE_VERIFY(content);
+    CORRADE_VERIFY(importer->openData(*content));
+    CORRADE_COMPARE(importer->image2DCount(), 2);
+    CORRADE_COMPARE(importer->configuration().value<std::size_t>("imageImporterCacheHits"), 0);
+    CORRADE_COMPARE(importer->configuration().value<std::size_t>("imageImporterCacheMisses"), 0);
+
+    /* Level count query followed by the data query of the same image is
+       always a cache hit */
+    CORRADE_COMPARE(importer->image2DLevelCount(0), 1);
+    CORRADE_COMPARE(importer->configuration().value<std::size_t>("imageImporterCacheHits"), 0);
+    CORRADE_COMPARE(importer->configuration().value<std::size_t>("imageImporterCacheMisses"), 1);
+    CORRADE_VERIFY(importer->image2D(0));
+    CORRADE_COMPARE(importer->configuration().value<std::size_t>("imageImporterCacheHits"), 1);
+    CORRADE_COMPARE(importer->configuration().value<std::size_t>("imageImporterCacheMisses"), 1);
+    CORRADE_COMPARE(callbackData.loadCount, 1);
+
+    /* Alternating between the two images, which both reference the same
+       external file, reuses the importers only if there's space for both in
+       the cache. Every miss means the file got loaded again. */
+    CORRADE_VERIFY(importer->image2D(1));
+    CORRADE_VERIFY(importer->image2D(0));
+    CORRADE_VERIFY(importer->image2D(1));
+    CORRADE_COMPARE(callbackData.loadCount, data.expectedLoadCount);
+    CORRADE_COMPARE(importer->configuration().value<std::size_t>("imageImporterCacheHits"), data.expectedHitCount);
+    CORRADE_COMPARE(importer->configuration().value<std::size_t>("imageImporterCacheMisses"), data.expectedLoadCount);
+
+    /* The plugin-specific APIs return the same */
+    #ifndef GLTFIMPORTER_PLUGIN_FILENAME
+    CORRADE_COMPARE(static_cast<GltfImporter&>(*importer).imageImporterCacheHits(), data.expectedHitCount);
+    CORRADE_COMPARE(static_cast<GltfImporter&>(*importer).imageImporterCacheMisses(), data.expectedLoadCount);
+    #endif
+
+    /* Opening a file again resets the statistics */
+    CORRADE_VERIFY(importer->openData(*content));
+    CORRADE_COMPARE(importer->configuration().value<std::size_t>("imageImporterCacheHits"), 0);
+    CORRADE_COMPARE(importer->configuration().value<std::size_t>("imageImporterCacheMisses"), 0);
+}
+
+void GltfImporterTest::imagePrefetch() {
+    auto&& data = ImagePrefetchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(_manager.loadState("PngImporter") == PluginManager::LoadState::NotFound)
+        CORRADE_SKIP("PngImporter plugin not found, cannot test");
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
+    importer->configuration().setValue("prefetchImages", true);
+    importer->configuration().setValue("prefetchThreads", data.threads);
+
+    /* Count how many times an image file gets loaded. Buffers are loaded with
+       LoadPermanent, so count only temporary loads. All loaded files are
+       kept around as the permanent ones have to stay. */
+    struct CallbackData {
+        std::size_t loadCount{};
+        Containers::Array<Containers::Array<char>> files;
+    } callbackData;
+    importer->setFileCallback([](const std::string& filename, InputFileCallbackPolicy policy, CallbackData& callbackData)
+            -> Containers::Optional<Containers::ArrayView<const char>>
+        {
+            if(policy == InputFileCallbackPolicy::Close)
+                return {};
+
+            if(policy == InputFileCallbackPolicy::LoadTemporary)
+                ++callbackData.loadCount;
+            Containers::Optional<Containers::Array<char>> file = Utility::Path::read(Utility::Path::join(GLTFIMPORTER_TEST_DIR, filename));
+            if(!file)
+                return {};
+            return Containers::ArrayView<const char>{arrayAppend(callbackData.files, *Utility::move(file))};
+        }, callbackData);
+
+    /* Prevent the file callback being used for the main glTF content */
+    Containers::Optional<Containers::Array<char>> content = Utility::Path::read(Utility::Path::join(GLTFIMPORTER_TEST_DIR, "image"_s + data.suffix));
+    CORRADE_VERIFY(content);
+    CORRADE_VERIFY(importer->openData(*content));
+    CORRADE_COMPARE(importer->image2DCount(), 2);
+
+    /* All images got loaded during opening already */
+    CORRADE_COMPARE(callbackData.loadCount, data.expectedLoadCountPrefetched);
+
+    /* Retrieving the images doesn't load anything anymore */
+    CORRADE_COMPARE(importer->image2DLevelCount(0), 1);
+    CORRADE_COMPARE(importer->image2DLevelCount(1), 1);
+    for(UnsignedInt id: {0, 1}) {
+        CORRADE_ITERATION(id);
+        Containers::Optional<Trade::ImageData2D> image = importer->image2D(id);
+        CORRADE_VERIFY(image);
+        CORRADE_COMPARE(image->size(), Vector2i(5, 3));
+        CORRADE_COMPARE(image->format(), PixelFormat::RGBA8Unorm);
+        CORRADE_COMPARE_AS(image->data(), Containers::arrayView(ExpectedImageData).prefix(60), TestSuite::Compare::Container);
+    }
+    CORRADE_COMPARE(callbackData.loadCount, data.expectedLoadCountPrefetched);
+
+    /* The prefetched data are released once retrieved, so retrieving again
+       goes through the regular import path */
+    Containers::Optional<Trade::ImageData2D> image = importer->image2D(1);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE_AS(image->data(), Containers::arrayView(ExpectedImageData).prefix(60), TestSuite::Compare::Container);
+    CORRADE_COMPARE(callbackData.loadCount, data.expectedLoadCount);
+}
+
+void GltfImporterTest::imagePrefetchInvalid() {
+    auto&& data = ImageInvalidNotFoundData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(_manager.loadState("PngImporter") == PluginManager::LoadState::NotFound)
+        CORRADE_SKIP("PngImporter plugin not found, cannot test");
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
+    importer->configuration().setValue("prefetchImages", true);
+
+    /* The prefetch fails silently */
+    {
+        Containers::String out;
+        Error redirectError{&out};
+        CORRADE_VERIFY(importer->openFile(Utility::Path::join(GLTFIMPORTER_TEST_DIR, "image-invalid-notfound.gltf")));
+        CORRADE_COMPARE(out, "");
+    }
+
+    Int id = importer->image2DForName(data.name);
+    CORRADE_VERIFY(id != -1);
+
+    /* And the error gets printed by the regular import path instead */
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->image2D(id));
+    CORRADE_COMPARE_AS(out,
+        Utility::format("\n{}\n", data.message),
+        TestSuite::Compare::StringHasSuffix);
+}
+
+void GltfImporterTest::imagePrefetchInvalidThreadCount() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
+    importer->configuration().setValue("prefetchImages", true);
+    importer->configuration().setValue("prefetchThreads", -3);
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openFile(Utility::Path::join(GLTFIMPORTER_TEST_DIR, "image.gltf")));
+    CORRADE_COMPARE(out, "Trade::GltfImporter::openData(): expected prefetchThreads to be zero or positive but got -3\n");
+}
+
+void GltfImporterTest::imagePrefetchIds2D() {
+    if(_manager.loadState("PngImporter") == PluginManager::LoadState::NotFound)
+        CORRADE_SKIP("PngImporter plugin not found, cannot test");
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
+    importer->configuration().setValue("prefetchImage2DIds", "1");
+    importer->configuration().setValue("prefetchThreads", 2);
+
+    /* Count how many times the image file gets loaded. Both images in the
+       file reference the same file, so just a single counter is enough. */
+    struct CallbackData {
+        std::size_t loadCount{};
+        Containers::Optional<Containers::Array<char>> file;
+    } callbackData;
+    importer->setFileCallback([](const std::string& filename, InputFileCallbackPolicy policy, CallbackData& callbackData)
+            -> Containers::Optional<Containers::ArrayView<const char>>
+        {
+            if(policy == InputFileCallbackPolicy::Close)
+                return {};
+
+            ++callbackData.loadCount;
+            callbackData.file = Utility::Path::read(Utility::Path::join(GLTFIMPORTER_TEST_DIR, filename));
+            if(!callbackData.file)
+                return {};
+            return Containers::arrayView(*callbackData.file);
+        }, callbackData);
+
+    /* Prevent the file callback being used for the main glTF content */
+    Containers::Optional<Containers::Array<char>> content = Utility::Path::read(Utility::Path::join(GLTFIMPORTER_TEST_DIR, "image.gltf"));
+    CORRADE_VERIFY(content);
+    CORRADE_VERIFY(importer->openData(*content));
+    CORRADE_COMPARE(importer->image2DCount(), 2);
+
+    /* Only the second image got loaded during opening */
+    CORRADE_COMPARE(callbackData.loadCount, 1);
+
+    /* Retrieving it doesn't load anything and doesn't go through the image
+       importer cache */
+    {
+        Containers::Optional<Trade::ImageData2D> image = importer->image2D(1);
+        CORRADE_VERIFY(image);
+        CORRADE_COMPARE(image->size(), Vector2i(5, 3));
+        CORRADE_COMPARE_AS(image->data(), Containers::arrayView(ExpectedImageData).prefix(60), TestSuite::Compare::Container);
+    }
+    CORRADE_COMPARE(callbackData.loadCount, 1);
+    CORRADE_COMPARE(importer->configuration().value<std::size_t>("imageImporterCacheMisses"), 0);
+
+    /* The first image wasn't prefetched and gets loaded only now */
+    {
+        Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+        CORRADE_VERIFY(image);
+        CORRADE_COMPARE_AS(image->data(), Containers::arrayView(ExpectedImageData).prefix(60), TestSuite::Compare::Container);
+    }
+    CORRADE_COMPARE(callbackData.loadCount, 2);
+    CORRADE_COMPARE(importer->configuration().value<std::size_t>("imageImporterCacheMisses"), 1);
+
+    /* Prefetching on an already opened file is possible only through the
+       plugin-specific API */
+    #ifdef GLTFIMPORTER_PLUGIN_FILENAME
+    CORRADE_SKIP("GltfImporter::prefetchImages2D() can be called only if the plugin is built as static");
+    #else
+    importer->configuration().setValue("prefetchImage2DIds", "");
+    CORRADE_VERIFY(importer->openData(*content));
+    CORRADE_COMPARE(callbackData.loadCount, 2);
+
+    static_cast<GltfImporter&>(*importer).prefetchImages2D(Containers::arrayView<UnsignedInt>({0}));
+    CORRADE_COMPARE(callbackData.loadCount, 3);
+    CORRADE_VERIFY(importer->image2D(0));
+    CORRADE_COMPARE(callbackData.loadCount, 3);
+    CORRADE_COMPARE(importer->configuration().value<std::size_t>("imageImporterCacheMisses"), 0);
+
+    /* Prefetching all images loads just the one that wasn't prefetched yet.
+       Already retrieved levels aren't prefetched again. */
+    static_cast<GltfImporter&>(*importer).prefetchImages();
+    CORRADE_COMPARE(callbackData.loadCount, 4);
+    CORRADE_VERIFY(importer->image2D(1));
+    CORRADE_COMPARE(callbackData.loadCount, 4);
+    CORRADE_COMPARE(importer->configuration().value<std::size_t>("imageImporterCacheMisses"), 0);
+    #endif
+}
+
+void GltfImporterTest::imagePrefetchIds3D() {
+    if(_manager.loadState("KtxImporter") == PluginManager::LoadState::NotFound)
+        CORRADE_SKIP("KtxImporter plugin not found, cannot test");
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
+    importer->configuration().setValue("experimentalKhrTextureKtx", true);
+    importer->configuration().setValue("prefetchImage3DIds", "1");
+
+    /* Record which files get loaded */
+    struct CallbackData {
+        Containers::Array<Containers::String> loaded;
+        Containers::Optional<Containers::Array<char>> file;
+    } callbackData;
+    importer->setFileCallback([](const std::string& filename, InputFileCallbackPolicy policy, CallbackData& callbackData)
+            -> Containers::Optional<Containers::ArrayView<const char>>
+        {
+            if(policy == InputFileCallbackPolicy::Close)
+                return {};
+
+            arrayAppend(callbackData.loaded, Containers::String{filename});
+            callbackData.file = Utility::Path::read(Utility::Path::join(GLTFIMPORTER_TEST_DIR, filename));
+            if(!callbackData.file)
+                return {};
+            return Containers::arrayView(*callbackData.file);
+        }, callbackData);
+
+    Containers::Optional<Containers::Array<char>> content = Utility::Path::read(Utility::Path::join(GLTFIMPORTER_TEST_DIR, "texture-ktx.gltf"));
+    CORRADE_VERIFY(content);
+    CORRADE_VERIFY(importer->openData(*content));
+    CORRADE_COMPARE(importer->image3DCount(), 2);
+
+    /* Only the second 3D image got loaded during opening */
+    CORRADE_COMPARE_AS(callbackData.loaded, Containers::arrayView<Containers::String>({
+        "image-2d-array.ktx2"_s
+    }), TestSuite::Compare::Container);
+
+    Containers::Optional<Trade::ImageData3D> image = importer->image3D(1);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), PixelFormat::RGB8Srgb);
+    CORRADE_COMPARE(image->size(), (Vector3i{4, 3, 3}));
+    CORRADE_COMPARE(callbackData.loaded.size(), 1);
+
+    /* Prefetching on an already opened file is possible only through the
+       plugin-specific API */
+    #ifdef GLTFIMPORTER_PLUGIN_FILENAME
+    CORRADE_SKIP("GltfImporter::prefetchImages3D() can be called only if the plugin is built as static");
+    #else
+    static_cast<GltfImporter&>(*importer).prefetchImages3D(Containers::arrayView<UnsignedInt>({0}));
+    CORRADE_COMPARE_AS(callbackData.loaded, Containers::arrayView<Containers::String>({
+        "image-2d-array.ktx2"_s,
+        "image-2d-array-mips.ktx2"_s
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(importer->image3DLevelCount(0), 3);
+    CORRADE_VERIFY(importer->image3D(0, 2));
+    CORRADE_COMPARE(callbackData.loaded.size(), 2);
+    #endif
+}
+
+void GltfImporterTest::imagePrefetchIdsInvalid() {
+    auto&& data = ImagePrefetchIdsInvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
+    importer->configuration().setValue(data.option, data.value);
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openFile(Utility::Path::join(GLTFIMPORTER_TEST_DIR, "image.gltf")));
+    CORRADE_COMPARE(out, Utility::format("Trade::GltfImporter::openData(): {}\n", data.message));
+}
+
 void GltfImporterTest::experimentalKhrTextureKtx2D() {
     if(_manager.loadState("KtxImporter") == PluginManager::LoadState::NotFound)
         CORRADE_SKIP("KtxImporter plugin not found, cannot test");
@@ -8417,6 +9668,35 @@ void GltfImporterTest::importTwice() {
     }
 }
 
+void GltfImporterTest::benchmarkOpenManyNodes() {
+    auto&& data = BenchmarkOpenManyNodesData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("GltfImporter");
+    importer->configuration().setValue("lazySceneFieldDiscovery", data.lazySceneFieldDiscovery);
+
+    /* A synthetic file with a million nodes, each with a few extras, to track
+       regressions in file opening time */
+    constexpr Containers::StringView header = R"({"asset":{"version":"2.0"},"nodes":[)"_s;
+    constexpr Containers::StringView node = R"({"name":"node","extras":{"radius":2.5,"visible":true,"category":"leaf","nested":{"id":7}}})"_s;
+    constexpr std::size_t nodeCount = 1000000;
+    Containers::Array<char> json;
+    arrayReserve(json, header.size() + nodeCount*(node.size() + 1) + 2);
+    arrayAppend(json, Containers::arrayView(header.data(), header.size()));
+    for(std::size_t i = 0; i != nodeCount; ++i) {
+        if(i) arrayAppend(json, ',');
+        arrayAppend(json, Containers::arrayView(node.data(), node.size()));
+    }
+    arrayAppend(json, {']', '}'});
+
+    bool opened = false;
+    CORRADE_BENCHMARK(1)
+        opened = importer->openData(json);
+
+    CORRADE_VERIFY(opened);
+    CORRADE_COMPARE(importer->objectCount(), UnsignedLong{nodeCount});
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::GltfImporterTest)
@@ -28,6 +28,8 @@
 #cmakedefine GLTFIMPORTER_PLUGIN_FILENAME "${GLTFIMPORTER_PLUGIN_FILENAME}"
 #cmakedefine BASISIMPORTER_PLUGIN_FILENAME "${BASISIMPORTER_PLUGIN_FILENAME}"
 #cmakedefine DDSIMPORTER_PLUGIN_FILENAME "${DDSIMPORTER_PLUGIN_FILENAME}"
+#cmakedefine DRACOIMPORTER_PLUGIN_FILENAME "${DRACOIMPORTER_PLUGIN_FILENAME}"
 #cmakedefine KTXIMPORTER_PLUGIN_FILENAME "${KTXIMPORTER_PLUGIN_FILENAME}"
 #cmakedefine STBIMAGEIMPORTER_PLUGIN_FILENAME "${STBIMAGEIMPORTER_PLUGIN_FILENAME}"
+#cmakedefine MAGNUM_WITH_DRACOIMPORTER
 #define GLTFIMPORTER_TEST_DIR "${GLTFIMPORTER_TEST_DIR}"
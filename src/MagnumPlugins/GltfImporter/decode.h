@@ -26,9 +26,12 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cmath>
+#include <cstring>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/String.h>
+#include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Macros.h>
 #include <Magnum/Magnum.h>
 
@@ -199,6 +202,384 @@ Containers::Optional<Containers::Array<char>> decodeBase64(const char* const err
     return Containers::optional(Utility::move(data));
 }
 
+
+/* EXT_meshopt_compression decoders, implementing the bitstream described in
+   https://github.com/KhronosGroup/glTF/blob/main/extensions/2.0/Vendor/EXT_meshopt_compression/README.md#appendix-a-bitstream
+   These don't print any message on failure and only return false, the
+   caller is expected to print an error with more context. The output is
+   expected to be exactly count*stride bytes large and aligned to the
+   stride. */
+
+/* Decodes a variable-length integer with 7 bits per byte, at most five bytes.
+   The caller is responsible for making sure there's enough bytes to read. */
+UnsignedInt decodeMeshoptVByte(const UnsignedByte*& data) {
+    const UnsignedByte lead = *data++;
+    if(lead < 128)
+        return lead;
+
+    UnsignedInt result = lead & 127;
+    for(UnsignedInt shift = 7; shift != 35; shift += 7) {
+        const UnsignedByte group = *data++;
+        result |= UnsignedInt(group & 127) << shift;
+        if(group < 128)
+            break;
+    }
+    return result;
+}
+
+/* Decodes a zigzag-encoded delta from the previous index */
+UnsignedInt decodeMeshoptIndex(const UnsignedByte*& data, const UnsignedInt last) {
+    const UnsignedInt v = decodeMeshoptVByte(data);
+    return last + ((v >> 1) ^ (0u - (v & 1)));
+}
+
+/* Mode 0, attributes. Only version 0 of the encoding is defined by the
+   extension. */
+bool decodeMeshoptAttributes(const Containers::ArrayView<const char> in, const std::size_t count, const std::size_t stride, const Containers::ArrayView<char> out) {
+    CORRADE_INTERNAL_ASSERT(stride && stride <= 256 && stride % 4 == 0 && out.size() == count*stride);
+
+    /* The stream ends with a tail containing the first vertex, padded from
+       the front to at least 32 bytes */
+    const std::size_t tailSize = stride < 32 ? 32 : stride;
+    if(in.size() < 1 + tailSize)
+        return false;
+
+    const UnsignedByte* data = reinterpret_cast<const UnsignedByte*>(in.data());
+    const UnsignedByte* const end = data + in.size();
+    if(*data++ != 0xa0)
+        return false;
+
+    UnsignedByte last[256];
+    for(std::size_t i = 0; i != stride; ++i)
+        last[i] = end[i - stride];
+
+    /* Vertices are encoded in blocks that fit into 8 kB but have at most 256
+       vertices, with the count rounded down to a multiple of 16. Each byte of
+       a vertex is then encoded separately, as groups of 16 deltas from the
+       previous vertex. */
+    UnsignedByte* const output = reinterpret_cast<UnsignedByte*>(out.data());
+    const std::size_t blockSizeUnclamped = (8192/stride) & ~std::size_t{15};
+    const std::size_t blockSize = blockSizeUnclamped < 256 ? blockSizeUnclamped : 256;
+    UnsignedByte deltas[256];
+    for(std::size_t blockOffset = 0; blockOffset < count; blockOffset += blockSize) {
+        const std::size_t blockCount = count - blockOffset < blockSize ? count - blockOffset : blockSize;
+        const std::size_t groupCount = (blockCount + 15)/16;
+
+        for(std::size_t byte = 0; byte != stride; ++byte) {
+            /* Group header has two bits per group, specifying whether the
+               group has 0, 2, 4 or 8 bits per delta */
+            const std::size_t headerSize = (groupCount + 3)/4;
+            if(std::size_t(end - data) < headerSize)
+                return false;
+            const UnsignedByte* const header = data;
+            data += headerSize;
+
+            for(std::size_t group = 0; group != groupCount; ++group) {
+                UnsignedByte* const groupDeltas = deltas + group*16;
+                const UnsignedInt bitsLog2 = (header[group/4] >> (group%4*2)) & 3;
+                if(bitsLog2 == 0) {
+                    for(std::size_t i = 0; i != 16; ++i)
+                        groupDeltas[i] = 0;
+                } else if(bitsLog2 == 3) {
+                    if(end - data < 16)
+                        return false;
+                    for(std::size_t i = 0; i != 16; ++i)
+                        groupDeltas[i] = data[i];
+                    data += 16;
+                } else {
+                    /* Deltas packed into 2 or 4 bits, from the most
+                       significant bits of each byte. Deltas that don't fit
+                       are stored as all ones, with the full byte following
+                       after all packed bytes. */
+                    const UnsignedInt bits = 1 << bitsLog2;
+                    const UnsignedInt deltasPerByte = 8/bits;
+                    const UnsignedByte sentinel = (1 << bits) - 1;
+                    const std::size_t packedSize = 16/deltasPerByte;
+                    if(std::size_t(end - data) < packedSize)
+                        return false;
+                    const UnsignedByte* extra = data + packedSize;
+                    for(std::size_t i = 0; i != 16; ++i) {
+                        const UnsignedByte delta = (data[i/deltasPerByte] >> (8 - bits*(i%deltasPerByte + 1))) & sentinel;
+                        if(delta != sentinel)
+                            groupDeltas[i] = delta;
+                        else if(extra != end)
+                            groupDeltas[i] = *extra++;
+                        else return false;
+                    }
+                    data = extra;
+                }
+            }
+
+            /* Undo the zigzag delta encoding */
+            UnsignedByte previous = last[byte];
+            for(std::size_t i = 0; i != blockCount; ++i) {
+                const UnsignedByte delta = deltas[i];
+                previous += UnsignedByte((delta >> 1) ^ (0u - (delta & 1)));
+                output[(blockOffset + i)*stride + byte] = previous;
+            }
+            last[byte] = previous;
+        }
+    }
+
+    /* Exactly the tail should be left */
+    return std::size_t(end - data) == tailSize;
+}
+
+/* Mode 1, triangles. Version 1 of the encoding is what the extension
+   mandates, version 0 is accepted as well. */
+bool decodeMeshoptTriangles(const Containers::ArrayView<const char> in, const std::size_t count, const std::size_t indexSize, const Containers::ArrayView<char> out) {
+    CORRADE_INTERNAL_ASSERT(count % 3 == 0 && (indexSize == 2 || indexSize == 4) && out.size() == count*indexSize);
+
+    /* Header byte, a code byte per triangle and a 16-byte table of auxiliary
+       codes at the end */
+    if(in.size() < 1 + count/3 + 16)
+        return false;
+
+    const UnsignedByte* const begin = reinterpret_cast<const UnsignedByte*>(in.data());
+    if((begin[0] & 0xf0) != 0xe0 || (begin[0] & 0x0f) > 1)
+        return false;
+    const UnsignedInt vertexFifoMax = (begin[0] & 0x0f) >= 1 ? 13 : 15;
+
+    const UnsignedByte* code = begin + 1;
+    const UnsignedByte* data = code + count/3;
+    const UnsignedByte* const codeAuxTable = begin + in.size() - 16;
+
+    /* Recently seen edges and vertices, as ring buffers of 16 items */
+    UnsignedInt edgeFifo[16][2];
+    UnsignedInt vertexFifo[16];
+    for(std::size_t i = 0; i != 16; ++i) {
+        edgeFifo[i][0] = edgeFifo[i][1] = ~UnsignedInt{};
+        vertexFifo[i] = ~UnsignedInt{};
+    }
+    std::size_t edgeFifoOffset = 0;
+    std::size_t vertexFifoOffset = 0;
+    const auto pushEdge = [&](const UnsignedInt a, const UnsignedInt b) {
+        edgeFifo[edgeFifoOffset][0] = a;
+        edgeFifo[edgeFifoOffset][1] = b;
+        edgeFifoOffset = (edgeFifoOffset + 1) & 15;
+    };
+    const auto pushVertex = [&](const UnsignedInt v, const bool advance) {
+        vertexFifo[vertexFifoOffset] = v;
+        vertexFifoOffset = (vertexFifoOffset + advance) & 15;
+    };
+
+    UnsignedInt next = 0;
+    UnsignedInt last = 0;
+    for(std::size_t i = 0; i != count; i += 3) {
+        /* A triangle reads at most 16 data bytes, one auxiliary code and
+           three five-byte indices. The code table at the end acts as a
+           padding so once this passes, no further bounds checks are needed. */
+        if(data > codeAuxTable)
+            return false;
+
+        const UnsignedByte codeTri = *code++;
+        UnsignedInt a, b, c;
+
+        /* Triangle sharing an edge with one of the recent triangles, upper
+           four bits are the edge FIFO index, lower four bits specify the
+           third vertex */
+        if(codeTri < 0xf0) {
+            const UnsignedInt* const edge = edgeFifo[(edgeFifoOffset - 1 - (codeTri >> 4)) & 15];
+            a = edge[0];
+            b = edge[1];
+
+            const UnsignedInt fec = codeTri & 15;
+            if(fec < vertexFifoMax) {
+                c = fec == 0 ? next++ : vertexFifo[(vertexFifoOffset - 1 - fec) & 15];
+                pushVertex(c, fec == 0);
+            } else {
+                /* 13 and 14 encode a previous and next index, 15 is an
+                   explicitly encoded index */
+                c = last = fec == 15 ? decodeMeshoptIndex(data, last) :
+                                       fec == 13 ? last - 1 : last + 1;
+                pushVertex(c, true);
+            }
+
+            pushEdge(c, b);
+            pushEdge(a, c);
+
+        /* Triangle not sharing any edge, with the lower four bits being an
+           index to the auxiliary code table, or a full auxiliary code byte
+           following in the data */
+        } else {
+            if(codeTri < 0xfe) {
+                const UnsignedByte codeAux = codeAuxTable[codeTri & 15];
+                const UnsignedInt feb = codeAux >> 4;
+                const UnsignedInt fec = codeAux & 15;
+
+                /* The first vertex is always a new one. All vertex FIFO
+                   lookups happen before any of the vertices are pushed. */
+                a = next++;
+                b = feb == 0 ? next++ : vertexFifo[(vertexFifoOffset - feb) & 15];
+                c = fec == 0 ? next++ : vertexFifo[(vertexFifoOffset - fec) & 15];
+
+                pushVertex(a, true);
+                pushVertex(b, feb == 0);
+                pushVertex(c, fec == 0);
+            } else {
+                const UnsignedByte codeAux = *data++;
+                const bool explicitA = codeTri == 0xff;
+                const UnsignedInt feb = codeAux >> 4;
+                const UnsignedInt fec = codeAux & 15;
+
+                /* A zero auxiliary code that's not in the table resets the
+                   new vertex counter */
+                if(codeAux == 0)
+                    next = 0;
+
+                a = explicitA ? 0 : next++;
+                b = feb == 0 ? next++ : vertexFifo[(vertexFifoOffset - feb) & 15];
+                c = fec == 0 ? next++ : vertexFifo[(vertexFifoOffset - fec) & 15];
+                if(explicitA)
+                    a = last = decodeMeshoptIndex(data, last);
+                if(feb == 15)
+                    b = last = decodeMeshoptIndex(data, last);
+                if(fec == 15)
+                    c = last = decodeMeshoptIndex(data, last);
+
+                pushVertex(a, true);
+                pushVertex(b, feb == 0 || feb == 15);
+                pushVertex(c, fec == 0 || fec == 15);
+            }
+
+            pushEdge(b, a);
+            pushEdge(c, b);
+            pushEdge(a, c);
+        }
+
+        if(indexSize == 2) {
+            UnsignedShort* const output = reinterpret_cast<UnsignedShort*>(out.data()) + i;
+            output[0] = a;
+            output[1] = b;
+            output[2] = c;
+        } else {
+            UnsignedInt* const output = reinterpret_cast<UnsignedInt*>(out.data()) + i;
+            output[0] = a;
+            output[1] = b;
+            output[2] = c;
+        }
+    }
+
+    /* All data should be consumed up to the code table */
+    return data == codeAuxTable;
+}
+
+/* Mode 2, indices. Version 1 of the encoding is what the extension mandates,
+   version 0 is accepted as well. */
+bool decodeMeshoptIndices(const Containers::ArrayView<const char> in, const std::size_t count, const std::size_t indexSize, const Containers::ArrayView<char> out) {
+    CORRADE_INTERNAL_ASSERT((indexSize == 2 || indexSize == 4) && out.size() == count*indexSize);
+
+    /* Header byte, at least one byte per index and a 4-byte padding at the
+       end */
+    if(in.size() < 1 + count + 4)
+        return false;
+
+    const UnsignedByte* const begin = reinterpret_cast<const UnsignedByte*>(in.data());
+    if((begin[0] & 0xf0) != 0xd0 || (begin[0] & 0x0f) > 1)
+        return false;
+
+    const UnsignedByte* data = begin + 1;
+    const UnsignedByte* const padding = begin + in.size() - 4;
+
+    /* Each index is a delta from one of two previous indices, with the lowest
+       bit selecting which */
+    UnsignedInt last[2]{};
+    for(std::size_t i = 0; i != count; ++i) {
+        /* An index reads at most five bytes, the padding at the end makes
+           sure that's always in bounds if there's at least one byte left */
+        if(data >= padding)
+            return false;
+
+        const UnsignedInt v = decodeMeshoptVByte(data);
+        UnsignedInt& previous = last[v & 1];
+        previous += (v >> 2) ^ (0u - ((v >> 1) & 1));
+
+        if(indexSize == 2)
+            reinterpret_cast<UnsignedShort*>(out.data())[i] = previous;
+        else
+            reinterpret_cast<UnsignedInt*>(out.data())[i] = previous;
+    }
+
+    /* All data should be consumed up to the padding */
+    return data == padding;
+}
+
+/* Octahedral filter, applied in-place on four-component 8- or 16-bit signed
+   normalized vectors. The first two components are octahedral coordinates,
+   the third one contains a scale, the fourth is left untouched. */
+template<class T> void decodeMeshoptFilterOctahedral(const Containers::ArrayView<char> data) {
+    T* const values = reinterpret_cast<T*>(data.data());
+    const std::size_t count = data.size()/(4*sizeof(T));
+    const Float max = Float((1 << (sizeof(T)*8 - 1)) - 1);
+    for(std::size_t i = 0; i != count; ++i) {
+        T* const vector = values + i*4;
+
+        Float x = vector[0];
+        Float y = vector[1];
+        const Float z = vector[2] - std::abs(x) - std::abs(y);
+
+        /* Fold the lower hemisphere */
+        const Float t = z < 0.0f ? z : 0.0f;
+        x += x >= 0.0f ? t : -t;
+        y += y >= 0.0f ? t : -t;
+
+        /* Normalize and round back to integers */
+        const Float scale = max/std::sqrt(x*x + y*y + z*z);
+        vector[0] = T(Int(x*scale + (x >= 0.0f ? 0.5f : -0.5f)));
+        vector[1] = T(Int(y*scale + (y >= 0.0f ? 0.5f : -0.5f)));
+        vector[2] = T(Int(z*scale + (z >= 0.0f ? 0.5f : -0.5f)));
+    }
+}
+
+/* Quaternion filter, applied in-place on 16-bit signed normalized
+   quaternions. The first three components are the three smallest quaternion
+   components, the fourth contains a scale in upper bits and the index of the
+   largest omitted component in the lowest two bits. */
+void decodeMeshoptFilterQuaternion(const Containers::ArrayView<char> data) {
+    Short* const values = reinterpret_cast<Short*>(data.data());
+    const std::size_t count = data.size()/8;
+    for(std::size_t i = 0; i != count; ++i) {
+        Short* const quaternion = values + i*4;
+
+        const Float scale = 0.70710678f/Float(quaternion[3] | 3);
+        const Float x = quaternion[0]*scale;
+        const Float y = quaternion[1]*scale;
+        const Float z = quaternion[2]*scale;
+
+        /* Reconstruct the largest component, clamping to avoid a NaN due to
+           precision errors */
+        const Float ww = 1.0f - x*x - y*y - z*z;
+        const Float w = std::sqrt(ww >= 0.0f ? ww : 0.0f);
+
+        /* Output order is given by the index of the largest component */
+        const UnsignedInt largest = quaternion[3] & 3;
+        quaternion[(largest + 1) & 3] = Short(Int(x*32767.0f + (x >= 0.0f ? 0.5f : -0.5f)));
+        quaternion[(largest + 2) & 3] = Short(Int(y*32767.0f + (y >= 0.0f ? 0.5f : -0.5f)));
+        quaternion[(largest + 3) & 3] = Short(Int(z*32767.0f + (z >= 0.0f ? 0.5f : -0.5f)));
+        quaternion[(largest + 0) & 3] = Short(Int(w*32767.0f + 0.5f));
+    }
+}
+
+/* Exponential filter, applied in-place on 32-bit values. Each value has a
+   signed 24-bit mantissa in the lower bits and a signed 8-bit exponent in
+   the upper bits. */
+void decodeMeshoptFilterExponential(const Containers::ArrayView<char> data) {
+    UnsignedInt* const values = reinterpret_cast<UnsignedInt*>(data.data());
+    const std::size_t count = data.size()/4;
+    for(std::size_t i = 0; i != count; ++i) {
+        const Int mantissa = Int(values[i] << 8) >> 8;
+        const Int exponent = Int(values[i]) >> 24;
+
+        /* Equivalent to ldexp(mantissa, exponent), multiplying with a power of
+           two constructed directly from its bit representation */
+        const UnsignedInt powerBits = UnsignedInt(exponent + 127) << 23;
+        Float power;
+        std::memcpy(&power, &powerBits, 4);
+        const Float value = power*Float(mantissa);
+        std::memcpy(values + i, &value, 4);
+    }
+}
+
 }}}
 
 #endif
@@ -28,6 +28,9 @@
 
 #include <cctype> /* std::isupper() */
 #include <algorithm> /* std::sort() */
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <Corrade/Containers/ArrayTuple.h>
 #include <Corrade/Containers/ArrayViewStl.h> /** @todo drop once Configuration is STL-free */
@@ -41,12 +44,14 @@
 #include <Corrade/Containers/ScopeGuard.h>
 #include <Corrade/Containers/StridedBitArrayView.h>
 #include <Corrade/Containers/StringIterable.h>
+#include <Corrade/Containers/StringStlHash.h>
 #include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/ConfigurationGroup.h>
 #include <Corrade/Utility/Format.h>
 #include <Corrade/Utility/JsonWriter.h>
 #include <Corrade/Utility/Macros.h> /* CORRADE_UNUSED */
 #include <Corrade/Utility/Path.h>
+#include <Corrade/Utility/Sha1.h>
 #include <Corrade/Utility/String.h> /* lowercase() */
 #include <Magnum/PixelFormat.h>
 #include <Magnum/Math/Color.h>
@@ -66,6 +71,7 @@
 
 #include "Magnum/Implementation/formatPluginsVersion.h"
 #include "MagnumPlugins/GltfImporter/Gltf.h"
+#include "MagnumPlugins/GltfSceneConverter/encode.h"
 
 /* We'd have to endian-flip everything that goes into buffers, plus the binary
    glTF headers, etc. Too much work, hard to automatically test because the
@@ -83,14 +89,15 @@ namespace {
    doAdd() for images and conversion to an extension name in doAdd() for
    textures. Values sorted by name. */
 enum class GltfExtension {
-    ExtTextureAstc = 1 << 0,
-    ExtTextureWebP = 1 << 1,
-    KhrMaterialsClearCoat = 1 << 2,
-    KhrMaterialsUnlit = 1 << 3,
-    KhrMeshQuantization = 1 << 4,
-    KhrTextureBasisu = 1 << 5,
-    KhrTextureKtx = 1 << 6,
-    KhrTextureTransform = 1 << 7,
+    ExtMeshoptCompression = 1 << 0,
+    ExtTextureAstc = 1 << 1,
+    ExtTextureWebP = 1 << 2,
+    KhrMaterialsClearCoat = 1 << 3,
+    KhrMaterialsUnlit = 1 << 4,
+    KhrMeshQuantization = 1 << 5,
+    KhrTextureBasisu = 1 << 6,
+    KhrTextureKtx = 1 << 7,
+    KhrTextureTransform = 1 << 8,
 };
 typedef Containers::EnumSet<GltfExtension> GltfExtensions;
 #ifdef CORRADE_TARGET_CLANG
@@ -111,6 +118,213 @@ struct MeshProperties {
     Containers::String gltfName;
 };
 
+/* Used for the deduplicate option. A full SHA-1 digest, as images and buffer
+   views that were already streamed to a file are matched on the hash alone.
+   Buffer view contents are additionally compared if they're still in
+   memory. The digest bytes are put into the key as-is, it's always the last
+   component so it can't clash with the other key parts. */
+Containers::String dataHash(const Containers::ArrayView<const char> data) {
+    const Utility::Sha1::Digest digest = (Utility::Sha1{} << data).digest();
+    return Containers::String{reinterpret_cast<const char*>(digest.byteArray()), Utility::Sha1::DigestSize};
+}
+
+/* Key for deduplicating images, packing everything that affects the output
+   together with a hash of the pixel data. Pixels of uncompressed images are
+   hashed without any padding so images differing only in the pixel storage
+   are still treated as the same. */
+template<UnsignedInt dimensions> Containers::String imageDeduplicationKey(const Containers::StringView imageConverterPluginName, const bool bundleImages, const ImageData<dimensions>& image) {
+    const Vector3i size = Vector3i::pad(image.size(), 1);
+    if(image.isCompressed())
+        return Utility::format("{}:{}:{}D:compressed:{}:{}x{}x{}:{}",
+            imageConverterPluginName,
+            bundleImages,
+            dimensions,
+            UnsignedInt(image.compressedFormat()),
+            size.x(), size.y(), size.z(),
+            dataHash(image.data()));
+
+    const Containers::StridedArrayView<dimensions + 1, const char> pixels = image.pixels();
+    Containers::String hash;
+    if(pixels.isContiguous())
+        hash = dataHash(pixels.asContiguous());
+    else {
+        Containers::Array<char> contiguous{NoInit, image.pixelSize()*std::size_t(image.size().product())};
+        Utility::copy(pixels, Containers::StridedArrayView<dimensions + 1, char>{contiguous, pixels.size()});
+        hash = dataHash(contiguous);
+    }
+
+    return Utility::format("{}:{}:{}D:{}:{}:{}x{}x{}:{}",
+        imageConverterPluginName,
+        bundleImages,
+        dimensions,
+        UnsignedInt(image.format()),
+        image.formatExtra(),
+        size.x(), size.y(), size.z(),
+        hash);
+}
+
+/* An image queued for conversion on a worker thread if imageConverterThreads
+   isn't 1. The image data are copied as the caller-owned input is not
+   guaranteed to stay around after add(). */
+struct QueuedImage {
+    UnsignedInt id;
+    Containers::String name;
+    Containers::String mimeType;
+    /* Empty if the image is bundled */
+    Containers::String filename;
+    bool accessorNames;
+    Containers::Pointer<AbstractImageConverter> imageConverter;
+    /* Only one of these is set, depending on image dimensions */
+    Containers::Optional<ImageData2D> image2D;
+    Containers::Optional<ImageData3D> image3D;
+
+    /* Filled by the worker thread. The data are set only for a bundled image,
+       output of the conversion is captured and replayed on the calling
+       thread once done. */
+    bool succeeded = false;
+    Containers::Optional<Containers::Array<char>> data;
+    Containers::String output;
+    Containers::String warningOutput;
+    Containers::String errorOutput;
+};
+
+template<UnsignedInt dimensions> ImageData<dimensions> copyImage(const ImageData<dimensions>& image) {
+    Containers::Array<char> data{NoInit, image.data().size()};
+    Utility::copy(image.data(), data);
+    if(image.isCompressed())
+        return ImageData<dimensions>{image.compressedStorage(), image.compressedFormat(), image.size(), Utility::move(data), image.flags()};
+    return ImageData<dimensions>{image.storage(), image.format(), image.formatExtra(), image.pixelSize(), image.size(), Utility::move(data), image.flags()};
+}
+
+void setQueuedImage(QueuedImage& queued, const ImageData2D& image) {
+    queued.image2D = copyImage(image);
+}
+
+void setQueuedImage(QueuedImage& queued, const ImageData3D& image) {
+    queued.image3D = copyImage(image);
+}
+
+/* The image copy is freed right after the conversion so the memory use
+   doesn't grow with the count of already converted images */
+void convertQueuedImage(QueuedImage& queued) {
+    {
+        Debug redirectOutput{&queued.output};
+        Warning redirectWarning{&queued.warningOutput};
+        Error redirectError{&queued.errorOutput};
+
+        if(!queued.filename) {
+            queued.data = queued.image2D ?
+                queued.imageConverter->convertToData(*queued.image2D) :
+                queued.imageConverter->convertToData(*queued.image3D);
+            queued.succeeded = !!queued.data;
+        } else {
+            queued.succeeded = queued.image2D ?
+                queued.imageConverter->convertToFile(*queued.image2D, queued.filename) :
+                queued.imageConverter->convertToFile(*queued.image3D, queued.filename);
+        }
+    }
+
+    queued.image2D = Containers::NullOpt;
+    queued.image3D = Containers::NullOpt;
+}
+
+/* Converts queued images on a fixed set of worker threads, in the order they
+   were queued. The image converter instances are created and destroyed on
+   the calling thread as the plugin manager isn't thread-safe. The count of
+   images waiting for conversion is bounded, queue() blocks if the workers
+   can't keep up, so at most a few image copies exist at a time. */
+class ImageConversionPool {
+    public:
+        explicit ImageConversionPool(UnsignedInt threadCount): _maxPendingCount{4*std::size_t(threadCount)} {
+            arrayReserve(_threads, threadCount);
+            for(UnsignedInt i = 0; i != threadCount; ++i)
+                arrayAppend(_threads, InPlaceInit, &ImageConversionPool::work, this);
+        }
+
+        /* Stops the workers without converting the remaining images if
+           finish() wasn't called, e.g. on abort() */
+        ~ImageConversionPool() {
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+                _stop = true;
+            }
+            _condition.notify_all();
+            for(std::thread& thread: _threads)
+                if(thread.joinable())
+                    thread.join();
+        }
+
+        std::size_t size() {
+            std::lock_guard<std::mutex> lock{_mutex};
+            return _images.size();
+        }
+
+        /* Waits until there's space for another image before making a copy
+           of it. There's just one thread queueing, so the space can only
+           grow until the image is appended below. */
+        template<UnsignedInt dimensions> void queue(Containers::Pointer<QueuedImage>&& queued, const ImageData<dimensions>& image) {
+            {
+                std::unique_lock<std::mutex> lock{_mutex};
+                _spaceCondition.wait(lock, [this]{
+                    return _images.size() - _convertedCount < _maxPendingCount;
+                });
+            }
+
+            setQueuedImage(*queued, image);
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+                arrayAppend(_images, Utility::move(queued));
+            }
+            _condition.notify_one();
+        }
+
+        /* Waits until all queued images are converted and returns them */
+        Containers::Array<Containers::Pointer<QueuedImage>> finish() {
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+                _finish = true;
+            }
+            _condition.notify_all();
+            for(std::thread& thread: _threads)
+                thread.join();
+            return Utility::move(_images);
+        }
+
+    private:
+        void work() {
+            for(;;) {
+                QueuedImage* image;
+                {
+                    std::unique_lock<std::mutex> lock{_mutex};
+                    _condition.wait(lock, [this]{
+                        return _stop || _finish || _next < _images.size();
+                    });
+                    if(_stop || _next == _images.size())
+                        return;
+                    image = _images[_next++].get();
+                }
+
+                /* The image is only accessed by this thread until finish(),
+                   and growing the array doesn't move the pointed-to data */
+                convertQueuedImage(*image);
+
+                {
+                    std::lock_guard<std::mutex> lock{_mutex};
+                    ++_convertedCount;
+                }
+                _spaceCondition.notify_one();
+            }
+        }
+
+        const std::size_t _maxPendingCount;
+        std::mutex _mutex;
+        std::condition_variable _condition, _spaceCondition;
+        Containers::Array<std::thread> _threads;
+        Containers::Array<Containers::Pointer<QueuedImage>> _images;
+        std::size_t _next = 0, _convertedCount = 0;
+        bool _stop = false, _finish = false;
+};
+
 }
 
 struct GltfSceneConverter::State {
@@ -194,6 +408,41 @@ struct GltfSceneConverter::State {
     Int defaultScene = -1;
 
     Containers::Array<char> buffer;
+    /* If streaming buffer data to a file, name of the file the data are
+       appended to -- the external buffer for a *.gltf, a temporary file that
+       gets spliced into the BIN chunk at the end for a *.glb. Empty if not
+       streaming. */
+    Containers::String bufferStreamFilename;
+    /* Size of buffer data already written to bufferStreamFilename. The
+       `buffer` array then contains only data after this offset. Always zero
+       if not streaming. */
+    std::size_t bufferOffset = 0;
+    /* Size of a placeholder buffer that's referenced by buffer views
+       compressed with EXT_meshopt_compression if meshoptCompressionFallback
+       is disabled. Its contents are never written anywhere. */
+    std::size_t meshoptFallbackBufferSize = 0;
+
+    /* Mesh buffer views, accessors and images already written, used if the
+       deduplicate option is enabled. Key for buffer views is packing the view
+       properties together with a hash of its contents, value is the output
+       glTF buffer view index and absolute offset of its data in the buffer,
+       used to verify the contents are actually the same. Key for accessors
+       is packing all accessor properties, key for images is made by
+       imageDeduplicationKey(), value is the output glTF accessor or image
+       index. */
+    std::unordered_map<Containers::String, Containers::Pair<UnsignedInt, std::size_t>> deduplicatedBufferViews;
+    std::unordered_map<Containers::String, UnsignedInt> deduplicatedAccessors;
+    std::unordered_map<Containers::String, UnsignedInt> deduplicatedImages;
+
+    /* Count of threads to convert images with, taken from the configuration
+       when beginning the file. If not 1, images are queued to the pool, which
+       is created on the first queued image, and written in
+       writeQueuedImages() called from doEndData() / doEndFile(), or from a
+       mesh add() if there are bundled images queued, as their data have to
+       be placed into the buffer before the mesh. */
+    UnsignedInt imageConverterThreadCount = 1;
+    Containers::Pointer<ImageConversionPool> imageConversionPool;
+    bool imageConversionPoolHasBundledImages = false;
 };
 
 using namespace Containers::Literals;
@@ -230,9 +479,40 @@ bool GltfSceneConverter::doBeginFile(const Containers::StringView filename) {
         _state->binary = Utility::String::lowercase(Utility::Path::splitExtension(filename).second()) != ".gltf"_s;
     } else _state->binary = configuration().value<bool>("binary");
 
+    /* If streaming, buffer data go to the external *.bin file directly for a
+       text glTF, or to a temporary file next to the output for a binary
+       one */
+    if(configuration().value<bool>("streamBuffer")) {
+        _state->bufferStreamFilename = _state->binary ?
+            filename + ".bin.tmp"_s :
+            Utility::Path::splitExtension(filename).first() + ".bin"_s;
+    }
+
     return AbstractSceneConverter::doBeginFile(filename);
 }
 
+bool GltfSceneConverter::flushBuffer() {
+    if(!_state->bufferStreamFilename || _state->buffer.isEmpty())
+        return true;
+
+    /* The file is created on the first flush, so if nothing ever gets
+       written to the buffer, no file is created either */
+    if(!(_state->bufferOffset ?
+        Utility::Path::append(_state->bufferStreamFilename, _state->buffer) :
+        Utility::Path::write(_state->bufferStreamFilename, _state->buffer)))
+    {
+        Error{} << "Trade::GltfSceneConverter: can't write buffer data to" << _state->bufferStreamFilename;
+        return false;
+    }
+
+    /* All offsets in the add() functions are absolute, so the whole buffer
+       can be written out. The capacity is kept to avoid reallocations in
+       subsequent add() calls. */
+    _state->bufferOffset += _state->buffer.size();
+    arrayClear(_state->buffer);
+    return true;
+}
+
 bool GltfSceneConverter::doBeginData() {
     /* If the state is already there, it's from doBeginFile(). Otherwise create
        a new one. */
@@ -247,6 +527,24 @@ bool GltfSceneConverter::doBeginData() {
             _state->binary = configuration().value<bool>("binary");
     }
 
+    /* Image conversion threads are decided upfront as all images have to
+       either be converted right away or all queued to keep their order.
+       The hardware concurrency can be reported as 0 if not known. */
+    const Int imageConverterThreads = configuration().value<Int>("imageConverterThreads");
+    if(imageConverterThreads < 0) {
+        Error{} << "Trade::GltfSceneConverter: expected imageConverterThreads to be zero or positive but got" << imageConverterThreads;
+        /* Reset the state also if it was created by doBeginFile(), as a
+           subsequent begin would assert otherwise */
+        _state = {};
+        return {};
+    }
+    _state->imageConverterThreadCount = imageConverterThreads;
+    if(!_state->imageConverterThreadCount) {
+        _state->imageConverterThreadCount = Math::max(std::thread::hardware_concurrency(), 1u);
+        if(flags() & SceneConverterFlag::Verbose)
+            Debug{} << "Trade::GltfSceneConverter: autodetected hardware concurrency to" << _state->imageConverterThreadCount << "image converter threads";
+    }
+
     /* Text file is pretty-printed according to options. For a binary file the
        defaults are already alright.  */
     if(!_state->binary) {
@@ -273,6 +571,15 @@ bool GltfSceneConverter::doBeginData() {
 }
 
 Containers::Optional<Containers::Array<char>> GltfSceneConverter::doEndData() {
+    /* Write images that were queued for conversion on worker threads. If
+       streaming, doEndFile() did that already. */
+    if(!writeQueuedImages())
+        return {};
+
+    /* If streaming, everything is already flushed to a file by doEndFile() */
+    CORRADE_INTERNAL_ASSERT(!_state->bufferStreamFilename || _state->buffer.isEmpty());
+    const std::size_t bufferSize = _state->bufferOffset + _state->buffer.size();
+
     Utility::JsonWriter json{_state->jsonOptions, _state->jsonIndentation};
     json.beginObject();
 
@@ -330,6 +637,7 @@ Containers::Optional<Containers::Array<char>> GltfSceneConverter::doEndData() {
            the loop */
         GltfExtensions usedExtensions = _state->usedExtensions|_state->requiredExtensions;
         const Containers::Pair<GltfExtension, Containers::StringView> extensionStrings[]{
+            {GltfExtension::ExtMeshoptCompression, "EXT_meshopt_compression"_s},
             {GltfExtension::ExtTextureWebP, "EXT_texture_webp"_s},
             {GltfExtension::ExtTextureAstc, "EXT_texture_astc"_s},
             {GltfExtension::KhrMaterialsClearCoat, "KHR_materials_clearcoat"_s},
@@ -365,31 +673,49 @@ Containers::Optional<Containers::Array<char>> GltfSceneConverter::doEndData() {
 
     /* Wrap up the buffer if it's non-empty or if there are any (empty) buffer
        views referencing it */
-    if(!_state->buffer.isEmpty() || !_state->gltfBufferViews.isEmpty()) {
+    if(bufferSize || !_state->gltfBufferViews.isEmpty()) {
         json.writeKey("buffers"_s);
         const Containers::ScopeGuard gltfBuffers = json.beginArrayScope();
-        const Containers::ScopeGuard gltfBuffer = json.beginObjectScope();
-
-        /* If not writing a binary glTF and the buffer is non-empty, save the
-           buffer to an external file and reference it. In a binary glTF the
-           buffer is just one with an implicit location. */
-        if(!_state->binary && !_state->buffer.isEmpty()) {
-            if(!_state->filename) {
-                Error{} << "Trade::GltfSceneConverter::endData(): can only write a glTF with external buffers if converting to a file";
-                return {};
-            }
+        {
+            const Containers::ScopeGuard gltfBuffer = json.beginObjectScope();
+
+            /* If not writing a binary glTF and the buffer is non-empty, save
+               the buffer to an external file and reference it. In a binary
+               glTF the buffer is just one with an implicit location. */
+            if(!_state->binary && bufferSize) {
+                if(!_state->filename) {
+                    Error{} << "Trade::GltfSceneConverter::endData(): can only write a glTF with external buffers if converting to a file";
+                    return {};
+                }
+
+                /* If streaming, the data are in the file already */
+                Containers::String bufferFilename = Utility::Path::splitExtension(*_state->filename).first() + ".bin"_s;
+                if(!_state->bufferStreamFilename)
+                    Utility::Path::write(bufferFilename, _state->buffer);
+                /** @todo configurable buffer name? or a path prefix if ending
+                    with /? or an extension alone if .. what, exactly? */
 
-            Containers::String bufferFilename = Utility::Path::splitExtension(*_state->filename).first() + ".bin"_s;
-            Utility::Path::write(bufferFilename, _state->buffer);
-            /** @todo configurable buffer name? or a path prefix if ending with /?
-                or an extension alone if .. what, exactly? */
+                /* Writing just the filename as the two files are expected to
+                   be next to each other */
+                json.writeKey("uri"_s).write(Utility::Path::filename(bufferFilename));
+            }
 
-            /* Writing just the filename as the two files are expected to be
-               next to each other */
-            json.writeKey("uri"_s).write(Utility::Path::filename(bufferFilename));
+            json.writeKey("byteLength"_s).write(bufferSize);
         }
 
-        json.writeKey("byteLength"_s).write(_state->buffer.size());
+        /* If there are EXT_meshopt_compression views without an uncompressed
+           fallback, they reference a second buffer that has no data at all
+           and is only marked as a fallback. This is exactly the case when
+           the extension is required. */
+        if(_state->requiredExtensions & GltfExtension::ExtMeshoptCompression) {
+            const Containers::ScopeGuard gltfBuffer = json.beginObjectScope();
+            json.writeKey("byteLength"_s).write(_state->meshoptFallbackBufferSize)
+                .writeKey("extensions"_s).beginObject()
+                    .writeKey("EXT_meshopt_compression"_s).beginObject()
+                        .writeKey("fallback"_s).write(true)
+                    .endObject()
+                .endObject();
+        }
     }
 
     /* Buffer views, accessors, ... If there are any, the array is left open --
@@ -519,15 +845,15 @@ Containers::Optional<Containers::Array<char>> GltfSceneConverter::doEndData() {
     Containers::Array<char> out;
     if(_state->binary) {
         jsonChunkPadding = 4*((json.size() + 3)/4) - json.size();
-        binChunkPadding = 4*((_state->buffer.size() + 3)/4) - _state->buffer.size();
+        binChunkPadding = 4*((bufferSize + 3)/4) - bufferSize;
         CORRADE_INTERNAL_ASSERT(jsonChunkPadding <= 3 && binChunkPadding <= 3);
 
         const std::size_t totalSize = 12 + /* file header */
             /* JSON chunk + header + padding */
             8 + json.size() + jsonChunkPadding +
             /* BIN chunk + header + padding */
-            (_state->buffer.isEmpty() ? 0 :
-                8 + _state->buffer.size() + binChunkPadding);
+            (!bufferSize ? 0 :
+                8 + bufferSize + binChunkPadding);
         Containers::arrayReserve<ArrayAllocator>(out, totalSize);
 
         /* glTF header */
@@ -564,16 +890,20 @@ Containers::Optional<Containers::Array<char>> GltfSceneConverter::doEndData() {
             i = ' ';
 
         /* Add the buffer as a second BIN chunk. The size includes padding
-           again, this time the padding has to be zeros. */
-        if(!_state->buffer.isEmpty()) {
+           again, this time the padding has to be zeros. If streaming, only
+           the chunk header is written here and doEndFile() appends the data
+           and the padding after. */
+        if(bufferSize) {
             Containers::arrayAppend<ArrayAllocator>(out,
-                CharCaster{UnsignedInt(_state->buffer.size() + binChunkPadding)}.data);
+                CharCaster{UnsignedInt(bufferSize + binChunkPadding)}.data);
             Containers::arrayAppend<ArrayAllocator>(out,
                 "BIN\0"_s);
-            Containers::arrayAppend<ArrayAllocator>(out,
-                _state->buffer);
-            for(char& i: Containers::arrayAppend<ArrayAllocator>(out, NoInit, binChunkPadding))
-                i = '\0';
+            if(!_state->bufferStreamFilename) {
+                Containers::arrayAppend<ArrayAllocator>(out,
+                    _state->buffer);
+                for(char& i: Containers::arrayAppend<ArrayAllocator>(out, NoInit, binChunkPadding))
+                    i = '\0';
+            }
         }
     }
 
@@ -581,7 +911,66 @@ Containers::Optional<Containers::Array<char>> GltfSceneConverter::doEndData() {
     return Containers::optional(Utility::move(out));
 }
 
+bool GltfSceneConverter::doEndFile(const Containers::StringView filename) {
+    /* If not streaming, the default implementation delegates to doEndData()
+       and saves its output */
+    if(!_state->bufferStreamFilename)
+        return AbstractSceneConverter::doEndFile(filename);
+
+    /* Queued images get appended to the buffer as well, so they need to be
+       written before the final flush */
+    if(!writeQueuedImages() || !flushBuffer())
+        return false;
+
+    const Containers::Optional<Containers::Array<char>> out = doEndData();
+    if(!out)
+        return false;
+
+    if(!Utility::Path::write(filename, *out)) {
+        Error{} << "Trade::GltfSceneConverter::endFile(): can't write to file" << filename;
+        return false;
+    }
+
+    /* For a binary glTF splice the streamed data into the BIN chunk, with the
+       chunk header already written by doEndData(). Memory-mapping the file
+       where possible to not need the whole buffer in memory again. */
+    if(_state->binary && _state->bufferOffset) {
+        {
+            #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+            const Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> data = Utility::Path::mapRead(_state->bufferStreamFilename);
+            #else
+            const Containers::Optional<Containers::Array<char>> data = Utility::Path::read(_state->bufferStreamFilename);
+            #endif
+            if(!data || !Utility::Path::append(filename, *data)) {
+                Error{} << "Trade::GltfSceneConverter::endFile(): can't append buffer data from" << _state->bufferStreamFilename << "to" << filename;
+                return false;
+            }
+        }
+
+        const std::size_t binChunkPadding = 4*((_state->bufferOffset + 3)/4) - _state->bufferOffset;
+        if(!Utility::Path::append(filename, "\0\0\0"_s.prefix(binChunkPadding))) {
+            Error{} << "Trade::GltfSceneConverter::endFile(): can't write to file" << filename;
+            return false;
+        }
+
+        Utility::Path::remove(_state->bufferStreamFilename);
+    }
+
+    /* The streamed file is complete now, make sure doAbort() doesn't touch it
+       anymore */
+    _state->bufferStreamFilename = {};
+
+    return true;
+}
+
 void GltfSceneConverter::doAbort() {
+    /* Remove the file the buffer was streamed to, if the conversion didn't
+       get to finishing it -- a temporary file for a binary glTF, or a
+       partially written external buffer for a text glTF. If nothing was
+       flushed yet, the file wasn't created by us, so leave it alone. */
+    if(_state && _state->bufferStreamFilename && _state->bufferOffset && Utility::Path::exists(_state->bufferStreamFilename))
+        Utility::Path::remove(_state->bufferStreamFilename);
+
     _state = {};
 }
 
@@ -1811,10 +2200,14 @@ bool GltfSceneConverter::doAdd(const UnsignedInt id, const MeshData& mesh, const
     /* Buffer view indices assigned to particular attributes, pointing to
        `bufferViews` above. */
     Containers::ArrayView<UnsignedInt> bufferViewAssignments;
+    /* Output glTF buffer view indices corresponding to `bufferViews`. These
+       are consecutive unless some views got deduplicated. */
+    Containers::ArrayView<UnsignedInt> gltfBufferViewIndices;
     Containers::ArrayTuple bufferViewAssignmentStorage{
         {NoInit, mesh.attributeCount(), attributesSortedByOffset},
         {NoInit, mesh.attributeCount(), bufferViews},
         {NoInit, mesh.attributeCount(), bufferViewAssignments},
+        {NoInit, mesh.attributeCount(), gltfBufferViewIndices},
     };
 
     /* Sort attributes by their offset to group them into (strided) buffer
@@ -1888,6 +2281,12 @@ bool GltfSceneConverter::doAdd(const UnsignedInt id, const MeshData& mesh, const
         }
     }
 
+    /* Bundled images queued for conversion on worker threads would otherwise
+       get their data and buffer views only after this mesh, making the
+       layout differ from a serial conversion. Write them first. */
+    if(_state->imageConversionPool && _state->imageConversionPoolHasBundledImages && !writeQueuedImages())
+        return {};
+
     /* At this point we're sure nothing will fail so we can start writing the
        JSON. Otherwise we'd end up with a partly-written JSON in case of an
        unsupported mesh, corruputing the output. */
@@ -1901,22 +2300,62 @@ bool GltfSceneConverter::doAdd(const UnsignedInt id, const MeshData& mesh, const
             _state->gltfAccessors.beginArray();
     }
 
+    /* With EXT_meshopt_compression, compressed index and vertex data get
+       put into the buffer and referenced from the extension object in each
+       buffer view. The uncompressed data either stay in the buffer as a
+       fallback, or they go only to a temporary array with the views
+       referencing a placeholder buffer of the same size that's never written
+       anywhere. Views that can't be compressed always have their data in the
+       buffer. */
+    const bool meshoptCompression = configuration().value<bool>("meshoptCompression");
+    const bool meshoptCompressionFallback = configuration().value<bool>("meshoptCompressionFallback");
+    Containers::Array<char> meshoptPlaceholderData;
+    bool meshoptUsed = false, meshoptRequired = false;
+
+    /* Buffer views compressed with EXT_meshopt_compression aren't
+       deduplicated, as their data may not even be in the buffer */
+    const bool deduplicate = configuration().value<bool>("deduplicate") && !meshoptCompression;
+
+    /* Returns an index of an already written buffer view with the same key
+       and the same contents as `data`, or -1 if there's none. If the earlier
+       data were already streamed to a file, they can't be compared and only
+       the SHA-1 digest in the key is relied on. */
+    const auto findDuplicateBufferView = [&](const Containers::String& key, const Containers::ArrayView<const char> data) -> Int {
+        const auto found = _state->deduplicatedBufferViews.find(key);
+        if(found == _state->deduplicatedBufferViews.end())
+            return -1;
+        const std::size_t offset = found->second.second();
+        if(offset >= _state->bufferOffset && Containers::StringView{_state->buffer.sliceSize(offset - _state->bufferOffset, data.size())} != Containers::StringView{data})
+            return -1;
+        return found->second.first();
+    };
+
     CORRADE_INTERNAL_ASSERT(_state->meshes.size() == id);
     MeshProperties& meshProperties = arrayAppend(_state->meshes, InPlaceInit);
     {
         /* Index view and accessor if the mesh is indexed */
         if(mesh.isIndexed()) {
+            const std::size_t indexTypeSize = meshIndexTypeSize(mesh.indexType());
+
+            /* The meshopt index codecs support only 16- and 32-bit indices,
+               8-bit indices are left uncompressed */
+            const bool meshoptIndices = meshoptCompression && indexTypeSize != 1;
+            const bool meshoptIndicesPlaceholder = meshoptIndices && !meshoptCompressionFallback;
+            Containers::Array<char>& indexBuffer = meshoptIndicesPlaceholder ? meshoptPlaceholderData : _state->buffer;
+            const std::size_t indexBufferOffset = meshoptIndicesPlaceholder ? _state->meshoptFallbackBufferSize : _state->bufferOffset;
+            const std::size_t indexBufferSizeBefore = indexBuffer.size();
+
             /* § 3.6.2.4 requires that "the offset of an accessor [...] MUST be
                a multiple of the size of the accessor’s component type". The
                byteOffset could be something else for example if there's
                (unaligned) image data preceding it. */
             {
-                const std::size_t indexTypeSize = meshIndexTypeSize(mesh.indexType());
-                const std::size_t padding = indexTypeSize*((_state->buffer.size() + indexTypeSize - 1)/indexTypeSize) - _state->buffer.size();
+                const std::size_t size = indexBufferOffset + indexBuffer.size();
+                const std::size_t padding = indexTypeSize*((size + indexTypeSize - 1)/indexTypeSize) - size;
                 CORRADE_INTERNAL_ASSERT(padding <= 3);
                 /** @todo any better API for this? Utility::fill()? this is
                     silly */
-                for(char& i: arrayAppend(_state->buffer, NoInit, padding))
+                for(char& i: arrayAppend(indexBuffer, NoInit, padding))
                     i = '\0';
             }
 
@@ -1924,37 +2363,126 @@ bool GltfSceneConverter::doAdd(const UnsignedInt id, const MeshData& mesh, const
                padding before and after */
             /** @todo or put the whole thing there, consistently with
                 vertexData()? */
-            const Containers::ArrayView<char> indexData = arrayAppend(_state->buffer, mesh.indices().asContiguous());
+            const Containers::ArrayView<char> indexData = arrayAppend(indexBuffer, mesh.indices().asContiguous());
+
+            /* If the same index data were written already, drop what was just
+               appended, including the padding, and reference the earlier
+               view instead */
+            Containers::String gltfBufferViewKey;
+            Int duplicateBufferView = -1;
+            if(deduplicate) {
+                gltfBufferViewKey = Utility::format("{}:0:{}:{}",
+                    Implementation::GltfTargetHintElementArray,
+                    indexData.size(),
+                    dataHash(indexData));
+                duplicateBufferView = findDuplicateBufferView(gltfBufferViewKey, indexData);
+            }
 
-            const std::size_t gltfBufferViewIndex = _state->gltfBufferViews.currentArraySize();
-            const Containers::ScopeGuard gltfBufferView = _state->gltfBufferViews.beginObjectScope();
-            _state->gltfBufferViews
-                .writeKey("buffer"_s).write(0)
-                /** @todo could be omitted if zero, is that useful for anything? */
-                .writeKey("byteOffset"_s).write(indexData - _state->buffer)
-                .writeKey("byteLength"_s).write(indexData.size())
-                .writeKey("target"_s).write(Implementation::GltfTargetHintElementArray);
-            if(configuration().value<bool>("accessorNames"))
-                _state->gltfBufferViews.writeKey("name"_s).write(Utility::format(
-                    name ? "mesh {0} ({1}) indices" : "mesh {0} indices",
-                    id, name));
+            std::size_t gltfBufferViewIndex;
+            if(duplicateBufferView != -1) {
+                arrayRemoveSuffix(indexBuffer, indexBuffer.size() - indexBufferSizeBefore);
+                gltfBufferViewIndex = duplicateBufferView;
+            } else {
+                if(deduplicate)
+                    _state->deduplicatedBufferViews.emplace(Utility::move(gltfBufferViewKey), Containers::pair(UnsignedInt(_state->gltfBufferViews.currentArraySize()), indexBufferOffset + (indexData - indexBuffer)));
+
+                gltfBufferViewIndex = _state->gltfBufferViews.currentArraySize();
+                const Containers::ScopeGuard gltfBufferView = _state->gltfBufferViews.beginObjectScope();
+                _state->gltfBufferViews
+                    .writeKey("buffer"_s).write(meshoptIndicesPlaceholder ? 1 : 0)
+                    /** @todo could be omitted if zero, is that useful for anything? */
+                    .writeKey("byteOffset"_s).write(indexBufferOffset + (indexData - indexBuffer))
+                    .writeKey("byteLength"_s).write(indexData.size())
+                    .writeKey("target"_s).write(Implementation::GltfTargetHintElementArray);
+                if(configuration().value<bool>("accessorNames"))
+                    _state->gltfBufferViews.writeKey("name"_s).write(Utility::format(
+                        name ? "mesh {0} ({1}) indices" : "mesh {0} indices",
+                        id, name));
+
+                /* Triangle lists use the dedicated codec, everything else the
+                   generic one. The index data view is potentially invalidated
+                   by the buffer growing from here on. */
+                if(meshoptIndices) {
+                    const bool triangles = mesh.primitive() == MeshPrimitive::Triangles && mesh.indexCount() % 3 == 0;
+
+                    /* Compressed data don't have any alignment requirements
+                       but keeping them four-byte aligned doesn't hurt */
+                    {
+                        const std::size_t size = _state->bufferOffset + _state->buffer.size();
+                        for(char& i: arrayAppend(_state->buffer, NoInit, 4*((size + 3)/4) - size))
+                            i = '\0';
+                    }
+                    const std::size_t compressedOffset = _state->buffer.size();
+                    const Containers::Array<UnsignedInt> indices = mesh.indicesAsArray();
+                    if(triangles)
+                        encodeMeshoptTriangles(indices, _state->buffer);
+                    else
+                        encodeMeshoptIndices(indices, _state->buffer);
+
+                    _state->gltfBufferViews.writeKey("extensions"_s).beginObject()
+                        .writeKey("EXT_meshopt_compression"_s).beginObject()
+                            .writeKey("buffer"_s).write(0)
+                            .writeKey("byteOffset"_s).write(_state->bufferOffset + compressedOffset)
+                            .writeKey("byteLength"_s).write(_state->buffer.size() - compressedOffset)
+                            .writeKey("byteStride"_s).write(indexTypeSize)
+                            .writeKey("count"_s).write(mesh.indexCount())
+                            .writeKey("mode"_s).write(triangles ? "TRIANGLES"_s : "INDICES"_s)
+                        .endObject()
+                    .endObject();
+
+                    meshoptUsed = true;
+                    meshoptRequired = meshoptRequired || meshoptIndicesPlaceholder;
+                }
+            }
 
-            const std::size_t gltfAccessorIndex = _state->gltfAccessors.currentArraySize();
-            const Containers::ScopeGuard gltfAccessor = _state->gltfAccessors.beginObjectScope();
-            _state->gltfAccessors
-                .writeKey("bufferView"_s).write(gltfBufferViewIndex)
-                /* bufferOffset is implicitly 0 */
-                .writeKey("componentType"_s).write(gltfIndexType)
-                .writeKey("count"_s).write(mesh.indexCount())
-                .writeKey("type"_s).write("SCALAR"_s);
-            if(configuration().value<bool>("accessorNames"))
-                _state->gltfAccessors.writeKey("name"_s).write(Utility::format(
-                    name ? "mesh {0} ({1}) indices" : "mesh {0} indices",
-                    id, name));
+            /* The key includes the buffer view index, so an accessor can be
+               found only if the view was deduplicated as well */
+            Containers::String gltfAccessorKey;
+            if(deduplicate) {
+                gltfAccessorKey = Utility::format("{}:0:{}:false:{}:SCALAR",
+                    gltfBufferViewIndex,
+                    gltfIndexType,
+                    mesh.indexCount());
+                const auto found = _state->deduplicatedAccessors.find(gltfAccessorKey);
+                if(found != _state->deduplicatedAccessors.end())
+                    meshProperties.gltfIndices = found->second;
+            }
 
-            meshProperties.gltfIndices = gltfAccessorIndex;
+            if(!meshProperties.gltfIndices) {
+                const std::size_t gltfAccessorIndex = _state->gltfAccessors.currentArraySize();
+                const Containers::ScopeGuard gltfAccessor = _state->gltfAccessors.beginObjectScope();
+                _state->gltfAccessors
+                    .writeKey("bufferView"_s).write(gltfBufferViewIndex)
+                    /* bufferOffset is implicitly 0 */
+                    .writeKey("componentType"_s).write(gltfIndexType)
+                    .writeKey("count"_s).write(mesh.indexCount())
+                    .writeKey("type"_s).write("SCALAR"_s);
+                if(configuration().value<bool>("accessorNames"))
+                    _state->gltfAccessors.writeKey("name"_s).write(Utility::format(
+                        name ? "mesh {0} ({1}) indices" : "mesh {0} indices",
+                        id, name));
+
+                if(deduplicate)
+                    _state->deduplicatedAccessors.emplace(Utility::move(gltfAccessorKey), UnsignedInt(gltfAccessorIndex));
+
+                meshProperties.gltfIndices = gltfAccessorIndex;
+            }
         }
 
+        /* The meshopt attribute codec supports only strides that are a
+           multiple of four and at most 256 bytes. The vertex data go to the
+           placeholder buffer only if all views can be compressed. */
+        const auto meshoptCompressibleStride = [](std::size_t stride) {
+            return stride % 4 == 0 && stride <= 256;
+        };
+        bool meshoptVerticesPlaceholder = meshoptCompression && !meshoptCompressionFallback && bufferViewOffset;
+        for(const Containers::Pair<std::size_t, std::size_t> bufferView: bufferViews.prefix(bufferViewOffset))
+            if(!meshoptCompressibleStride(bufferView.second()))
+                meshoptVerticesPlaceholder = false;
+        Containers::Array<char>& vertexBuffer = meshoptVerticesPlaceholder ? meshoptPlaceholderData : _state->buffer;
+        const std::size_t vertexBufferOffset = meshoptVerticesPlaceholder ? _state->meshoptFallbackBufferSize : _state->bufferOffset;
+        const std::size_t vertexBufferSizeBefore = vertexBuffer.size();
+
         /* § 3.6.2.4 requires that "For performance and compatibility reasons,
            [...] accessor.byteOffset and bufferView.byteStride MUST be
            multiples of 4". The byteOffset could be something else for example
@@ -1962,40 +2490,93 @@ bool GltfSceneConverter::doAdd(const UnsignedInt id, const MeshData& mesh, const
            8- or 16-bit indices. Pad the buffer appropriately. */
         /** @todo enforce also 4-byte-aligned stride */
         {
-            const std::size_t padding = 4*((_state->buffer.size() + 3)/4) - _state->buffer.size();
+            const std::size_t size = vertexBufferOffset + vertexBuffer.size();
+            const std::size_t padding = 4*((size + 3)/4) - size;
             CORRADE_INTERNAL_ASSERT(padding <= 3);
             /** @todo any better API for this? Utility::fill()? this is silly */
-            for(char& i: arrayAppend(_state->buffer, NoInit, padding))
+            for(char& i: arrayAppend(vertexBuffer, NoInit, padding))
                 i = '\0';
         }
 
         /* Vertex data, plus any padding after. The view needs to include also
            the padding so it can get sliced to strided views without asserts. */
-        Containers::ArrayView<char> vertexData = arrayAppend(_state->buffer, NoInit, mesh.vertexData().size() + vertexBufferPadding);
+        Containers::ArrayView<char> vertexData = arrayAppend(vertexBuffer, NoInit, mesh.vertexData().size() + vertexBufferPadding);
         Utility::copy(mesh.vertexData(), vertexData.prefix(mesh.vertexData().size()));
         /** @todo any better API for this? Utility::fill()? this is silly */
         for(char& i: vertexData.exceptPrefix(mesh.vertexData().size()))
             i = '\0';
+        const std::size_t vertexDataOffset = vertexBufferOffset + (vertexData - vertexBuffer);
 
-        /* Remember the base buffer view index to which `bufferViewAssignments`
-           are relative to. If there are no buffer views, the buffer view
-           array might not even be opened yet. There are also no attributes in
-           that case, thus use a deliberately wrong value to catch accidental
-           access. */
-        const std::size_t gltfBaseBufferViewIndex = bufferViewOffset ?
-            _state->gltfBufferViews.currentArraySize() : ~std::size_t{};
+        /* Flip texture coordinates unless they're meant to be flipped in the
+           material. Done before writing the buffer views as the compressed
+           data need to contain the flipped coordinates as well. */
+        if(!configuration().value<bool>("textureCoordinateYFlipInMaterial")) for(const GltfAttribute& gltfAttribute: gltfAttributes) {
+            if(mesh.attributeName(gltfAttribute.originalId) != MeshAttribute::TextureCoordinates)
+                continue;
 
-        /* Write buffer views (minOffset, maxOffset, stride) */
-        for(const Containers::Pair<std::size_t, std::size_t> bufferView: bufferViews.prefix(bufferViewOffset)) {
+            const VertexFormat format = mesh.attributeFormat(gltfAttribute.originalId);
+            CORRADE_INTERNAL_ASSERT(gltfAttribute.offset == 0);
+            Containers::StridedArrayView1D<char> data{vertexData,
+                vertexData + mesh.attributeOffset(gltfAttribute.originalId),
+                mesh.vertexCount(), mesh.attributeStride(gltfAttribute.originalId)};
+            if(format == VertexFormat::Vector2)
+                for(auto& c: Containers::arrayCast<Vector2>(data))
+                    c.y() = 1.0f - c.y();
+            else if(format == VertexFormat::Vector2ubNormalized)
+                for(auto& c: Containers::arrayCast<Vector2ub>(data))
+                    c.y() = 255 - c.y();
+            else if(format == VertexFormat::Vector2usNormalized)
+                for(auto& c: Containers::arrayCast<Vector2us>(data))
+                    c.y() = 65535 - c.y();
+            /* Other formats are not possible to flip, and thus have to be
+               flipped in the material instead. This was already checked at
+               the top, failing if textureCoordinateYFlipInMaterial isn't set
+               for those formats, so it should never get here. */
+            else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+        }
+
+        /* Compressed vertex data get collected here and appended to the
+           buffer only after all views are written, as the buffer growing
+           would invalidate the vertexData view if both are the same */
+        Containers::Array<char> meshoptVertexData;
+        const std::size_t meshoptVertexDataOffset = 4*((_state->bufferOffset + _state->buffer.size() + 3)/4);
+
+        /* Write buffer views (minOffset, maxOffset, stride). If the same view
+           with the same contents was written already, reference it instead.
+           The vertex data are dropped from the buffer only if all views were
+           found, as otherwise they're still referenced. */
+        std::size_t duplicateBufferViewCount = 0;
+        for(std::size_t i = 0; i != bufferViewOffset; ++i) {
+            const Containers::Pair<std::size_t, std::size_t> bufferView = bufferViews[i];
+
+            Containers::String gltfBufferViewKey;
+            if(deduplicate) {
+                const Containers::ArrayView<const char> data = vertexData.sliceSize(bufferView.first(), mesh.vertexCount()*bufferView.second());
+                gltfBufferViewKey = Utility::format("{}:{}:{}:{}",
+                    Implementation::GltfTargetHintArray,
+                    bufferView.second(),
+                    data.size(),
+                    dataHash(data));
+                const Int duplicateBufferView = findDuplicateBufferView(gltfBufferViewKey, data);
+                if(duplicateBufferView != -1) {
+                    gltfBufferViewIndices[i] = duplicateBufferView;
+                    ++duplicateBufferViewCount;
+                    continue;
+                }
+
+                _state->deduplicatedBufferViews.emplace(Utility::move(gltfBufferViewKey), Containers::pair(UnsignedInt(_state->gltfBufferViews.currentArraySize()), vertexDataOffset + bufferView.first()));
+            }
+
+            gltfBufferViewIndices[i] = _state->gltfBufferViews.currentArraySize();
             const Containers::ScopeGuard gltfBufferView = _state->gltfBufferViews.beginObjectScope();
 
             _state->gltfBufferViews
-                .writeKey("buffer"_s).write(0)
+                .writeKey("buffer"_s).write(meshoptVerticesPlaceholder ? 1 : 0)
                 /* Byte offset could be omitted if zero but since that
                    happens only for the very first view in a buffer and we
                    have always at most one buffer, the minimal savings are
                    not worth the inconsistency */
-                .writeKey("byteOffset"_s).write(vertexData - _state->buffer + bufferView.first())
+                .writeKey("byteOffset"_s).write(vertexDataOffset + bufferView.first())
                 .writeKey("byteLength"_s).write(mesh.vertexCount()*bufferView.second())
                 /* Byte stride could be omitted if there would be just one
                    tightly packed accessor (in which case it'd be implicitly
@@ -2022,6 +2603,81 @@ bool GltfSceneConverter::doAdd(const UnsignedInt id, const MeshData& mesh, const
                 _state->gltfBufferViews.writeKey("name"_s).write(Utility::format(
                     name ? "mesh {0} ({1}) vertices" : "mesh {0} vertices",
                     id, name));
+
+            if(!meshoptCompression || !meshoptCompressibleStride(bufferView.second()))
+                continue;
+
+            Containers::ArrayView<const char> uncompressed = vertexData.sliceSize(bufferView.first(), mesh.vertexCount()*bufferView.second());
+
+            /* If the view contains just a single normal or four-component
+               tangent in an 8- or 16-bit normalized format, the octahedral
+               filter can be used. It's lossy, so it's applied on a copy to
+               keep the fallback data unchanged. */
+            Containers::StringView meshoptFilter;
+            Containers::Array<char> filtered;
+            if(configuration().value<bool>("meshoptCompressionFilters")) {
+                UnsignedInt attributeCount = 0;
+                UnsignedInt attributeId{};
+                for(UnsignedInt j = 0; j != mesh.attributeCount(); ++j) {
+                    if(bufferViewAssignments[j] != i)
+                        continue;
+                    ++attributeCount;
+                    attributeId = j;
+                }
+
+                const MeshAttribute attributeName = mesh.attributeName(attributeId);
+                const VertexFormat format = mesh.attributeFormat(attributeId);
+                if(attributeCount == 1 &&
+                   mesh.attributeOffset(attributeId) == bufferView.first() &&
+                   (attributeName == MeshAttribute::Normal ||
+                    attributeName == MeshAttribute::Tangent))
+                {
+                    if(bufferView.second() == 4 &&
+                       (format == VertexFormat::Vector3bNormalized ||
+                        format == VertexFormat::Vector4bNormalized))
+                    {
+                        filtered = Containers::Array<char>{NoInit, uncompressed.size()};
+                        Utility::copy(uncompressed, filtered);
+                        encodeMeshoptFilterOctahedral<Byte>(filtered);
+                        meshoptFilter = "OCTAHEDRAL"_s;
+                    } else if(bufferView.second() == 8 &&
+                       (format == VertexFormat::Vector3sNormalized ||
+                        format == VertexFormat::Vector4sNormalized))
+                    {
+                        filtered = Containers::Array<char>{NoInit, uncompressed.size()};
+                        Utility::copy(uncompressed, filtered);
+                        encodeMeshoptFilterOctahedral<Short>(filtered);
+                        meshoptFilter = "OCTAHEDRAL"_s;
+                    }
+                }
+
+                if(meshoptFilter)
+                    uncompressed = filtered;
+            }
+
+            /* Compressed data don't have any alignment requirements but
+               keeping them four-byte aligned doesn't hurt */
+            for(char& j: arrayAppend(meshoptVertexData, NoInit, 4*((meshoptVertexData.size() + 3)/4) - meshoptVertexData.size()))
+                j = '\0';
+            const std::size_t compressedOffset = meshoptVertexData.size();
+            encodeMeshoptAttributes(uncompressed, mesh.vertexCount(), bufferView.second(), meshoptVertexData);
+
+            _state->gltfBufferViews.writeKey("extensions"_s).beginObject()
+                .writeKey("EXT_meshopt_compression"_s).beginObject()
+                    .writeKey("buffer"_s).write(0)
+                    .writeKey("byteOffset"_s).write(meshoptVertexDataOffset + compressedOffset)
+                    .writeKey("byteLength"_s).write(meshoptVertexData.size() - compressedOffset)
+                    .writeKey("byteStride"_s).write(bufferView.second())
+                    .writeKey("count"_s).write(mesh.vertexCount())
+                    .writeKey("mode"_s).write("ATTRIBUTES"_s);
+            if(meshoptFilter)
+                _state->gltfBufferViews.writeKey("filter"_s).write(meshoptFilter);
+            _state->gltfBufferViews
+                    .endObject()
+                .endObject();
+
+            meshoptUsed = true;
+            meshoptRequired = meshoptRequired || meshoptVerticesPlaceholder;
         }
 
         /* Attribute views and accessors */
@@ -2029,36 +2685,36 @@ bool GltfSceneConverter::doAdd(const UnsignedInt id, const MeshData& mesh, const
             const MeshAttribute attributeName = mesh.attributeName(gltfAttribute.originalId);
             const VertexFormat format = mesh.attributeFormat(gltfAttribute.originalId);
 
-            /* Flip texture coordinates unless they're meant to be flipped in
-               the material */
-            if(attributeName == MeshAttribute::TextureCoordinates && !configuration().value<bool>("textureCoordinateYFlipInMaterial")) {
-                CORRADE_INTERNAL_ASSERT(gltfAttribute.offset == 0);
-                Containers::StridedArrayView1D<char> data{vertexData,
-                    vertexData + mesh.attributeOffset(gltfAttribute.originalId),
-                    mesh.vertexCount(), mesh.attributeStride(gltfAttribute.originalId)};
-                if(format == VertexFormat::Vector2)
-                    for(auto& c: Containers::arrayCast<Vector2>(data))
-                        c.y() = 1.0f - c.y();
-                else if(format == VertexFormat::Vector2ubNormalized)
-                    for(auto& c: Containers::arrayCast<Vector2ub>(data))
-                        c.y() = 255 - c.y();
-                else if(format == VertexFormat::Vector2usNormalized)
-                    for(auto& c: Containers::arrayCast<Vector2us>(data))
-                        c.y() = 65535 - c.y();
-                /* Other formats are not possible to flip, and thus have to be
-                   flipped in the material instead. This was already checked
-                   at the top, failing if textureCoordinateYFlipInMaterial
-                   isn't set for those formats, so it should never get here. */
-                else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+            const UnsignedInt gltfBufferViewIndex = gltfBufferViewIndices[bufferViewAssignments[gltfAttribute.originalId]];
+            const std::size_t gltfByteOffset = mesh.attributeOffset(gltfAttribute.originalId) + gltfAttribute.offset - bufferViews[bufferViewAssignments[gltfAttribute.originalId]].first();
+
+            /* The key includes the buffer view index, so an accessor can be
+               found only if the view was deduplicated as well. POSITION
+               bounds are calculated from the data so they don't need to be
+               a part of the key. */
+            Containers::String gltfAccessorKey;
+            if(deduplicate) {
+                gltfAccessorKey = Utility::format("{}:{}:{}:{}:{}:{}",
+                    gltfBufferViewIndex,
+                    gltfByteOffset,
+                    gltfAttribute.accessorComponentType,
+                    isVertexFormatNormalized(format),
+                    mesh.vertexCount(),
+                    gltfAttribute.accessorType);
+                const auto found = _state->deduplicatedAccessors.find(gltfAccessorKey);
+                if(found != _state->deduplicatedAccessors.end()) {
+                    arrayAppend(meshProperties.gltfAttributes, InPlaceInit, gltfAttribute.name, found->second);
+                    continue;
+                }
             }
 
             const UnsignedInt gltfAccessorIndex = _state->gltfAccessors.currentArraySize();
             const Containers::ScopeGuard gltfAccessor = _state->gltfAccessors.beginObjectScope();
             _state->gltfAccessors
-                .writeKey("bufferView"_s).write(gltfBaseBufferViewIndex + bufferViewAssignments[gltfAttribute.originalId]);
+                .writeKey("bufferView"_s).write(gltfBufferViewIndex);
             /* Write byteOffset only if non-zero. Compared to byteStride in the
                buffer view above, this is easy to do, so why not. */
-            if(const std::size_t gltfByteOffset = mesh.attributeOffset(gltfAttribute.originalId) + gltfAttribute.offset - bufferViews[bufferViewAssignments[gltfAttribute.originalId]].first())
+            if(gltfByteOffset)
                 _state->gltfAccessors.writeKey("byteOffset"_s).write(gltfByteOffset);
             _state->gltfAccessors
                 .writeKey("componentType"_s).write(gltfAttribute.accessorComponentType);
@@ -2116,9 +2772,25 @@ bool GltfSceneConverter::doAdd(const UnsignedInt id, const MeshData& mesh, const
                     name ? "mesh {0} ({1}) {2}" : "mesh {0} {2}",
                     id, name, gltfAttribute.name));
 
+            if(deduplicate)
+                _state->deduplicatedAccessors.emplace(Utility::move(gltfAccessorKey), gltfAccessorIndex);
+
             arrayAppend(meshProperties.gltfAttributes, InPlaceInit, gltfAttribute.name, gltfAccessorIndex);
         }
 
+        /* If all vertex buffer views were deduplicated, nothing references
+           the vertex data anymore. Drop them, including the padding before. */
+        if(bufferViewOffset && duplicateBufferViewCount == bufferViewOffset)
+            arrayRemoveSuffix(vertexBuffer, vertexBuffer.size() - vertexBufferSizeBefore);
+
+        /* Put the compressed vertex data to the buffer, the vertexData view
+           isn't used anymore so it's fine if it gets invalidated */
+        if(!meshoptVertexData.isEmpty()) {
+            for(char& i: arrayAppend(_state->buffer, NoInit, meshoptVertexDataOffset - _state->bufferOffset - _state->buffer.size()))
+                i = '\0';
+            arrayAppend(_state->buffer, meshoptVertexData);
+        }
+
         /* Triangles are a default */
         if(gltfMode != 4)
             meshProperties.gltfMode = gltfMode;
@@ -2127,7 +2799,17 @@ bool GltfSceneConverter::doAdd(const UnsignedInt id, const MeshData& mesh, const
     if(name)
         meshProperties.gltfName = name;
 
-    return true;
+    /* The extension is required if any view references the placeholder
+       buffer, otherwise it's only used. Required takes precedence if
+       different meshes were added with different options. */
+    _state->meshoptFallbackBufferSize += meshoptPlaceholderData.size();
+    if(meshoptRequired) {
+        _state->requiredExtensions |= GltfExtension::ExtMeshoptCompression;
+        _state->usedExtensions &= ~GltfExtension::ExtMeshoptCompression;
+    } else if(meshoptUsed && !(_state->requiredExtensions & GltfExtension::ExtMeshoptCompression))
+        _state->usedExtensions |= GltfExtension::ExtMeshoptCompression;
+
+    return flushBuffer();
 }
 
 namespace {
@@ -3266,6 +3948,7 @@ bool GltfSceneConverter::doAdd(CORRADE_UNUSED const UnsignedInt id, const Textur
                     textureExtensionString = "KHR_texture_ktx"_s;
                     break;
                 /* LCOV_EXCL_START */
+                case GltfExtension::ExtMeshoptCompression:
                 case GltfExtension::KhrMaterialsUnlit:
                 case GltfExtension::KhrMaterialsClearCoat:
                 case GltfExtension::KhrMeshQuantization:
@@ -3343,23 +4026,14 @@ Containers::Pointer<AbstractImageConverter> loadAndInstantiateImageConverter(Plu
 
 }
 
-template<UnsignedInt dimensions> bool GltfSceneConverter::convertAndWriteImage(const UnsignedInt id, const Containers::StringView name, AbstractImageConverter& imageConverter, const ImageData<dimensions>& image, bool bundleImages) {
-    /* Only one of these two is filled */
-    Containers::ArrayView<char> imageData;
+template<UnsignedInt dimensions> bool GltfSceneConverter::convertAndWriteImage(const UnsignedInt id, const Containers::StringView name, Containers::Pointer<AbstractImageConverter>&& imageConverter, const ImageData<dimensions>& image, bool bundleImages) {
+    /* External images need a filename to be written to */
     Containers::String imageFilename;
-    if(bundleImages) {
-        const Containers::Optional<Containers::Array<char>> out = imageConverter.convertToData(image);
-        if(!out) {
-            Error{} << "Trade::GltfSceneConverter::add(): can't convert an image";
-            return {};
-        }
-
-        imageData = arrayAppend(_state->buffer, *out);
-    } else {
+    if(!bundleImages) {
         /* All existing image converters that return a MIME type return an
            extension as well, so we can (currently) get away with an assert.
            Might need to be revisited eventually. */
-        const Containers::String extension = imageConverter.extension();
+        const Containers::String extension = imageConverter->extension();
         CORRADE_INTERNAL_ASSERT(extension);
 
         if(!_state->filename) {
@@ -3371,13 +4045,46 @@ template<UnsignedInt dimensions> bool GltfSceneConverter::convertAndWriteImage(c
             Utility::Path::splitExtension(*_state->filename).first(),
             id,
             extension);
+    }
+
+    /* If converting on worker threads, queue a copy of the image, waiting
+       until there's space in the queue. The result gets written in
+       writeQueuedImages(), any conversion failure is thus reported only from
+       endData() / endFile(). */
+    if(_state->imageConverterThreadCount != 1) {
+        if(!_state->imageConversionPool)
+            _state->imageConversionPool.emplace(_state->imageConverterThreadCount);
+
+        Containers::Pointer<QueuedImage> queued{InPlaceInit};
+        queued->id = id;
+        queued->name = name;
+        queued->mimeType = imageConverter->mimeType();
+        queued->filename = Utility::move(imageFilename);
+        queued->accessorNames = configuration().value<bool>("accessorNames");
+        queued->imageConverter = Utility::move(imageConverter);
+        _state->imageConversionPool->queue(Utility::move(queued), image);
+        if(bundleImages)
+            _state->imageConversionPoolHasBundledImages = true;
+        return true;
+    }
 
-        if(!imageConverter.convertToFile(image, imageFilename)) {
-            Error{} << "Trade::GltfSceneConverter::add(): can't convert an image file";
+    /* Otherwise convert right away */
+    Containers::Optional<Containers::Array<char>> out;
+    if(bundleImages) {
+        out = imageConverter->convertToData(image);
+        if(!out) {
+            Error{} << "Trade::GltfSceneConverter::add(): can't convert an image";
             return {};
         }
+    } else if(!imageConverter->convertToFile(image, imageFilename)) {
+        Error{} << "Trade::GltfSceneConverter::add(): can't convert an image file";
+        return {};
     }
 
+    return writeImage(id, name, imageConverter->mimeType(), out ? Containers::ArrayView<const char>{*out} : nullptr, imageFilename, configuration().value<bool>("accessorNames"));
+}
+
+bool GltfSceneConverter::writeImage(const UnsignedInt id, const Containers::StringView name, const Containers::StringView mimeType, const Containers::ArrayView<const char> data, const Containers::StringView filename, const bool accessorNames) {
     /* At this point we're sure nothing will fail so we can start writing the
        JSON. Otherwise we'd end up with a partly-written JSON in case of an
        unsupported mesh, corruputing the output. */
@@ -3389,11 +4096,12 @@ template<UnsignedInt dimensions> bool GltfSceneConverter::convertAndWriteImage(c
     const Containers::ScopeGuard gltfImage = _state->gltfImages.beginObjectScope();
 
     /* Bundled image, needs a buffer view and a MIME type */
-    if(bundleImages) {
+    if(!filename) {
         /* The caller should have already checked the MIME type is not empty */
-        const Containers::String mimeType = imageConverter.mimeType();
         CORRADE_INTERNAL_ASSERT(mimeType);
 
+        const Containers::ArrayView<char> imageData = arrayAppend(_state->buffer, data);
+
         /* If this is a first buffer view, open the buffer view array */
         if(_state->gltfBufferViews.isEmpty())
             _state->gltfBufferViews.beginArray();
@@ -3404,9 +4112,9 @@ template<UnsignedInt dimensions> bool GltfSceneConverter::convertAndWriteImage(c
         _state->gltfBufferViews
             .writeKey("buffer"_s).write(0)
             /** @todo could be omitted if zero, is that useful for anything? */
-            .writeKey("byteOffset"_s).write(imageData - _state->buffer)
+            .writeKey("byteOffset"_s).write(_state->bufferOffset + (imageData - _state->buffer))
             .writeKey("byteLength"_s).write(imageData.size());
-        if(configuration().value<bool>("accessorNames"))
+        if(accessorNames)
             _state->gltfBufferViews.writeKey("name"_s).write(Utility::format(
                 name ? "image {0} ({1})" : "image {0}", id, name));
 
@@ -3420,12 +4128,42 @@ template<UnsignedInt dimensions> bool GltfSceneConverter::convertAndWriteImage(c
         /* Reference the file from the image. Writing just the filename as the
            two files are expected to be next to each other. */
         _state->gltfImages
-            .writeKey("uri"_s).write(Utility::Path::filename(imageFilename));
+            .writeKey("uri"_s).write(Utility::Path::filename(filename));
     }
 
     if(name)
         _state->gltfImages.writeKey("name"_s).write(name);
 
+    return flushBuffer();
+}
+
+bool GltfSceneConverter::writeQueuedImages() {
+    if(!_state->imageConversionPool)
+        return true;
+
+    /* Wait for all conversions to finish, write the images in the order they
+       were added and destroy the converter instances on this thread */
+    Containers::Array<Containers::Pointer<QueuedImage>> images = _state->imageConversionPool->finish();
+    _state->imageConversionPool = nullptr;
+    _state->imageConversionPoolHasBundledImages = false;
+    for(Containers::Pointer<QueuedImage>& image: images) {
+        if(image->output)
+            Debug{Debug::Flag::NoNewlineAtTheEnd} << image->output;
+        if(image->warningOutput)
+            Warning{Debug::Flag::NoNewlineAtTheEnd} << image->warningOutput;
+        if(!image->succeeded) {
+            if(image->errorOutput)
+                Error{Debug::Flag::NoNewlineAtTheEnd} << image->errorOutput;
+            Error{} << "Trade::GltfSceneConverter: can't convert" << (image->filename ? "image file" : "image") << image->id;
+            return false;
+        }
+
+        if(!writeImage(image->id, image->name, image->mimeType, image->data ? Containers::ArrayView<const char>{*image->data} : nullptr, image->filename, image->accessorNames))
+            return false;
+
+        image = nullptr;
+    }
+
     return true;
 }
 
@@ -3526,14 +4264,32 @@ bool GltfSceneConverter::doAdd(const UnsignedInt id, const ImageData2D& image, c
         extension = GltfExtension{};
     }
 
-    const UnsignedInt gltfImageId = image2DCount() + image3DCount();
-    CORRADE_INTERNAL_ASSERT(gltfImageId == (_state->gltfImages.isEmpty() ? 0 : _state->gltfImages.currentArraySize()));
+    /* If an image with the same contents was converted already, reference
+       it instead of converting it again. Otherwise the glTF image ID is the
+       next in the sequence, counting also images queued for conversion. It's
+       not equal to image2DCount() + image3DCount() if some images were
+       deduplicated. */
+    UnsignedInt gltfImageId = (_state->gltfImages.isEmpty() ? 0 : _state->gltfImages.currentArraySize()) + (_state->imageConversionPool ? _state->imageConversionPool->size() : 0);
+    Containers::String deduplicationKey;
+    bool duplicate = false;
+    if(configuration().value<bool>("deduplicate")) {
+        deduplicationKey = imageDeduplicationKey(imageConverterPluginName, bundleImages, image);
+        const auto found = _state->deduplicatedImages.find(deduplicationKey);
+        if(found != _state->deduplicatedImages.end()) {
+            gltfImageId = found->second;
+            duplicate = true;
+        }
+    }
 
     /* If the image writing fails due to an error, don't add any extensions
        -- otherwise we'd blow up on the asserts below when adding the next
        image */
-    if(!convertAndWriteImage(id, name, *imageConverter, image, bundleImages))
-        return false;
+    if(!duplicate) {
+        if(!convertAndWriteImage(id, name, Utility::move(imageConverter), image, bundleImages))
+            return false;
+        if(deduplicationKey)
+            _state->deduplicatedImages.emplace(Utility::move(deduplicationKey), gltfImageId);
+    }
 
     CORRADE_INTERNAL_ASSERT(_state->image2DIdsTextureExtensions.size() == id);
     arrayAppend(_state->image2DIdsTextureExtensions, InPlaceInit, gltfImageId, extension);
@@ -3598,14 +4354,32 @@ bool GltfSceneConverter::doAdd(const UnsignedInt id, const ImageData3D& image, c
         return {};
     }
 
-    const UnsignedInt gltfImageId = image2DCount() + image3DCount();
-    CORRADE_INTERNAL_ASSERT(gltfImageId == (_state->gltfImages.isEmpty() ? 0 : _state->gltfImages.currentArraySize()));
+    /* If an image with the same contents was converted already, reference
+       it instead of converting it again. Otherwise the glTF image ID is the
+       next in the sequence, counting also images queued for conversion. It's
+       not equal to image2DCount() + image3DCount() if some images were
+       deduplicated. */
+    UnsignedInt gltfImageId = (_state->gltfImages.isEmpty() ? 0 : _state->gltfImages.currentArraySize()) + (_state->imageConversionPool ? _state->imageConversionPool->size() : 0);
+    Containers::String deduplicationKey;
+    bool duplicate = false;
+    if(configuration().value<bool>("deduplicate")) {
+        deduplicationKey = imageDeduplicationKey(imageConverterPluginName, bundleImages, image);
+        const auto found = _state->deduplicatedImages.find(deduplicationKey);
+        if(found != _state->deduplicatedImages.end()) {
+            gltfImageId = found->second;
+            duplicate = true;
+        }
+    }
 
     /* If the image writing fails due to an error, don't add any extensions
        -- otherwise we'd blow up on the asserts below when adding the next
        image */
-    if(!convertAndWriteImage(id, name, *imageConverter, image, bundleImages))
-        return false;
+    if(!duplicate) {
+        if(!convertAndWriteImage(id, name, Utility::move(imageConverter), image, bundleImages))
+            return false;
+        if(deduplicationKey)
+            _state->deduplicatedImages.emplace(Utility::move(deduplicationKey), gltfImageId);
+    }
 
     CORRADE_INTERNAL_ASSERT(_state->image3DIdsTextureExtensionsLayerCount.size() == id);
     arrayAppend(_state->image3DIdsTextureExtensionsLayerCount, InPlaceInit, gltfImageId, extension, UnsignedInt(image.size().z()));
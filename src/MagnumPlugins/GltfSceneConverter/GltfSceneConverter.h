@@ -112,6 +112,17 @@ conversion warnings to be suppressed. Both @ref SceneConverterFlag::Quiet and
 @ref ImageConverterFlags and propagated to image converter plugins the
 converter delegates to.
 
+Mesh and image data are by default collected in memory and written to the
+output only in @ref endFile() or @ref endData(), which means the peak memory
+use is about the size of the output. When converting to a file, enabling the
+@cb{.ini} streamBuffer @ce
+@ref Trade-GltfSceneConverter-configuration "configuration option" makes every
+@ref add() write the data to a file right away, keeping only the JSON metadata
+in memory. For a `*.gltf` output it's the external `*.bin` buffer, for a
+`*.glb` it's a temporary `*.glb.bin.tmp` file next to the output that's
+copied into the binary chunk and deleted in @ref endFile(). If the conversion
+is aborted, the partially written file is deleted in both cases.
+
 @subsection Trade-GltfSceneConverter-behavior-meshes Mesh export
 
 -   The @ref MeshData is exported with its exact binary layout. Only padding
@@ -256,6 +267,39 @@ converter delegates to.
     preserved only if all meshes referenced by the object have the same. Meshes
     that were not referenced by any scene are written at the end, without any
     material assignment.
+-   If the @cb{.ini} meshoptCompression @ce
+    @ref Trade-GltfSceneConverter-configuration "configuration option" is
+    enabled, index and vertex buffer views are compressed using
+    [EXT_meshopt_compression](https://github.com/KhronosGroup/glTF/blob/main/extensions/2.0/Vendor/EXT_meshopt_compression/README.md).
+    The encoder is built into the plugin, no external library is needed.
+    Triangle lists use the `TRIANGLES` mode, which may rotate the order of
+    vertices in each triangle while preserving the winding, other indexed
+    primitives the `INDICES` mode. @ref MeshIndexType::UnsignedByte indices
+    and vertex buffer views with a stride that's not a multiple of four or is
+    larger than 256 bytes are left uncompressed. By default the uncompressed
+    data are not written, with the buffer views referencing a placeholder
+    buffer and the extension being added to required extensions. Enabling
+    @cb{.ini} meshoptCompressionFallback @ce keeps the uncompressed data in
+    the buffer as a fallback, in which case the extension is only added to
+    used extensions. With @cb{.ini} meshoptCompressionFilters @ce, buffer
+    views containing just a single @ref MeshAttribute::Normal in
+    @ref VertexFormat::Vector3bNormalized /
+    @relativeref{VertexFormat,Vector3sNormalized} or
+    @ref MeshAttribute::Tangent in @ref VertexFormat::Vector4bNormalized /
+    @relativeref{VertexFormat,Vector4sNormalized} are additionally encoded
+    with the lossy `OCTAHEDRAL` filter. The `QUATERNION` and `EXPONENTIAL`
+    filters are not used for mesh attributes.
+-   If the @cb{.ini} deduplicate @ce
+    @ref Trade-GltfSceneConverter-configuration "configuration option" is
+    enabled, index and vertex buffer views with the same stride and contents
+    as a view written by an earlier @ref add() are referenced instead of
+    written again, and so are accessors with the same properties. Vertex data
+    are dropped from the buffer only if all vertex buffer views of the mesh
+    were found, the names written with @cb{.ini} accessorNames @ce are then
+    the ones of the first occurrence. Contents are identified by a SHA-1
+    digest and additionally compared byte-by-byte, unless the earlier data
+    were already written out with @cb{.ini} streamBuffer @ce. Buffer views
+    compressed with @cb{.ini} meshoptCompression @ce are not deduplicated.
 -   At the moment, alignment rules for vertex stride are not respected.
 -   In some cases it might happen that the official Khronos glTF validator
     will warn about `min` / `max` accessor bounds very slightly differing from
@@ -274,6 +318,21 @@ converter delegates to.
     to be set globally via
     @relativeref{Corrade,PluginManager::Manager::metadata()} through the image
     converter manager.
+-   If the @cb{.ini} imageConverterThreads @ce
+    @ref Trade-GltfSceneConverter-configuration "configuration option" is set
+    to a value other than @cpp 1 @ce before beginning a file, @ref add()
+    only copies the image and queues it for conversion on a pool of worker
+    threads. The count of images waiting for conversion is limited to four
+    times the thread count, if the workers can't keep up, @ref add() waits
+    until there's space, and the copy is freed once the image is converted.
+    The converted images are then written in the order they were
+    added in @ref endData() or @ref endFile(), or already when adding a mesh
+    if there are images bundled into the buffer queued, so the output is the
+    same as with a serial conversion. Any conversion error is reported from
+    there. Image converter plugins are instantiated and destroyed on the
+    calling thread, but the conversion itself runs on the workers, so
+    converters that load other plugins during conversion such as
+    @relativeref{Trade,AnyImageConverter} shouldn't be used in this case.
 -   By default, images are saved as external files for a `*.gltf` output and
     embedded into the buffer for a `*.glb` output. This behavior can be
     overriden using the @cb{.ini} bundleImages @ce
@@ -306,6 +365,15 @@ converter delegates to.
     ID and name if the @cb{.ini} accessorNames @ce
     @ref Trade-GltfSceneConverter-configuration "configuration option" is
     enabled.
+-   If the @cb{.ini} deduplicate @ce
+    @ref Trade-GltfSceneConverter-configuration "configuration option" is
+    enabled, an image with the same format, size and pixel contents as an
+    image added earlier with the same @cb{.ini} imageConverter @ce and
+    @cb{.ini} bundleImages @ce options isn't converted again, and textures
+    referencing it reference the earlier image instead. Its name is then not
+    saved. Pixel contents are identified by a SHA-1 digest, ignoring any
+    padding given by the @ref PixelStorage. Changing image converter options
+    between the @ref add() calls isn't taken into account.
 -   The texture is required to only be added after all images it references
 -   At the moment, there's no support for exporting multi-level images even
     though the KTX2 container is capable of storing these.
@@ -518,8 +586,11 @@ class MAGNUM_GLTFSCENECONVERTER_EXPORT GltfSceneConverter: public AbstractSceneC
         MAGNUM_GLTFSCENECONVERTER_LOCAL bool doBeginFile(Containers::StringView filename) override;
         MAGNUM_GLTFSCENECONVERTER_LOCAL bool doBeginData() override;
         MAGNUM_GLTFSCENECONVERTER_LOCAL Containers::Optional<Containers::Array<char>> doEndData() override;
+        MAGNUM_GLTFSCENECONVERTER_LOCAL bool doEndFile(Containers::StringView filename) override;
         MAGNUM_GLTFSCENECONVERTER_LOCAL void doAbort() override;
 
+        MAGNUM_GLTFSCENECONVERTER_LOCAL bool flushBuffer();
+
         MAGNUM_GLTFSCENECONVERTER_LOCAL void doSetDefaultScene(UnsignedInt id) override;
         MAGNUM_GLTFSCENECONVERTER_LOCAL void doSetObjectName(UnsignedLong object, Containers::StringView name) override;
         MAGNUM_GLTFSCENECONVERTER_LOCAL void doSetSceneFieldName(SceneField field, Containers::StringView name) override;
@@ -532,7 +603,9 @@ class MAGNUM_GLTFSCENECONVERTER_EXPORT GltfSceneConverter: public AbstractSceneC
 
         MAGNUM_GLTFSCENECONVERTER_LOCAL bool doAdd(UnsignedInt id, const TextureData& texture, Containers::StringView name) override;
 
-        template<UnsignedInt dimensions> MAGNUM_GLTFSCENECONVERTER_LOCAL bool convertAndWriteImage(UnsignedInt id, Containers::StringView name, AbstractImageConverter& imageConverter, const ImageData<dimensions>& image, bool bundleImages);
+        template<UnsignedInt dimensions> MAGNUM_GLTFSCENECONVERTER_LOCAL bool convertAndWriteImage(UnsignedInt id, Containers::StringView name, Containers::Pointer<AbstractImageConverter>&& imageConverter, const ImageData<dimensions>& image, bool bundleImages);
+        MAGNUM_GLTFSCENECONVERTER_LOCAL bool writeImage(UnsignedInt id, Containers::StringView name, Containers::StringView mimeType, Containers::ArrayView<const char> data, Containers::StringView filename, bool accessorNames);
+        MAGNUM_GLTFSCENECONVERTER_LOCAL bool writeQueuedImages();
         MAGNUM_GLTFSCENECONVERTER_LOCAL bool doAdd(UnsignedInt id, const ImageData2D& image, Containers::StringView name) override;
         MAGNUM_GLTFSCENECONVERTER_LOCAL bool doAdd(UnsignedInt id, const ImageData3D& image, Containers::StringView name) override;
 
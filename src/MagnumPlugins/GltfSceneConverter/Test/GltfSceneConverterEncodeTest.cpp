@@ -0,0 +1,318 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2024 Pablo Escobar <mail@rvrs.in>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "MagnumPlugins/GltfSceneConverter/encode.h"
+/* For roundtrip tests */
+#include "MagnumPlugins/GltfImporter/decode.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct GltfSceneConverterEncodeTest: TestSuite::Tester {
+    explicit GltfSceneConverterEncodeTest();
+
+    void meshoptAttributes();
+    void meshoptAttributesEmpty();
+    void meshoptAttributesMultipleBlocks();
+    void meshoptAttributesRoundtrip();
+    void meshoptTriangles();
+    void meshoptTrianglesRoundtrip();
+    void meshoptIndices();
+    void meshoptFilterOctahedral();
+};
+
+const struct {
+    const char* name;
+    std::size_t count, stride;
+} MeshoptAttributesRoundtripData[]{
+    {"one vertex", 1, 4},
+    {"less than a group", 13, 12},
+    {"exactly one block", 256, 16},
+    {"several blocks", 1000, 20},
+    {"several blocks, large stride", 100, 256},
+};
+
+GltfSceneConverterEncodeTest::GltfSceneConverterEncodeTest() {
+    addTests({&GltfSceneConverterEncodeTest::meshoptAttributes,
+              &GltfSceneConverterEncodeTest::meshoptAttributesEmpty,
+              &GltfSceneConverterEncodeTest::meshoptAttributesMultipleBlocks});
+
+    addInstancedTests({&GltfSceneConverterEncodeTest::meshoptAttributesRoundtrip},
+        Containers::arraySize(MeshoptAttributesRoundtripData));
+
+    addTests({&GltfSceneConverterEncodeTest::meshoptTriangles,
+              &GltfSceneConverterEncodeTest::meshoptTrianglesRoundtrip,
+              &GltfSceneConverterEncodeTest::meshoptIndices,
+              &GltfSceneConverterEncodeTest::meshoptFilterOctahedral});
+}
+
+void GltfSceneConverterEncodeTest::meshoptAttributes() {
+    /* The same data as in GltfImporterDecodeTest::meshoptAttributes(), the
+       encoder should produce the exact same bytes. The data is picked to use
+       all four group encodings: zero deltas, 2-bit and 4-bit deltas with and
+       without extra bytes and raw bytes. */
+    const UnsignedByte input[]{
+        0x00, 0x00, 0x64, 0x07, 0x79, 0x00, 0x00, 0x00,
+        0x01, 0x02, 0x63, 0x07, 0x42, 0x00, 0x01, 0x00,
+        0x02, 0x04, 0x62, 0x07, 0xbd, 0x00, 0x04, 0x00,
+        0x03, 0x06, 0x61, 0x07, 0xf2, 0x00, 0x09, 0x00,
+        0x04, 0x08, 0x60, 0x07, 0x21, 0x00, 0x10, 0x00,
+        0x05, 0x0a, 0x5f, 0x07, 0x06, 0x00, 0x19, 0x00,
+        0x06, 0x0c, 0x5e, 0x07, 0xf0, 0x00, 0x24, 0x00,
+        0x07, 0x0e, 0x5d, 0x07, 0x84, 0x00, 0x31, 0x00,
+        0x08, 0x10, 0x5c, 0x07, 0x77, 0x00, 0x40, 0x00,
+        0x09, 0x12, 0x5b, 0x07, 0x62, 0x00, 0x51, 0x00,
+        0x0a, 0x14, 0x5a, 0x07, 0xf0, 0x00, 0x64, 0x00,
+        0x0b, 0x16, 0x59, 0x07, 0xf3, 0x00, 0x79, 0x00,
+        0x0c, 0x18, 0x58, 0x07, 0xcb, 0x00, 0x90, 0x00,
+        0x0d, 0x1a, 0x57, 0x07, 0x4d, 0x00, 0xa9, 0x00,
+        0x0e, 0x1c, 0x56, 0x07, 0x76, 0x00, 0xc4, 0x00,
+        0x0f, 0x1e, 0x55, 0x07, 0x4d, 0x00, 0xe1, 0x00,
+        0x10, 0x20, 0x54, 0x07, 0xc7, 0x00, 0x00, 0x00,
+        0x11, 0x22, 0x53, 0x07, 0x07, 0x00, 0x21, 0x00,
+        0x12, 0x24, 0x52, 0x07, 0x20, 0x00, 0x44, 0xc8,
+        0x13, 0x26, 0x51, 0x07, 0x51, 0x00, 0x69, 0xc8
+    };
+    const UnsignedByte expected[]{
+        0xa0, 0x05, 0x2a, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x06, 0x04,
+        0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0xff, 0x00, 0x00, 0x00, 0x04,
+        0x04, 0x04, 0x04, 0x05, 0x15, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00,
+        0x00, 0x07, 0x00, 0x6d, 0xf6, 0x6a, 0x5e, 0x35, 0x2b, 0xd7, 0x19, 0x29,
+        0xe3, 0x06, 0x4f, 0xfb, 0x52, 0x51, 0xff, 0x00, 0x00, 0x00, 0xf4, 0x80,
+        0x32, 0x62, 0x00, 0x07, 0x00, 0x02, 0x06, 0x0a, 0x0e, 0x12, 0x16, 0x1a,
+        0x1e, 0x22, 0x26, 0x2a, 0x2e, 0x32, 0x36, 0x3a, 0xff, 0x00, 0x00, 0x00,
+        0x3e, 0x42, 0x46, 0x4a, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x64, 0x07, 0x79, 0x00, 0x00, 0x00
+    };
+
+    /* Existing contents should be preserved */
+    Containers::Array<char> out;
+    arrayAppend(out, {'h', 'e', 'y'});
+    encodeMeshoptAttributes(Containers::arrayCast<const char>(Containers::arrayView(input)), 20, 8, out);
+    CORRADE_COMPARE_AS(out.prefix(3),
+        Containers::arrayView({'h', 'e', 'y'}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const UnsignedByte>(out.exceptPrefix(3)),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void GltfSceneConverterEncodeTest::meshoptAttributesEmpty() {
+    /* Just the header and the tail with an all-zero base vertex */
+    Containers::Array<char> out;
+    encodeMeshoptAttributes(nullptr, 0, 8, out);
+    CORRADE_COMPARE(out.size(), 1 + 32);
+    CORRADE_COMPARE(out[0], '\xa0');
+    for(std::size_t i = 1; i != out.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out[i], '\0');
+    }
+
+    CORRADE_VERIFY(decodeMeshoptAttributes(out, 0, 8, nullptr));
+}
+
+void GltfSceneConverterEncodeTest::meshoptAttributesMultipleBlocks() {
+    /* Inverse of GltfImporterDecodeTest::meshoptAttributesMultipleBlocks().
+       With a 256-byte stride, a block has 32 vertices, so 40 vertices are
+       split into two. All deltas are zero, so each block is just one zero
+       group header per byte, followed by the tail with the base vertex. */
+    Containers::Array<char> input{NoInit, 40*256};
+    for(std::size_t i = 0; i != input.size(); ++i)
+        input[i] = char(i%256*3);
+
+    Containers::Array<char> out;
+    encodeMeshoptAttributes(input, 40, 256, out);
+    CORRADE_COMPARE(out.size(), 1 + 2*256 + 256);
+    CORRADE_COMPARE(out[0], '\xa0');
+    for(std::size_t i = 0; i != 2*256; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out[1 + i], '\0');
+    }
+    CORRADE_COMPARE_AS(out.exceptPrefix(1 + 2*256),
+        input.prefix(256),
+        TestSuite::Compare::Container);
+}
+
+void GltfSceneConverterEncodeTest::meshoptAttributesRoundtrip() {
+    auto&& data = MeshoptAttributesRoundtripData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Slowly changing data with a bit of noise, to have groups with various
+       encodings */
+    Containers::Array<char> input{NoInit, data.count*data.stride};
+    UnsignedInt state = 1;
+    for(std::size_t i = 0; i != data.count; ++i) {
+        for(std::size_t j = 0; j != data.stride; ++j) {
+            state = state*1103515245 + 12345;
+            input[i*data.stride + j] = char(i*(j + 1)/3 + (state >> 16)%5);
+        }
+    }
+
+    Containers::Array<char> out;
+    encodeMeshoptAttributes(input, data.count, data.stride, out);
+
+    Containers::Array<char> decoded{NoInit, data.count*data.stride};
+    CORRADE_VERIFY(decodeMeshoptAttributes(out, data.count, data.stride, decoded));
+    CORRADE_COMPARE_AS(decoded, input,
+        TestSuite::Compare::Container);
+}
+
+void GltfSceneConverterEncodeTest::meshoptTriangles() {
+    /* Same data as in GltfImporterDecodeTest::meshoptTriangles(), the
+       encoder should produce the exact same bytes. The input uses all
+       triangle codes -- a new triangle from the auxiliary code table,
+       triangles sharing an edge with a new vertex and a vertex from the
+       FIFO, as well as explicitly encoded auxiliary codes and indices. */
+    const UnsignedInt input[]{
+        0, 1, 2, 2, 1, 3, 2, 3, 4, 4, 3, 5, 6, 7, 8, 100, 200, 300, 300, 200, 7,
+        0, 9, 1
+    };
+    const UnsignedByte expected[]{
+        0xe1, 0xf0, 0x10, 0x00, 0x10, 0xf0, 0xff, 0x14, 0xfe, 0xff, 0xc8, 0x01,
+        0xc8, 0x01, 0xc8, 0x01, 0xbc, 0x00, 0x76, 0x87, 0x56, 0x67, 0x78, 0xa9,
+        0x86, 0x65, 0x89, 0x68, 0x98, 0x01, 0x69, 0x00, 0x00
+    };
+
+    Containers::Array<char> out;
+    encodeMeshoptTriangles(input, out);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const UnsignedByte>(out),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void GltfSceneConverterEncodeTest::meshoptTrianglesRoundtrip() {
+    /* A grid of quads, followed by the same triangles in a scrambled order
+       and offset by a large value, to exercise both the edge and vertex
+       FIFOs and explicitly encoded indices */
+    Containers::Array<UnsignedInt> input;
+    for(UnsignedInt y = 0; y != 10; ++y) {
+        for(UnsignedInt x = 0; x != 10; ++x) {
+            const UnsignedInt v = y*11 + x;
+            arrayAppend(input, {v, v + 1, v + 11, v + 1, v + 12, v + 11});
+        }
+    }
+    for(std::size_t i = 0; i != 200; ++i) {
+        const std::size_t triangle = i*37%200;
+        for(std::size_t j = 0; j != 3; ++j)
+            arrayAppend(input, input[triangle*3 + j] + 100000);
+    }
+
+    Containers::Array<char> out;
+    encodeMeshoptTriangles(input, out);
+    CORRADE_COMPARE_AS(out.size(), input.size()*4,
+        TestSuite::Compare::Less);
+
+    Containers::Array<UnsignedInt> decoded{NoInit, input.size()};
+    CORRADE_VERIFY(decodeMeshoptTriangles(out, input.size(), 4, Containers::arrayCast<char>(decoded)));
+
+    /* The triangles can get rotated, but the winding has to stay */
+    for(std::size_t i = 0; i != input.size(); i += 3) {
+        CORRADE_ITERATION(i/3);
+        const UnsignedInt* a = input + i;
+        const UnsignedInt* b = decoded + i;
+        CORRADE_VERIFY(
+            (a[0] == b[0] && a[1] == b[1] && a[2] == b[2]) ||
+            (a[0] == b[1] && a[1] == b[2] && a[2] == b[0]) ||
+            (a[0] == b[2] && a[1] == b[0] && a[2] == b[1]));
+    }
+}
+
+void GltfSceneConverterEncodeTest::meshoptIndices() {
+    /* Same data as in GltfImporterDecodeTest::meshoptIndices(), the encoder
+       should produce the exact same bytes */
+    const UnsignedInt input[]{
+        0, 1, 2, 3, 100, 4, 101, 5, 70000, 6, 2
+    };
+    const UnsignedByte expected[]{
+        0xd1, 0x00, 0x04, 0x04, 0x04, 0x84, 0x03, 0x11, 0x04, 0x05, 0xac, 0x88,
+        0x11, 0x05, 0x0f, 0x00, 0x00, 0x00, 0x00
+    };
+
+    Containers::Array<char> out;
+    encodeMeshoptIndices(input, out);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const UnsignedByte>(out),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void GltfSceneConverterEncodeTest::meshoptFilterOctahedral() {
+    /* 8-bit. The fourth component is left untouched. */
+    {
+        Byte data[]{
+            0, 0, 127, 5,
+            127, 0, 0, 12,
+            0, -127, 0, -1,
+            0, 0, -127, 3,
+            73, 73, 74, 0,
+            /* Zero vector is encoded as pointing up */
+            0, 0, 0, 7
+        };
+        encodeMeshoptFilterOctahedral<Byte>(Containers::arrayCast<char>(Containers::arrayView(data)));
+        CORRADE_COMPARE_AS(Containers::arrayView(data), Containers::arrayView<Byte>({
+            0, 0, 127, 5,
+            127, 0, 127, 12,
+            0, -127, 127, -1,
+            127, 127, 127, 3,
+            42, 42, 127, 0,
+            0, 0, 127, 7
+        }), TestSuite::Compare::Container);
+
+        /* Axis-aligned vectors survive a roundtrip exactly */
+        decodeMeshoptFilterOctahedral<Byte>(Containers::arrayCast<char>(Containers::arrayView(data)));
+        CORRADE_COMPARE_AS(Containers::arrayView(data).prefix(20), Containers::arrayView<Byte>({
+            0, 0, 127, 5,
+            127, 0, 0, 12,
+            0, -127, 0, -1,
+            0, 0, -127, 3,
+            73, 73, 74, 0
+        }), TestSuite::Compare::Container);
+
+    /* 16-bit */
+    } {
+        Short data[]{
+            0, 0, 32767, 5,
+            0, 0, -32767, 7,
+            14543, -29086, 4024, -3
+        };
+        encodeMeshoptFilterOctahedral<Short>(Containers::arrayCast<char>(Containers::arrayView(data)));
+        CORRADE_COMPARE_AS(Containers::arrayView(data), Containers::arrayView<Short>({
+            0, 0, 32767, 5,
+            32767, 32767, 32767, 7,
+            10000, -20000, 32767, -3
+        }), TestSuite::Compare::Container);
+    }
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::GltfSceneConverterEncodeTest)
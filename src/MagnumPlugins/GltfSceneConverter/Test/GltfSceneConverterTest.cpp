@@ -42,6 +42,7 @@
 #include <Corrade/TestSuite/Compare/Numeric.h>
 #include <Corrade/TestSuite/Compare/StringToFile.h>
 #include <Corrade/TestSuite/Compare/String.h>
+#include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/ConfigurationGroup.h>
 #include <Corrade/Utility/Format.h>
 #include <Corrade/Utility/Path.h>
@@ -78,6 +79,8 @@ struct GltfSceneConverterTest: TestSuite::Tester {
     void generatorVersion();
 
     void abort();
+    void streamBuffer();
+    void streamBufferAbort();
 
     void addMesh();
     void addMeshBufferViewsNonInterleaved();
@@ -97,6 +100,8 @@ struct GltfSceneConverterTest: TestSuite::Tester {
     void addMeshCustomObjectIdAttributeName();
     void addMeshMultiple();
     void addMeshBufferAlignment();
+    void addMeshMeshoptCompression();
+    void addMeshDeduplicate();
     void addMeshInvalid();
 
     void addImage2D();
@@ -109,6 +114,11 @@ struct GltfSceneConverterTest: TestSuite::Tester {
     void addImagePropagateConfigurationGroup();
     void addImageMultiple();
     /* Multiple 2D + 3D images tested in addMaterial2DArrayTextures() */
+    void addImageDeduplicate();
+    void addImageThreads();
+    void addImageThreadsMoreImagesThanThreads();
+    void addImageThreadsFailed();
+    void addImageThreadsInvalid();
     void addImageNoConverterManager();
     void addImageExternalToData();
     void addImageInvalid2D();
@@ -342,6 +352,54 @@ const struct {
         nullptr}
 };
 
+const struct {
+    const char* name;
+    const char* filename;
+    bool binary;
+} StreamBufferData[]{
+    {"*.gltf", "stream-buffer.gltf", false},
+    {"*.glb", "stream-buffer.glb", true},
+};
+
+const struct {
+    const char* name;
+    const char* filename;
+    const char* streamFilename;
+} StreamBufferAbortData[]{
+    {"*.gltf", "stream-buffer-abort.gltf", "stream-buffer-abort.bin"},
+    {"*.glb", "stream-buffer-abort.glb", "stream-buffer-abort.glb.bin.tmp"},
+};
+
+const struct {
+    const char* name;
+    bool fallback, filters;
+} AddMeshMeshoptCompressionData[]{
+    {"", false, false},
+    {"with fallback", true, false},
+    {"with filters", false, true},
+    {"with fallback and filters", true, true},
+};
+
+const struct {
+    const char* name;
+    const char* filename;
+    UnsignedInt threads;
+} AddImageThreadsData[]{
+    {"*.gltf, 2 threads", "image-threads.gltf", 2},
+    {"*.glb, 2 threads", "image-threads.glb", 2},
+    {"*.glb, autodetected threads", "image-threads.glb", 0},
+};
+
+const struct {
+    const char* name;
+    bool streamBuffer;
+} AddMeshDeduplicateData[]{
+    {"", false},
+    /* Earlier data are written out already, so only the hashes get
+       compared */
+    {"streamed buffer", true},
+};
+
 /** @todo drop this once compatibilitySkinningAttributes no longer exists in
     AssimpImporter and GltfImporter */
 const struct {
@@ -2055,6 +2113,12 @@ GltfSceneConverterTest::GltfSceneConverterTest() {
               &GltfSceneConverterTest::generatorVersion,
               &GltfSceneConverterTest::abort});
 
+    addInstancedTests({&GltfSceneConverterTest::streamBuffer},
+        Containers::arraySize(StreamBufferData));
+
+    addInstancedTests({&GltfSceneConverterTest::streamBufferAbort},
+        Containers::arraySize(StreamBufferAbortData));
+
     addInstancedTests({&GltfSceneConverterTest::addMesh},
         Containers::arraySize(FileVariantWithNamesData));
 
@@ -2095,6 +2159,12 @@ GltfSceneConverterTest::GltfSceneConverterTest() {
               &GltfSceneConverterTest::addMeshMultiple,
               &GltfSceneConverterTest::addMeshBufferAlignment});
 
+    addInstancedTests({&GltfSceneConverterTest::addMeshMeshoptCompression},
+        Containers::arraySize(AddMeshMeshoptCompressionData));
+
+    addInstancedTests({&GltfSceneConverterTest::addMeshDeduplicate},
+        Containers::arraySize(AddMeshDeduplicateData));
+
     addInstancedTests({&GltfSceneConverterTest::addMeshInvalid},
         Containers::arraySize(AddMeshInvalidData));
 
@@ -2120,6 +2190,14 @@ GltfSceneConverterTest::GltfSceneConverterTest() {
         Containers::arraySize(QuietData));
 
     addTests({&GltfSceneConverterTest::addImageMultiple,
+              &GltfSceneConverterTest::addImageDeduplicate});
+
+    addInstancedTests({&GltfSceneConverterTest::addImageThreads},
+        Containers::arraySize(AddImageThreadsData));
+
+    addTests({&GltfSceneConverterTest::addImageThreadsMoreImagesThanThreads,
+              &GltfSceneConverterTest::addImageThreadsFailed,
+              &GltfSceneConverterTest::addImageThreadsInvalid,
               &GltfSceneConverterTest::addImageNoConverterManager,
               &GltfSceneConverterTest::addImageExternalToData});
 
@@ -2404,6 +2482,107 @@ void GltfSceneConverterTest::abort() {
         TestSuite::Compare::StringToFile);
 }
 
+void GltfSceneConverterTest::streamBuffer() {
+    auto&& data = StreamBufferData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Odd data sizes, with and without meshopt compression, to verify that
+       alignment padding and offsets are calculated from the absolute buffer
+       position also if the preceding data were already written out */
+    const UnsignedByte indicesA[]{0, 1, 2, 0, 1};
+    const Vector3b positionsA[]{{1, 2, 3}, {40, 50, 60}, {7, 8, 9}};
+    MeshData a{MeshPrimitive::LineLoop,
+        {}, indicesA, MeshIndexData{indicesA},
+        {}, positionsA, {
+            MeshAttributeData{MeshAttribute::Position, Containers::arrayView(positionsA)}
+        }};
+    const UnsignedShort indicesB[]{0, 1, 2, 2, 1, 0};
+    const Vector3 positionsB[]{{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}, {7.0f, 8.0f, 9.0f}};
+    MeshData b{MeshPrimitive::Triangles,
+        {}, indicesB, MeshIndexData{indicesB},
+        {}, positionsB, {
+            MeshAttributeData{MeshAttribute::Position, Containers::arrayView(positionsB)}
+        }};
+
+    Containers::String filename = Utility::Path::join(GLTFSCENECONVERTER_TEST_OUTPUT_DIR, data.filename);
+    Containers::String bufferFilename = Utility::Path::join(GLTFSCENECONVERTER_TEST_OUTPUT_DIR, "stream-buffer.bin");
+    Containers::String temporaryFilename = filename + ".bin.tmp"_s;
+
+    const auto convert = [&](bool streamBuffer) {
+        Containers::Pointer<AbstractSceneConverter> converter =  _converterManager.instantiate("GltfSceneConverter");
+        converter->configuration().setValue("streamBuffer", streamBuffer);
+        CORRADE_VERIFY(converter->beginFile(filename));
+        CORRADE_VERIFY(converter->add(a));
+        converter->configuration().setValue("meshoptCompression", true);
+        CORRADE_VERIFY(converter->add(b));
+        converter->configuration().setValue("meshoptCompression", false);
+        CORRADE_VERIFY(converter->add(a));
+        CORRADE_VERIFY(converter->endFile());
+    };
+
+    /* Convert without streaming first to have something to compare to */
+    if(Utility::Path::exists(bufferFilename))
+        CORRADE_VERIFY(Utility::Path::remove(bufferFilename));
+    {
+        CORRADE_ITERATION("without streaming");
+        convert(false);
+    }
+    Containers::Optional<Containers::Array<char>> expected = Utility::Path::read(filename);
+    CORRADE_VERIFY(expected);
+    Containers::Optional<Containers::Array<char>> expectedBuffer;
+    if(!data.binary) {
+        expectedBuffer = Utility::Path::read(bufferFilename);
+        CORRADE_VERIFY(expectedBuffer);
+        CORRADE_VERIFY(Utility::Path::remove(bufferFilename));
+    }
+
+    /* The streamed output should be exactly the same */
+    {
+        CORRADE_ITERATION("with streaming");
+        convert(true);
+    }
+    CORRADE_COMPARE_AS(filename,
+        Containers::StringView{Containers::arrayView(*expected)},
+        TestSuite::Compare::FileToString);
+    if(data.binary) {
+        CORRADE_VERIFY(!Utility::Path::exists(bufferFilename));
+        /* The temporary file is deleted after */
+        CORRADE_VERIFY(!Utility::Path::exists(temporaryFilename));
+    } else {
+        CORRADE_COMPARE_AS(bufferFilename,
+            Containers::StringView{Containers::arrayView(*expectedBuffer)},
+            TestSuite::Compare::FileToString);
+    }
+}
+
+void GltfSceneConverterTest::streamBufferAbort() {
+    auto&& data = StreamBufferAbortData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractSceneConverter> converter =  _converterManager.instantiate("GltfSceneConverter");
+    converter->configuration().setValue("streamBuffer", true);
+
+    Containers::String filename = Utility::Path::join(GLTFSCENECONVERTER_TEST_OUTPUT_DIR, data.filename);
+    Containers::String temporaryFilename = Utility::Path::join(GLTFSCENECONVERTER_TEST_OUTPUT_DIR, data.streamFilename);
+    CORRADE_VERIFY(converter->beginFile(filename));
+
+    const Vector3 positions[1]{};
+    CORRADE_VERIFY(converter->add(MeshData{MeshPrimitive::Triangles, {}, positions, {
+        MeshAttributeData{MeshAttribute::Position, Containers::arrayView(positions)}
+    }}));
+
+    /* The data are written right away */
+    CORRADE_VERIFY(Utility::Path::exists(temporaryFilename));
+    Containers::Optional<std::size_t> size = Utility::Path::size(temporaryFilename);
+    CORRADE_VERIFY(size);
+    CORRADE_COMPARE(*size, sizeof(positions));
+
+    /* Starting a new file should clean up the previous state including the
+       partially written file */
+    CORRADE_VERIFY(converter->beginData());
+    CORRADE_VERIFY(!Utility::Path::exists(temporaryFilename));
+}
+
 void GltfSceneConverterTest::addMesh() {
     auto&& data = FileVariantWithNamesData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
@@ -3790,6 +3969,252 @@ void GltfSceneConverterTest::addMeshBufferAlignment() {
         TestSuite::Compare::Container);
 }
 
+void GltfSceneConverterTest::addMeshMeshoptCompression() {
+    auto&& data = AddMeshMeshoptCompressionData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Interleaved positions and texture coordinates and normals in a separate
+       view, which makes them a candidate for the octahedral filter. The
+       normals are axis-aligned so they survive the filter without any
+       precision loss. */
+    struct Vertex {
+        Vector3 position;
+        Vector2 textureCoordinates;
+    };
+    const struct Vertices {
+        Vertex interleaved[4];
+        Vector4b normals[4];
+    } vertices[]{{{
+        {{-1.0f, -1.0f, 0.0f}, {0.0f, 0.25f}},
+        {{ 1.0f, -1.0f, 0.0f}, {1.0f, 0.25f}},
+        {{-1.0f,  1.0f, 0.0f}, {0.0f, 0.75f}},
+        {{ 1.0f,  1.0f, 0.0f}, {1.0f, 0.75f}},
+    }, {
+        {0, 0, 127, 0},
+        {127, 0, 0, 0},
+        {0, -127, 0, 0},
+        {0, 0, -127, 0}
+    }}};
+    const auto interleaved = Containers::stridedArrayView(vertices[0].interleaved);
+    const Containers::Array<MeshAttributeData> attributes{InPlaceInit, {
+        MeshAttributeData{MeshAttribute::Position, interleaved.slice(&Vertex::position)},
+        MeshAttributeData{MeshAttribute::TextureCoordinates, interleaved.slice(&Vertex::textureCoordinates)},
+        MeshAttributeData{MeshAttribute::Normal, VertexFormat::Vector3bNormalized, Containers::stridedArrayView(vertices[0].normals)}
+    }};
+
+    /* A triangle list, compressed with the TRIANGLES mode. The encoder
+       doesn't need to rotate any triangles here. */
+    const UnsignedShort indicesA[]{0, 1, 2, 2, 1, 3};
+    MeshData a{MeshPrimitive::Triangles,
+        {}, indicesA, MeshIndexData{indicesA},
+        {}, vertices, meshAttributeDataNonOwningArray(attributes)};
+
+    /* A line list, compressed with the INDICES mode */
+    const UnsignedInt indicesB[]{0, 1, 1, 3, 3, 2, 2, 0};
+    MeshData b{MeshPrimitive::Lines,
+        {}, indicesB, MeshIndexData{indicesB},
+        {}, vertices, meshAttributeDataNonOwningArray(attributes)};
+
+    /* 8-bit indices and a three-byte stride can't be compressed, this mesh
+       should be saved as-is and the data should be in the buffer even with
+       the fallback disabled */
+    const UnsignedByte indicesC[]{0, 1, 2};
+    const Vector3b positionsC[]{{1, 2, 3}, {40, 50, 60}, {7, 8, 9}};
+    MeshData c{MeshPrimitive::Triangles,
+        {}, indicesC, MeshIndexData{indicesC},
+        {}, positionsC, {
+            MeshAttributeData{MeshAttribute::Position, Containers::arrayView(positionsC)}
+        }};
+
+    Containers::Pointer<AbstractSceneConverter> converter =  _converterManager.instantiate("GltfSceneConverter");
+    converter->configuration().setValue("meshoptCompression", true);
+    converter->configuration().setValue("meshoptCompressionFallback", data.fallback);
+    converter->configuration().setValue("meshoptCompressionFilters", data.filters);
+
+    Containers::String filename = Utility::Path::join(GLTFSCENECONVERTER_TEST_OUTPUT_DIR, "mesh-meshopt.gltf");
+    CORRADE_VERIFY(converter->beginFile(filename));
+    CORRADE_VERIFY(converter->add(a));
+    CORRADE_VERIFY(converter->add(b));
+    CORRADE_VERIFY(converter->add(c));
+    CORRADE_VERIFY(converter->endFile());
+
+    const Containers::Optional<Containers::String> gltf = Utility::Path::readString(filename);
+    CORRADE_VERIFY(gltf);
+
+    /* The extension is required only if there's no fallback. The quantization
+       extension is required always because of the normals. */
+    CORRADE_COMPARE_AS(*gltf,
+        "\"extensionsUsed\": [\n"
+        "    \"EXT_meshopt_compression\",\n"
+        "    \"KHR_mesh_quantization\"\n"
+        "  ]",
+        TestSuite::Compare::StringContains);
+    CORRADE_COMPARE_AS(*gltf, data.fallback ?
+        "\"extensionsRequired\": [\n"
+        "    \"KHR_mesh_quantization\"\n"
+        "  ]" :
+        "\"extensionsRequired\": [\n"
+        "    \"EXT_meshopt_compression\",\n"
+        "    \"KHR_mesh_quantization\"\n"
+        "  ]",
+        TestSuite::Compare::StringContains);
+
+    /* The placeholder buffer is there only if there's no fallback */
+    CORRADE_COMPARE(gltf->contains("\"fallback\": true"), !data.fallback);
+
+    CORRADE_COMPARE_AS(*gltf,
+        "\"mode\": \"TRIANGLES\"",
+        TestSuite::Compare::StringContains);
+    CORRADE_COMPARE_AS(*gltf,
+        "\"mode\": \"INDICES\"",
+        TestSuite::Compare::StringContains);
+    CORRADE_COMPARE_AS(*gltf,
+        "\"mode\": \"ATTRIBUTES\"",
+        TestSuite::Compare::StringContains);
+    CORRADE_COMPARE(gltf->contains("\"filter\": \"OCTAHEDRAL\""), data.filters);
+
+    if(_importerManager.loadState("GltfImporter") == PluginManager::LoadState::NotFound)
+        CORRADE_SKIP("GltfImporter plugin not found, cannot test a roundtrip");
+
+    Containers::Pointer<AbstractImporter> importer = _importerManager.instantiate("GltfImporter");
+    CORRADE_VERIFY(importer->openFile(filename));
+    CORRADE_COMPARE(importer->meshCount(), 3);
+
+    Containers::Optional<MeshData> importedA = importer->mesh(0);
+    CORRADE_VERIFY(importedA);
+    CORRADE_COMPARE(importedA->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE_AS(importedA->indices<UnsignedShort>(),
+        Containers::arrayView(indicesA),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(importedA->attribute<Vector3>(MeshAttribute::Position),
+        a.attribute<Vector3>(MeshAttribute::Position),
+        TestSuite::Compare::Container);
+    /* Y-flipped on export and back on import */
+    CORRADE_COMPARE_AS(importedA->attribute<Vector2>(MeshAttribute::TextureCoordinates),
+        a.attribute<Vector2>(MeshAttribute::TextureCoordinates),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(importedA->attributeFormat(MeshAttribute::Normal), VertexFormat::Vector3bNormalized);
+    CORRADE_COMPARE_AS(importedA->attribute<Vector3b>(MeshAttribute::Normal),
+        a.attribute<Vector3b>(MeshAttribute::Normal),
+        TestSuite::Compare::Container);
+
+    Containers::Optional<MeshData> importedB = importer->mesh(1);
+    CORRADE_VERIFY(importedB);
+    CORRADE_COMPARE(importedB->primitive(), MeshPrimitive::Lines);
+    CORRADE_COMPARE_AS(importedB->indices<UnsignedInt>(),
+        Containers::arrayView(indicesB),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(importedB->attribute<Vector3>(MeshAttribute::Position),
+        b.attribute<Vector3>(MeshAttribute::Position),
+        TestSuite::Compare::Container);
+
+    Containers::Optional<MeshData> importedC = importer->mesh(2);
+    CORRADE_VERIFY(importedC);
+    CORRADE_COMPARE_AS(importedC->indices<UnsignedByte>(),
+        Containers::arrayView(indicesC),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(importedC->attribute<Vector3b>(MeshAttribute::Position),
+        Containers::arrayView(positionsC),
+        TestSuite::Compare::Container);
+}
+
+void GltfSceneConverterTest::addMeshDeduplicate() {
+    auto&& data = AddMeshDeduplicateData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    struct Vertex {
+        Vector3 position;
+        Vector2 textureCoordinates;
+    } vertices[]{
+        {{-1.0f, -1.0f, 0.0f}, {0.0f, 0.0f}},
+        {{ 1.0f, -1.0f, 0.0f}, {1.0f, 0.0f}},
+        {{-1.0f,  1.0f, 0.0f}, {0.0f, 1.0f}},
+        {{ 1.0f,  1.0f, 0.0f}, {1.0f, 1.0f}},
+    };
+    const auto view = Containers::stridedArrayView(vertices);
+    const UnsignedShort indices[]{0, 1, 2, 2, 1, 3};
+    MeshData a{MeshPrimitive::Triangles,
+        {}, indices, MeshIndexData{indices},
+        {}, vertices, {
+            MeshAttributeData{MeshAttribute::Position, view.slice(&Vertex::position)},
+            MeshAttributeData{MeshAttribute::TextureCoordinates, view.slice(&Vertex::textureCoordinates)}
+        }};
+
+    /* The same contents in a different memory location, should reuse
+       everything including the accessors */
+    Vertex verticesCopy[4];
+    Utility::copy(vertices, verticesCopy);
+    const auto viewCopy = Containers::stridedArrayView(verticesCopy);
+    const UnsignedShort indicesCopy[]{0, 1, 2, 2, 1, 3};
+    MeshData b{MeshPrimitive::Triangles,
+        {}, indicesCopy, MeshIndexData{indicesCopy},
+        {}, verticesCopy, {
+            MeshAttributeData{MeshAttribute::Position, viewCopy.slice(&Vertex::position)},
+            MeshAttributeData{MeshAttribute::TextureCoordinates, viewCopy.slice(&Vertex::textureCoordinates)}
+        }};
+
+    /* Different indices, should reuse just the vertex data */
+    const UnsignedShort indicesDifferent[]{0, 1, 3, 0, 3, 2};
+    MeshData c{MeshPrimitive::Triangles,
+        {}, indicesDifferent, MeshIndexData{indicesDifferent},
+        {}, vertices, {
+            MeshAttributeData{MeshAttribute::Position, view.slice(&Vertex::position)},
+            MeshAttributeData{MeshAttribute::TextureCoordinates, view.slice(&Vertex::textureCoordinates)}
+        }};
+
+    Containers::Pointer<AbstractSceneConverter> converter =  _converterManager.instantiate("GltfSceneConverter");
+    converter->configuration().setValue("deduplicate", true);
+    converter->configuration().setValue("streamBuffer", data.streamBuffer);
+
+    Containers::String filename = Utility::Path::join(GLTFSCENECONVERTER_TEST_OUTPUT_DIR, "mesh-deduplicate.gltf");
+    Containers::String bufferFilename = Utility::Path::join(GLTFSCENECONVERTER_TEST_OUTPUT_DIR, "mesh-deduplicate.bin");
+    CORRADE_VERIFY(converter->beginFile(filename));
+    CORRADE_VERIFY(converter->add(a));
+    CORRADE_VERIFY(converter->add(b));
+    CORRADE_VERIFY(converter->add(c));
+    CORRADE_VERIFY(converter->endFile());
+
+    /* Index and vertex data of the first mesh, followed by just the indices
+       of the third */
+    Containers::Optional<std::size_t> bufferSize = Utility::Path::size(bufferFilename);
+    CORRADE_VERIFY(bufferSize);
+    CORRADE_COMPARE(*bufferSize, sizeof(indices) + sizeof(vertices) + sizeof(indicesDifferent));
+
+    const Containers::Optional<Containers::String> gltf = Utility::Path::readString(filename);
+    CORRADE_VERIFY(gltf);
+    const auto count = [](Containers::StringView string, Containers::StringView substring) {
+        std::size_t count = 0;
+        for(Containers::StringView found = string.find(substring); found; found = string.suffix(found.end()).find(substring))
+            ++count;
+        return count;
+    };
+    /* Three buffer views plus the buffer itself, four accessors */
+    CORRADE_COMPARE(count(*gltf, "\"byteLength\""), 3 + 1);
+    CORRADE_COMPARE(count(*gltf, "\"componentType\""), 4);
+
+    if(_importerManager.loadState("GltfImporter") == PluginManager::LoadState::NotFound)
+        CORRADE_SKIP("GltfImporter plugin not found, cannot test a roundtrip");
+
+    Containers::Pointer<AbstractImporter> importer = _importerManager.instantiate("GltfImporter");
+    CORRADE_VERIFY(importer->openFile(filename));
+    CORRADE_COMPARE(importer->meshCount(), 3);
+
+    for(UnsignedInt i: {0, 1, 2}) {
+        CORRADE_ITERATION(i);
+        Containers::Optional<MeshData> imported = importer->mesh(i);
+        CORRADE_VERIFY(imported);
+        CORRADE_COMPARE_AS(imported->indices<UnsignedShort>(),
+            Containers::arrayView(i == 2 ? indicesDifferent : indices),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(imported->attribute<Vector3>(MeshAttribute::Position),
+            view.slice(&Vertex::position),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(imported->attribute<Vector2>(MeshAttribute::TextureCoordinates),
+            view.slice(&Vertex::textureCoordinates),
+            TestSuite::Compare::Container);
+    }
+}
+
 void GltfSceneConverterTest::addMeshInvalid() {
     auto&& data = AddMeshInvalidData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
@@ -4308,6 +4733,189 @@ void GltfSceneConverterTest::addImageMultiple() {
     CORRADE_COMPARE(imported2->pixels<Color3ub>()[0][0], 0xff6632_rgb);
 }
 
+void GltfSceneConverterTest::addImageDeduplicate() {
+    if(_imageConverterManager.loadState("PngImageConverter") == PluginManager::LoadState::NotFound)
+        CORRADE_SKIP("PngImageConverter plugin not found, cannot test");
+
+    Containers::Pointer<AbstractSceneConverter> converter =  _converterManager.instantiate("GltfSceneConverter");
+    converter->configuration().setValue("deduplicate", true);
+    converter->configuration().setValue("imageConverter", "PngImageConverter");
+
+    CORRADE_VERIFY(converter->beginData());
+
+    /* The first two have the same pixels, just a different padding, the
+       third is different */
+    const char imageData0[]{'\x33', '\x66', '\xff', '\x00',
+                            '\x66', '\x33', '\xff', '\x00'};
+    const char imageData1[]{'\x33', '\x66', '\xff',
+                            '\x66', '\x33', '\xff'};
+    const char imageData2[]{'\xff', '\x66', '\x33', '\x00',
+                            '\x66', '\x33', '\xff', '\x00'};
+    CORRADE_VERIFY(converter->add(ImageView2D{PixelFormat::RGB8Unorm, {1, 2}, imageData0}));
+    CORRADE_VERIFY(converter->add(ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {1, 2}, imageData1}));
+    CORRADE_VERIFY(converter->add(ImageView2D{PixelFormat::RGB8Unorm, {1, 2}, imageData2}));
+
+    for(UnsignedInt i: {0, 1, 2})
+        CORRADE_VERIFY(converter->add(TextureData{TextureType::Texture2D,
+            SamplerFilter::Nearest,
+            SamplerFilter::Nearest,
+            SamplerMipmap::Base,
+            SamplerWrapping::Repeat,
+            i}));
+
+    Containers::Optional<Containers::Array<char>> out = converter->endData();
+    CORRADE_VERIFY(out);
+
+    if(_importerManager.loadState("GltfImporter") == PluginManager::LoadState::NotFound)
+        CORRADE_SKIP("GltfImporter plugin not found, cannot test a roundtrip");
+    if(_importerManager.loadState("PngImporter") == PluginManager::LoadState::NotFound)
+        CORRADE_SKIP("PngImporter plugin not found, cannot test a roundtrip");
+
+    Containers::Pointer<AbstractImporter> importer = _importerManager.instantiate("GltfImporter");
+    CORRADE_VERIFY(importer->openData(*out));
+    CORRADE_COMPARE(importer->image2DCount(), 2);
+    CORRADE_COMPARE(importer->textureCount(), 3);
+
+    Containers::Optional<TextureData> texture1 = importer->texture(1);
+    CORRADE_VERIFY(texture1);
+    CORRADE_COMPARE(texture1->image(), 0);
+
+    Containers::Optional<TextureData> texture2 = importer->texture(2);
+    CORRADE_VERIFY(texture2);
+    CORRADE_COMPARE(texture2->image(), 1);
+
+    Containers::Optional<ImageData2D> imported1 = importer->image2D(1);
+    CORRADE_VERIFY(imported1);
+    CORRADE_COMPARE(imported1->pixels<Color3ub>()[0][0], 0xff6633_rgb);
+}
+
+void GltfSceneConverterTest::addImageThreads() {
+    auto&& data = AddImageThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(_imageConverterManager.loadState("PngImageConverter") == PluginManager::LoadState::NotFound)
+        CORRADE_SKIP("PngImageConverter plugin not found, cannot test");
+
+    /* Images of different sizes interleaved with a mesh, to verify the
+       queued images don't affect placement of other data in the buffer */
+    Color3ub imageData0[16*16];
+    Color3ub imageData1[3*5];
+    for(std::size_t i = 0; i != Containers::arraySize(imageData0); ++i)
+        imageData0[i] = {UnsignedByte(i), UnsignedByte(255 - i), UnsignedByte(i*3)};
+    for(std::size_t i = 0; i != Containers::arraySize(imageData1); ++i)
+        imageData1[i] = {UnsignedByte(i*7), UnsignedByte(i), 128};
+    const Vector3 positions[]{{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}, {7.0f, 8.0f, 9.0f}};
+    MeshData mesh{MeshPrimitive::Triangles, {}, positions, {
+        MeshAttributeData{MeshAttribute::Position, Containers::arrayView(positions)}
+    }};
+
+    Containers::String filename = Utility::Path::join(GLTFSCENECONVERTER_TEST_OUTPUT_DIR, data.filename);
+    const auto convert = [&](UnsignedInt threads) {
+        Containers::Pointer<AbstractSceneConverter> converter =  _converterManager.instantiate("GltfSceneConverter");
+        converter->configuration().setValue("imageConverterThreads", threads);
+        CORRADE_VERIFY(converter->beginFile(filename));
+        CORRADE_VERIFY(converter->add(ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {16, 16}, imageData0}, "first"));
+        CORRADE_VERIFY(converter->add(mesh));
+        CORRADE_VERIFY(converter->add(ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {3, 5}, imageData1}));
+        CORRADE_VERIFY(converter->add(TextureData{TextureType::Texture2D,
+            SamplerFilter::Nearest,
+            SamplerFilter::Nearest,
+            SamplerMipmap::Base,
+            SamplerWrapping::Repeat,
+            1}));
+        CORRADE_VERIFY(converter->add(ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {3, 5}, imageData1}, "third"));
+        CORRADE_VERIFY(converter->endFile());
+    };
+
+    /* Convert serially first to have something to compare to. The external
+       images are named after the image ID so they get overwritten. */
+    {
+        CORRADE_ITERATION("serial");
+        convert(1);
+    }
+    Containers::Optional<Containers::Array<char>> expected = Utility::Path::read(filename);
+    CORRADE_VERIFY(expected);
+
+    /* The output should be exactly the same */
+    {
+        CORRADE_ITERATION("threaded");
+        convert(data.threads);
+    }
+    CORRADE_COMPARE_AS(filename,
+        Containers::StringView{Containers::arrayView(*expected)},
+        TestSuite::Compare::FileToString);
+}
+
+void GltfSceneConverterTest::addImageThreadsMoreImagesThanThreads() {
+    if(_imageConverterManager.loadState("PngImageConverter") == PluginManager::LoadState::NotFound)
+        CORRADE_SKIP("PngImageConverter plugin not found, cannot test");
+
+    /* The count of images waiting for conversion is limited to four times
+       the thread count, so this makes add() wait for the workers several
+       times. Each image is different to verify they don't get mixed up. */
+    Color3ub imageData[32][4*4];
+    for(std::size_t i = 0; i != Containers::arraySize(imageData); ++i)
+        for(std::size_t j = 0; j != Containers::arraySize(imageData[i]); ++j)
+            imageData[i][j] = {UnsignedByte(i), UnsignedByte(j), UnsignedByte(i*j)};
+
+    const auto convert = [&](UnsignedInt threads) -> Containers::Optional<Containers::Array<char>> {
+        Containers::Pointer<AbstractSceneConverter> converter =  _converterManager.instantiate("GltfSceneConverter");
+        converter->configuration().setValue("imageConverterThreads", threads);
+        if(!converter->beginData())
+            return {};
+        for(std::size_t i = 0; i != Containers::arraySize(imageData); ++i)
+            if(!converter->add(ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {4, 4}, imageData[i]}))
+                return {};
+        return converter->endData();
+    };
+
+    /* The output should be exactly the same as a serial conversion */
+    Containers::Optional<Containers::Array<char>> expected = convert(1);
+    CORRADE_VERIFY(expected);
+    Containers::Optional<Containers::Array<char>> out = convert(2);
+    CORRADE_VERIFY(out);
+    CORRADE_COMPARE(Containers::StringView{Containers::arrayView(*out)},
+        Containers::StringView{Containers::arrayView(*expected)});
+}
+
+void GltfSceneConverterTest::addImageThreadsFailed() {
+    if(_imageConverterManager.loadState("PngImageConverter") == PluginManager::LoadState::NotFound)
+        CORRADE_SKIP("PngImageConverter plugin not found, cannot test");
+
+    Containers::Pointer<AbstractSceneConverter> converter =  _converterManager.instantiate("GltfSceneConverter");
+    converter->configuration().setValue("imageConverterThreads", 2);
+
+    CORRADE_VERIFY(converter->beginData());
+
+    /* The failure is reported only at the end, the first image is fine */
+    CORRADE_VERIFY(converter->add(ImageView2D{PixelFormat::RGBA8Unorm, {1, 1}, "abc"}));
+    CORRADE_VERIFY(converter->add(ImageView2D{PixelFormat::R32F, {1, 1}, "abc"}));
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->endData());
+    CORRADE_COMPARE(out,
+        "Trade::StbImageConverter::convertToData(): PixelFormat::R32F is not supported for BMP/JPEG/PNG/TGA output\n"
+        "Trade::GltfSceneConverter: can't convert image 1\n");
+}
+
+void GltfSceneConverterTest::addImageThreadsInvalid() {
+    Containers::Pointer<AbstractSceneConverter> converter =  _converterManager.instantiate("GltfSceneConverter");
+    converter->configuration().setValue("imageConverterThreads", -3);
+
+    {
+        Containers::String out;
+        Error redirectError{&out};
+        CORRADE_VERIFY(!converter->beginData());
+        CORRADE_COMPARE(out, "Trade::GltfSceneConverter: expected imageConverterThreads to be zero or positive but got -3\n");
+    }
+
+    /* The state should be cleaned up properly so it's possible to begin
+       again */
+    converter->configuration().setValue("imageConverterThreads", 1);
+    CORRADE_VERIFY(converter->beginFile(Utility::Path::join(GLTFSCENECONVERTER_TEST_OUTPUT_DIR, "image-threads-invalid.glb")));
+}
+
 void GltfSceneConverterTest::addImageNoConverterManager() {
     /* Create a new manager that doesn't have the image converter manager
        registered; load the plugin directly from the build tree. Otherwise it's
@@ -0,0 +1,424 @@
+#ifndef Magnum_Trade_encode_h
+#define Magnum_Trade_encode_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Utility/Assert.h>
+#include <Magnum/Magnum.h>
+
+namespace Magnum { namespace Trade { namespace {
+
+/* Used only by GltfSceneConverter, but put into a dedicated header for easier
+   testing */
+
+/* EXT_meshopt_compression encoders, producing the bitstream described in
+   https://github.com/KhronosGroup/glTF/blob/main/extensions/2.0/Vendor/EXT_meshopt_compression/README.md#appendix-a-bitstream
+   and appending it to a growable array. The output is meant to be decodable
+   by any conforming decoder, not necessarily bit-exact with what the
+   meshoptimizer library itself produces. */
+
+/* Encodes a variable-length integer with 7 bits per byte */
+void encodeMeshoptVByte(Containers::Array<char>& out, UnsignedInt value) {
+    while(value >= 128) {
+        arrayAppend(out, char((value & 127)|128));
+        value >>= 7;
+    }
+    arrayAppend(out, char(value));
+}
+
+/* Encodes a zigzag delta from the previous index */
+void encodeMeshoptIndex(Containers::Array<char>& out, const UnsignedInt value, const UnsignedInt last) {
+    const UnsignedInt delta = value - last;
+    encodeMeshoptVByte(out, (delta << 1) ^ (0u - (delta >> 31)));
+}
+
+/* Mode 0, attributes, version 0 of the encoding */
+void encodeMeshoptAttributes(const Containers::ArrayView<const char> in, const std::size_t count, const std::size_t stride, Containers::Array<char>& out) {
+    CORRADE_INTERNAL_ASSERT(stride && stride <= 256 && stride % 4 == 0 && in.size() == count*stride);
+
+    const UnsignedByte* const input = reinterpret_cast<const UnsignedByte*>(in.data());
+    arrayAppend(out, char(0xa0));
+
+    /* The first vertex is a baseline for deltas in the first block, it's
+       then stored in the tail at the end. An empty input has an all-zero
+       baseline. */
+    UnsignedByte last[256]{};
+    if(count) for(std::size_t i = 0; i != stride; ++i)
+        last[i] = input[i];
+    UnsignedByte first[256];
+    for(std::size_t i = 0; i != stride; ++i)
+        first[i] = last[i];
+
+    /* Same block subdivision as in the decoder. Each byte of a vertex is
+       encoded separately, as groups of 16 zigzag deltas from the previous
+       vertex, with each group picking the smallest of the four possible
+       representations. */
+    const std::size_t blockSizeUnclamped = (8192/stride) & ~std::size_t{15};
+    const std::size_t blockSize = blockSizeUnclamped < 256 ? blockSizeUnclamped : 256;
+    UnsignedByte deltas[256];
+    for(std::size_t blockOffset = 0; blockOffset < count; blockOffset += blockSize) {
+        const std::size_t blockCount = count - blockOffset < blockSize ? count - blockOffset : blockSize;
+        const std::size_t groupCount = (blockCount + 15)/16;
+
+        for(std::size_t byte = 0; byte != stride; ++byte) {
+            UnsignedByte previous = last[byte];
+            for(std::size_t i = 0; i != blockCount; ++i) {
+                const UnsignedByte current = input[(blockOffset + i)*stride + byte];
+                const UnsignedByte delta = current - previous;
+                deltas[i] = UnsignedByte((delta << 1) ^ (delta & 0x80 ? 0xff : 0x00));
+                previous = current;
+            }
+            for(std::size_t i = blockCount; i != groupCount*16; ++i)
+                deltas[i] = 0;
+            last[byte] = previous;
+
+            /* Group header with two bits per group, filled as the groups get
+               written */
+            const std::size_t headerOffset = out.size();
+            for(char& i: arrayAppend(out, NoInit, (groupCount + 3)/4))
+                i = 0;
+
+            for(std::size_t group = 0; group != groupCount; ++group) {
+                const UnsignedByte* const groupDeltas = deltas + group*16;
+
+                /* Size of the 2- and 4-bit representation is the packed bytes
+                   plus deltas that don't fit and have to be stored fully */
+                std::size_t size2 = 4, size4 = 8;
+                bool allZero = true;
+                for(std::size_t i = 0; i != 16; ++i) {
+                    if(groupDeltas[i] >= 3) ++size2;
+                    if(groupDeltas[i] >= 15) ++size4;
+                    if(groupDeltas[i]) allZero = false;
+                }
+
+                UnsignedInt bitsLog2;
+                if(allZero) bitsLog2 = 0;
+                else if(size2 <= size4 && size2 <= 16) bitsLog2 = 1;
+                else if(size4 <= 16) bitsLog2 = 2;
+                else bitsLog2 = 3;
+                out[headerOffset + group/4] |= char(bitsLog2 << (group%4*2));
+
+                if(bitsLog2 == 3) {
+                    for(std::size_t i = 0; i != 16; ++i)
+                        arrayAppend(out, char(groupDeltas[i]));
+                } else if(bitsLog2 != 0) {
+                    const UnsignedInt bits = 1 << bitsLog2;
+                    const UnsignedInt deltasPerByte = 8/bits;
+                    const UnsignedByte sentinel = (1 << bits) - 1;
+                    const std::size_t packedOffset = out.size();
+                    for(char& i: arrayAppend(out, NoInit, 16/deltasPerByte))
+                        i = 0;
+                    for(std::size_t i = 0; i != 16; ++i) {
+                        const UnsignedByte delta = groupDeltas[i] < sentinel ? groupDeltas[i] : sentinel;
+                        out[packedOffset + i/deltasPerByte] |= char(delta << (8 - bits*(i%deltasPerByte + 1)));
+                    }
+                    for(std::size_t i = 0; i != 16; ++i)
+                        if(groupDeltas[i] >= sentinel)
+                            arrayAppend(out, char(groupDeltas[i]));
+                }
+            }
+        }
+    }
+
+    /* Tail with the first vertex, padded from the front to at least 32
+       bytes */
+    for(std::size_t i = stride; i < 32; ++i)
+        arrayAppend(out, '\0');
+    for(std::size_t i = 0; i != stride; ++i)
+        arrayAppend(out, char(first[i]));
+}
+
+/* Mode 1, triangles, version 1 of the encoding. Order of vertices in each
+   triangle may get rotated, preserving the winding. */
+void encodeMeshoptTriangles(const Containers::ArrayView<const UnsignedInt> indices, Containers::Array<char>& out) {
+    CORRADE_INTERNAL_ASSERT(indices.size() % 3 == 0);
+
+    /* Table of auxiliary codes for triangles that don't share an edge with a
+       recent triangle, stored at the end of the stream. Upper four bits
+       specify the second and lower the third vertex, either a new one (0) or
+       an index into the vertex FIFO. */
+    constexpr UnsignedByte CodeAuxTable[16]{
+        0x00, 0x76, 0x87, 0x56, 0x67, 0x78, 0xa9, 0x86,
+        0x65, 0x89, 0x68, 0x98, 0x01, 0x69, 0x00, 0x00
+    };
+
+    arrayAppend(out, char(0xe1));
+    /* One code byte per triangle, followed by data of variable length */
+    const std::size_t codeOffset = out.size();
+    arrayAppend(out, NoInit, indices.size()/3);
+    Containers::Array<char> data;
+
+    /* Recently seen edges and vertices, as ring buffers of 16 items, exactly
+       mirroring what the decoder does */
+    UnsignedInt edgeFifo[16][2];
+    UnsignedInt vertexFifo[16];
+    for(std::size_t i = 0; i != 16; ++i) {
+        edgeFifo[i][0] = edgeFifo[i][1] = ~UnsignedInt{};
+        vertexFifo[i] = ~UnsignedInt{};
+    }
+    std::size_t edgeFifoOffset = 0;
+    std::size_t vertexFifoOffset = 0;
+    const auto pushEdge = [&](const UnsignedInt a, const UnsignedInt b) {
+        edgeFifo[edgeFifoOffset][0] = a;
+        edgeFifo[edgeFifoOffset][1] = b;
+        edgeFifoOffset = (edgeFifoOffset + 1) & 15;
+    };
+    const auto pushVertex = [&](const UnsignedInt v, const bool advance) {
+        vertexFifo[vertexFifoOffset] = v;
+        vertexFifoOffset = (vertexFifoOffset + advance) & 15;
+    };
+    /* Index into the vertex FIFO as the decoder uses it for triangles not
+       sharing an edge, 1 to 14, or 0 if not found */
+    const auto findVertex = [&](const UnsignedInt v) -> UnsignedInt {
+        for(UnsignedInt i = 1; i != 15; ++i)
+            if(vertexFifo[(vertexFifoOffset - i) & 15] == v)
+                return i;
+        return 0;
+    };
+
+    UnsignedInt next = 0;
+    UnsignedInt last = 0;
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        const UnsignedInt rotations[3][3]{
+            {indices[i + 0], indices[i + 1], indices[i + 2]},
+            {indices[i + 1], indices[i + 2], indices[i + 0]},
+            {indices[i + 2], indices[i + 0], indices[i + 1]},
+        };
+        char& code = out[codeOffset + i/3];
+
+        /* Triangle sharing an edge with one of the recent triangles. Edge
+           FIFO indices are limited to 0 to 14 as 0xf0 and above are codes
+           for triangles without a shared edge. */
+        bool found = false;
+        for(const UnsignedInt (&rotation)[3]: rotations) {
+            const UnsignedInt a = rotation[0], b = rotation[1], c = rotation[2];
+            UnsignedInt fe = 0;
+            for(; fe != 15; ++fe) {
+                const UnsignedInt* const edge = edgeFifo[(edgeFifoOffset - 1 - fe) & 15];
+                if(edge[0] == a && edge[1] == b)
+                    break;
+            }
+            if(fe == 15)
+                continue;
+
+            /* The third vertex is either a new one, one of the recent ones
+               (1 to 12), a previous / next explicit one (13, 14) or an
+               explicit one (15) */
+            UnsignedInt fec = 0;
+            if(c == next) {
+                ++next;
+                pushVertex(c, true);
+            } else {
+                for(fec = 1; fec != 13; ++fec)
+                    if(vertexFifo[(vertexFifoOffset - 1 - fec) & 15] == c)
+                        break;
+                if(fec != 13) {
+                    pushVertex(c, false);
+                } else {
+                    if(c == last - 1)
+                        fec = 13;
+                    else if(c == last + 1)
+                        fec = 14;
+                    else {
+                        fec = 15;
+                        encodeMeshoptIndex(data, c, last);
+                    }
+                    last = c;
+                    pushVertex(c, true);
+                }
+            }
+
+            code = char((fe << 4)|fec);
+            pushEdge(c, b);
+            pushEdge(a, c);
+            found = true;
+            break;
+        }
+        if(found)
+            continue;
+
+        /* Prefer a rotation where the first vertex is a new one as that can
+           be encoded implicitly */
+        const UnsignedInt* rotation = rotations[0];
+        for(const UnsignedInt (&r)[3]: rotations) {
+            if(r[0] == next) {
+                rotation = r;
+                break;
+            }
+        }
+        const UnsignedInt a = rotation[0], b = rotation[1], c = rotation[2];
+
+        /* If the first vertex is new and the other two are either new or
+           in the vertex FIFO, try to find the combination in the auxiliary
+           code table. All FIFO lookups happen before any pushes. */
+        if(a == next) {
+            UnsignedInt nextB = next + 1;
+            UnsignedInt feb = 0, fec = 0;
+            bool inFifo = true;
+            if(b == nextB)
+                ++nextB;
+            else if(!(feb = findVertex(b)))
+                inFifo = false;
+            if(inFifo) {
+                if(c == nextB)
+                    ++nextB;
+                else if(!(fec = findVertex(c)))
+                    inFifo = false;
+            }
+
+            UnsignedInt tableIndex = 0;
+            if(inFifo) for(; tableIndex != 14; ++tableIndex)
+                if(CodeAuxTable[tableIndex] == ((feb << 4)|fec))
+                    break;
+            if(inFifo && tableIndex != 14) {
+                code = char(0xf0|tableIndex);
+                next = nextB;
+                pushVertex(a, true);
+                pushVertex(b, feb == 0);
+                pushVertex(c, fec == 0);
+                pushEdge(b, a);
+                pushEdge(c, b);
+                pushEdge(a, c);
+                continue;
+            }
+        }
+
+        /* Otherwise store the auxiliary code explicitly, with vertices that
+           are neither new nor in the FIFO encoded explicitly (15) */
+        UnsignedInt nextC = next;
+        UnsignedInt fea = 15, feb = 15, fec = 15;
+        if(a == nextC) {
+            fea = 0;
+            ++nextC;
+        }
+        if(b == nextC) {
+            feb = 0;
+            ++nextC;
+        } else if(const UnsignedInt fifoIndex = findVertex(b))
+            feb = fifoIndex;
+        if(c == nextC) {
+            fec = 0;
+            ++nextC;
+        } else if(const UnsignedInt fifoIndex = findVertex(c))
+            fec = fifoIndex;
+
+        /* A zero auxiliary code resets the new vertex counter in the decoder,
+           which is only correct if it's zero already. Encode all vertices
+           explicitly otherwise. Zero code with an implicit first vertex
+           would be handled by the table above already. */
+        if(feb == 0 && fec == 0 && next != 0) {
+            CORRADE_INTERNAL_ASSERT(fea == 15);
+            feb = fec = 15;
+            nextC = next;
+        }
+
+        code = char(fea == 0 ? 0xfe : 0xff);
+        arrayAppend(data, char((feb << 4)|fec));
+        if(fea == 15) {
+            encodeMeshoptIndex(data, a, last);
+            last = a;
+        }
+        if(feb == 15) {
+            encodeMeshoptIndex(data, b, last);
+            last = b;
+        }
+        if(fec == 15) {
+            encodeMeshoptIndex(data, c, last);
+            last = c;
+        }
+        next = nextC;
+        pushVertex(a, true);
+        pushVertex(b, feb == 0 || feb == 15);
+        pushVertex(c, fec == 0 || fec == 15);
+        pushEdge(b, a);
+        pushEdge(c, b);
+        pushEdge(a, c);
+    }
+
+    arrayAppend(out, data);
+    arrayAppend(out, Containers::arrayView(reinterpret_cast<const char*>(CodeAuxTable), 16));
+}
+
+/* Mode 2, indices, version 1 of the encoding. Used for index buffers that
+   aren't triangle lists. */
+void encodeMeshoptIndices(const Containers::ArrayView<const UnsignedInt> indices, Containers::Array<char>& out) {
+    arrayAppend(out, char(0xd1));
+
+    /* Each index is a delta from one of two previous indices, whichever is
+       closer, with the lowest bit selecting which */
+    UnsignedInt last[2]{};
+    for(const UnsignedInt index: indices) {
+        const UnsignedInt distance0 = index >= last[0] ? index - last[0] : last[0] - index;
+        const UnsignedInt distance1 = index >= last[1] ? index - last[1] : last[1] - index;
+        const UnsignedInt which = distance0 <= distance1 ? 0 : 1;
+        const UnsignedInt delta = index - last[which];
+        encodeMeshoptVByte(out, (((delta << 1) ^ (0u - (delta >> 31))) << 1)|which);
+        last[which] = index;
+    }
+
+    /* Padding for the decoder to be able to read five bytes at once */
+    for(std::size_t i = 0; i != 4; ++i)
+        arrayAppend(out, '\0');
+}
+
+/* Octahedral filter, applied in-place on four-component 8- or 16-bit signed
+   normalized vectors, with the first three components being a (not
+   necessarily normalized) direction. The direction is converted to
+   octahedral coordinates in the first two components with the third one
+   containing a scale, the fourth is left untouched. Lossy, but the decoded
+   vectors are normalized. */
+template<class T> void encodeMeshoptFilterOctahedral(const Containers::ArrayView<char> data) {
+    T* const values = reinterpret_cast<T*>(data.data());
+    const std::size_t count = data.size()/(4*sizeof(T));
+    const Float max = Float((1 << (sizeof(T)*8 - 1)) - 1);
+    for(std::size_t i = 0; i != count; ++i) {
+        T* const vector = values + i*4;
+
+        /* Project onto the octahedron, a zero vector stays zero */
+        Float x = vector[0];
+        Float y = vector[1];
+        const Float z = vector[2];
+        const Float length = std::abs(x) + std::abs(y) + std::abs(z);
+        const Float scale = length == 0.0f ? 0.0f : 1.0f/length;
+        x *= scale;
+        y *= scale;
+
+        /* Unfold the lower hemisphere */
+        const Float u = z >= 0.0f ? x : (1.0f - std::abs(y))*(x >= 0.0f ? 1.0f : -1.0f);
+        const Float v = z >= 0.0f ? y : (1.0f - std::abs(x))*(y >= 0.0f ? 1.0f : -1.0f);
+
+        vector[0] = T(Int(u*max + (u >= 0.0f ? 0.5f : -0.5f)));
+        vector[1] = T(Int(v*max + (v >= 0.0f ? 0.5f : -0.5f)));
+        vector[2] = T(Int(max));
+    }
+}
+
+}}}
+
+#endif
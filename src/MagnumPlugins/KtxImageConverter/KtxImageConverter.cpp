@@ -28,9 +28,11 @@
 #include "KtxImageConverter.h"
 
 #include <string>
+#include <thread>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/ScopeGuard.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/Containers/StringIterable.h>
 #include <Corrade/Utility/Algorithms.h>
@@ -46,6 +48,10 @@
 #include "Magnum/Implementation/formatPluginsVersion.h"
 #include "MagnumPlugins/KtxImporter/KtxHeader.h"
 
+#ifdef MAGNUM_KTXIMAGECONVERTER_WITH_ZSTD
+#include <zstd.h>
+#endif
+
 namespace Magnum { namespace Trade {
 
 namespace {
@@ -716,7 +722,7 @@ template<UnsignedInt dimensions, template<UnsignedInt, typename> class View> Con
     const auto vkFormat = vulkanFormat(format);
     CORRADE_INTERNAL_ASSERT(vkFormat.first() != Implementation::VK_FORMAT_UNDEFINED);
 
-    const Containers::Array<char> dataFormatDescriptor = fillDataFormatDescriptor(format, vkFormat.second());
+    Containers::Array<char> dataFormatDescriptor = fillDataFormatDescriptor(format, vkFormat.second());
 
     /* Fill key/value data. Values can be any byte-string but we only write
        constant text strings. Keys must be sorted alphabetically.
@@ -764,6 +770,53 @@ template<UnsignedInt dimensions, template<UnsignedInt, typename> class View> Con
         return {};
     }
 
+    const auto supercompressionSchemeName = configuration.value<Containers::StringView>("supercompressionScheme");
+    Implementation::SuperCompressionScheme supercompressionScheme;
+    if(!supercompressionSchemeName)
+        supercompressionScheme = Implementation::SuperCompressionScheme::None;
+    else if(supercompressionSchemeName == "zstd"_s) {
+        #ifdef MAGNUM_KTXIMAGECONVERTER_WITH_ZSTD
+        supercompressionScheme = Implementation::SuperCompressionScheme::Zstandard;
+        #else
+        Error{} << "Trade::KtxImageConverter::convertToData(): the plugin was built without Zstandard supercompression support";
+        return {};
+        #endif
+    } else {
+        Error{} << "Trade::KtxImageConverter::convertToData(): unsupported supercompression scheme" << supercompressionSchemeName;
+        return {};
+    }
+
+    /* With supercompression, the bytesPlane values in the DFD are required to
+       be zero as the level data no longer have a fixed size per plane */
+    if(supercompressionScheme != Implementation::SuperCompressionScheme::None)
+        reinterpret_cast<Implementation::KdfBasicBlockHeader*>(dataFormatDescriptor.exceptPrefix(sizeof(UnsignedInt)).data())->bytesPlane[0] = 0;
+
+    #ifdef MAGNUM_KTXIMAGECONVERTER_WITH_ZSTD
+    ZSTD_CCtx* const zstdContext = supercompressionScheme == Implementation::SuperCompressionScheme::Zstandard ? ZSTD_createCCtx() : nullptr;
+    Containers::ScopeGuard zstdContextGuard{zstdContext, ZSTD_freeCCtx};
+    if(zstdContext) {
+        /* Out-of-range compression levels are clamped by zstd itself */
+        ZSTD_CCtx_setParameter(zstdContext, ZSTD_c_compressionLevel, configuration.value<Int>("zstdLevel"));
+
+        /* Read as a signed value to catch negative values instead of having
+           them wrap around to billions of threads */
+        const Int zstdThreads = configuration.value<Int>("zstdThreads");
+        if(zstdThreads < 0) {
+            Error{} << "Trade::KtxImageConverter::convertToData(): expected zstdThreads to be zero or positive but got" << zstdThreads;
+            return {};
+        }
+
+        UnsignedInt threadCount = zstdThreads;
+        if(threadCount == 0)
+            threadCount = std::thread::hardware_concurrency();
+        /* zstd compresses on the calling thread if nbWorkers is 0, any other
+           value spawns that many workers. Setting it fails if zstd is built
+           without multithreading, in which case it stays single-threaded. */
+        if(threadCount > 1 && ZSTD_isError(ZSTD_CCtx_setParameter(zstdContext, ZSTD_c_nbWorkers, threadCount)) && !(converterFlags & ImageConverterFlag::Quiet))
+            Warning{} << "Trade::KtxImageConverter::convertToData(): zstd was built without multithreading support, compressing on a single thread";
+    }
+    #endif
+
     /* Value has to be a String instead of a StringView due to the generated
        writer name. The orientation and swizzle are however fortunately small
        enough to fit into SSO. */
@@ -826,8 +879,10 @@ template<UnsignedInt dimensions, template<UnsignedInt, typename> class View> Con
         return {};
     }
 
-    /* Fill level index */
+    /* Fill level index. With supercompression the levels get compressed
+       right away as the compressed size is needed to calculate the offsets. */
     Containers::Array<Implementation::KtxLevel> levelIndex{numMipmaps};
+    Containers::Array<Containers::Array<char>> compressedLevels{supercompressionScheme != Implementation::SuperCompressionScheme::None ? numMipmaps : 0};
 
     const std::size_t levelIndexSize = numMipmaps*sizeof(Implementation::KtxLevel);
     std::size_t levelOffset = sizeof(Implementation::KtxHeader) + levelIndexSize +
@@ -853,17 +908,40 @@ template<UnsignedInt dimensions, template<UnsignedInt, typename> class View> Con
 
         /* Offset needs to be aligned to the least common multiple of the
            texel/block size and 4. Not needed with supercompression. */
-        const std::size_t alignment = leastCommonMultiple(unitDataSize, 4);
-        levelOffset = (levelOffset + alignment - 1)/alignment*alignment;
+        if(supercompressionScheme == Implementation::SuperCompressionScheme::None) {
+            const std::size_t alignment = leastCommonMultiple(unitDataSize, 4);
+            levelOffset = (levelOffset + alignment - 1)/alignment*alignment;
+        }
 
         const Vector3i unitCount = (Vector3i::pad(mipSize, 1) + unitSize - Vector3i{1})/unitSize;
         const std::size_t levelSize = unitDataSize*unitCount.product();
 
         levelIndex[mip].byteOffset = levelOffset;
-        levelIndex[mip].byteLength = levelSize;
         levelIndex[mip].uncompressedByteLength = levelSize;
 
-        levelOffset += levelSize;
+        #ifdef MAGNUM_KTXIMAGECONVERTER_WITH_ZSTD
+        if(supercompressionScheme == Implementation::SuperCompressionScheme::Zstandard) {
+            Containers::Array<char> pixels{NoInit, levelSize};
+            copyPixels(image, pixels);
+            endianSwap(pixels, formatTypeSize(format));
+
+            /* The array is left at the upper bound size, only the prefix
+               given by byteLength gets copied to the output */
+            compressedLevels[mip] = Containers::Array<char>{NoInit, ZSTD_compressBound(levelSize)};
+            const std::size_t compressedSize = ZSTD_compress2(zstdContext, compressedLevels[mip].data(), compressedLevels[mip].size(), pixels.data(), pixels.size());
+            if(ZSTD_isError(compressedSize)) {
+                Error{} << "Trade::KtxImageConverter::convertToData(): Zstandard compression of level" << mip << "failed:" << ZSTD_getErrorName(compressedSize);
+                return {};
+            }
+
+            levelIndex[mip].byteLength = compressedSize;
+        } else
+        #endif
+        {
+            levelIndex[mip].byteLength = levelSize;
+        }
+
+        levelOffset += levelIndex[mip].byteLength;
     }
 
     const std::size_t dataSize = levelOffset;
@@ -896,15 +974,17 @@ template<UnsignedInt dimensions, template<UnsignedInt, typename> class View> Con
         header.faceCount = 1;
     }
     header.levelCount = levelIndex.size();
-    header.supercompressionScheme = Implementation::SuperCompressionScheme::None;
+    header.supercompressionScheme = supercompressionScheme;
 
     for(UnsignedInt i = 0; i != levelIndex.size(); ++i) {
         const Implementation::KtxLevel& level = levelIndex[i];
-        const auto& image = imageLevels[i];
         const auto pixels = data.sliceSize(level.byteOffset, level.byteLength);
-        copyPixels(image, pixels);
-
-        endianSwap(pixels, header.typeSize);
+        if(supercompressionScheme != Implementation::SuperCompressionScheme::None) {
+            Utility::copy(compressedLevels[i].prefix(level.byteLength), pixels);
+        } else {
+            copyPixels(imageLevels[i], pixels);
+            endianSwap(pixels, header.typeSize);
+        }
 
         Utility::Endianness::littleEndianInPlace(
             level.byteOffset, level.byteLength,
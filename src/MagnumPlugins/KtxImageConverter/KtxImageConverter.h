@@ -126,9 +126,16 @@ supported.
 
 @subsection Trade-KtxImageConverter-behavior-supercompression Supercompression
 
-Saving files with [supercompression](https://github.khronos.org/KTX-Specification/#supercompressionSchemes)
-is not supported. You can however use @ref BasisImageConverter to create
-Basis-supercompressed KTX2 files.
+Files can be saved with Zstandard [supercompression](https://github.khronos.org/KTX-Specification/#supercompressionSchemes)
+by setting the @cb{.ini} supercompressionScheme @ce
+@ref Trade-KtxImageConverter-configuration "configuration option" to
+@cpp "zstd" @ce. This is available only if the plugin is built with
+[zstd](https://github.com/facebook/zstd), which is an optional dependency used
+automatically if found when building the plugin. Each level is compressed
+separately, with the compression level and the number of zstd worker threads
+controlled by the @cb{.ini} zstdLevel @ce and @cb{.ini} zstdThreads @ce
+options. Other supercompression schemes are not supported. You can however use
+@ref BasisImageConverter to create Basis-supercompressed KTX2 files.
 
 @section Trade-KtxImageConverter-configuration Plugin-specific configuration
 
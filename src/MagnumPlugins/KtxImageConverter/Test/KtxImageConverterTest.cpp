@@ -122,6 +122,11 @@ struct KtxImageConverterTest: TestSuite::Tester {
     void configurationEmpty();
     void configurationSorted();
 
+    void supercompressionZstd();
+    void supercompressionZstdNotAvailable();
+    void supercompressionZstdInvalidThreadCount();
+    void supercompressionInvalid();
+
     void convertTwice();
 
     /* Explicitly forbid system-wide plugin dependencies */
@@ -340,6 +345,18 @@ const struct {
     {"invalid characters", "1012", "invalid characters in swizzle 1012"}
 };
 
+const struct {
+    const char* name;
+    Int level;
+    Int threads;
+} SupercompressionZstdData[]{
+    {"", 3, 1},
+    {"fastest level", -5, 1},
+    {"highest level", 22, 1},
+    {"multithreaded", 3, 4},
+    {"hardware concurrency", 3, 0}
+};
+
 Containers::Array<char> readDataFormatDescriptor(Containers::ArrayView<const char> fileData) {
     CORRADE_INTERNAL_ASSERT(fileData.size() >= sizeof(Implementation::KtxHeader));
     const Implementation::KtxHeader& header = *reinterpret_cast<const Implementation::KtxHeader*>(fileData.data());
@@ -438,7 +455,14 @@ KtxImageConverterTest::KtxImageConverterTest() {
     addInstancedTests({&KtxImageConverterTest::configurationEmpty},
         Containers::arraySize(QuietData));
 
-    addTests({&KtxImageConverterTest::configurationSorted,
+    addTests({&KtxImageConverterTest::configurationSorted});
+
+    addInstancedTests({&KtxImageConverterTest::supercompressionZstd},
+        Containers::arraySize(SupercompressionZstdData));
+
+    addTests({&KtxImageConverterTest::supercompressionZstdNotAvailable,
+              &KtxImageConverterTest::supercompressionZstdInvalidThreadCount,
+              &KtxImageConverterTest::supercompressionInvalid,
 
               &KtxImageConverterTest::convertTwice});
 
@@ -1456,6 +1480,123 @@ void KtxImageConverterTest::configurationSorted() {
     CORRADE_VERIFY(swizzleOffset.begin() < writerOffset.begin());
 }
 
+void KtxImageConverterTest::supercompressionZstd() {
+    auto&& data = SupercompressionZstdData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    #ifndef KTXIMAGECONVERTER_WITH_ZSTD
+    CORRADE_SKIP("KtxImageConverter was built without Zstandard support, cannot test");
+    #else
+    Containers::Pointer<AbstractImageConverter> converter = _converterManager.instantiate("KtxImageConverter");
+    /* Zstd may be built without multithreading, which prints a warning */
+    converter->addFlags(ImageConverterFlag::Quiet);
+    converter->configuration().setValue("supercompressionScheme", "zstd");
+    converter->configuration().setValue("zstdLevel", data.level);
+    converter->configuration().setValue("zstdThreads", data.threads);
+
+    constexpr Vector2i size{4, 3};
+    const auto mip0 = Containers::arrayCast<const Color3ub>(Containers::arrayView(
+        PatternRgbData[Containers::arraySize(PatternRgbData) - 1]));
+    const Color3ub mip1[2]{0xffffff_rgb, 0x007f7f_rgb};
+    const Color3ub mip2[1]{0x000000_rgb};
+
+    PixelStorage storage;
+    storage.setAlignment(1);
+    const ImageView2D inputImages[3]{
+        ImageView2D{storage, PixelFormat::RGB8Srgb, Math::max(size >> 0, 1), mip0},
+        ImageView2D{storage, PixelFormat::RGB8Srgb, Math::max(size >> 1, 1), mip1},
+        ImageView2D{storage, PixelFormat::RGB8Srgb, Math::max(size >> 2, 1), mip2}
+    };
+
+    Containers::Optional<Containers::Array<char>> output = converter->convertToData(inputImages);
+    CORRADE_VERIFY(output);
+
+    const Implementation::KtxHeader& header = *reinterpret_cast<const Implementation::KtxHeader*>(output->data());
+    CORRADE_COMPARE(Utility::Endianness::littleEndian(header.supercompressionScheme), Implementation::SuperCompressionScheme::Zstandard);
+    CORRADE_COMPARE(Utility::Endianness::littleEndian(header.levelCount), 3);
+
+    /* Uncompressed lengths are the actual pixel data sizes, levels are stored
+       from smallest to largest without any alignment padding in between */
+    const auto levels = Containers::arrayCast<const Implementation::KtxLevel>(output->sliceSize(sizeof(Implementation::KtxHeader), 3*sizeof(Implementation::KtxLevel)));
+    CORRADE_COMPARE(Utility::Endianness::littleEndian(levels[0].uncompressedByteLength), 4*3*3);
+    CORRADE_COMPARE(Utility::Endianness::littleEndian(levels[1].uncompressedByteLength), 2*1*3);
+    CORRADE_COMPARE(Utility::Endianness::littleEndian(levels[2].uncompressedByteLength), 1*1*3);
+    CORRADE_COMPARE(Utility::Endianness::littleEndian(levels[1].byteOffset),
+        Utility::Endianness::littleEndian(levels[2].byteOffset) +
+        Utility::Endianness::littleEndian(levels[2].byteLength));
+    CORRADE_COMPARE(Utility::Endianness::littleEndian(levels[0].byteOffset),
+        Utility::Endianness::littleEndian(levels[1].byteOffset) +
+        Utility::Endianness::littleEndian(levels[1].byteLength));
+    CORRADE_COMPARE(Utility::Endianness::littleEndian(levels[0].byteOffset) +
+        Utility::Endianness::littleEndian(levels[0].byteLength), output->size());
+
+    /* The bytesPlane values are required to be zero with supercompression */
+    Containers::Array<char> dfd = readDataFormatDescriptor(*output);
+    const Implementation::KdfBasicBlockHeader& dfdHeader = *reinterpret_cast<const Implementation::KdfBasicBlockHeader*>(dfd.exceptPrefix(sizeof(UnsignedInt)).data());
+    CORRADE_COMPARE(dfdHeader.bytesPlane[0], 0);
+
+    if(_importerManager.loadState("KtxImporter") == PluginManager::LoadState::NotFound)
+        CORRADE_SKIP("KtxImporter plugin not found, cannot test");
+
+    /* KtxImporter is built in the same tree, so it has Zstd support as well */
+    Containers::Pointer<AbstractImporter> importer = _importerManager.instantiate("KtxImporter");
+    CORRADE_VERIFY(importer->openData(*output));
+    CORRADE_COMPARE(importer->image2DLevelCount(0), 3);
+    for(UnsignedInt i = 0; i != 3; ++i) {
+        CORRADE_ITERATION(i);
+        Containers::Optional<Trade::ImageData2D> image = importer->image2D(0, i);
+        CORRADE_VERIFY(image);
+        CORRADE_COMPARE(image->size(), inputImages[i].size());
+        CORRADE_COMPARE_AS(image->data(), inputImages[i].data(), TestSuite::Compare::Container);
+    }
+    #endif
+}
+
+void KtxImageConverterTest::supercompressionZstdNotAvailable() {
+    #ifdef KTXIMAGECONVERTER_WITH_ZSTD
+    CORRADE_SKIP("KtxImageConverter was built with Zstandard support, cannot test");
+    #else
+    Containers::Pointer<AbstractImageConverter> converter = _converterManager.instantiate("KtxImageConverter");
+    converter->configuration().setValue("supercompressionScheme", "zstd");
+
+    Containers::String out;
+    Error redirectError{&out};
+
+    const UnsignedByte bytes[4]{};
+    CORRADE_VERIFY(!converter->convertToData(ImageView2D{PixelFormat::RGBA8Unorm, {1, 1}, bytes}));
+    CORRADE_COMPARE(out, "Trade::KtxImageConverter::convertToData(): the plugin was built without Zstandard supercompression support\n");
+    #endif
+}
+
+void KtxImageConverterTest::supercompressionZstdInvalidThreadCount() {
+    #ifndef KTXIMAGECONVERTER_WITH_ZSTD
+    CORRADE_SKIP("KtxImageConverter was built without Zstandard support, cannot test");
+    #else
+    Containers::Pointer<AbstractImageConverter> converter = _converterManager.instantiate("KtxImageConverter");
+    converter->configuration().setValue("supercompressionScheme", "zstd");
+    converter->configuration().setValue("zstdThreads", -1);
+
+    Containers::String out;
+    Error redirectError{&out};
+
+    const UnsignedByte bytes[4]{};
+    CORRADE_VERIFY(!converter->convertToData(ImageView2D{PixelFormat::RGBA8Unorm, {1, 1}, bytes}));
+    CORRADE_COMPARE(out, "Trade::KtxImageConverter::convertToData(): expected zstdThreads to be zero or positive but got -1\n");
+    #endif
+}
+
+void KtxImageConverterTest::supercompressionInvalid() {
+    Containers::Pointer<AbstractImageConverter> converter = _converterManager.instantiate("KtxImageConverter");
+    converter->configuration().setValue("supercompressionScheme", "basislz");
+
+    Containers::String out;
+    Error redirectError{&out};
+
+    const UnsignedByte bytes[4]{};
+    CORRADE_VERIFY(!converter->convertToData(ImageView2D{PixelFormat::RGBA8Unorm, {1, 1}, bytes}));
+    CORRADE_COMPARE(out, "Trade::KtxImageConverter::convertToData(): unsupported supercompression scheme basislz\n");
+}
+
 void KtxImageConverterTest::convertTwice() {
     Containers::Pointer<AbstractImageConverter> converter = _converterManager.instantiate("KtxImageConverter");
 
@@ -27,5 +27,6 @@
 
 #cmakedefine KTXIMAGECONVERTER_PLUGIN_FILENAME "${KTXIMAGECONVERTER_PLUGIN_FILENAME}"
 #cmakedefine KTXIMPORTER_PLUGIN_FILENAME "${KTXIMPORTER_PLUGIN_FILENAME}"
+#cmakedefine KTXIMAGECONVERTER_WITH_ZSTD
 #define KTXIMPORTER_TEST_DIR "${KTXIMPORTER_TEST_DIR}"
 #define KTXIMAGECONVERTER_TEST_DIR "${KTXIMAGECONVERTER_TEST_DIR}"
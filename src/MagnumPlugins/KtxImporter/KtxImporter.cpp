@@ -54,6 +54,13 @@
 #include <Magnum/Trade/TextureData.h>
 #endif
 
+#ifdef MAGNUM_KTXIMPORTER_WITH_ZSTD
+#include <zstd.h>
+#endif
+#ifdef MAGNUM_KTXIMPORTER_WITH_ZLIB
+#include <zlib.h>
+#endif
+
 namespace Magnum { namespace Trade {
 
 namespace {
@@ -257,15 +264,77 @@ Containers::Optional<Format> decodeFormat(Implementation::VkFormat vkFormat) {
     return {};
 }
 
+bool isSupercompressionSupported(const Implementation::SuperCompressionScheme scheme) {
+    switch(scheme) {
+        case Implementation::SuperCompressionScheme::None:
+        #ifdef MAGNUM_KTXIMPORTER_WITH_ZSTD
+        case Implementation::SuperCompressionScheme::Zstandard:
+        #endif
+        #ifdef MAGNUM_KTXIMPORTER_WITH_ZLIB
+        case Implementation::SuperCompressionScheme::ZLIB:
+        #endif
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool decompressLevel(const char* const messagePrefix, const Implementation::SuperCompressionScheme scheme, const Containers::ArrayView<const char> in, const Containers::ArrayView<char> out) {
+    std::size_t size{};
+    switch(scheme) {
+        #ifdef MAGNUM_KTXIMPORTER_WITH_ZSTD
+        case Implementation::SuperCompressionScheme::Zstandard: {
+            size = ZSTD_decompress(out.data(), out.size(), in.data(), in.size());
+            if(ZSTD_isError(size)) {
+                Error{} << messagePrefix << "Zstandard decompression failed:" << ZSTD_getErrorName(size);
+                return false;
+            }
+        } break;
+        #endif
+        #ifdef MAGNUM_KTXIMPORTER_WITH_ZLIB
+        case Implementation::SuperCompressionScheme::ZLIB: {
+            uLongf outSize = out.size();
+            const int result = uncompress(reinterpret_cast<Bytef*>(out.data()), &outSize, reinterpret_cast<const Bytef*>(in.data()), in.size());
+            if(result != Z_OK) {
+                Error{} << messagePrefix << "ZLIB decompression failed:" << zError(result);
+                return false;
+            }
+            size = outSize;
+        } break;
+        #endif
+        /* Other schemes are rejected in doOpenData() already */
+        default: CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+
+    if(size != out.size()) {
+        Error{} << messagePrefix << "expected" << out.size() << "bytes of decompressed level data but got" << size;
+        return false;
+    }
+
+    return true;
+}
+
 }
 
 struct KtxImporter::File {
     struct LevelData {
         Vector3i size;
+        /* Image data if the file isn't supercompressed, otherwise the whole
+           supercompressed level, shared by all images in it */
         Containers::ArrayView<char> data;
+        /* If the file is supercompressed, size of the whole decompressed
+           level and offset of the image data in it. The image data size is
+           calculated from the level size. */
+        std::size_t decompressedLevelSize;
+        std::size_t decompressedOffset;
     };
 
     Containers::Array<char> in;
+    /* Whether the input data is owned externally and thus guaranteed to stay
+       in scope, used for zero-copy import */
+    bool inExternallyOwned;
+
+    Implementation::SuperCompressionScheme supercompressionScheme;
 
     /* Dimensions of the source image (1-3) */
     UnsignedByte numDimensions;
@@ -282,6 +351,11 @@ struct KtxImporter::File {
     /* Usually only one image with n or n+1 dimensions, multiple images for
        3D array layers */
     Containers::Array<Containers::Array<LevelData>> imageData;
+
+    /* Last decompressed supercompressed level that contains multiple images,
+       kept to not have to decompress it again for each image in it */
+    Containers::Array<char> decompressedLevel;
+    UnsignedInt decompressedLevelId = ~UnsignedInt{};
 };
 
 KtxImporter::KtxImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): AbstractImporter{manager, plugin} {}
@@ -504,11 +578,13 @@ void KtxImporter::doOpenData(Containers::Array<char>&& data, DataFlags dataFlags
         return;
     }
 
-    /** @todo Support supercompression */
-    if(header.supercompressionScheme != Implementation::SuperCompressionScheme::None) {
-        Error{} << "Trade::KtxImporter::openData(): supercompression is currently not supported";
+    /* Zstandard and ZLIB supercompression is decoded in doImage(), if the
+       plugin was built with the corresponding libraries */
+    if(!isSupercompressionSupported(header.supercompressionScheme)) {
+        Error{} << "Trade::KtxImporter::openData(): supercompression scheme" << UnsignedInt(header.supercompressionScheme) << "is not supported";
         return;
     }
+    f->supercompressionScheme = header.supercompressionScheme;
 
     /* typeSize is the size of the format's underlying type, not the texel
        size, e.g. 2 for RG16F. For any sane format it should be a
@@ -553,6 +629,7 @@ void KtxImporter::doOpenData(Containers::Array<char>&& data, DataFlags dataFlags
         f->in = Utility::move(data);
     else
         f->in = Containers::Array<char>{InPlaceInit, data};
+    f->inExternallyOwned = !!(dataFlags & DataFlag::ExternallyOwned);
 
     /* The level index contains byte ranges for each mipmap, from largest to
        smallest. Each mipmap contains tightly packed images ordered by
@@ -610,15 +687,54 @@ void KtxImporter::doOpenData(Containers::Array<char>&& data, DataFlags dataFlags
             imageLength = levelSize.product()*f->pixelFormat.size;
         const std::size_t totalLength = imageLength*numImages;
 
-        if(level.byteLength < totalLength) {
-            Error{} << "Trade::KtxImporter::openData(): level data too short, "
-                "expected at least" << totalLength << "bytes but got" << level.byteLength;
-            return;
-        }
+        /* Supercompressed levels are decompressed only once actually
+           requested in doImage(), so check just the uncompressed length
+           here. Unlike with uncompressed data it has to match exactly, as
+           it's used to size the decompression buffer and a larger value
+           would allow a file to request an arbitrarily large allocation. */
+        if(f->supercompressionScheme != Implementation::SuperCompressionScheme::None) {
+            if(level.uncompressedByteLength < totalLength) {
+                Error{} << "Trade::KtxImporter::openData(): uncompressed level data too short, "
+                    "expected at least" << totalLength << "bytes but got" << level.uncompressedByteLength;
+                return;
+            }
+            if(level.uncompressedByteLength > totalLength) {
+                Error{} << "Trade::KtxImporter::openData(): uncompressed level data too long, "
+                    "expected" << totalLength << "bytes but got" << level.uncompressedByteLength;
+                return;
+            }
+
+            /* Zstandard frames usually contain the decompressed size as well,
+               check it upfront to not allocate the output only to fail
+               during decompression */
+            #ifdef MAGNUM_KTXIMPORTER_WITH_ZSTD
+            if(f->supercompressionScheme == Implementation::SuperCompressionScheme::Zstandard) {
+                const Containers::ArrayView<const char> levelData = f->in.sliceSize(level.byteOffset, level.byteLength);
+                const unsigned long long frameContentSize = ZSTD_getFrameContentSize(levelData.data(), levelData.size());
+                if(frameContentSize != ZSTD_CONTENTSIZE_UNKNOWN &&
+                   frameContentSize != ZSTD_CONTENTSIZE_ERROR &&
+                   frameContentSize != totalLength)
+                {
+                    Error{} << "Trade::KtxImporter::openData(): expected" << totalLength << "bytes of uncompressed level data but the Zstandard frame contains" << frameContentSize;
+                    return;
+                }
+            }
+            #endif
 
-        for(UnsignedInt image = 0; image != numImages; ++image) {
-            const std::size_t offset = level.byteOffset + image*imageLength;
-            f->imageData[image][i] = {levelSize, f->in.sliceSize(offset, imageLength)};
+            for(UnsignedInt image = 0; image != numImages; ++image)
+                f->imageData[image][i] = {levelSize, f->in.sliceSize(level.byteOffset, level.byteLength), totalLength, image*imageLength};
+
+        } else {
+            if(level.byteLength < totalLength) {
+                Error{} << "Trade::KtxImporter::openData(): level data too short, "
+                    "expected at least" << totalLength << "bytes but got" << level.byteLength;
+                return;
+            }
+
+            for(UnsignedInt image = 0; image != numImages; ++image) {
+                const std::size_t offset = level.byteOffset + image*imageLength;
+                f->imageData[image][i] = {levelSize, f->in.sliceSize(offset, imageLength), 0, 0};
+            }
         }
 
         /* Halve each dimension, rounding down */
@@ -861,10 +977,83 @@ void KtxImporter::doOpenData(Containers::Array<char>&& data, DataFlags dataFlags
     _f = Utility::move(f);
 }
 
-template<UnsignedInt dimensions> ImageData<dimensions> KtxImporter::doImage(const char* messagePrefix, UnsignedInt id, UnsignedInt level) {
+template<UnsignedInt dimensions> Containers::Optional<ImageData<dimensions>> KtxImporter::doImage(const char* messagePrefix, UnsignedInt id, UnsignedInt level) {
     const File::LevelData& levelData = _f->imageData[id][level];
     const auto size = Math::Vector<dimensions, Int>::pad(levelData.size);
-    Containers::Array<char> data{NoInit, levelData.data.size()};
+
+    /* Size of the image data. Without supercompression it's directly the
+       data view, otherwise it's calculated the same way as in doOpenData(). */
+    std::size_t dataSize;
+    if(_f->supercompressionScheme == Implementation::SuperCompressionScheme::None)
+        dataSize = levelData.data.size();
+    else if(_f->pixelFormat.isCompressed) {
+        const Vector3i& blockSize = _f->pixelFormat.blockSize;
+        dataSize = ((levelData.size + (blockSize - Vector3i{1}))/blockSize).product()*_f->pixelFormat.size;
+    } else
+        dataSize = levelData.size.product()*_f->pixelFormat.size;
+
+    /* Adjust pixel storage if row size is not four byte aligned */
+    PixelStorage storage;
+    if(!_f->pixelFormat.isCompressed && (levelData.size.x()*_f->pixelFormat.size)%4 != 0)
+        storage.setAlignment(1);
+
+    /* If the memory is owned externally and is thus guaranteed to stay in
+       scope, zero-copy import is requested and the data can be used as-is,
+       reference them directly. That's the case if the file isn't
+       supercompressed, there's no flip or swizzle to perform and either the
+       type is single-byte or the system is Little-Endian, i.e. no endian swap
+       is needed either. */
+    if(_f->inExternallyOwned && configuration().value<bool>("zeroCopy") &&
+       _f->supercompressionScheme == Implementation::SuperCompressionScheme::None &&
+       _f->flip.none() &&
+       _f->pixelFormat.swizzle == SwizzleType::None
+       #ifdef CORRADE_TARGET_BIG_ENDIAN
+       && _f->pixelFormat.typeSize == 1
+       #endif
+    ) {
+        if(_f->pixelFormat.isCompressed)
+            return ImageData<dimensions>{_f->pixelFormat.compressed, size, DataFlags{}, levelData.data, ImageFlag<dimensions>(UnsignedShort(_f->imageFlags))};
+        return ImageData<dimensions>{storage, _f->pixelFormat.uncompressed, size, DataFlags{}, levelData.data, ImageFlag<dimensions>(UnsignedShort(_f->imageFlags))};
+    }
+
+    Containers::Array<char> data{NoInit, dataSize};
+
+    /* Decompress the level if the file is supercompressed. It's done on
+       demand instead of at open time to not have the whole decompressed file
+       in memory. If the level contains just this image and it doesn't need to
+       be flipped (or can be flipped in-place, which is the case of
+       block-compressed data), decompress directly to the output, skipping
+       the copy below. Otherwise decompress the whole level to a temporary
+       array and take the image slice from there. If the level contains
+       multiple images, the temporary array is kept until a different level
+       is requested, so importing all images in a level decompresses it just
+       once. */
+    Containers::ArrayView<const char> levelImageData = levelData.data;
+    Containers::Array<char> decompressed;
+    if(_f->supercompressionScheme != Implementation::SuperCompressionScheme::None) {
+        const bool multipleImages = levelData.decompressedLevelSize != dataSize;
+        Containers::ArrayView<char> decompressedLevel;
+        if(multipleImages && _f->decompressedLevelId == level) {
+            decompressedLevel = _f->decompressedLevel;
+        } else {
+            if(!multipleImages && (_f->pixelFormat.isCompressed || _f->flip.none()))
+                decompressedLevel = data;
+            else {
+                decompressed = Containers::Array<char>{NoInit, levelData.decompressedLevelSize};
+                decompressedLevel = decompressed;
+            }
+
+            if(!decompressLevel(messagePrefix, _f->supercompressionScheme, levelData.data, decompressedLevel))
+                return {};
+
+            if(multipleImages) {
+                _f->decompressedLevel = Utility::move(decompressed);
+                _f->decompressedLevelId = level;
+            }
+        }
+
+        levelImageData = decompressedLevel.sliceSize(levelData.decompressedOffset, dataSize);
+    }
 
     /* Block-compressed images don't have any flipping, swizzling or endian
        swapping performed on them. Special-casing this mainly to avoid having
@@ -875,7 +1064,10 @@ template<UnsignedInt dimensions> ImageData<dimensions> KtxImporter::doImage(cons
         CORRADE_INTERNAL_ASSERT(_f->pixelFormat.swizzle == SwizzleType::None);
         CORRADE_INTERNAL_ASSERT(_f->pixelFormat.typeSize == 1);
 
-        Utility::copy(levelData.data, data);
+        /* If the data were decompressed directly to the output, the copy
+           isn't needed */
+        if(levelImageData.data() != data.data())
+            Utility::copy(levelImageData, data);
         /** @todo clean this up once blocks() is a thing */
         const CompressedPixelFormat format = _f->pixelFormat.compressed;
         const Vector3i blockSize = compressedPixelFormatBlockSize(format);
@@ -921,7 +1113,7 @@ template<UnsignedInt dimensions> ImageData<dimensions> KtxImporter::doImage(cons
 
     /* Copy image data, flipping along axes if necessary. Assuming src is
        tightly packed, stride gets calculated implicitly. */
-    Containers::StridedArrayView4D<const char> src{levelData.data, {
+    Containers::StridedArrayView4D<const char> src{levelImageData, {
         std::size_t(levelData.size.z()),
         std::size_t(levelData.size.y()),
         std::size_t(levelData.size.x()),
@@ -936,19 +1128,16 @@ template<UnsignedInt dimensions> ImageData<dimensions> KtxImporter::doImage(cons
     if(_f->flip[0])
         src = src.flipped<2>();
 
-    /* Without flipped dimensions this becomes a single memcpy */
-    Utility::copy(src, dst);
+    /* Without flipped dimensions this becomes a single memcpy. If the data
+       were decompressed directly to the output, there's nothing to copy. */
+    if(levelImageData.data() != data.data())
+        Utility::copy(src, dst);
 
     /* Swizzle BGR(A) if necessary */
     swizzlePixels(_f->pixelFormat.swizzle, _f->pixelFormat.typeSize, data);
 
     endianSwap(data, _f->pixelFormat.typeSize);
 
-    /* Adjust pixel storage if row size is not four byte aligned */
-    PixelStorage storage;
-    if((levelData.size.x()*_f->pixelFormat.size)%4 != 0)
-        storage.setAlignment(1);
-
     /** @todo the DFD block has KHR_DF_FLAG_ALPHA_PREMULTIPLIED, pass it
         through ImageFlags once such flag exists:
         https://github.khronos.org/KTX-Specification/#_providing_additional_information */
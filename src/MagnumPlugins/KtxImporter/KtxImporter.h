@@ -205,11 +205,35 @@ Calls to the @ref image1DCount() / @ref image2DCount() / @ref image3DCount(),
 
 @subsection Trade-KtxImporter-behavior-supercompression Supercompression
 
-Importing files with [supercompression](https://www.khronos.org/registry/KTX/specs/2.0/ktxspec_v2.html#supercompressionSchemes)
-is not supported. When @ref Trade-KtxImporter-behavior-basis "forwarding Basis Universal compressed files",
+Files with Zstandard [supercompression](https://www.khronos.org/registry/KTX/specs/2.0/ktxspec_v2.html#supercompressionSchemes)
+are imported if the plugin is built with [zstd](https://github.com/facebook/zstd)
+available, files with ZLIB supercompression if it's built with
+[zlib](https://zlib.net/) available. Both dependencies are optional and are
+used automatically if found when building the plugin, the import fails for
+files using an unavailable supercompression scheme. The level data are
+decompressed only when a particular image level is requested, not when opening
+the file. For 3D array images, where a single level contains multiple images,
+the most recently decompressed level is kept in memory, so importing all
+images of a level decompresses it just once. The uncompressed level size
+recorded in the file is expected to match the size calculated from the image
+dimensions and format exactly. Other supercompression schemes are not supported. When
+@ref Trade-KtxImporter-behavior-basis "forwarding Basis Universal compressed files",
 some supercompression schemes like BasisLZ and Zstandard can be handled by
 @ref BasisImporter.
 
+@subsection Trade-KtxImporter-behavior-zero-copy Zero-copy import
+
+If the file is opened with @ref openMemory() and the
+@cb{.ini} zeroCopy @ce @ref Trade-KtxImporter-configuration "configuration option"
+is enabled, images that aren't supercompressed and don't need any flipping,
+swizzling or endian swapping reference the input memory directly instead of
+making a copy. Such images have @ref ImageData::dataFlags() empty, and the
+memory passed to @ref openMemory() has to stay in scope for as long as the
+images are used. The orientation check can be avoided for example by setting
+the @cb{.ini} assumeOrientation @ce option to @cb{.ini} ruo @ce. Files opened
+with @ref openData() or @ref openFile() are always copied, as are files
+forwarded to @ref BasisImporter.
+
 @section Trade-KtxImporter-configuration Plugin-specific configuration
 
 For some formats, it's possible to tune various options through
@@ -234,7 +258,7 @@ class MAGNUM_KTXIMPORTER_EXPORT KtxImporter: public AbstractImporter {
         MAGNUM_KTXIMPORTER_LOCAL void doClose() override;
         MAGNUM_KTXIMPORTER_LOCAL void doOpenData(Containers::Array<char>&& data, DataFlags dataFlags) override;
 
-        template<UnsignedInt dimensions> MAGNUM_KTXIMPORTER_LOCAL ImageData<dimensions> doImage(const char* messagePrefix, UnsignedInt id, UnsignedInt level);
+        template<UnsignedInt dimensions> MAGNUM_KTXIMPORTER_LOCAL Containers::Optional<ImageData<dimensions>> doImage(const char* messagePrefix, UnsignedInt id, UnsignedInt level);
 
         MAGNUM_KTXIMPORTER_LOCAL UnsignedInt doImage1DCount() const override;
         MAGNUM_KTXIMPORTER_LOCAL UnsignedInt doImage1DLevelCount(UnsignedInt id) override;
@@ -128,6 +128,11 @@ struct KtxImporterTest: TestSuite::Tester {
     void swizzleUnsupported();
     void swizzleCompressed();
 
+    void supercompression();
+    void supercompressionInvalid();
+
+    void zeroCopy();
+
     void openMemory();
     void openTwice();
     void openNormalAfterBasis();
@@ -260,7 +265,7 @@ const struct {
         "invalid type size for compressed format, expected 1 but got 4"},
     {"supercompression", "2d-rgb.ktx2", {},
         offsetof(Implementation::KtxHeader, supercompressionScheme), 1,
-        "supercompression is currently not supported"},
+        "supercompression scheme 1 is not supported"},
     {"3d depth", "3d.ktx2", {},
         offsetof(Implementation::KtxHeader, vkFormat), VK_FORMAT_D32_SFLOAT,
         "3D images can't have depth/stencil format"},
@@ -660,6 +665,85 @@ const struct {
         nullptr, Containers::arrayCast<const char>(PatternRgba2DData)}
 };
 
+const struct {
+    const char* name;
+    const char* file;
+    const char* uncompressedFile;
+    Implementation::SuperCompressionScheme scheme;
+    const char* assumeOrientation;
+} SupercompressionData[]{
+    {"Zstandard", "2d-mipmaps-and-layers-zstd.ktx2", "2d-mipmaps-and-layers.ktx2",
+        Implementation::SuperCompressionScheme::Zstandard, nullptr},
+    /* Without a flip the level gets decompressed directly to the output */
+    {"Zstandard, no flip", "2d-mipmaps-and-layers-zstd.ktx2", "2d-mipmaps-and-layers.ktx2",
+        Implementation::SuperCompressionScheme::Zstandard, "ruo"},
+    /* Multiple images in a single level */
+    {"Zstandard, 3D array", "3d-layers-zstd.ktx2", "3d-layers.ktx2",
+        Implementation::SuperCompressionScheme::Zstandard, nullptr},
+    {"ZLIB", "2d-mipmaps-and-layers-zlib.ktx2", "2d-mipmaps-and-layers.ktx2",
+        Implementation::SuperCompressionScheme::ZLIB, nullptr},
+    {"ZLIB, no flip", "2d-mipmaps-and-layers-zlib.ktx2", "2d-mipmaps-and-layers.ktx2",
+        Implementation::SuperCompressionScheme::ZLIB, "ruo"},
+};
+
+const struct {
+    const char* name;
+    const char* file;
+    Implementation::SuperCompressionScheme scheme;
+    std::size_t offset;
+    UnsignedLong value;
+    const char* openMessage;
+    const char* imageMessage;
+} SupercompressionInvalidData[]{
+    {"Zstandard uncompressed level too short", "2d-mipmaps-and-layers-zstd.ktx2",
+        Implementation::SuperCompressionScheme::Zstandard,
+        sizeof(Implementation::KtxHeader) + offsetof(Implementation::KtxLevel, uncompressedByteLength), 107,
+        "uncompressed level data too short, expected at least 108 bytes but got 107", nullptr},
+    {"Zstandard uncompressed level too long", "2d-mipmaps-and-layers-zstd.ktx2",
+        Implementation::SuperCompressionScheme::Zstandard,
+        sizeof(Implementation::KtxHeader) + offsetof(Implementation::KtxLevel, uncompressedByteLength), 109,
+        "uncompressed level data too long, expected 108 bytes but got 109", nullptr},
+    {"Zstandard invalid data", "2d-mipmaps-and-layers-zstd.ktx2",
+        Implementation::SuperCompressionScheme::Zstandard,
+        /* Level 0 data offset, overwriting the frame magic */
+        329, 0,
+        nullptr, "Zstandard decompression failed: Unknown frame descriptor"},
+    {"ZLIB uncompressed level too short", "2d-mipmaps-and-layers-zlib.ktx2",
+        Implementation::SuperCompressionScheme::ZLIB,
+        sizeof(Implementation::KtxHeader) + offsetof(Implementation::KtxLevel, uncompressedByteLength), 107,
+        "uncompressed level data too short, expected at least 108 bytes but got 107", nullptr},
+    {"ZLIB uncompressed level too long", "2d-mipmaps-and-layers-zlib.ktx2",
+        Implementation::SuperCompressionScheme::ZLIB,
+        sizeof(Implementation::KtxHeader) + offsetof(Implementation::KtxLevel, uncompressedByteLength), 109,
+        "uncompressed level data too long, expected 108 bytes but got 109", nullptr},
+    {"ZLIB invalid data", "2d-mipmaps-and-layers-zlib.ktx2",
+        Implementation::SuperCompressionScheme::ZLIB,
+        /* Level 0 data offset, overwriting the stream header */
+        316, 0,
+        nullptr, "ZLIB decompression failed: data error"},
+};
+
+const struct {
+    const char* name;
+    const char* filename;
+    UnsignedInt id, level;
+    const char* assumeOrientation;
+    bool zeroCopy;
+} ZeroCopyData[]{
+    {"2D, orientation matches",
+        "2d-rgba.ktx2", 0, 0, "ruo", true},
+    {"2D, flip",
+        "2d-rgba.ktx2", 0, 0, nullptr, false},
+    {"2D, implicit swizzle",
+        "bgr.ktx2", 0, 0, "ruo", false},
+    {"2D, second level",
+        "2d-mipmaps.ktx2", 0, 1, "ruo", true},
+    {"2D, compressed",
+        "2d-compressed-bc1.ktx2", 0, 0, "ruo", true},
+    {"3D array, second layer",
+        "3d-layers.ktx2", 1, 0, "ruo", true},
+};
+
 /* Shared among all plugins that implement data copying optimizations */
 const struct {
     const char* name;
@@ -815,6 +899,15 @@ KtxImporterTest::KtxImporterTest() {
               &KtxImporterTest::swizzleUnsupported,
               &KtxImporterTest::swizzleCompressed});
 
+    addInstancedTests({&KtxImporterTest::supercompression},
+        Containers::arraySize(SupercompressionData));
+
+    addInstancedTests({&KtxImporterTest::supercompressionInvalid},
+        Containers::arraySize(SupercompressionInvalidData));
+
+    addInstancedTests({&KtxImporterTest::zeroCopy},
+        Containers::arraySize(ZeroCopyData)*Containers::arraySize(OpenMemoryData));
+
     addInstancedTests({&KtxImporterTest::openMemory},
         Containers::arraySize(OpenMemoryData));
 
@@ -2515,6 +2608,167 @@ void KtxImporterTest::swizzleCompressed() {
     CORRADE_COMPARE(out, "Trade::KtxImporter::openData(): unsupported channel mapping bgra\n");
 }
 
+void KtxImporterTest::supercompression() {
+    auto&& data = SupercompressionData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    #ifndef KTXIMPORTER_WITH_ZSTD
+    if(data.scheme == Implementation::SuperCompressionScheme::Zstandard)
+        CORRADE_SKIP("KtxImporter was built without Zstandard support, can't test.");
+    #endif
+    #ifndef KTXIMPORTER_WITH_ZLIB
+    if(data.scheme == Implementation::SuperCompressionScheme::ZLIB)
+        CORRADE_SKIP("KtxImporter was built without ZLIB support, can't test.");
+    #endif
+
+    /* The supercompressed file should import exactly the same as the
+       uncompressed variant */
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("KtxImporter");
+    Containers::Pointer<AbstractImporter> uncompressedImporter = _manager.instantiate("KtxImporter");
+    /* Quiet to not print warnings about missing orientation */
+    importer->addFlags(ImporterFlag::Quiet);
+    uncompressedImporter->addFlags(ImporterFlag::Quiet);
+    if(data.assumeOrientation) {
+        importer->configuration().setValue("assumeOrientation", data.assumeOrientation);
+        uncompressedImporter->configuration().setValue("assumeOrientation", data.assumeOrientation);
+    }
+
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(KTXIMPORTER_TEST_DIR, data.file)));
+    CORRADE_VERIFY(uncompressedImporter->openFile(Utility::Path::join(KTXIMPORTER_TEST_DIR, data.uncompressedFile)));
+
+    CORRADE_COMPARE(importer->image3DCount(), uncompressedImporter->image3DCount());
+    for(UnsignedInt i = 0; i != importer->image3DCount(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(importer->image3DLevelCount(i), uncompressedImporter->image3DLevelCount(i));
+        for(UnsignedInt level = 0; level != importer->image3DLevelCount(i); ++level) {
+            CORRADE_ITERATION(level);
+
+            Containers::Optional<Trade::ImageData3D> image = importer->image3D(i, level);
+            Containers::Optional<Trade::ImageData3D> expected = uncompressedImporter->image3D(i, level);
+            CORRADE_VERIFY(image);
+            CORRADE_VERIFY(expected);
+            CORRADE_COMPARE(image->flags(), expected->flags());
+            CORRADE_COMPARE(image->format(), expected->format());
+            CORRADE_COMPARE(image->size(), expected->size());
+            CORRADE_COMPARE_AS(image->data(), expected->data(), TestSuite::Compare::Container);
+        }
+    }
+
+    /* Import all images again level by level, which for levels containing
+       multiple images reuses the level decompressed for the first image */
+    for(UnsignedInt level = 0; level != importer->image3DLevelCount(0); ++level) {
+        CORRADE_ITERATION(level);
+        for(UnsignedInt i = 0; i != importer->image3DCount(); ++i) {
+            CORRADE_ITERATION(i);
+
+            Containers::Optional<Trade::ImageData3D> image = importer->image3D(i, level);
+            Containers::Optional<Trade::ImageData3D> expected = uncompressedImporter->image3D(i, level);
+            CORRADE_VERIFY(image);
+            CORRADE_VERIFY(expected);
+            CORRADE_COMPARE_AS(image->data(), expected->data(), TestSuite::Compare::Container);
+        }
+    }
+}
+
+void KtxImporterTest::supercompressionInvalid() {
+    auto&& data = SupercompressionInvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    #ifndef KTXIMPORTER_WITH_ZSTD
+    if(data.scheme == Implementation::SuperCompressionScheme::Zstandard)
+        CORRADE_SKIP("KtxImporter was built without Zstandard support, can't test.");
+    #endif
+    #ifndef KTXIMPORTER_WITH_ZLIB
+    if(data.scheme == Implementation::SuperCompressionScheme::ZLIB)
+        CORRADE_SKIP("KtxImporter was built without ZLIB support, can't test.");
+    #endif
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("KtxImporter");
+    importer->addFlags(ImporterFlag::Quiet);
+
+    Containers::Optional<Containers::Array<char>> fileData = Utility::Path::read(Utility::Path::join(KTXIMPORTER_TEST_DIR, data.file));
+    CORRADE_VERIFY(fileData);
+    CORRADE_COMPARE_AS(data.offset + sizeof(UnsignedLong), fileData->size(), TestSuite::Compare::LessOrEqual);
+
+    /* Overwrite either a 64-bit level index entry or the first bytes of the
+       compressed data */
+    const UnsignedLong value = Utility::Endianness::littleEndian(data.value);
+    Utility::copy(Containers::arrayView(reinterpret_cast<const char*>(&value), sizeof(UnsignedLong)),
+        fileData->sliceSize(data.offset, sizeof(UnsignedLong)));
+
+    Containers::String out;
+    Error redirectError{&out};
+    if(data.openMessage) {
+        CORRADE_VERIFY(!importer->openData(*fileData));
+        CORRADE_COMPARE(out, Utility::format("Trade::KtxImporter::openData(): {}\n", data.openMessage));
+    } else {
+        CORRADE_VERIFY(importer->openData(*fileData));
+        CORRADE_VERIFY(!importer->image3D(0));
+        CORRADE_COMPARE(out, Utility::format("Trade::KtxImporter::image3D(): {}\n", data.imageMessage));
+    }
+}
+
+void KtxImporterTest::zeroCopy() {
+    auto&& data = ZeroCopyData[testCaseInstanceId()/Containers::arraySize(OpenMemoryData)];
+    auto&& open = OpenMemoryData[testCaseInstanceId()%Containers::arraySize(OpenMemoryData)];
+    setTestCaseDescription(Utility::format("{}, {}", data.name, open.name));
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("KtxImporter");
+    if(data.assumeOrientation)
+        importer->configuration().setValue("assumeOrientation", data.assumeOrientation);
+    /* Disabled by default */
+    CORRADE_VERIFY(!importer->configuration().value<bool>("zeroCopy"));
+    importer->configuration().setValue("zeroCopy", true);
+
+    /* Import the same with zero copy disabled for comparison */
+    Containers::Pointer<AbstractImporter> copyingImporter = _manager.instantiate("KtxImporter");
+    if(data.assumeOrientation)
+        copyingImporter->configuration().setValue("assumeOrientation", data.assumeOrientation);
+    CORRADE_VERIFY(copyingImporter->openFile(Utility::Path::join(KTXIMPORTER_TEST_DIR, data.filename)));
+
+    Containers::Optional<Containers::Array<char>> memory = Utility::Path::read(Utility::Path::join(KTXIMPORTER_TEST_DIR, data.filename));
+    CORRADE_VERIFY(memory);
+    CORRADE_VERIFY(open.open(*importer, *memory));
+
+    DataFlags dataFlags;
+    Containers::ArrayView<const char> imageData;
+    Containers::Array<char> expectedData;
+    if(importer->image3DCount()) {
+        Containers::Optional<ImageData3D> image = importer->image3D(data.id, data.level);
+        Containers::Optional<ImageData3D> expected = copyingImporter->image3D(data.id, data.level);
+        CORRADE_VERIFY(image);
+        CORRADE_VERIFY(expected);
+        CORRADE_COMPARE(image->size(), expected->size());
+        dataFlags = image->dataFlags();
+        imageData = image->data();
+        expectedData = expected->release();
+    } else {
+        Containers::Optional<ImageData2D> image = importer->image2D(data.id, data.level);
+        Containers::Optional<ImageData2D> expected = copyingImporter->image2D(data.id, data.level);
+        CORRADE_VERIFY(image);
+        CORRADE_VERIFY(expected);
+        CORRADE_COMPARE(image->size(), expected->size());
+        CORRADE_COMPARE(image->storage().alignment(), expected->storage().alignment());
+        dataFlags = image->dataFlags();
+        imageData = image->data();
+        expectedData = expected->release();
+    }
+
+    /* Only memory passed to openMemory() is guaranteed to stay in scope and
+       thus gets referenced, the data are copied otherwise. The data views
+       stay valid after the image is destroyed in that case, so it's fine to
+       compare them here. */
+    if(data.zeroCopy && open.open == OpenMemoryData[1].open) {
+        CORRADE_COMPARE(dataFlags, DataFlags{});
+        CORRADE_VERIFY(imageData.data() >= memory->data());
+        CORRADE_VERIFY(imageData.data() + imageData.size() <= memory->end());
+        CORRADE_COMPARE_AS(imageData, expectedData,
+            TestSuite::Compare::Container);
+    } else {
+        CORRADE_COMPARE(dataFlags, DataFlag::Owned|DataFlag::Mutable);
+    }
+}
+
 void KtxImporterTest::openMemory() {
     /* Same as imageRgba() except that it uses openData() & openMemory()
        instead of openFile() to test data copying on import */
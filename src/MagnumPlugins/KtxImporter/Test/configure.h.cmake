@@ -29,5 +29,7 @@
 #cmakedefine BASISIMPORTER_PLUGIN_FILENAME "${BASISIMPORTER_PLUGIN_FILENAME}"
 #cmakedefine BCDECIMAGECONVERTER_PLUGIN_FILENAME "${BCDECIMAGECONVERTER_PLUGIN_FILENAME}"
 #cmakedefine ETCDECIMAGECONVERTER_PLUGIN_FILENAME "${ETCDECIMAGECONVERTER_PLUGIN_FILENAME}"
+#cmakedefine KTXIMPORTER_WITH_ZSTD
+#cmakedefine KTXIMPORTER_WITH_ZLIB
 #define BASISIMPORTER_TEST_DIR "${BASISIMPORTER_TEST_DIR}"
 #define KTXIMPORTER_TEST_DIR "${KTXIMPORTER_TEST_DIR}"
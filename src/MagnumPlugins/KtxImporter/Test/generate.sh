@@ -155,3 +155,10 @@ magnum-imageconverter ../../DdsImporter/Test/dxt1-3d.dds -D3 -i assumeYUpZBackwa
 # Reusing AstcImporter test files same as above, just with a different
 # overriden orientation
 magnum-imageconverter ../../AstcImporter/Test/3x3x3.astc -D3 -i assumeYUpZBackward -c orientation=ruo,generator= 3d-compressed-astc3d-ruo.ktx2
+
+# Zstandard and ZLIB supercompressed variants of existing files, the importer
+# should produce the same output for these as for the originals. Needs
+# KTX-Software 4.3+ for the ZLIB support.
+ktx compress --zstd 19 2d-mipmaps-and-layers.ktx2 2d-mipmaps-and-layers-zstd.ktx2
+ktx compress --zstd 19 3d-layers.ktx2 3d-layers-zstd.ktx2
+ktx compress --zlib 9 2d-mipmaps-and-layers.ktx2 2d-mipmaps-and-layers-zlib.ktx2
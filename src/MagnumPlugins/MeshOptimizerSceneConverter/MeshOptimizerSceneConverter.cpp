@@ -26,18 +26,32 @@
 
 #include "MeshOptimizerSceneConverter.h"
 
+#include <cstdlib>
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Iterable.h>
 #include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/ConfigurationGroup.h>
+#include <Magnum/Math/ConfigurationValue.h>
+#include <Magnum/Math/FunctionsBatch.h>
 #include <Magnum/Math/PackingBatch.h>
-#include <Magnum/Math/Vector3.h>
+#include <Magnum/Math/Vector4.h>
 #include <Magnum/MeshTools/Combine.h>
 #include <Magnum/MeshTools/Copy.h>
 #include <Magnum/MeshTools/Duplicate.h>
 #include <Magnum/MeshTools/GenerateIndices.h>
 #include <Magnum/MeshTools/Interleave.h>
+#include <Magnum/Trade/AbstractImporter.h>
 #include <Magnum/Trade/ArrayAllocator.h>
 #include <Magnum/Trade/MeshData.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include <meshoptimizer.h>
 
 namespace Magnum { namespace Trade {
@@ -47,7 +61,10 @@ MeshOptimizerSceneConverter::MeshOptimizerSceneConverter(PluginManager::Abstract
 MeshOptimizerSceneConverter::~MeshOptimizerSceneConverter() = default;
 
 SceneConverterFeatures MeshOptimizerSceneConverter::doFeatures() const {
-    return SceneConverterFeature::ConvertMeshInPlace|SceneConverterFeature::ConvertMesh;
+    return SceneConverterFeature::ConvertMeshInPlace|
+           SceneConverterFeature::ConvertMesh|
+           SceneConverterFeature::ConvertMultiple|
+           SceneConverterFeature::AddMeshes;
 }
 
 namespace {
@@ -87,7 +104,18 @@ void analyze(const MeshData& mesh, const Utility::ConfigurationGroup& configurat
     else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
 }
 
-void analyzePost(const char* prefix, const MeshData& mesh, const Utility::ConfigurationGroup& configuration, const SceneConverterFlags flags, const Containers::StridedArrayView1D<const Vector3> positions, Containers::Optional<UnsignedInt>& vertexSize, meshopt_VertexCacheStatistics& vertexCacheStatsBefore, meshopt_VertexFetchStatistics& vertexFetchStatsBefore, meshopt_OverdrawStatistics& overdrawStatsBefore) {
+/* Totals of the before & after stats for convertBatch(), the ratios are
+   calculated from these when printing */
+struct Statistics {
+    UnsignedLong verticesTransformedBefore, verticesTransformed,
+        warpsExecutedBefore, warpsExecuted,
+        bytesFetchedBefore, bytesFetched,
+        pixelsShadedBefore, pixelsShaded,
+        pixelsCoveredBefore, pixelsCovered;
+    bool hasVertexFetch, hasOverdraw;
+};
+
+void analyzePost(const char* prefix, const MeshData& mesh, const Utility::ConfigurationGroup& configuration, const SceneConverterFlags flags, const Containers::StridedArrayView1D<const Vector3> positions, Containers::Optional<UnsignedInt>& vertexSize, meshopt_VertexCacheStatistics& vertexCacheStatsBefore, meshopt_VertexFetchStatistics& vertexFetchStatsBefore, meshopt_OverdrawStatistics& overdrawStatsBefore, Statistics* const statistics = nullptr) {
     /* If vertex size is zero, it means there was an implementation-specific
        vertex format somewhere. Print a warning about that. */
     CORRADE_INTERNAL_ASSERT(vertexSize);
@@ -105,6 +133,28 @@ void analyzePost(const char* prefix, const MeshData& mesh, const Utility::Config
     meshopt_OverdrawStatistics overdrawStats;
     analyze(mesh, configuration, positions, vertexSize, vertexCacheStats, vertexFetchStats, overdrawStats);
 
+    /* If the stats are aggregated, only accumulate them, the caller prints
+       them at the end */
+    if(statistics) {
+        statistics->verticesTransformedBefore += vertexCacheStatsBefore.vertices_transformed;
+        statistics->verticesTransformed += vertexCacheStats.vertices_transformed;
+        statistics->warpsExecutedBefore += vertexCacheStatsBefore.warps_executed;
+        statistics->warpsExecuted += vertexCacheStats.warps_executed;
+        if(*vertexSize) {
+            statistics->bytesFetchedBefore += vertexFetchStatsBefore.bytes_fetched;
+            statistics->bytesFetched += vertexFetchStats.bytes_fetched;
+            statistics->hasVertexFetch = true;
+        }
+        if(positions) {
+            statistics->pixelsShadedBefore += overdrawStatsBefore.pixels_shaded;
+            statistics->pixelsShaded += overdrawStats.pixels_shaded;
+            statistics->pixelsCoveredBefore += overdrawStatsBefore.pixels_covered;
+            statistics->pixelsCovered += overdrawStats.pixels_covered;
+            statistics->hasOverdraw = true;
+        }
+        return;
+    }
+
     Debug{} << prefix << "processing stats:";
     Debug{} << "  vertex cache:\n   "
         << vertexCacheStatsBefore.vertices_transformed << "->"
@@ -230,9 +280,309 @@ bool convertInPlaceInternal(const char* prefix, MeshData& mesh, const SceneConve
     return true;
 }
 
+UnsignedInt simplify(const Utility::ConfigurationGroup& configuration, const Containers::ArrayView<const UnsignedInt> inputIndices, const Containers::StridedArrayView1D<const Vector3> positions, const UnsignedInt vertexCount, const UnsignedInt targetIndexCount, const Float targetError, const Containers::ArrayView<UnsignedInt> outputIndices) {
+    if(configuration.value<bool>("simplifySloppy")) {
+        /* The nullptr at the end is not needed but without it GCC's
+           -Wzero-as-null-pointer-constant fires due to the default argument
+           being `= 0`. WHAT THE FUCK, how is this warning useful?! Why
+           everything today feels like hastily patched together by
+           incompetent idiots?! */
+        return meshopt_simplifySloppy(
+            outputIndices.data(),
+            inputIndices.data(),
+            inputIndices.size(),
+            static_cast<const Float*>(positions.data()),
+            vertexCount,
+            positions.stride(),
+            targetIndexCount
+            #if MESHOPTIMIZER_VERSION >= 160
+            , targetError, nullptr
+            #endif
+        );
+    } else {
+        #if MESHOPTIMIZER_VERSION >= 180
+        Int flags = 0;
+        #define _c(option)                                                  \
+            if(configuration.value<bool>("simplify" #option))               \
+                flags |= meshopt_Simplify ## option;
+        _c(LockBorder)
+        #if MESHOPTIMIZER_VERSION >= 210
+        _c(Sparse)
+        _c(ErrorAbsolute)
+        #endif
+        #if MESHOPTIMIZER_VERSION >= 220
+        _c(Prune)
+        #endif
+        #if MESHOPTIMIZER_VERSION >= 250
+        _c(Regularize)
+        _c(Permissive)
+        #endif
+        #undef _c
+        #endif
+        return meshopt_simplify(
+            outputIndices.data(),
+            inputIndices.data(),
+            inputIndices.size(),
+            static_cast<const Float*>(positions.data()),
+            vertexCount,
+            positions.stride(),
+            targetIndexCount,
+            targetError
+            #if MESHOPTIMIZER_VERSION >= 180
+            , flags
+            #endif
+            #if MESHOPTIMIZER_VERSION >= 160
+            , nullptr
+            #endif
+        );
+    }
+}
+
+MeshData copyInterleaved(const MeshData& mesh) {
+    /* Make the mesh interleaved (with a contiguous index array) and owned
+       first */
+    MeshData out = MeshTools::copy(MeshTools::interleave(mesh));
+    CORRADE_INTERNAL_ASSERT(MeshTools::isInterleaved(out));
+    CORRADE_INTERNAL_ASSERT(!out.isIndexed() || out.indices().isContiguous());
+
+    /* Convert to an indexed triangle mesh if we have a strip or a fan */
+    if(out.primitive() == MeshPrimitive::TriangleStrip ||
+       out.primitive() == MeshPrimitive::TriangleFan)
+        out = MeshTools::generateIndices(Utility::move(out));
+
+    return out;
+}
+
+bool isFloatVertexFormat(const VertexFormat format) {
+    return format == VertexFormat::Vector2 ||
+           format == VertexFormat::Vector3 ||
+           format == VertexFormat::Vector4;
+}
+
+bool isInRange(const Containers::StridedArrayView2D<const Float>& data, const Float min, const Float max) {
+    for(const Containers::StridedArrayView1D<const Float> i: data)
+        for(const Float j: i)
+            if(!(j >= min && j <= max)) return false;
+    return true;
+}
+
+bool checkQuantizeOptions(const char* prefix, const Utility::ConfigurationGroup& configuration) {
+    const UnsignedInt normalBits = configuration.value<UnsignedInt>("quantizeNormalBits");
+    if(configuration.value<bool>("quantize") && normalBits != 8 && normalBits != 16) {
+        Error{} << prefix << "expected quantizeNormalBits to be either 8 or 16 but got" << normalBits;
+        return false;
+    }
+
+    return true;
+}
+
+MeshData quantize(const char* prefix, MeshData&& mesh, const Utility::ConfigurationGroup& configuration, const SceneConverterFlags flags, Matrix4& positionTransformation) {
+    /* Sizes of all attributes are needed to calculate the new layout, which
+       isn't possible for implementation-specific formats */
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        if(isVertexFormatImplementationSpecific(mesh.attributeFormat(i))) {
+            if(!(flags & SceneConverterFlag::Quiet))
+                Warning{} << prefix << "can't quantize a mesh with" << mesh.attributeFormat(i) << Debug::nospace << ", skipping";
+            return Utility::move(mesh);
+        }
+    }
+
+    const VertexFormat normalComponentFormat = configuration.value<UnsignedInt>("quantizeNormalBits") == 16 ? VertexFormat::Short : VertexFormat::Byte;
+
+    /* Decide on the output format of each attribute. Only attributes that
+       KHR_mesh_quantization allows in a quantized form and that fit into the
+       normalized range are quantized, everything else is kept as-is. Array
+       and morph target attributes are left untouched as well. */
+    Containers::Array<VertexFormat> formats{NoInit, mesh.attributeCount()};
+    Containers::Array<std::size_t> offsets{NoInit, mesh.attributeCount()};
+    std::size_t vertexSizeBefore = 0;
+    std::size_t stride = 0;
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        const MeshAttribute name = mesh.attributeName(i);
+        const VertexFormat format = mesh.attributeFormat(i);
+        formats[i] = format;
+        if(isFloatVertexFormat(format) && !mesh.attributeArraySize(i) && mesh.attributeMorphTargetId(i) == -1) {
+            const UnsignedInt componentCount = vertexFormatComponentCount(format);
+            const Containers::StridedArrayView2D<const Float> data = Containers::arrayCast<2, const Float>(mesh.attribute(i));
+            if(name == MeshAttribute::Position && configuration.value<bool>("quantizePositions"))
+                formats[i] = vertexFormat(VertexFormat::Short, componentCount, true);
+            else if((name == MeshAttribute::Normal || name == MeshAttribute::Tangent || name == MeshAttribute::Bitangent) && configuration.value<bool>("quantizeNormals") && isInRange(data, -1.0f, 1.0f))
+                formats[i] = vertexFormat(normalComponentFormat, componentCount, true);
+            else if(name == MeshAttribute::TextureCoordinates && configuration.value<bool>("quantizeTextureCoordinates") && isInRange(data, 0.0f, 1.0f))
+                formats[i] = vertexFormat(VertexFormat::UnsignedShort, componentCount, true);
+            else if(name == MeshAttribute::Color && configuration.value<bool>("quantizeColors") && isInRange(data, 0.0f, 1.0f))
+                formats[i] = vertexFormat(VertexFormat::UnsignedByte, componentCount, true);
+        }
+
+        const UnsignedInt arraySize = Math::max(mesh.attributeArraySize(i), UnsignedShort{1});
+        vertexSizeBefore += vertexFormatSize(format)*arraySize;
+
+        /* Keep each attribute four-byte aligned, as glTF requires */
+        offsets[i] = stride;
+        stride += (vertexFormatSize(formats[i])*arraySize + 3) & ~std::size_t{3};
+    }
+
+    Containers::Array<char> vertexData{ValueInit, mesh.vertexCount()*stride};
+    Containers::Array<MeshAttributeData> attributes{mesh.attributeCount()};
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        const UnsignedShort arraySize = mesh.attributeArraySize(i);
+        const Containers::StridedArrayView2D<char> dst{vertexData,
+            vertexData.data() + offsets[i],
+            {mesh.vertexCount(), vertexFormatSize(formats[i])*Math::max(arraySize, UnsignedShort{1})},
+            {std::ptrdiff_t(stride), 1}};
+        attributes[i] = MeshAttributeData{mesh.attributeName(i), formats[i],
+            offsets[i], mesh.vertexCount(), std::ptrdiff_t(stride),
+            arraySize, mesh.attributeMorphTargetId(i)};
+
+        if(formats[i] == mesh.attributeFormat(i)) {
+            Utility::copy(mesh.attribute(i), dst);
+            continue;
+        }
+
+        Containers::StridedArrayView2D<const Float> src = Containers::arrayCast<2, const Float>(mesh.attribute(i));
+
+        /* Positions are normalized to the [-1, 1] range with a uniform scale
+           so the dequantization transformation doesn't distort normals */
+        Containers::Array<Float> positionStorage;
+        if(mesh.attributeName(i) == MeshAttribute::Position) {
+            const std::size_t componentCount = src.size()[1];
+            Vector3 min, max;
+            for(std::size_t j = 0; j != componentCount; ++j) {
+                const Containers::Pair<Float, Float> minmax = Math::minmax(src.transposed<0, 1>()[j]);
+                min[j] = minmax.first();
+                max[j] = minmax.second();
+            }
+            const Vector3 center = (min + max)*0.5f;
+            Float scale = (max - min).max()*0.5f;
+            if(!scale) scale = 1.0f;
+
+            positionStorage = Containers::Array<Float>{NoInit, src.size()[0]*componentCount};
+            const Containers::StridedArrayView2D<Float> normalized{positionStorage, src.size()};
+            for(std::size_t j = 0; j != src.size()[0]; ++j)
+                for(std::size_t k = 0; k != componentCount; ++k)
+                    normalized[j][k] = (src[j][k] - center[k])/scale;
+            src = normalized;
+
+            positionTransformation = Matrix4::translation(center)*Matrix4::scaling(Vector3{scale});
+        }
+
+        const VertexFormat componentFormat = vertexFormatComponentFormat(formats[i]);
+        if(componentFormat == VertexFormat::Short)
+            Math::packInto(src, Containers::arrayCast<2, Short>(dst));
+        else if(componentFormat == VertexFormat::Byte)
+            Math::packInto(src, Containers::arrayCast<2, Byte>(dst));
+        else if(componentFormat == VertexFormat::UnsignedShort)
+            Math::packInto(src, Containers::arrayCast<2, UnsignedShort>(dst));
+        else if(componentFormat == VertexFormat::UnsignedByte)
+            Math::packInto(src, Containers::arrayCast<2, UnsignedByte>(dst));
+        else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+
+    if(flags & SceneConverterFlag::Verbose)
+        Debug{} << prefix << "quantized vertex size from" << vertexSizeBefore << "to" << stride << "bytes";
+
+    /* Point clouds don't need to be indexed */
+    const UnsignedInt vertexCount = mesh.vertexCount();
+    if(!mesh.isIndexed())
+        return MeshData{mesh.primitive(),
+            Utility::move(vertexData), Utility::move(attributes), vertexCount,
+            mesh.importerState()};
+
+    const MeshIndexData indices{mesh.indexType(), mesh.indices().asContiguous()};
+    return MeshData{mesh.primitive(),
+        mesh.releaseIndexData(), indices,
+        Utility::move(vertexData), Utility::move(attributes), vertexCount,
+        mesh.importerState()};
+}
+
+/* Parses a whitespace-separated list of floats in given option */
+bool parseFloats(const char* prefix, const Utility::ConfigurationGroup& configuration, const char* option, Containers::Array<Float>& out) {
+    const Containers::Array<Containers::StringView> values = configuration.value<Containers::StringView>(option).splitOnWhitespaceWithoutEmptyParts();
+    out = Containers::Array<Float>{NoInit, values.size()};
+    for(std::size_t i = 0; i != values.size(); ++i) {
+        /* std::strtof() needs a null-terminated string */
+        const Containers::String value = values[i];
+        char* end;
+        out[i] = std::strtof(value.data(), &end);
+        if(end != value.end()) {
+            Error{} << prefix << "invalid" << option << "value" << values[i];
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template<class T> void remapIndices(const Containers::ArrayView<T> indices, const Containers::ArrayView<const UnsignedInt> remap) {
+    for(T& i: indices) i = remap[i];
+}
+
+bool spatialSortPoints(const char* prefix, MeshData& mesh) {
+    if(!mesh.hasAttribute(MeshAttribute::Position)) {
+        Error{} << prefix << "spatialSortPoints requires the mesh to have positions";
+        return false;
+    }
+
+    Containers::Array<Vector3> positionStorage;
+    Containers::StridedArrayView1D<const Vector3> positions;
+    populatePositions(mesh, positionStorage, positions);
+
+    /* The remap table maps old vertex IDs to new ones. Calculate it fully
+       before touching the vertex data, as the positions may point there. */
+    Containers::Array<UnsignedInt> remap{NoInit, mesh.vertexCount()};
+    meshopt_spatialSortRemap(remap.data(), static_cast<const Float*>(positions.data()), mesh.vertexCount(), positions.stride());
+
+    /* This assumes the mesh is interleaved, same as with vertex fetch
+       optimization in convertInPlaceInternal(). The remapping works in-place
+       as well. */
+    Containers::StridedArrayView2D<char> interleavedData = MeshTools::interleavedMutableData(mesh);
+    meshopt_remapVertexBuffer(interleavedData.data(), interleavedData.data(), mesh.vertexCount(), interleavedData.stride()[0], remap.data());
+
+    /* Indexed point clouds get the index buffer updated to point to the new
+       locations. Only doConvert() can get here with an indexed mesh, which
+       guarantees the indices are contiguous. */
+    if(mesh.isIndexed()) {
+        if(mesh.indexType() == MeshIndexType::UnsignedInt)
+            remapIndices(mesh.mutableIndices<UnsignedInt>().asContiguous(), remap);
+        else if(mesh.indexType() == MeshIndexType::UnsignedShort)
+            remapIndices(mesh.mutableIndices<UnsignedShort>().asContiguous(), remap);
+        else if(mesh.indexType() == MeshIndexType::UnsignedByte)
+            remapIndices(mesh.mutableIndices<UnsignedByte>().asContiguous(), remap);
+        else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+
+    return true;
+}
+
 }
 
 bool MeshOptimizerSceneConverter::doConvertInPlace(MeshData& mesh) {
+    /* Point clouds take a completely separate path, none of the checks below
+       apply to them */
+    if(mesh.primitive() == MeshPrimitive::Points && configuration().value<bool>("spatialSortPoints")) {
+        if(configuration().value<bool>("quantize")) {
+            Error{} << "Trade::MeshOptimizerSceneConverter::convertInPlace(): vertex quantization can't be performed in-place, use convert() instead";
+            return false;
+        }
+
+        if(mesh.isIndexed()) {
+            Error{} << "Trade::MeshOptimizerSceneConverter::convertInPlace(): spatialSortPoints can be performed in-place only on non-indexed meshes, use convert() instead";
+            return false;
+        }
+
+        if(!(mesh.vertexDataFlags() & DataFlag::Mutable)) {
+            Error{} << "Trade::MeshOptimizerSceneConverter::convertInPlace(): spatialSortPoints requires vertex data to be mutable";
+            return false;
+        }
+
+        if(!MeshTools::isInterleaved(mesh)) {
+            Error{} << "Trade::MeshOptimizerSceneConverter::convertInPlace(): spatialSortPoints requires the mesh to be interleaved";
+            return false;
+        }
+
+        return spatialSortPoints("Trade::MeshOptimizerSceneConverter::convertInPlace():", mesh);
+    }
+
     if((configuration().value<bool>("optimizeVertexCache") ||
         configuration().value<bool>("optimizeOverdraw") ||
         configuration().value<bool>("optimizeVertexFetch")) &&
@@ -261,6 +611,16 @@ bool MeshOptimizerSceneConverter::doConvertInPlace(MeshData& mesh) {
         return false;
     }
 
+    if(configuration().value<bool>("buildMeshlets")) {
+        Error{} << "Trade::MeshOptimizerSceneConverter::convertInPlace(): meshlet building can't be performed in-place, use convert() instead";
+        return false;
+    }
+
+    if(configuration().value<bool>("quantize")) {
+        Error{} << "Trade::MeshOptimizerSceneConverter::convertInPlace(): vertex quantization can't be performed in-place, use convert() instead";
+        return false;
+    }
+
     /* Errors for non-indexed meshes and implementation-specific index buffers
        are printed directly in convertInPlaceInternal() */
     if(mesh.isIndexed()) {
@@ -290,7 +650,11 @@ bool MeshOptimizerSceneConverter::doConvertInPlace(MeshData& mesh) {
     return true;
 }
 
-Containers::Optional<MeshData> MeshOptimizerSceneConverter::doConvert(const MeshData& mesh) {
+namespace {
+
+/* If meshlets are built and processedMesh is non-null, the processed mesh
+   the meshlets refer to is saved there instead of being discarded */
+Containers::Optional<MeshData> convertInternal(const MeshData& mesh, const SceneConverterFlags flags, const Utility::ConfigurationGroup& configuration, Matrix4& quantizedPositionTransformation, Statistics* const statistics, Containers::Optional<MeshData>* const processedMesh = nullptr) {
     /* If the mesh is indexed with an implementation-specific index type,
        interleave() won't be able to turn its index buffer into a contiguous
        one. So fail early if that's the case. The mesh doesn't necessarily have
@@ -301,16 +665,66 @@ Containers::Optional<MeshData> MeshOptimizerSceneConverter::doConvert(const Mesh
         return {};
     }
 
-    /* Make the mesh interleaved (with a contiguous index array) and owned
-       first */
-    MeshData out = MeshTools::copy(MeshTools::interleave(mesh));
-    CORRADE_INTERNAL_ASSERT(MeshTools::isInterleaved(out));
-    CORRADE_INTERNAL_ASSERT(!out.isIndexed() || out.indices().isContiguous());
+    /* Point clouds are only spatially sorted and optionally quantized, none
+       of the triangle-oriented operations apply to them */
+    if(mesh.primitive() == MeshPrimitive::Points && configuration.value<bool>("spatialSortPoints")) {
+        if(!checkQuantizeOptions("Trade::MeshOptimizerSceneConverter::convert():", configuration))
+            return {};
 
-    /* Convert to an indexed triangle mesh if we have a strip or a fan */
-    if(out.primitive() == MeshPrimitive::TriangleStrip ||
-       out.primitive() == MeshPrimitive::TriangleFan)
-        out = MeshTools::generateIndices(Utility::move(out));
+        MeshData out = copyInterleaved(mesh);
+        if(!spatialSortPoints("Trade::MeshOptimizerSceneConverter::convert():", out))
+            return {};
+
+        if(configuration.value<bool>("quantize"))
+            out = quantize("Trade::MeshOptimizerSceneConverter::convert():", Utility::move(out), configuration, flags, quantizedPositionTransformation);
+
+        return Containers::optional(Utility::move(out));
+    }
+
+    /* Check meshlet building options upfront to not fail only after all other
+       processing is done */
+    const bool buildMeshlets = configuration.value<bool>("buildMeshlets");
+    #if MESHOPTIMIZER_VERSION >= 170
+    const UnsignedInt meshletMaxVertexCount = configuration.value<UnsignedInt>("buildMeshletsMaxVertices");
+    const UnsignedInt meshletMaxTriangleCount = configuration.value<UnsignedInt>("buildMeshletsMaxTriangles");
+    const Float meshletConeWeight = configuration.value<Float>("buildMeshletsConeWeight");
+    #endif
+    if(buildMeshlets) {
+        /* Meshlets don't contain any vertex data, and quantizing just the
+           processed mesh would make the bounding spheres and cones computed
+           from the original positions inconsistent with it */
+        if(configuration.value<bool>("quantize")) {
+            Error{} << "Trade::MeshOptimizerSceneConverter::convert(): quantization can't be combined with meshlet building";
+            return {};
+        }
+
+        #if MESHOPTIMIZER_VERSION < 170
+        Error{} << "Trade::MeshOptimizerSceneConverter::convert(): buildMeshlets requires meshoptimizer 0.17 or newer";
+        return {};
+        #else
+        if(!mesh.hasAttribute(MeshAttribute::Position)) {
+            Error{} << "Trade::MeshOptimizerSceneConverter::convert(): buildMeshlets requires the mesh to have positions";
+            return {};
+        }
+        if(meshletMaxVertexCount < 3 || meshletMaxVertexCount > 255) {
+            Error{} << "Trade::MeshOptimizerSceneConverter::convert(): expected buildMeshletsMaxVertices to be between 3 and 255 but got" << meshletMaxVertexCount;
+            return {};
+        }
+        if(!meshletMaxTriangleCount || meshletMaxTriangleCount > 512 || meshletMaxTriangleCount % 4) {
+            Error{} << "Trade::MeshOptimizerSceneConverter::convert(): expected buildMeshletsMaxTriangles to be a multiple of 4 between 4 and 512 but got" << meshletMaxTriangleCount;
+            return {};
+        }
+        if(meshletConeWeight < 0.0f || meshletConeWeight > 1.0f) {
+            Error{} << "Trade::MeshOptimizerSceneConverter::convert(): expected buildMeshletsConeWeight to be between 0 and 1 but got" << meshletConeWeight;
+            return {};
+        }
+        #endif
+    }
+
+    if(!checkQuantizeOptions("Trade::MeshOptimizerSceneConverter::convert():", configuration))
+        return {};
+
+    MeshData out = copyInterleaved(mesh);
 
     meshopt_VertexCacheStatistics vertexCacheStatsBefore;
     meshopt_VertexFetchStatistics vertexFetchStatsBefore;
@@ -318,14 +732,14 @@ Containers::Optional<MeshData> MeshOptimizerSceneConverter::doConvert(const Mesh
     Containers::Array<Vector3> positionStorage;
     Containers::StridedArrayView1D<const Vector3> positions;
     Containers::Optional<UnsignedInt> vertexSize;
-    if(!convertInPlaceInternal("Trade::MeshOptimizerSceneConverter::convert():", out, flags(), configuration(), positionStorage, positions, vertexSize, vertexCacheStatsBefore, vertexFetchStatsBefore, overdrawStatsBefore))
+    if(!convertInPlaceInternal("Trade::MeshOptimizerSceneConverter::convert():", out, flags, configuration, positionStorage, positions, vertexSize, vertexCacheStatsBefore, vertexFetchStatsBefore, overdrawStatsBefore))
         return Containers::NullOpt;
 
-    if(configuration().value<bool>("simplify") ||
-       configuration().value<bool>("simplifySloppy"))
+    if(configuration.value<bool>("simplify") ||
+       configuration.value<bool>("simplifySloppy"))
     {
-        const UnsignedInt targetIndexCount = out.indexCount()*configuration().value<Float>("simplifyTargetIndexCountThreshold");
-        const Float targetError = configuration().value<Float>("simplifyTargetError");
+        const UnsignedInt targetIndexCount = out.indexCount()*configuration.value<Float>("simplifyTargetIndexCountThreshold");
+        const Float targetError = configuration.value<Float>("simplifyTargetError");
 
         /* In this case meshoptimizer doesn't provide overloads, so let's do
            this on our side instead */
@@ -341,64 +755,9 @@ Containers::Optional<MeshData> MeshOptimizerSceneConverter::doConvert(const Mesh
         Containers::Array<UnsignedInt> outputIndices;
         Containers::arrayResize<Trade::ArrayAllocator>(outputIndices, NoInit, mesh.indexCount());
 
-        UnsignedInt vertexCount;
-        if(configuration().value<bool>("simplifySloppy")) {
-            /* The nullptr at the end is not needed but without it GCC's
-               -Wzero-as-null-pointer-constant fires due to the default
-               argument being `= 0`. WHAT THE FUCK, how is this warning
-               useful?! Why everything today feels like hastily patched
-               together by incompetent idiots?! */
-            vertexCount = meshopt_simplifySloppy(
-                outputIndices.data(),
-                inputIndices.data(),
-                out.indexCount(),
-                static_cast<const Float*>(positions.data()),
-                out.vertexCount(),
-                positions.stride(),
-                targetIndexCount
-                #if MESHOPTIMIZER_VERSION >= 160
-                , targetError, nullptr
-                #endif
-            );
-        } else {
-            #if MESHOPTIMIZER_VERSION >= 180
-            Int flags = 0;
-            #define _c(option)                                              \
-                if(configuration().value<bool>("simplify" #option))         \
-                    flags |= meshopt_Simplify ## option;
-            _c(LockBorder)
-            #if MESHOPTIMIZER_VERSION >= 210
-            _c(Sparse)
-            _c(ErrorAbsolute)
-            #endif
-            #if MESHOPTIMIZER_VERSION >= 220
-            _c(Prune)
-            #endif
-            #if MESHOPTIMIZER_VERSION >= 250
-            _c(Regularize)
-            _c(Permissive)
-            #endif
-            #undef _c
-            #endif
-            vertexCount = meshopt_simplify(
-                outputIndices.data(),
-                inputIndices.data(),
-                out.indexCount(),
-                static_cast<const Float*>(positions.data()),
-                out.vertexCount(),
-                positions.stride(),
-                targetIndexCount,
-                targetError
-                #if MESHOPTIMIZER_VERSION >= 180
-                , flags
-                #endif
-                #if MESHOPTIMIZER_VERSION >= 160
-                , nullptr
-                #endif
-            );
-        }
-
-        if(!vertexCount && configuration().value<bool>("simplifyFailEmpty")) {
+        const UnsignedInt vertexCount = simplify(configuration, inputIndices, positions, out.vertexCount(), targetIndexCount, targetError, outputIndices);
+
+        if(!vertexCount && configuration.value<bool>("simplifyFailEmpty")) {
             Error{} << "Trade::MeshOptimizerSceneConverter::convert(): simplification resulted in an empty mesh";
             return {};
         }
@@ -417,19 +776,775 @@ Containers::Optional<MeshData> MeshOptimizerSceneConverter::doConvert(const Mesh
 
         /* If we're printing stats after, repopulate the positions to avoid
            using a now-gone array */
-        if(flags() & SceneConverterFlag::Verbose)
+        if(flags & SceneConverterFlag::Verbose)
             populatePositions(out, positionStorage, positions);
     }
 
     /* Print before & after stats if verbose output is requested */
-    if(flags() & SceneConverterFlag::Verbose)
-        analyzePost("Trade::MeshOptimizerSceneConverter::convert():", out, configuration(), flags(), positions, vertexSize, vertexCacheStatsBefore, vertexFetchStatsBefore, overdrawStatsBefore);
+    if(flags & SceneConverterFlag::Verbose)
+        analyzePost("Trade::MeshOptimizerSceneConverter::convert():", out, configuration, flags, positions, vertexSize, vertexCacheStatsBefore, vertexFetchStatsBefore, overdrawStatsBefore, statistics);
+
+    /* Quantize the vertex data as the last step. The combination with
+       meshlets was rejected above. */
+    if(configuration.value<bool>("quantize"))
+        out = quantize("Trade::MeshOptimizerSceneConverter::convert():", Utility::move(out), configuration, flags, quantizedPositionTransformation);
+
+    /* Build meshlets out of the processed mesh. The vertex indices in them
+       refer to the vertices of the mesh that would be returned otherwise. */
+    #if MESHOPTIMIZER_VERSION >= 170
+    if(buildMeshlets) {
+        /* The positions may be gone after simplification, or not populated
+           at all if nothing else needed them */
+        populatePositions(out, positionStorage, positions);
+
+        /* Same as with simplification, meshoptimizer accepts only 32-bit
+           indices here */
+        Containers::Array<UnsignedInt> indicesStorage;
+        Containers::ArrayView<const UnsignedInt> indices;
+        if(out.indexType() == MeshIndexType::UnsignedInt)
+            indices = out.indices<UnsignedInt>().asContiguous();
+        else {
+            indicesStorage = out.indicesAsArray();
+            indices = indicesStorage;
+        }
+
+        const std::size_t maxMeshletCount = meshopt_buildMeshletsBound(indices.size(), meshletMaxVertexCount, meshletMaxTriangleCount);
+        Containers::Array<meshopt_Meshlet> meshlets{NoInit, maxMeshletCount};
+        Containers::Array<UnsignedInt> meshletVertices{NoInit, maxMeshletCount*meshletMaxVertexCount};
+        Containers::Array<UnsignedByte> meshletTriangles{NoInit, maxMeshletCount*meshletMaxTriangleCount*3};
+        const std::size_t meshletCount = meshopt_buildMeshlets(
+            meshlets.data(),
+            meshletVertices.data(),
+            meshletTriangles.data(),
+            indices.data(),
+            indices.size(),
+            static_cast<const Float*>(positions.data()),
+            out.vertexCount(),
+            positions.stride(),
+            meshletMaxVertexCount,
+            meshletMaxTriangleCount,
+            meshletConeWeight);
+
+        /* Each meshlet is a single "vertex" with the vertex and triangle
+           arrays padded to the max size, followed by the counts and culling
+           data. The triangle array size is a multiple of 4, so everything
+           after stays four-byte aligned. */
+        const std::size_t trianglesOffset = meshletMaxVertexCount*sizeof(UnsignedInt);
+        const std::size_t vertexCountOffset = trianglesOffset + meshletMaxTriangleCount*3;
+        const std::size_t triangleCountOffset = vertexCountOffset + sizeof(UnsignedInt);
+        const std::size_t boundingSphereOffset = triangleCountOffset + sizeof(UnsignedInt);
+        const std::size_t coneApexOffset = boundingSphereOffset + sizeof(Vector4);
+        const std::size_t coneOffset = coneApexOffset + sizeof(Vector3);
+        const std::size_t stride = coneOffset + sizeof(Vector4);
+
+        /* Zero-init so the unused parts of the padded arrays are
+           deterministic */
+        Containers::Array<char> meshletData{ValueInit, meshletCount*stride};
+        const Containers::StridedArrayView2D<UnsignedInt> outVertices{meshletData,
+            reinterpret_cast<UnsignedInt*>(meshletData.data()),
+            {meshletCount, meshletMaxVertexCount},
+            {std::ptrdiff_t(stride), 4}};
+        const Containers::StridedArrayView2D<UnsignedByte> outTriangles{meshletData,
+            reinterpret_cast<UnsignedByte*>(meshletData.data() + trianglesOffset),
+            {meshletCount, meshletMaxTriangleCount*3},
+            {std::ptrdiff_t(stride), 1}};
+        const Containers::StridedArrayView1D<UnsignedInt> outVertexCounts{meshletData,
+            reinterpret_cast<UnsignedInt*>(meshletData.data() + vertexCountOffset),
+            meshletCount, std::ptrdiff_t(stride)};
+        const Containers::StridedArrayView1D<UnsignedInt> outTriangleCounts{meshletData,
+            reinterpret_cast<UnsignedInt*>(meshletData.data() + triangleCountOffset),
+            meshletCount, std::ptrdiff_t(stride)};
+        const Containers::StridedArrayView1D<Vector4> outBoundingSpheres{meshletData,
+            reinterpret_cast<Vector4*>(meshletData.data() + boundingSphereOffset),
+            meshletCount, std::ptrdiff_t(stride)};
+        const Containers::StridedArrayView1D<Vector3> outConeApices{meshletData,
+            reinterpret_cast<Vector3*>(meshletData.data() + coneApexOffset),
+            meshletCount, std::ptrdiff_t(stride)};
+        const Containers::StridedArrayView1D<Vector4> outCones{meshletData,
+            reinterpret_cast<Vector4*>(meshletData.data() + coneOffset),
+            meshletCount, std::ptrdiff_t(stride)};
+        for(std::size_t i = 0; i != meshletCount; ++i) {
+            const meshopt_Meshlet& meshlet = meshlets[i];
+            Utility::copy(meshletVertices.sliceSize(meshlet.vertex_offset, meshlet.vertex_count),
+                outVertices[i].prefix(meshlet.vertex_count));
+            Utility::copy(meshletTriangles.sliceSize(meshlet.triangle_offset, meshlet.triangle_count*3),
+                outTriangles[i].prefix(meshlet.triangle_count*3));
+            outVertexCounts[i] = meshlet.vertex_count;
+            outTriangleCounts[i] = meshlet.triangle_count;
+
+            const meshopt_Bounds bounds = meshopt_computeMeshletBounds(
+                meshletVertices.data() + meshlet.vertex_offset,
+                meshletTriangles.data() + meshlet.triangle_offset,
+                meshlet.triangle_count,
+                static_cast<const Float*>(positions.data()),
+                out.vertexCount(),
+                positions.stride());
+            outBoundingSpheres[i] = {Vector3::from(bounds.center), bounds.radius};
+            outConeApices[i] = Vector3::from(bounds.cone_apex);
+            outCones[i] = {Vector3::from(bounds.cone_axis), bounds.cone_cutoff};
+        }
+
+        if(flags & SceneConverterFlag::Verbose)
+            Debug{} << "Trade::MeshOptimizerSceneConverter::convert(): built" << meshletCount << "meshlets out of" << indices.size()/3 << "triangles";
+
+        Containers::Array<MeshAttributeData> attributes{InPlaceInit, {
+            MeshAttributeData{meshAttributeCustom(0), VertexFormat::UnsignedInt,
+                0, UnsignedInt(meshletCount), std::ptrdiff_t(stride),
+                UnsignedShort(meshletMaxVertexCount)},
+            MeshAttributeData{meshAttributeCustom(1), VertexFormat::UnsignedByte,
+                trianglesOffset, UnsignedInt(meshletCount), std::ptrdiff_t(stride),
+                UnsignedShort(meshletMaxTriangleCount*3)},
+            MeshAttributeData{meshAttributeCustom(2), VertexFormat::UnsignedInt,
+                vertexCountOffset, UnsignedInt(meshletCount), std::ptrdiff_t(stride)},
+            MeshAttributeData{meshAttributeCustom(3), VertexFormat::UnsignedInt,
+                triangleCountOffset, UnsignedInt(meshletCount), std::ptrdiff_t(stride)},
+            MeshAttributeData{meshAttributeCustom(4), VertexFormat::Vector4,
+                boundingSphereOffset, UnsignedInt(meshletCount), std::ptrdiff_t(stride)},
+            MeshAttributeData{meshAttributeCustom(5), VertexFormat::Vector3,
+                coneApexOffset, UnsignedInt(meshletCount), std::ptrdiff_t(stride)},
+            MeshAttributeData{meshAttributeCustom(6), VertexFormat::Vector4,
+                coneOffset, UnsignedInt(meshletCount), std::ptrdiff_t(stride)},
+        }};
+
+        if(processedMesh)
+            *processedMesh = Utility::move(out);
+        out = MeshData{MeshPrimitive::Meshlets,
+            Utility::move(meshletData), Utility::move(attributes),
+            UnsignedInt(meshletCount)};
+    }
+    #endif
 
     /* GCC 4.8 needs an explicit conversion, otherwise it tries to copy the
        thing and fails */
     return Containers::optional(Utility::move(out));
 }
 
+/* Checks options that don't depend on the mesh, done upfront so the failure
+   isn't reported for each mesh again */
+bool checkLodChainOptions(const char* const prefix, const Utility::ConfigurationGroup& configuration) {
+    /* These produce something else than a mesh with a chain of index
+       buffers, so it makes no sense to combine them */
+    if(configuration.value<bool>("buildMeshlets")) {
+        Error{} << prefix << "meshlet building can't be combined with LOD chain generation";
+        return false;
+    }
+
+    if(configuration.value<bool>("spatialSortPoints")) {
+        Error{} << prefix << "spatialSortPoints can't be combined with LOD chain generation";
+        return false;
+    }
+
+    return checkQuantizeOptions(prefix, configuration);
+}
+
+/* Parses the lodChain and lodChainTargetErrors options into levels, which
+   stay empty if lodChain is empty */
+bool parseLodChain(const char* const prefix, const Utility::ConfigurationGroup& configuration, Containers::Array<MeshOptimizerSceneConverter::LodLevel>& levels) {
+    Containers::Array<Float> thresholds;
+    Containers::Array<Float> targetErrors;
+    if(!parseFloats(prefix, configuration, "lodChain", thresholds) ||
+       !parseFloats(prefix, configuration, "lodChainTargetErrors", targetErrors))
+        return false;
+    if(thresholds.isEmpty())
+        return true;
+
+    if(!targetErrors.isEmpty() && targetErrors.size() != thresholds.size()) {
+        Error{} << prefix << "expected" << thresholds.size() << "lodChainTargetErrors values but got" << targetErrors.size();
+        return false;
+    }
+
+    /* Values outside of the range would result in negative or out-of-bounds
+       target index counts */
+    for(const Float threshold: thresholds) {
+        if(!(threshold >= 0.0f && threshold <= 1.0f)) {
+            Error{} << prefix << "expected lodChain values to be between 0 and 1 but got" << threshold;
+            return false;
+        }
+    }
+
+    if(!checkLodChainOptions(prefix, configuration))
+        return false;
+
+    const Float targetError = configuration.value<Float>("simplifyTargetError");
+    levels = Containers::Array<MeshOptimizerSceneConverter::LodLevel>{NoInit, thresholds.size()};
+    for(std::size_t i = 0; i != levels.size(); ++i)
+        levels[i] = MeshOptimizerSceneConverter::LodLevel{thresholds[i], targetErrors.isEmpty() ? targetError : targetErrors[i]};
+
+    return true;
+}
+
+Containers::Optional<MeshData> lodChainInternal(const char* const prefix, const MeshData& mesh, const SceneConverterFlags flags, const Utility::ConfigurationGroup& configuration, const Containers::ArrayView<const MeshOptimizerSceneConverter::LodLevel> levels, const Containers::ArrayView<Containers::Pair<UnsignedInt, UnsignedInt>> levelIndexRanges, Matrix4& quantizedPositionTransformation, Statistics* const statistics) {
+    /* Options that don't depend on the mesh are checked by the caller using
+       checkLodChainOptions() */
+    if(mesh.isIndexed() && isMeshIndexTypeImplementationSpecific(mesh.indexType())) {
+        Error{} << prefix << "can't perform any operation on an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType());
+        return {};
+    }
+
+    if(!mesh.hasAttribute(MeshAttribute::Position)) {
+        Error{} << prefix << "the mesh is expected to have positions";
+        return {};
+    }
+
+    /* Do the same processing as in convertInternal(), except for
+       simplification */
+    MeshData out = copyInterleaved(mesh);
+
+    meshopt_VertexCacheStatistics vertexCacheStatsBefore;
+    meshopt_VertexFetchStatistics vertexFetchStatsBefore;
+    meshopt_OverdrawStatistics overdrawStatsBefore;
+    Containers::Array<Vector3> positionStorage;
+    Containers::StridedArrayView1D<const Vector3> positions;
+    Containers::Optional<UnsignedInt> vertexSize;
+    if(!convertInPlaceInternal(prefix, out, flags, configuration, positionStorage, positions, vertexSize, vertexCacheStatsBefore, vertexFetchStatsBefore, overdrawStatsBefore))
+        return {};
+
+    if(flags & SceneConverterFlag::Verbose)
+        analyzePost(prefix, out, configuration, flags, positions, vertexSize, vertexCacheStatsBefore, vertexFetchStatsBefore, overdrawStatsBefore, statistics);
+
+    /* Positions are populated by convertInPlaceInternal() only if some
+       operation needed them */
+    if(!positions)
+        populatePositions(out, positionStorage, positions);
+
+    Containers::Array<UnsignedInt> inputIndicesStorage;
+    Containers::ArrayView<const UnsignedInt> inputIndices;
+    if(out.indexType() == MeshIndexType::UnsignedInt)
+        inputIndices = out.indices<UnsignedInt>().asContiguous();
+    else {
+        inputIndicesStorage = out.indicesAsArray();
+        inputIndices = inputIndicesStorage;
+    }
+
+    /* All levels go into a single index buffer, each simplified from the
+       previous level to not have to process the full mesh every time. The
+       index buffer is grown by the worst case for each level and then
+       shrunk back to what was actually produced, and because that can
+       reallocate the previous level is referenced by an offset. */
+    Containers::Array<UnsignedInt> outputIndices;
+    std::size_t previousOffset = 0;
+    std::size_t previousCount = inputIndices.size();
+    for(std::size_t i = 0; i != levels.size(); ++i) {
+        const std::size_t offset = outputIndices.size();
+        Containers::arrayResize<Trade::ArrayAllocator>(outputIndices, NoInit, offset + previousCount);
+
+        const Containers::ArrayView<const UnsignedInt> levelInputIndices = i == 0 ? inputIndices : outputIndices.sliceSize(previousOffset, previousCount);
+        const Containers::ArrayView<UnsignedInt> levelOutputIndices = outputIndices.sliceSize(offset, previousCount);
+        const UnsignedInt targetIndexCount = inputIndices.size()*levels[i].targetIndexCountThreshold;
+        const UnsignedInt count = simplify(configuration, levelInputIndices, positions, out.vertexCount(), targetIndexCount, levels[i].targetError, levelOutputIndices);
+
+        /* The simplified index buffer is not optimized for vertex cache
+           anymore */
+        if(configuration.value<bool>("optimizeVertexCache"))
+            meshopt_optimizeVertexCache(levelOutputIndices.data(), levelOutputIndices.data(), count, out.vertexCount());
+
+        Containers::arrayResize<Trade::ArrayAllocator>(outputIndices, offset + count);
+        levelIndexRanges[i] = {UnsignedInt(offset), count};
+
+        if(flags & SceneConverterFlag::Verbose)
+            Debug{} << prefix << "level" << i << "has" << count << "indices";
+
+        previousOffset = offset;
+        previousCount = count;
+    }
+
+    /* All levels share the original vertex buffer, unused vertices are not
+       removed */
+    const UnsignedInt vertexCount = out.vertexCount();
+    MeshIndexData indices{outputIndices};
+    MeshData lods{out.primitive(),
+        Containers::arrayAllocatorCast<char, Trade::ArrayAllocator>(Utility::move(outputIndices)), indices,
+        out.releaseVertexData(), out.releaseAttributeData(), vertexCount};
+
+    if(configuration.value<bool>("quantize"))
+        lods = quantize(prefix, Utility::move(lods), configuration, flags, quantizedPositionTransformation);
+
+    /* GCC 4.8 needs an explicit conversion, otherwise it tries to copy the
+       thing and fails */
+    return Containers::optional(Utility::move(lods));
+}
+
+}
+
+Containers::Optional<MeshData> MeshOptimizerSceneConverter::doConvert(const MeshData& mesh) {
+    /* The transformation is mirrored to the configuration so it's accessible
+       also if the plugin is loaded dynamically. Reset it first so a failed
+       conversion doesn't leave a stale value there. */
+    _quantizedPositionTransformation = {};
+    configuration().setValue("quantizedPositionTransformation", _quantizedPositionTransformation);
+
+    /* A LOD chain consists of several index buffers, which a single mesh
+       can't represent without exposing the index ranges somewhere */
+    if(!configuration().value<Containers::StringView>("lodChain").trimmed().isEmpty()) {
+        Error{} << "Trade::MeshOptimizerSceneConverter::convert(): LOD chain generation is available only through begin(), add() and end()";
+        return {};
+    }
+
+    Containers::Optional<MeshData> out = convertInternal(mesh, flags(), configuration(), _quantizedPositionTransformation, nullptr);
+    configuration().setValue("quantizedPositionTransformation", _quantizedPositionTransformation);
+    return out;
+}
+
+Containers::Optional<MeshData> MeshOptimizerSceneConverter::convertLodChain(const MeshData& mesh, const Containers::ArrayView<const LodLevel> levels, const Containers::ArrayView<Containers::Pair<UnsignedInt, UnsignedInt>> levelIndexRanges) {
+    CORRADE_ASSERT(levelIndexRanges.size() == levels.size(),
+        "Trade::MeshOptimizerSceneConverter::convertLodChain(): expected" << levels.size() << "index ranges but got" << levelIndexRanges.size(), {});
+
+    for(const LodLevel& level: levels) {
+        if(!(level.targetIndexCountThreshold >= 0.0f && level.targetIndexCountThreshold <= 1.0f)) {
+            Error{} << "Trade::MeshOptimizerSceneConverter::convertLodChain(): expected level target index count thresholds to be between 0 and 1 but got" << level.targetIndexCountThreshold;
+            return {};
+        }
+    }
+
+    if(!checkLodChainOptions("Trade::MeshOptimizerSceneConverter::convertLodChain():", configuration()))
+        return {};
+
+    _quantizedPositionTransformation = {};
+    Containers::Optional<MeshData> out = lodChainInternal("Trade::MeshOptimizerSceneConverter::convertLodChain():", mesh, flags(), configuration(), levels, levelIndexRanges, _quantizedPositionTransformation, nullptr);
+    configuration().setValue("quantizedPositionTransformation", _quantizedPositionTransformation);
+    return out;
+}
+
+Matrix4 MeshOptimizerSceneConverter::quantizedPositionTransformation() const {
+    return _quantizedPositionTransformation;
+}
+
+namespace {
+
+struct BatchItem {
+    /* Either points to caller-owned data for convertBatch() or to the
+       storage, which is a copy made in add() and freed once converted */
+    const MeshData* input;
+    Containers::Optional<MeshData> inputStorage;
+
+    Containers::Optional<MeshData> mesh;
+    Matrix4 quantizedPositionTransformation;
+    /* Non-empty only if the mesh is a LOD chain */
+    Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>> levelIndexRanges;
+    /* Set only if the mesh is meshlets, containing the mesh they refer to */
+    Containers::Optional<MeshData> processedMesh;
+    Statistics statistics{};
+
+    /* Output of the conversion, captured on the worker thread and replayed
+       on the calling thread once all meshes are done */
+    Containers::String output;
+    Containers::String warningOutput;
+    Containers::String errorOutput;
+};
+
+/* Checks batch-specific options and returns the thread count to use,
+   including the calling thread, or 0 if the options are invalid */
+UnsignedInt batchThreadCount(const char* const prefix, const SceneConverterFlags flags, const Utility::ConfigurationGroup& configuration) {
+    const Int batchThreads = configuration.value<Int>("batchThreads");
+    if(batchThreads < 0) {
+        Error{} << prefix << "expected batchThreads to be zero or positive but got" << batchThreads;
+        return 0;
+    }
+
+    UnsignedInt threadCount = batchThreads;
+    if(!threadCount) {
+        threadCount = Math::max(std::thread::hardware_concurrency(), 1u);
+        if(flags & SceneConverterFlag::Verbose)
+            Debug{} << prefix << "autodetected hardware concurrency to" << threadCount << "threads";
+    }
+
+    return threadCount;
+}
+
+/* Converts a single item with the output captured, generating a LOD chain
+   if there are any levels. The input copy, if any, is freed right after so
+   the memory use doesn't grow with the count of already converted meshes. */
+void convertBatchItem(BatchItem& item, const SceneConverterFlags flags, const Utility::ConfigurationGroup& configuration, const Containers::ArrayView<const MeshOptimizerSceneConverter::LodLevel> lodLevels) {
+    {
+        Debug redirectOutput{&item.output};
+        Warning redirectWarning{&item.warningOutput};
+        Error redirectError{&item.errorOutput};
+        Statistics* const statistics = flags & SceneConverterFlag::Verbose ? &item.statistics : nullptr;
+        if(lodLevels.isEmpty())
+            item.mesh = convertInternal(*item.input, flags, configuration, item.quantizedPositionTransformation, statistics, &item.processedMesh);
+        else {
+            item.levelIndexRanges = Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>>{ValueInit, lodLevels.size()};
+            item.mesh = lodChainInternal("Trade::MeshOptimizerSceneConverter::add():", *item.input, flags, configuration, lodLevels, item.levelIndexRanges, item.quantizedPositionTransformation, statistics);
+        }
+    }
+    item.input = nullptr;
+    item.inputStorage = Containers::NullOpt;
+}
+
+/* Replays the captured output of all items in the order the meshes were
+   passed and prints aggregated stats. Returns false if any mesh failed. */
+bool finishBatch(const char* const prefix, const SceneConverterFlags flags, const Containers::ArrayView<const Containers::Pointer<BatchItem>> items) {
+    bool succeeded = true;
+    Statistics statistics{};
+    for(std::size_t i = 0; i != items.size(); ++i) {
+        const BatchItem& item = *items[i];
+        if(item.output)
+            Debug{Debug::Flag::NoNewlineAtTheEnd} << item.output;
+        if(item.warningOutput)
+            Warning{Debug::Flag::NoNewlineAtTheEnd} << item.warningOutput;
+        if(item.errorOutput)
+            Error{Debug::Flag::NoNewlineAtTheEnd} << item.errorOutput;
+        if(!item.mesh) {
+            Error{} << prefix << "can't convert mesh" << i;
+            succeeded = false;
+        }
+
+        statistics.verticesTransformedBefore += item.statistics.verticesTransformedBefore;
+        statistics.verticesTransformed += item.statistics.verticesTransformed;
+        statistics.warpsExecutedBefore += item.statistics.warpsExecutedBefore;
+        statistics.warpsExecuted += item.statistics.warpsExecuted;
+        statistics.bytesFetchedBefore += item.statistics.bytesFetchedBefore;
+        statistics.bytesFetched += item.statistics.bytesFetched;
+        statistics.pixelsShadedBefore += item.statistics.pixelsShadedBefore;
+        statistics.pixelsShaded += item.statistics.pixelsShaded;
+        statistics.pixelsCoveredBefore += item.statistics.pixelsCoveredBefore;
+        statistics.pixelsCovered += item.statistics.pixelsCovered;
+        statistics.hasVertexFetch = statistics.hasVertexFetch || item.statistics.hasVertexFetch;
+        statistics.hasOverdraw = statistics.hasOverdraw || item.statistics.hasOverdraw;
+    }
+
+    /* Print the aggregated stats instead of the per-mesh ones, which would be
+       too much for large batches */
+    if(flags & SceneConverterFlag::Verbose) {
+        Debug{} << prefix << "processing stats for" << items.size() << "meshes:";
+        Debug{} << "  vertex cache:\n   "
+            << statistics.verticesTransformedBefore << "->"
+            << statistics.verticesTransformed << "transformed vertices\n   "
+            << statistics.warpsExecutedBefore << "->"
+            << statistics.warpsExecuted << "executed warps";
+        if(statistics.hasVertexFetch) Debug{} << "  vertex fetch:\n   "
+            << statistics.bytesFetchedBefore << "->"
+            << statistics.bytesFetched << "bytes fetched";
+        if(statistics.hasOverdraw) Debug{} << "  overdraw:\n   "
+            << statistics.pixelsShadedBefore << "->"
+            << statistics.pixelsShaded << "shaded pixels\n   "
+            << statistics.pixelsCoveredBefore << "->"
+            << statistics.pixelsCovered << "covered pixels\n    overdraw"
+            << (statistics.pixelsCoveredBefore ? Float(statistics.pixelsShadedBefore)/statistics.pixelsCoveredBefore : 0.0f) << "->"
+            << (statistics.pixelsCovered ? Float(statistics.pixelsShaded)/statistics.pixelsCovered : 0.0f);
+    }
+
+    return succeeded;
+}
+
+/* Converts meshes added through add() on a fixed set of worker threads while
+   more meshes are being added. The count of meshes waiting for conversion is
+   bounded, add() blocks if the workers can't keep up, so at most a few
+   copies of the input meshes exist at a time. With a single thread the
+   meshes are converted directly in add(). The flags, configuration and LOD
+   levels are a snapshot from begin(), as the caller is free to modify them
+   while the workers are reading them. */
+class MeshConversionPool {
+    public:
+        explicit MeshConversionPool(const UnsignedInt threadCount, const SceneConverterFlags flags, const Utility::ConfigurationGroup& configuration, Containers::Array<MeshOptimizerSceneConverter::LodLevel>&& lodLevels): _flags{flags}, _configuration{configuration}, _lodLevels{Utility::move(lodLevels)}, _maxPendingCount{4*std::size_t(threadCount)} {
+            /* The calling thread is counted as well as it's busy adding
+               the meshes */
+            arrayReserve(_threads, threadCount - 1);
+            for(UnsignedInt i = 1; i < threadCount; ++i)
+                arrayAppend(_threads, InPlaceInit, &MeshConversionPool::work, this);
+        }
+
+        /* Stops the workers without converting the remaining meshes if
+           finish() wasn't called, e.g. on abort() */
+        ~MeshConversionPool() {
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+                _stop = true;
+            }
+            _workCondition.notify_all();
+            for(std::thread& thread: _threads)
+                if(thread.joinable())
+                    thread.join();
+        }
+
+        void add(const MeshData& mesh) {
+            Containers::Pointer<BatchItem> item{InPlaceInit};
+
+            if(_threads.isEmpty()) {
+                item->input = &mesh;
+                convertBatchItem(*item, _flags, _configuration, _lodLevels);
+                arrayAppend(_items, Utility::move(item));
+                return;
+            }
+
+            /* Wait until there's space for another mesh before making the
+               copy. There's just one thread adding, so the space can only
+               grow until the item is appended below. */
+            {
+                std::unique_lock<std::mutex> lock{_mutex};
+                _spaceCondition.wait(lock, [this]{
+                    return _items.size() - _convertedCount < _maxPendingCount;
+                });
+            }
+
+            item->inputStorage = MeshTools::copy(mesh);
+            item->input = &*item->inputStorage;
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+                arrayAppend(_items, Utility::move(item));
+            }
+            _workCondition.notify_one();
+        }
+
+        /* Waits until all added meshes are converted and returns them */
+        Containers::Array<Containers::Pointer<BatchItem>> finish() {
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+                _finish = true;
+            }
+            _workCondition.notify_all();
+            for(std::thread& thread: _threads)
+                thread.join();
+            return Utility::move(_items);
+        }
+
+    private:
+        void work() {
+            for(;;) {
+                BatchItem* item;
+                {
+                    std::unique_lock<std::mutex> lock{_mutex};
+                    _workCondition.wait(lock, [this]{
+                        return _stop || _finish || _next < _items.size();
+                    });
+                    if(_stop || _next == _items.size())
+                        return;
+                    item = _items[_next++].get();
+                }
+
+                /* The item is only accessed by this thread until finish(),
+                   and growing the array doesn't move the pointed-to data */
+                convertBatchItem(*item, _flags, _configuration, _lodLevels);
+
+                {
+                    std::lock_guard<std::mutex> lock{_mutex};
+                    ++_convertedCount;
+                }
+                _spaceCondition.notify_one();
+            }
+        }
+
+        const SceneConverterFlags _flags;
+        const Utility::ConfigurationGroup _configuration;
+        const Containers::Array<MeshOptimizerSceneConverter::LodLevel> _lodLevels;
+        const std::size_t _maxPendingCount;
+
+        std::mutex _mutex;
+        std::condition_variable _workCondition, _spaceCondition;
+        Containers::Array<std::thread> _threads;
+        Containers::Array<Containers::Pointer<BatchItem>> _items;
+        std::size_t _next = 0, _convertedCount = 0;
+        bool _stop = false, _finish = false;
+};
+
+/* Names of the custom meshlet attributes, indexed by their
+   meshAttributeCustom() ID */
+constexpr const char* MeshletAttributeNames[]{
+    "MeshletVertices",
+    "MeshletTriangles",
+    "MeshletVertexCount",
+    "MeshletTriangleCount",
+    "MeshletBoundingSphere",
+    "MeshletConeApex",
+    "MeshletCone"
+};
+
+/* Returned from end(), with the meshes converted in a batch */
+class BatchImporter: public AbstractImporter {
+    public:
+        explicit BatchImporter(Containers::Array<Containers::Pointer<BatchItem>>&& items, Containers::Array<Containers::String>&& names): _items{Utility::move(items)}, _names{Utility::move(names)} {}
+
+    private:
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return _opened; }
+        void doClose() override {
+            _opened = false;
+            _items = {};
+            _names = {};
+        }
+
+        UnsignedInt doMeshCount() const override { return _items.size(); }
+
+        Int doMeshForName(const Containers::StringView name) override {
+            for(std::size_t i = 0; i != _names.size(); ++i)
+                if(_names[i] == name) return i;
+            return -1;
+        }
+
+        Containers::String doMeshName(const UnsignedInt id) override {
+            return _names[id];
+        }
+
+        /* A LOD chain has a level for each LOD, meshlets have the processed
+           mesh as the first level and the meshlets as the second */
+        UnsignedInt doMeshLevelCount(const UnsignedInt id) override {
+            const BatchItem& item = *_items[id];
+            if(!item.levelIndexRanges.isEmpty())
+                return item.levelIndexRanges.size();
+            return item.processedMesh ? 2 : 1;
+        }
+
+        MeshAttribute doMeshAttributeForName(const Containers::StringView name) override {
+            for(std::size_t i = 0; i != Containers::arraySize(MeshletAttributeNames); ++i)
+                if(name == MeshletAttributeNames[i]) return meshAttributeCustom(i);
+            return {};
+        }
+
+        Containers::String doMeshAttributeName(const MeshAttribute name) override {
+            const UnsignedInt id = meshAttributeCustom(name);
+            return id < Containers::arraySize(MeshletAttributeNames) ? MeshletAttributeNames[id] : "";
+        }
+
+        Containers::Optional<MeshData> doMesh(const UnsignedInt id, const UnsignedInt level) override {
+            const BatchItem& item = *_items[id];
+
+            /* Return a copy so the data stay valid after the importer is
+               closed. The importer state points to the dequantization
+               transformation, which is what convert() would save to the
+               configuration. As with other importers, the state is valid
+               only as long as the importer stays opened. */
+            const void* const importerState = &item.quantizedPositionTransformation;
+
+            /* LOD chain levels get just their own part of the index buffer,
+               the vertex data shared by all levels are copied for each */
+            if(!item.levelIndexRanges.isEmpty()) {
+                const MeshData& mesh = *item.mesh;
+                const Containers::Pair<UnsignedInt, UnsignedInt> range = item.levelIndexRanges[level];
+                Containers::Array<char> indexData{NoInit, range.second()*sizeof(UnsignedInt)};
+                Utility::copy(mesh.indices<UnsignedInt>().asContiguous().sliceSize(range.first(), range.second()),
+                    Containers::arrayCast<UnsignedInt>(indexData));
+                const MeshIndexData indices{Containers::arrayCast<UnsignedInt>(indexData)};
+
+                MeshData vertices = MeshTools::copy(MeshData{mesh.primitive(),
+                    {}, mesh.vertexData(),
+                    meshAttributeDataNonOwningArray(mesh.attributeData()),
+                    mesh.vertexCount()});
+                const UnsignedInt vertexCount = vertices.vertexCount();
+                return MeshData{mesh.primitive(),
+                    Utility::move(indexData), indices,
+                    vertices.releaseVertexData(), vertices.releaseAttributeData(),
+                    vertexCount, importerState};
+            }
+
+            MeshData copy = MeshTools::copy(item.processedMesh && level == 0 ? *item.processedMesh : *item.mesh);
+            const UnsignedInt vertexCount = copy.vertexCount();
+            if(!copy.isIndexed())
+                return MeshData{copy.primitive(),
+                    copy.releaseVertexData(), copy.releaseAttributeData(),
+                    vertexCount, importerState};
+
+            const MeshIndexData indices{copy.indexType(), copy.indices().asContiguous()};
+            return MeshData{copy.primitive(),
+                copy.releaseIndexData(), indices,
+                copy.releaseVertexData(), copy.releaseAttributeData(),
+                vertexCount, importerState};
+        }
+
+        bool _opened = true;
+        Containers::Array<Containers::Pointer<BatchItem>> _items;
+        Containers::Array<Containers::String> _names;
+};
+
+}
+
+struct MeshOptimizerSceneConverter::BatchState {
+    Containers::Pointer<MeshConversionPool> pool;
+    Containers::Array<Containers::String> names;
+};
+
+Containers::Array<Containers::Optional<MeshData>> MeshOptimizerSceneConverter::convertBatch(const Containers::Iterable<const MeshData> meshes, const Containers::ArrayView<Matrix4> quantizedPositionTransformations) {
+    CORRADE_ASSERT(quantizedPositionTransformations.isEmpty() || quantizedPositionTransformations.size() == meshes.size(),
+        "Trade::MeshOptimizerSceneConverter::convertBatch(): expected either no or" << meshes.size() << "quantized position transformations but got" << quantizedPositionTransformations.size(), {});
+
+    /* If the options are invalid, all items stay NullOpt */
+    Containers::Array<Containers::Optional<MeshData>> out{meshes.size()};
+
+    /* The output has no way to express the LOD chain index ranges */
+    if(!configuration().value<Containers::StringView>("lodChain").trimmed().isEmpty()) {
+        Error{} << "Trade::MeshOptimizerSceneConverter::convertBatch(): LOD chain generation is available only through begin(), add() and end()";
+        return out;
+    }
+
+    const UnsignedInt threadCount = batchThreadCount("Trade::MeshOptimizerSceneConverter::convertBatch():", flags(), configuration());
+    if(!threadCount)
+        return out;
+
+    /* All meshes are available upfront here, so there's no need for the
+       bounded queue and copies of MeshConversionPool. Each mesh is converted
+       independently into its own slot with the output captured, so the
+       result doesn't depend on how the meshes got distributed among the
+       threads. The configuration is only read from there. */
+    Containers::Array<Containers::Pointer<BatchItem>> items{meshes.size()};
+    for(std::size_t i = 0; i != meshes.size(); ++i) {
+        items[i].emplace();
+        items[i]->input = &meshes[i];
+    }
+    std::atomic<std::size_t> next{0};
+    auto work = [&]() {
+        for(std::size_t i; (i = next++) < items.size(); )
+            convertBatchItem(*items[i], flags(), configuration(), {});
+    };
+
+    /* The calling thread does its share of the work as well, so with a
+       single thread nothing gets spawned */
+    const std::size_t usedThreadCount = Math::min(std::size_t(threadCount), meshes.size());
+    Containers::Array<std::thread> threads{usedThreadCount ? usedThreadCount - 1 : 0};
+    for(std::thread& thread: threads)
+        thread = std::thread{work};
+    work();
+    for(std::thread& thread: threads)
+        thread.join();
+
+    finishBatch("Trade::MeshOptimizerSceneConverter::convertBatch():", flags(), items);
+    for(std::size_t i = 0; i != items.size(); ++i) {
+        out[i] = Utility::move(items[i]->mesh);
+        if(!quantizedPositionTransformations.isEmpty())
+            quantizedPositionTransformations[i] = items[i]->quantizedPositionTransformation;
+    }
+
+    return out;
+}
+
+bool MeshOptimizerSceneConverter::doBegin() {
+    const UnsignedInt threadCount = batchThreadCount("Trade::MeshOptimizerSceneConverter::begin():", flags(), configuration());
+    Containers::Array<LodLevel> lodLevels;
+    if(!threadCount || !parseLodChain("Trade::MeshOptimizerSceneConverter::begin():", configuration(), lodLevels))
+        return false;
+
+    _batchState.emplace();
+    _batchState->pool.emplace(threadCount, flags(), configuration(), Utility::move(lodLevels));
+    return true;
+}
+
+bool MeshOptimizerSceneConverter::doAdd(UnsignedInt, const MeshData& mesh, const Containers::StringView name) {
+    /* The conversion is started right away, failures are reported only in
+       end() in order to have the output ordered */
+    _batchState->pool->add(mesh);
+    arrayAppend(_batchState->names, InPlaceInit, name);
+    return true;
+}
+
+Containers::Pointer<AbstractImporter> MeshOptimizerSceneConverter::doEnd() {
+    /* Take over the state so it's released even if the conversion fails */
+    const Containers::Pointer<BatchState> state = Utility::move(_batchState);
+
+    Containers::Array<Containers::Pointer<BatchItem>> items = state->pool->finish();
+    if(!finishBatch("Trade::MeshOptimizerSceneConverter::end():", flags(), items))
+        return {};
+
+    /* Convert the growable arrays back to a default deleter to avoid
+       dangling deleter function pointer issues when unloading the plugin */
+    arrayShrink(items, DefaultInit);
+    Containers::Array<Containers::String> names = Utility::move(state->names);
+    arrayShrink(names, DefaultInit);
+
+    return Containers::pointer<BatchImporter>(Utility::move(items), Utility::move(names));
+}
+
+void MeshOptimizerSceneConverter::doAbort() {
+    _batchState = nullptr;
+}
+
 }}
 
 CORRADE_PLUGIN_REGISTER(MeshOptimizerSceneConverter, Magnum::Trade::MeshOptimizerSceneConverter,
@@ -31,6 +31,9 @@
  * @m_since_{plugins,2020,06}
  */
 
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pointer.h>
+#include <Magnum/Math/Matrix4.h>
 #include <Magnum/Trade/AbstractSceneConverter.h>
 
 #include "MagnumPlugins/MeshOptimizerSceneConverter/configure.h"
@@ -171,6 +174,186 @@ case, enable the @cb{.ini} simplifyFailEmpty @ce option to make the process
 fail in that case instead. There are also other
 @ref Trade-MeshOptimizerSceneConverter-configuration "simplification options".
 
+@subsection Trade-MeshOptimizerSceneConverter-behavior-meshlets Meshlet generation
+
+If the @cb{.ini} buildMeshlets @ce
+@ref Trade-MeshOptimizerSceneConverter-configuration "configuration option" is
+enabled, @ref convert(const MeshData&) splits the mesh into
+[meshlets](https://github.com/zeux/meshoptimizer#mesh-shading) suitable for
+mesh shaders or cluster culling and returns them instead of the processed
+mesh. The meshlets are built after all other operations, and the vertex
+indices they contain refer to vertices of the mesh that
+@ref convert(const MeshData&) would return with the same options but
+@cb{.ini} buildMeshlets @ce disabled. The operation requires the mesh to have a
+position attribute, and can't be performed in-place.
+
+The returned mesh is a @ref MeshPrimitive::Meshlets with one vertex per meshlet
+and the following custom attributes. The vertex and triangle arrays are
+always padded to the @cb{.ini} buildMeshletsMaxVertices @ce and
+@cb{.ini} buildMeshletsMaxTriangles @ce sizes, with the actual counts stored in
+separate attributes:
+
+-   @ref meshAttributeCustom() "meshAttributeCustom(0)" --- meshlet vertices,
+    an array of @ref VertexFormat::UnsignedInt indices into the processed mesh
+-   @ref meshAttributeCustom() "meshAttributeCustom(1)" --- meshlet triangles,
+    an array of @ref VertexFormat::UnsignedByte indices into the meshlet
+    vertices, three for each triangle
+-   @ref meshAttributeCustom() "meshAttributeCustom(2)" --- meshlet vertex
+    count, @ref VertexFormat::UnsignedInt
+-   @ref meshAttributeCustom() "meshAttributeCustom(3)" --- meshlet triangle
+    count, @ref VertexFormat::UnsignedInt
+-   @ref meshAttributeCustom() "meshAttributeCustom(4)" --- bounding sphere
+    center and radius, @ref VertexFormat::Vector4
+-   @ref meshAttributeCustom() "meshAttributeCustom(5)" --- normal cone apex,
+    @ref VertexFormat::Vector3
+-   @ref meshAttributeCustom() "meshAttributeCustom(6)" --- normal cone axis
+    and cutoff, @ref VertexFormat::Vector4
+
+When converting through @ref begin(),
+@ref add(const MeshData&, Containers::StringView) and @ref end(), the processed
+mesh the meshlets refer to isn't discarded. Each mesh in the returned importer
+has two levels, with the processed mesh being the first and the meshlets the
+second, and @ref AbstractImporter::meshAttributeName() returns
+@cpp "MeshletVertices" @ce, @cpp "MeshletTriangles" @ce,
+@cpp "MeshletVertexCount" @ce, @cpp "MeshletTriangleCount" @ce,
+@cpp "MeshletBoundingSphere" @ce, @cpp "MeshletConeApex" @ce and
+@cpp "MeshletCone" @ce for the above custom attributes.
+
+The bounding sphere and normal cone are calculated using
+@cpp meshopt_computeMeshletBounds() @ce, see its documentation for how to use
+them for culling. Meshlet generation is available only since meshoptimizer
+0.17, on older versions the conversion fails.
+
+@subsection Trade-MeshOptimizerSceneConverter-behavior-quantization Vertex quantization
+
+If the @cb{.ini} quantize @ce
+@ref Trade-MeshOptimizerSceneConverter-configuration "configuration option" is
+enabled, @ref convert(const MeshData&) and @ref convertLodChain() convert
+floating-point vertex attributes to smaller normalized integer types as the
+last step, in a way that's compatible with the
+[KHR_mesh_quantization](https://github.com/KhronosGroup/glTF/blob/main/extensions/2.0/Khronos/KHR_mesh_quantization/README.md)
+glTF extension:
+
+-   @ref MeshAttribute::Position is converted to a 16-bit normalized signed
+    type, scaled uniformly to fit into the @f$ [-1, 1] @f$ range. The
+    transformation that converts the quantized positions back to the original
+    space is then available through @ref quantizedPositionTransformation()
+    and is meant to be applied to the node the mesh is attached to. As that
+    function is available only if the plugin is linked statically, the
+    transformation is also saved into the
+    @cb{.ini} quantizedPositionTransformation @ce
+    @ref Trade-MeshOptimizerSceneConverter-configuration "configuration option"
+    after each @ref convert(const MeshData&), from where it can be retrieved
+    with @ref Utility::ConfigurationGroup::value() "value<Matrix4>()".
+-   @ref MeshAttribute::Normal, @relativeref{MeshAttribute,Tangent} and
+    @relativeref{MeshAttribute,Bitangent} are converted to a 8-bit or 16-bit
+    normalized signed type, depending on the @cb{.ini} quantizeNormalBits @ce
+    option, if all values are in the @f$ [-1, 1] @f$ range
+-   @ref MeshAttribute::TextureCoordinates are converted to a 16-bit
+    normalized unsigned type if they're all in the @f$ [0, 1] @f$ range
+-   @ref MeshAttribute::Color is converted to an 8-bit normalized unsigned
+    type if all values are in the @f$ [0, 1] @f$ range
+
+Each of the above can be excluded from the quantization by disabling the
+@cb{.ini} quantizePositions @ce, @cb{.ini} quantizeNormals @ce,
+@cb{.ini} quantizeTextureCoordinates @ce or @cb{.ini} quantizeColors @ce
+option, respectively.
+
+Attributes that are already in a packed type, custom attributes, array
+attributes and morph target attributes are kept as-is. Every attribute in the
+output is padded to be four-byte aligned. The operation can't be performed
+in-place and is skipped with a warning if the mesh contains attributes with
+implementation-specific vertex formats. It can't be combined with
+@cb{.ini} buildMeshlets @ce, the conversion fails if both are enabled.
+
+The KHR_mesh_quantization extension doesn't support octahedral encoding of
+normals and tangents, and neither does the quantization done here.
+
+@subsection Trade-MeshOptimizerSceneConverter-behavior-points Point cloud spatial sorting
+
+Meshes with @ref MeshPrimitive::Points are rejected by default. If the
+@cb{.ini} spatialSortPoints @ce
+@ref Trade-MeshOptimizerSceneConverter-configuration "configuration option" is
+enabled, their vertices are instead reordered using
+@cpp meshopt_spatialSortRemap() @ce so points close to each other are close in
+memory as well, which improves GPU cache utilization and makes the data
+compress better. It requires the mesh to have a position attribute. Indexed
+point clouds get their index buffer remapped to the new vertex order, all
+other options except for @cb{.ini} quantize @ce are ignored.
+
+The sorting can be performed in-place as well, in which case the mesh is
+required to be non-indexed and interleaved, with mutable vertex data.
+
+@subsection Trade-MeshOptimizerSceneConverter-behavior-lod Level of detail chain generation
+
+To avoid repeating the whole processing for every level when building a chain
+of levels of detail, the plugin-specific @ref convertLodChain() API simplifies
+the mesh to all levels in a single call, with each level taking the previous
+one as an input. All levels share a single vertex buffer and differ only in
+the index ranges, see the function documentation for more information.
+
+The same is available through the generic @ref AbstractSceneConverter
+interface by setting the @cb{.ini} lodChain @ce
+@ref Trade-MeshOptimizerSceneConverter-configuration "configuration option" to
+a whitespace-separated list of target index count thresholds in the
+@f$ [0, 1] @f$ range, one for each level, and converting the meshes in a
+@ref Trade-MeshOptimizerSceneConverter-behavior-batch "batch". The target
+error of each level is then taken from the @cb{.ini} lodChainTargetErrors @ce
+list, which is expected to have the same count of values, or from
+@cb{.ini} simplifyTargetError @ce if the list is empty. In the importer
+returned from @ref end(), @ref AbstractImporter::meshLevelCount() of each mesh
+is then the count of levels, with each @ref AbstractImporter::mesh() level
+containing just the indices of given level and a copy of the vertex buffer
+shared by all levels. The @ref begin() function fails if the options are
+invalid. As a LOD chain can't be represented with a single mesh,
+@ref convert(const MeshData&) and @ref convertBatch() fail if
+@cb{.ini} lodChain @ce is non-empty.
+
+LOD chain generation can't be combined with the @cb{.ini} buildMeshlets @ce
+and @cb{.ini} spatialSortPoints @ce options, @ref begin() and
+@ref convertLodChain() fail if either is enabled.
+
+@subsection Trade-MeshOptimizerSceneConverter-behavior-batch Batch conversion
+
+The plugin-specific @ref convertBatch() API converts many meshes at once,
+distributing them across multiple threads. The thread count is controlled
+with the @cb{.ini} batchThreads @ce
+@ref Trade-MeshOptimizerSceneConverter-configuration "configuration option",
+defaulting to the hardware concurrency. A negative value makes the conversion
+fail.
+
+The same is available through the generic @ref AbstractSceneConverter
+interface using @ref begin(), @ref add(const MeshData&, Containers::StringView)
+and @ref end(). Conversion of each mesh is started already in
+@ref add(const MeshData&, Containers::StringView) on a pool of worker threads,
+which works on a copy of the mesh that's freed once converted. The count of
+meshes waiting for conversion is limited to four times the thread count, if
+the workers can't keep up, @ref add(const MeshData&, Containers::StringView)
+waits until there's space, so memory use doesn't grow with the count of added
+meshes. With @cb{.ini} batchThreads @ce set to @cpp 1 @ce, the meshes are
+converted directly in @ref add(const MeshData&, Containers::StringView). The
+options are taken from the configuration at the time of @ref begin(), changing
+them afterwards has no effect on the batch, and @ref begin() fails if they're
+invalid.
+
+The @ref end() function waits for all conversions to finish and returns an
+importer containing the converted meshes with their names. The
+@ref AbstractImporter::meshCount() corresponds to the count of added meshes,
+@ref MeshData::importerState() of each imported mesh points to a
+@ref Magnum::Matrix4 "Matrix4" with what
+@ref quantizedPositionTransformation() would return for it. Each
+@ref AbstractImporter::mesh() call returns a copy of the data, which thus stay
+valid after the importer is closed. The importer state however points to
+importer-owned memory and, as with other importers, is valid only until the
+importer is closed or destroyed. If conversion of any mesh fails, the whole
+@ref end() fails. The returned importer is implemented in the plugin binary,
+so it has to be destroyed before the plugin is unloaded.
+
+If the @cb{.ini} lodChain @ce option is set, each mesh is converted to a chain
+of levels of detail instead, see
+@ref Trade-MeshOptimizerSceneConverter-behavior-lod for details. This isn't
+available in @ref convertBatch(), which fails in that case.
+
 @section Trade-MeshOptimizerSceneConverter-configuration Plugin-specific configuration
 
 It's possible to tune various output options through @ref configuration(). See
@@ -188,11 +371,141 @@ class MAGNUM_MESHOPTIMIZERSCENECONVERTER_EXPORT MeshOptimizerSceneConverter: pub
 
         ~MeshOptimizerSceneConverter();
 
+        /**
+         * @brief Level of detail parameters
+         * @m_since_latest_{plugins}
+         *
+         * @see @ref convertLodChain()
+         */
+        struct LodLevel {
+            /**
+             * Target index count relative to the full mesh, equivalent to
+             * the @cb{.ini} simplifyTargetIndexCountThreshold @ce
+             * configuration option
+             */
+            Float targetIndexCountThreshold;
+
+            /**
+             * Target error, equivalent to the @cb{.ini} simplifyTargetError @ce
+             * configuration option
+             */
+            Float targetError;
+        };
+
+        /**
+         * @brief Generate a chain of levels of detail
+         * @m_since_latest_{plugins}
+         *
+         * Performs the same operations as @ref convert(const MeshData&),
+         * but instead of simplifying the mesh once, simplifies it
+         * successively for each entry in @p levels, each level taking the
+         * previous one as an input. The returned mesh contains index buffers
+         * of all levels concatenated together, sharing a single vertex buffer
+         * with no unused vertices removed. Index offset and count of each
+         * level is written to @p levelIndexRanges, which is expected to have
+         * the same size as @p levels.
+         *
+         * The @cb{.ini} simplifySloppy @ce and other simplification
+         * @ref Trade-MeshOptimizerSceneConverter-configuration "configuration options"
+         * are respected, @cb{.ini} simplify @ce,
+         * @cb{.ini} simplifyTargetIndexCountThreshold @ce,
+         * @cb{.ini} simplifyTargetError @ce, @cb{.ini} simplifyFailEmpty @ce,
+         * @cb{.ini} lodChain @ce and @cb{.ini} lodChainTargetErrors @ce are
+         * ignored, @cb{.ini} buildMeshlets @ce and
+         * @cb{.ini} spatialSortPoints @ce are expected to be disabled. If
+         * @cb{.ini} optimizeVertexCache @ce is enabled, each level is
+         * optimized for vertex cache after the simplification. The mesh
+         * is required to have a position attribute. The output index type is
+         * always @ref MeshIndexType::UnsignedInt. A level with
+         * @ref LodLevel::targetIndexCountThreshold set to @cpp 1.0f @ce
+         * can be used to include the full-detail mesh in the chain. If any
+         * @ref LodLevel::targetIndexCountThreshold is outside of the
+         * @f$ [0, 1] @f$ range, prints a message to
+         * @relativeref{Magnum,Error} and returns
+         * @relativeref{Corrade,Containers::NullOpt}.
+         *
+         * This function can be called only if the plugin is linked
+         * statically. Through the @ref AbstractSceneConverter interface, use
+         * the @cb{.ini} lodChain @ce option together with @ref begin(),
+         * @ref add(const MeshData&, Containers::StringView) and @ref end()
+         * instead, see @ref Trade-MeshOptimizerSceneConverter-behavior-lod
+         * for more information.
+         */
+        Containers::Optional<MeshData> convertLodChain(const MeshData& mesh, Containers::ArrayView<const LodLevel> levels, Containers::ArrayView<Containers::Pair<UnsignedInt, UnsignedInt>> levelIndexRanges);
+
+        /**
+         * @brief Dequantization transformation of the last converted mesh
+         * @m_since_latest_{plugins}
+         *
+         * If the @cb{.ini} quantize @ce and @cb{.ini} quantizePositions @ce
+         * @ref Trade-MeshOptimizerSceneConverter-configuration "configuration options"
+         * are enabled, returns a transformation that converts positions of
+         * the mesh returned from the last @ref convert(const MeshData&) or
+         * @ref convertLodChain() call back to the original space. Returns an
+         * identity matrix otherwise. See
+         * @ref Trade-MeshOptimizerSceneConverter-behavior-quantization for
+         * more information.
+         *
+         * This function can be called only if the plugin is linked
+         * statically. Through the @ref AbstractSceneConverter interface, the
+         * same value is available in the
+         * @cb{.ini} quantizedPositionTransformation @ce
+         * @ref Trade-MeshOptimizerSceneConverter-configuration "configuration option".
+         */
+        Matrix4 quantizedPositionTransformation() const;
+
+        /**
+         * @brief Convert a batch of meshes in parallel
+         * @m_since_latest_{plugins}
+         *
+         * Performs the same operation as @ref convert(const MeshData&) on
+         * each mesh in @p meshes, distributing them among
+         * @cb{.ini} batchThreads @ce threads, one of them being the calling
+         * thread. Returns an array with a converted mesh for each input mesh,
+         * with failed conversions being @relativeref{Corrade,Containers::NullOpt}.
+         * The results don't depend on the thread count or on the order in
+         * which the meshes got processed.
+         *
+         * If @p quantizedPositionTransformations is not empty, it's expected
+         * to have the same size as @p meshes and is filled with what
+         * @ref quantizedPositionTransformation() would return for each mesh.
+         *
+         * Output of each conversion is captured and printed only once all
+         * meshes are processed, in the order the meshes were passed, each
+         * failure being additionally followed by a message containing the
+         * mesh index. With @ref SceneConverterFlag::Verbose enabled, the
+         * per-mesh analyzer output is replaced with totals over the whole
+         * batch.
+         *
+         * If the @cb{.ini} batchThreads @ce option is negative or the
+         * @cb{.ini} lodChain @ce option is set, prints a message to
+         * @relativeref{Magnum,Error} and returns
+         * @relativeref{Corrade,Containers::NullOpt} for all meshes.
+         *
+         * This function can be called only if the plugin is linked
+         * statically. Through the @ref AbstractSceneConverter interface, use
+         * @ref begin(), @ref add(const MeshData&, Containers::StringView) and
+         * @ref end() instead, see
+         * @ref Trade-MeshOptimizerSceneConverter-behavior-batch for more
+         * information.
+         */
+        Containers::Array<Containers::Optional<MeshData>> convertBatch(Containers::Iterable<const MeshData> meshes, Containers::ArrayView<Matrix4> quantizedPositionTransformations = {});
+
     private:
         MAGNUM_MESHOPTIMIZERSCENECONVERTER_LOCAL SceneConverterFeatures doFeatures() const override;
 
         MAGNUM_MESHOPTIMIZERSCENECONVERTER_LOCAL bool doConvertInPlace(MeshData& mesh) override;
         MAGNUM_MESHOPTIMIZERSCENECONVERTER_LOCAL Containers::Optional<MeshData> doConvert(const MeshData& mesh) override;
+
+        MAGNUM_MESHOPTIMIZERSCENECONVERTER_LOCAL bool doBegin() override;
+        MAGNUM_MESHOPTIMIZERSCENECONVERTER_LOCAL bool doAdd(UnsignedInt id, const MeshData& mesh, Containers::StringView name) override;
+        MAGNUM_MESHOPTIMIZERSCENECONVERTER_LOCAL Containers::Pointer<AbstractImporter> doEnd() override;
+        MAGNUM_MESHOPTIMIZERSCENECONVERTER_LOCAL void doAbort() override;
+
+        Matrix4 _quantizedPositionTransformation;
+
+        struct BatchState;
+        Containers::Pointer<BatchState> _batchState;
 };
 
 }}
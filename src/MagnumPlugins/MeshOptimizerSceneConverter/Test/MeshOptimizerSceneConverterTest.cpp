@@ -24,27 +24,40 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Iterable.h>
 #include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StringView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
 #include <Corrade/TestSuite/Compare/String.h>
 #include <Corrade/Utility/ConfigurationGroup.h>
 #include <Corrade/Utility/Format.h>
-#include <Magnum/Math/Vector3.h>
+#include <Magnum/Math/ConfigurationValue.h>
+#include <Magnum/Math/Vector4.h>
 #include <Magnum/MeshTools/CompressIndices.h>
 #include <Magnum/MeshTools/GenerateIndices.h>
 #include <Magnum/MeshTools/Interleave.h>
+#include <Magnum/MeshTools/Transform.h>
 #include <Magnum/Primitives/Circle.h>
 #include <Magnum/Primitives/Icosphere.h>
 #include <Magnum/Primitives/Plane.h>
 #include <Magnum/Primitives/Square.h>
 #include <Magnum/Primitives/UVSphere.h>
+#include <Magnum/Trade/AbstractImporter.h>
 #include <Magnum/Trade/AbstractSceneConverter.h>
 #include <Magnum/Trade/MeshData.h>
 #include <meshoptimizer.h> /* MESHOPTIMIZER_VERSION */
 
 #include "configure.h"
 
+/* Plugin-specific APIs can be called only if the plugin is linked in
+   statically */
+#ifndef MESHOPTIMIZERSCENECONVERTER_PLUGIN_FILENAME
+#include "MagnumPlugins/MeshOptimizerSceneConverter/MeshOptimizerSceneConverter.h"
+#endif
+
 namespace Magnum { namespace Trade { namespace Test { namespace {
 
 struct MeshOptimizerSceneConverterTest: TestSuite::Tester {
@@ -92,6 +105,37 @@ struct MeshOptimizerSceneConverterTest: TestSuite::Tester {
     #endif
     void simplifyEmpty();
 
+    void buildMeshletsInPlace();
+    #if MESHOPTIMIZER_VERSION >= 170
+    void buildMeshletsNoPositions();
+    void buildMeshletsInvalidOptions();
+    void buildMeshlets();
+    void buildMeshletsBatch();
+    #endif
+
+    void lodChain();
+    void lodChainDefaultTargetError();
+    void lodChainNoPositions();
+    void lodChainInvalidOptions();
+
+    void quantizeInPlace();
+    void quantizeInvalidNormalBits();
+    void quantize();
+    void quantizeOutOfRange();
+    void quantizedPositionTransformation();
+    void quantizedPositionTransformationFailed();
+
+    void batch();
+    void batchFailed();
+    void batchMoreMeshesThanThreads();
+    void batchInvalidOptions();
+    void batchVerbose();
+
+    void spatialSortPointsInPlaceIndexed();
+    void spatialSortPointsNoPositions();
+    void spatialSortPoints();
+    void spatialSortPointsQuantize();
+
     /* Explicitly forbid system-wide plugin dependencies */
     PluginManager::Manager<AbstractSceneConverter> _manager{"nonexistent"};
 };
@@ -158,6 +202,100 @@ const struct {
     {"empty input, failEmpty", {}, 0, 1.0e-2f, nullptr},
 };
 
+#if MESHOPTIMIZER_VERSION >= 170
+const struct {
+    const char* name;
+    const char* option;
+    const char* value;
+    const char* message;
+} BuildMeshletsInvalidOptionsData[]{
+    {"too few vertices", "buildMeshletsMaxVertices", "2",
+        "expected buildMeshletsMaxVertices to be between 3 and 255 but got 2"},
+    {"too many vertices", "buildMeshletsMaxVertices", "256",
+        "expected buildMeshletsMaxVertices to be between 3 and 255 but got 256"},
+    {"zero triangles", "buildMeshletsMaxTriangles", "0",
+        "expected buildMeshletsMaxTriangles to be a multiple of 4 between 4 and 512 but got 0"},
+    {"too many triangles", "buildMeshletsMaxTriangles", "516",
+        "expected buildMeshletsMaxTriangles to be a multiple of 4 between 4 and 512 but got 516"},
+    {"triangles not a multiple of four", "buildMeshletsMaxTriangles", "126",
+        "expected buildMeshletsMaxTriangles to be a multiple of 4 between 4 and 512 but got 126"},
+    {"cone weight out of range", "buildMeshletsConeWeight", "1.5",
+        "expected buildMeshletsConeWeight to be between 0 and 1 but got 1.5"},
+    {"quantization", "quantize", "true",
+        "quantization can't be combined with meshlet building"},
+};
+#endif
+
+const struct {
+    const char* name;
+    const char* lodChain;
+    const char* lodChainTargetErrors;
+    const char* option;
+    const char* message;
+} LodChainInvalidOptionsData[]{
+    {"invalid threshold", "1.0 0.5f", "", nullptr,
+        "invalid lodChain value 0.5f"},
+    {"invalid target error", "1.0 0.5", "0.1 error", nullptr,
+        "invalid lodChainTargetErrors value error"},
+    {"target error count mismatch", "1.0 0.5 0.25", "0.1 0.1", nullptr,
+        "expected 3 lodChainTargetErrors values but got 2"},
+    {"negative threshold", "1.0 -0.5", "", nullptr,
+        "expected lodChain values to be between 0 and 1 but got -0.5"},
+    {"threshold larger than one", "1.5 0.5", "", nullptr,
+        "expected lodChain values to be between 0 and 1 but got 1.5"},
+    {"meshlets", "1.0 0.5", "", "buildMeshlets",
+        "meshlet building can't be combined with LOD chain generation"},
+    {"point cloud sorting", "1.0 0.5", "", "spatialSortPoints",
+        "spatialSortPoints can't be combined with LOD chain generation"},
+};
+
+const struct {
+    const char* name;
+    bool quantizeNormals;
+    UnsignedInt normalBits;
+    VertexFormat normalFormat, tangentFormat;
+    UnsignedInt stride;
+} QuantizeData[]{
+    {"8-bit normals", true, 8,
+        VertexFormat::Vector3bNormalized, VertexFormat::Vector4bNormalized,
+        8 + 4 + 4 + 4},
+    {"16-bit normals", true, 16,
+        VertexFormat::Vector3sNormalized, VertexFormat::Vector4sNormalized,
+        8 + 8 + 8 + 4},
+    {"normals not quantized", false, 8,
+        VertexFormat::Vector3, VertexFormat::Vector4,
+        8 + 12 + 16 + 4},
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} BatchData[]{
+    {"single thread", 1},
+    {"three threads", 3},
+    {"more threads than meshes", 16},
+    {"autodetected thread count", 0},
+};
+
+const struct {
+    const char* name;
+    const char* option;
+    const char* value;
+    const char* message;
+} BatchInvalidOptionsData[]{
+    {"negative thread count", "batchThreads", "-1",
+        "expected batchThreads to be zero or positive but got -1"},
+};
+
+const struct {
+    const char* name;
+    bool inPlace, indexed;
+} SpatialSortPointsData[]{
+    {"", false, false},
+    {"in-place", true, false},
+    {"indexed", false, true},
+};
+
 MeshOptimizerSceneConverterTest::MeshOptimizerSceneConverterTest() {
     addTests({
         &MeshOptimizerSceneConverterTest::notTriangles,
@@ -229,6 +367,56 @@ MeshOptimizerSceneConverterTest::MeshOptimizerSceneConverterTest() {
     addInstancedTests({&MeshOptimizerSceneConverterTest::simplifyEmpty},
         Containers::arraySize(SimplifyEmptyData));
 
+    addTests({&MeshOptimizerSceneConverterTest::buildMeshletsInPlace,
+              #if MESHOPTIMIZER_VERSION >= 170
+              &MeshOptimizerSceneConverterTest::buildMeshletsNoPositions
+              #endif
+              });
+
+    #if MESHOPTIMIZER_VERSION >= 170
+    addInstancedTests({&MeshOptimizerSceneConverterTest::buildMeshletsInvalidOptions},
+        Containers::arraySize(BuildMeshletsInvalidOptionsData));
+
+    addTests({&MeshOptimizerSceneConverterTest::buildMeshlets,
+              &MeshOptimizerSceneConverterTest::buildMeshletsBatch});
+    #endif
+
+    addTests({&MeshOptimizerSceneConverterTest::lodChain,
+              &MeshOptimizerSceneConverterTest::lodChainDefaultTargetError,
+              &MeshOptimizerSceneConverterTest::lodChainNoPositions});
+
+    addInstancedTests({&MeshOptimizerSceneConverterTest::lodChainInvalidOptions},
+        Containers::arraySize(LodChainInvalidOptionsData));
+
+    addTests({&MeshOptimizerSceneConverterTest::quantizeInPlace,
+              &MeshOptimizerSceneConverterTest::quantizeInvalidNormalBits});
+
+    addInstancedTests({&MeshOptimizerSceneConverterTest::quantize},
+        Containers::arraySize(QuantizeData));
+
+    addTests({&MeshOptimizerSceneConverterTest::quantizeOutOfRange,
+              &MeshOptimizerSceneConverterTest::quantizedPositionTransformation,
+              &MeshOptimizerSceneConverterTest::quantizedPositionTransformationFailed});
+
+    addInstancedTests({&MeshOptimizerSceneConverterTest::batch},
+        Containers::arraySize(BatchData));
+
+    addTests({&MeshOptimizerSceneConverterTest::batchFailed,
+              &MeshOptimizerSceneConverterTest::batchMoreMeshesThanThreads});
+
+    addInstancedTests({&MeshOptimizerSceneConverterTest::batchInvalidOptions},
+        Containers::arraySize(BatchInvalidOptionsData));
+
+    addTests({&MeshOptimizerSceneConverterTest::batchVerbose,
+
+              &MeshOptimizerSceneConverterTest::spatialSortPointsInPlaceIndexed,
+              &MeshOptimizerSceneConverterTest::spatialSortPointsNoPositions});
+
+    addInstancedTests({&MeshOptimizerSceneConverterTest::spatialSortPoints},
+        Containers::arraySize(SpatialSortPointsData));
+
+    addTests({&MeshOptimizerSceneConverterTest::spatialSortPointsQuantize});
+
     /* Load the plugin directly from the build tree. Otherwise it's static and
        already loaded. */
     #ifdef MESHOPTIMIZERSCENECONVERTER_PLUGIN_FILENAME
@@ -1383,6 +1571,946 @@ void MeshOptimizerSceneConverterTest::simplifyEmpty() {
     }
 }
 
+void MeshOptimizerSceneConverterTest::buildMeshletsInPlace() {
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MeshOptimizerSceneConverter");
+    converter->configuration().setValue("optimizeVertexCache", false);
+    converter->configuration().setValue("optimizeOverdraw", false);
+    converter->configuration().setValue("optimizeVertexFetch", false);
+    converter->configuration().setValue("buildMeshlets", true);
+
+    const UnsignedByte indexData[3]{};
+    MeshData mesh{MeshPrimitive::Triangles,
+        {}, indexData, MeshIndexData{indexData},
+        nullptr, {}, 1};
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convertInPlace(mesh));
+    CORRADE_COMPARE(out,
+        "Trade::MeshOptimizerSceneConverter::convertInPlace(): meshlet building can't be performed in-place, use convert() instead\n");
+}
+
+#if MESHOPTIMIZER_VERSION >= 170
+void MeshOptimizerSceneConverterTest::buildMeshletsNoPositions() {
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MeshOptimizerSceneConverter");
+    converter->configuration().setValue("optimizeVertexCache", false);
+    converter->configuration().setValue("optimizeOverdraw", false);
+    converter->configuration().setValue("optimizeVertexFetch", false);
+    converter->configuration().setValue("buildMeshlets", true);
+
+    const UnsignedByte indexData[3]{};
+    MeshData mesh{MeshPrimitive::Triangles,
+        {}, indexData, MeshIndexData{indexData},
+        nullptr, {}, 1};
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convert(mesh));
+    CORRADE_COMPARE(out,
+        "Trade::MeshOptimizerSceneConverter::convert(): buildMeshlets requires the mesh to have positions\n");
+}
+
+void MeshOptimizerSceneConverterTest::buildMeshletsInvalidOptions() {
+    auto&& data = BuildMeshletsInvalidOptionsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MeshOptimizerSceneConverter");
+    converter->configuration().setValue("buildMeshlets", true);
+    converter->configuration().setValue(data.option, data.value);
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convert(Primitives::icosphereSolid(1)));
+    CORRADE_COMPARE(out, Utility::format("Trade::MeshOptimizerSceneConverter::convert(): {}\n", data.message));
+}
+
+void MeshOptimizerSceneConverterTest::buildMeshlets() {
+    const MeshData icosphere = Primitives::icosphereSolid(3);
+
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MeshOptimizerSceneConverter");
+    converter->configuration().setValue("buildMeshletsMaxVertices", 32);
+    converter->configuration().setValue("buildMeshletsMaxTriangles", 40);
+
+    /* The meshlets reference vertices of the mesh returned with the same
+       options but meshlet building disabled */
+    Containers::Optional<MeshData> processed = converter->convert(icosphere);
+    CORRADE_VERIFY(processed);
+
+    /* The option should exist and be disabled by default */
+    CORRADE_COMPARE(converter->configuration().value<Containers::StringView>("buildMeshlets"), "false");
+    converter->configuration().setValue("buildMeshlets", true);
+
+    Containers::Optional<MeshData> meshlets = converter->convert(icosphere);
+    CORRADE_VERIFY(meshlets);
+    CORRADE_COMPARE(meshlets->primitive(), MeshPrimitive::Meshlets);
+    CORRADE_VERIFY(!meshlets->isIndexed());
+    CORRADE_COMPARE(meshlets->attributeCount(), 7);
+    /* 1280 triangles, at most 40 in each meshlet */
+    CORRADE_COMPARE_AS(meshlets->vertexCount(), 32,
+        TestSuite::Compare::GreaterOrEqual);
+
+    CORRADE_COMPARE(meshlets->attributeFormat(meshAttributeCustom(0)), VertexFormat::UnsignedInt);
+    CORRADE_COMPARE(meshlets->attributeArraySize(meshAttributeCustom(0)), 32);
+    CORRADE_COMPARE(meshlets->attributeFormat(meshAttributeCustom(1)), VertexFormat::UnsignedByte);
+    CORRADE_COMPARE(meshlets->attributeArraySize(meshAttributeCustom(1)), 40*3);
+    CORRADE_COMPARE(meshlets->attributeFormat(meshAttributeCustom(2)), VertexFormat::UnsignedInt);
+    CORRADE_COMPARE(meshlets->attributeFormat(meshAttributeCustom(3)), VertexFormat::UnsignedInt);
+    CORRADE_COMPARE(meshlets->attributeFormat(meshAttributeCustom(4)), VertexFormat::Vector4);
+    CORRADE_COMPARE(meshlets->attributeFormat(meshAttributeCustom(5)), VertexFormat::Vector3);
+    CORRADE_COMPARE(meshlets->attributeFormat(meshAttributeCustom(6)), VertexFormat::Vector4);
+
+    const Containers::StridedArrayView2D<const UnsignedInt> vertices = meshlets->attribute<UnsignedInt[]>(meshAttributeCustom(0));
+    const Containers::StridedArrayView2D<const UnsignedByte> triangles = meshlets->attribute<UnsignedByte[]>(meshAttributeCustom(1));
+    const Containers::StridedArrayView1D<const UnsignedInt> vertexCounts = meshlets->attribute<UnsignedInt>(meshAttributeCustom(2));
+    const Containers::StridedArrayView1D<const UnsignedInt> triangleCounts = meshlets->attribute<UnsignedInt>(meshAttributeCustom(3));
+    const Containers::StridedArrayView1D<const Vector4> boundingSpheres = meshlets->attribute<Vector4>(meshAttributeCustom(4));
+    const Containers::Array<Vector3> positions = processed->positions3DAsArray();
+
+    /* All triangles should be present exactly once, each should reference
+       vertices of the processed mesh and be inside the bounding sphere */
+    UnsignedInt triangleCount = 0;
+    for(std::size_t i = 0; i != meshlets->vertexCount(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_AS(vertexCounts[i], 32,
+            TestSuite::Compare::LessOrEqual);
+        CORRADE_COMPARE_AS(triangleCounts[i], 40,
+            TestSuite::Compare::LessOrEqual);
+        triangleCount += triangleCounts[i];
+
+        for(std::size_t j = 0; j != triangleCounts[i]*3; ++j) {
+            CORRADE_COMPARE_AS(triangles[i][j], vertexCounts[i],
+                TestSuite::Compare::Less);
+            const UnsignedInt vertex = vertices[i][triangles[i][j]];
+            CORRADE_COMPARE_AS(vertex, processed->vertexCount(),
+                TestSuite::Compare::Less);
+            CORRADE_COMPARE_AS((positions[vertex] - boundingSpheres[i].xyz()).length(), boundingSpheres[i].w()*1.001f,
+                TestSuite::Compare::LessOrEqual);
+        }
+    }
+    CORRADE_COMPARE(triangleCount, processed->indexCount()/3);
+}
+
+void MeshOptimizerSceneConverterTest::buildMeshletsBatch() {
+    const MeshData icosphere = Primitives::icosphereSolid(3);
+
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MeshOptimizerSceneConverter");
+    converter->configuration().setValue("buildMeshletsMaxVertices", 32);
+    converter->configuration().setValue("buildMeshletsMaxTriangles", 40);
+
+    Containers::Optional<MeshData> processed = converter->convert(icosphere);
+    CORRADE_VERIFY(processed);
+
+    converter->configuration().setValue("buildMeshlets", true);
+    Containers::Optional<MeshData> meshlets = converter->convert(icosphere);
+    CORRADE_VERIFY(meshlets);
+
+    CORRADE_VERIFY(converter->begin());
+    CORRADE_VERIFY(converter->add(icosphere));
+    Containers::Pointer<AbstractImporter> importer = converter->end();
+    CORRADE_VERIFY(importer);
+    CORRADE_COMPARE(importer->meshCount(), 1);
+
+    /* Through the batch interface, the processed mesh the meshlets refer to
+       is available as well, in the first level */
+    CORRADE_COMPARE(importer->meshLevelCount(0), 2);
+
+    Containers::Optional<MeshData> importedProcessed = importer->mesh(0, 0);
+    CORRADE_VERIFY(importedProcessed);
+    CORRADE_COMPARE(importedProcessed->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(importedProcessed->vertexCount(), processed->vertexCount());
+    CORRADE_COMPARE_AS(importedProcessed->indicesAsArray(), processed->indicesAsArray(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(importedProcessed->positions3DAsArray(), processed->positions3DAsArray(),
+        TestSuite::Compare::Container);
+
+    Containers::Optional<MeshData> importedMeshlets = importer->mesh(0, 1);
+    CORRADE_VERIFY(importedMeshlets);
+    CORRADE_COMPARE(importedMeshlets->primitive(), MeshPrimitive::Meshlets);
+    CORRADE_COMPARE(importedMeshlets->vertexCount(), meshlets->vertexCount());
+    CORRADE_COMPARE(importedMeshlets->attributeCount(), 7);
+    CORRADE_COMPARE_AS(importedMeshlets->vertexData(), meshlets->vertexData(),
+        TestSuite::Compare::Container);
+
+    /* The custom attributes have names */
+    CORRADE_COMPARE(importer->meshAttributeName(meshAttributeCustom(0)), "MeshletVertices");
+    CORRADE_COMPARE(importer->meshAttributeName(meshAttributeCustom(1)), "MeshletTriangles");
+    CORRADE_COMPARE(importer->meshAttributeName(meshAttributeCustom(2)), "MeshletVertexCount");
+    CORRADE_COMPARE(importer->meshAttributeName(meshAttributeCustom(3)), "MeshletTriangleCount");
+    CORRADE_COMPARE(importer->meshAttributeName(meshAttributeCustom(4)), "MeshletBoundingSphere");
+    CORRADE_COMPARE(importer->meshAttributeName(meshAttributeCustom(5)), "MeshletConeApex");
+    CORRADE_COMPARE(importer->meshAttributeName(meshAttributeCustom(6)), "MeshletCone");
+    CORRADE_COMPARE(importer->meshAttributeName(meshAttributeCustom(7)), "");
+    CORRADE_COMPARE(importer->meshAttributeForName("MeshletBoundingSphere"), meshAttributeCustom(4));
+    CORRADE_COMPARE(importer->meshAttributeForName("Nonexistent"), MeshAttribute{});
+}
+#endif
+
+void MeshOptimizerSceneConverterTest::lodChain() {
+    const MeshData icosphere = Primitives::icosphereSolid(3);
+
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MeshOptimizerSceneConverter");
+    /* Should be ignored */
+    converter->configuration().setValue("simplifyTargetIndexCountThreshold", 0.1f);
+
+    /* The options should exist and be empty by default */
+    CORRADE_COMPARE(converter->configuration().value<Containers::StringView>("lodChain"), "");
+    CORRADE_COMPARE(converter->configuration().value<Containers::StringView>("lodChainTargetErrors"), "");
+    converter->configuration().setValue("lodChain", "1.0 0.5\t 0.25");
+    converter->configuration().setValue("lodChainTargetErrors", "0.0 0.5 0.5");
+
+    /* A single mesh can't represent the whole chain */
+    {
+        Containers::String out;
+        Error redirectError{&out};
+        CORRADE_VERIFY(!converter->convert(icosphere));
+        CORRADE_COMPARE(out, "Trade::MeshOptimizerSceneConverter::convert(): LOD chain generation is available only through begin(), add() and end()\n");
+    }
+
+    CORRADE_VERIFY(converter->begin());
+    CORRADE_VERIFY(converter->add(icosphere));
+    Containers::Pointer<AbstractImporter> importer = converter->end();
+    CORRADE_VERIFY(importer);
+    CORRADE_COMPARE(importer->meshCount(), 1);
+    CORRADE_COMPARE(importer->meshLevelCount(0), 3);
+
+    /* Each level has its own index buffer, the vertex buffer is the same for
+       all and no vertices are removed */
+    Containers::Optional<MeshData> levels[3];
+    for(UnsignedInt i = 0; i != 3; ++i) {
+        CORRADE_ITERATION(i);
+        levels[i] = importer->mesh(0, i);
+        CORRADE_VERIFY(levels[i]);
+        CORRADE_COMPARE(levels[i]->primitive(), MeshPrimitive::Triangles);
+        CORRADE_COMPARE(levels[i]->indexType(), MeshIndexType::UnsignedInt);
+        CORRADE_COMPARE(levels[i]->indexData().size(), levels[i]->indexCount()*4);
+        CORRADE_COMPARE(levels[i]->vertexCount(), icosphere.vertexCount());
+        CORRADE_COMPARE(levels[i]->attributeCount(), icosphere.attributeCount());
+        CORRADE_COMPARE_AS(levels[i]->attribute<Vector3>(MeshAttribute::Position), levels[0]->attribute<Vector3>(MeshAttribute::Position),
+            TestSuite::Compare::Container);
+        for(UnsignedInt index: levels[i]->indices<UnsignedInt>())
+            CORRADE_COMPARE_AS(index, icosphere.vertexCount(),
+                TestSuite::Compare::Less);
+    }
+
+    /* The first level is the full mesh, the others are gradually smaller */
+    CORRADE_COMPARE(levels[0]->indexCount(), icosphere.indexCount());
+    CORRADE_COMPARE_AS(levels[1]->indexCount(), icosphere.indexCount()/2,
+        TestSuite::Compare::LessOrEqual);
+    CORRADE_COMPARE_AS(levels[1]->indexCount(), 0,
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(levels[2]->indexCount(), icosphere.indexCount()/4,
+        TestSuite::Compare::LessOrEqual);
+    CORRADE_COMPARE_AS(levels[2]->indexCount(), 0,
+        TestSuite::Compare::Greater);
+
+    /* The plugin-specific API should give back the same, with the levels
+       concatenated. The batch API can't represent the chain either. */
+    #ifdef MESHOPTIMIZERSCENECONVERTER_PLUGIN_FILENAME
+    CORRADE_SKIP("MeshOptimizerSceneConverter::convertLodChain() can be called only if the plugin is built as static");
+    #else
+    const MeshOptimizerSceneConverter::LodLevel lodLevels[]{
+        {1.0f, 0.0f},
+        {0.5f, 0.5f},
+        {0.25f, 0.5f},
+    };
+    Containers::Pair<UnsignedInt, UnsignedInt> levelIndexRanges[3];
+    Containers::Optional<MeshData> staticLods = static_cast<MeshOptimizerSceneConverter&>(*converter).convertLodChain(icosphere, lodLevels, levelIndexRanges);
+    CORRADE_VERIFY(staticLods);
+    CORRADE_VERIFY(!staticLods->importerState());
+    CORRADE_COMPARE(levelIndexRanges[0].first(), 0);
+    for(std::size_t i = 0; i != 3; ++i) {
+        CORRADE_ITERATION(i);
+        if(i) CORRADE_COMPARE(levelIndexRanges[i].first(), levelIndexRanges[i - 1].first() + levelIndexRanges[i - 1].second());
+        CORRADE_COMPARE_AS(staticLods->indices<UnsignedInt>().sliceSize(levelIndexRanges[i].first(), levelIndexRanges[i].second()), levels[i]->indices<UnsignedInt>(),
+            TestSuite::Compare::Container);
+    }
+    CORRADE_COMPARE(staticLods->indexCount(), levelIndexRanges[2].first() + levelIndexRanges[2].second());
+
+    const MeshData* meshes[]{&icosphere};
+    Containers::String out;
+    Error redirectError{&out};
+    Containers::Array<Containers::Optional<MeshData>> converted = static_cast<MeshOptimizerSceneConverter&>(*converter).convertBatch(Containers::arrayView(meshes));
+    CORRADE_COMPARE(converted.size(), 1);
+    CORRADE_VERIFY(!converted[0]);
+    CORRADE_COMPARE(out, "Trade::MeshOptimizerSceneConverter::convertBatch(): LOD chain generation is available only through begin(), add() and end()\n");
+    #endif
+}
+
+void MeshOptimizerSceneConverterTest::lodChainDefaultTargetError() {
+    const MeshData icosphere = Primitives::icosphereSolid(3);
+
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MeshOptimizerSceneConverter");
+    converter->configuration().setValue("lodChain", "0.5");
+    converter->configuration().setValue("simplifyTargetError", 0.5f);
+    CORRADE_VERIFY(converter->begin());
+    CORRADE_VERIFY(converter->add(icosphere));
+    Containers::Pointer<AbstractImporter> importer = converter->end();
+    CORRADE_VERIFY(importer);
+    Containers::Optional<MeshData> lods = importer->mesh(0);
+    CORRADE_VERIFY(lods);
+
+    /* Without lodChainTargetErrors, simplifyTargetError is used, which gives
+       the same result as with the error specified explicitly */
+    converter->configuration().setValue("simplifyTargetError", 0.0f);
+    converter->configuration().setValue("lodChainTargetErrors", "0.5");
+    CORRADE_VERIFY(converter->begin());
+    CORRADE_VERIFY(converter->add(icosphere));
+    Containers::Pointer<AbstractImporter> expectedImporter = converter->end();
+    CORRADE_VERIFY(expectedImporter);
+    Containers::Optional<MeshData> expected = expectedImporter->mesh(0);
+    CORRADE_VERIFY(expected);
+    CORRADE_COMPARE_AS(lods->indexCount(), 0,
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(lods->indices<UnsignedInt>(), expected->indices<UnsignedInt>(),
+        TestSuite::Compare::Container);
+}
+
+void MeshOptimizerSceneConverterTest::lodChainNoPositions() {
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MeshOptimizerSceneConverter");
+    converter->configuration().setValue("lodChain", "0.5");
+
+    const UnsignedByte indexData[3]{};
+    MeshData mesh{MeshPrimitive::Triangles,
+        {}, indexData, MeshIndexData{indexData},
+        nullptr, {}, 1};
+
+    {
+        CORRADE_VERIFY(converter->begin());
+        CORRADE_VERIFY(converter->add(mesh));
+
+        Containers::String out;
+        Error redirectError{&out};
+        CORRADE_VERIFY(!converter->end());
+        CORRADE_COMPARE(out,
+            "Trade::MeshOptimizerSceneConverter::add(): the mesh is expected to have positions\n"
+            "Trade::MeshOptimizerSceneConverter::end(): can't convert mesh 0\n");
+    }
+
+    #ifdef MESHOPTIMIZERSCENECONVERTER_PLUGIN_FILENAME
+    CORRADE_SKIP("MeshOptimizerSceneConverter::convertLodChain() can be called only if the plugin is built as static");
+    #else
+    const MeshOptimizerSceneConverter::LodLevel levels[]{
+        {0.5f, 0.01f}
+    };
+    Containers::Pair<UnsignedInt, UnsignedInt> levelIndexRanges[1];
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!static_cast<MeshOptimizerSceneConverter&>(*converter).convertLodChain(mesh, levels, levelIndexRanges));
+    CORRADE_COMPARE(out,
+        "Trade::MeshOptimizerSceneConverter::convertLodChain(): the mesh is expected to have positions\n");
+    #endif
+}
+
+void MeshOptimizerSceneConverterTest::lodChainInvalidOptions() {
+    auto&& data = LodChainInvalidOptionsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MeshOptimizerSceneConverter");
+    converter->configuration().setValue("lodChain", data.lodChain);
+    converter->configuration().setValue("lodChainTargetErrors", data.lodChainTargetErrors);
+    if(data.option)
+        converter->configuration().setValue(data.option, true);
+
+    /* The options are checked upfront */
+    {
+        Containers::String out;
+        Error redirectError{&out};
+        CORRADE_VERIFY(!converter->begin());
+        CORRADE_COMPARE(out, Utility::format("Trade::MeshOptimizerSceneConverter::begin(): {}\n", data.message));
+    }
+
+    /* The option checks are done in the plugin-specific API as well */
+    if(!data.option)
+        return;
+
+    #ifdef MESHOPTIMIZERSCENECONVERTER_PLUGIN_FILENAME
+    CORRADE_SKIP("MeshOptimizerSceneConverter::convertLodChain() can be called only if the plugin is built as static");
+    #else
+    const MeshOptimizerSceneConverter::LodLevel levels[]{
+        {0.5f, 0.01f}
+    };
+    Containers::Pair<UnsignedInt, UnsignedInt> levelIndexRanges[1];
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!static_cast<MeshOptimizerSceneConverter&>(*converter).convertLodChain(Primitives::icosphereSolid(1), levels, levelIndexRanges));
+    CORRADE_COMPARE(out, Utility::format("Trade::MeshOptimizerSceneConverter::convertLodChain(): {}\n", data.message));
+    #endif
+}
+
+void MeshOptimizerSceneConverterTest::quantizeInPlace() {
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MeshOptimizerSceneConverter");
+    converter->configuration().setValue("optimizeVertexCache", false);
+    converter->configuration().setValue("optimizeOverdraw", false);
+    converter->configuration().setValue("optimizeVertexFetch", false);
+    converter->configuration().setValue("quantize", true);
+
+    const UnsignedByte indexData[3]{};
+    MeshData mesh{MeshPrimitive::Triangles,
+        {}, indexData, MeshIndexData{indexData},
+        nullptr, {}, 1};
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convertInPlace(mesh));
+    CORRADE_COMPARE(out,
+        "Trade::MeshOptimizerSceneConverter::convertInPlace(): vertex quantization can't be performed in-place, use convert() instead\n");
+}
+
+void MeshOptimizerSceneConverterTest::quantizeInvalidNormalBits() {
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MeshOptimizerSceneConverter");
+    converter->configuration().setValue("quantize", true);
+    converter->configuration().setValue("quantizeNormalBits", 12);
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convert(Primitives::icosphereSolid(1)));
+    CORRADE_COMPARE(out,
+        "Trade::MeshOptimizerSceneConverter::convert(): expected quantizeNormalBits to be either 8 or 16 but got 12\n");
+}
+
+void MeshOptimizerSceneConverterTest::quantize() {
+    auto&& data = QuantizeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const MeshData sphere = Primitives::uvSphereSolid(4, 6, Primitives::UVSphereFlag::TextureCoordinates|Primitives::UVSphereFlag::Tangents);
+
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MeshOptimizerSceneConverter");
+
+    /* Reference output with the same options but no quantization */
+    Containers::Optional<MeshData> processed = converter->convert(sphere);
+    CORRADE_VERIFY(processed);
+
+    /* The option should exist and be disabled by default */
+    CORRADE_COMPARE(converter->configuration().value<Containers::StringView>("quantize"), "false");
+    converter->configuration().setValue("quantize", true);
+    converter->configuration().setValue("quantizeNormalBits", data.normalBits);
+    /* The option should exist and be enabled by default */
+    CORRADE_COMPARE(converter->configuration().value<Containers::StringView>("quantizeNormals"), "true");
+    converter->configuration().setValue("quantizeNormals", data.quantizeNormals);
+
+    Containers::Optional<MeshData> quantized = converter->convert(sphere);
+    CORRADE_VERIFY(quantized);
+    CORRADE_COMPARE(quantized->vertexCount(), processed->vertexCount());
+    CORRADE_COMPARE_AS(quantized->indicesAsArray(), processed->indicesAsArray(),
+        TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(quantized->attributeFormat(MeshAttribute::Position), VertexFormat::Vector3sNormalized);
+    CORRADE_COMPARE(quantized->attributeFormat(MeshAttribute::Normal), data.normalFormat);
+    CORRADE_COMPARE(quantized->attributeFormat(MeshAttribute::Tangent), data.tangentFormat);
+    CORRADE_COMPARE(quantized->attributeFormat(MeshAttribute::TextureCoordinates), VertexFormat::Vector2usNormalized);
+    CORRADE_COMPARE(quantized->attributeStride(MeshAttribute::Position), data.stride);
+
+    /* The sphere is centered and has a unit radius, so the positions should
+       be the same as the original after unpacking. Texture coordinates are
+       in the [0, 1] range as well. */
+    const Float precision = !data.quantizeNormals ? 0.0f :
+        data.normalBits == 8 ? 1.0f/127.0f : 1.0f/32767.0f;
+    const Containers::Array<Vector3> positions = quantized->positions3DAsArray();
+    const Containers::Array<Vector3> expectedPositions = processed->positions3DAsArray();
+    const Containers::Array<Vector3> normals = quantized->normalsAsArray();
+    const Containers::Array<Vector3> expectedNormals = processed->normalsAsArray();
+    const Containers::Array<Vector2> textureCoordinates = quantized->textureCoordinates2DAsArray();
+    const Containers::Array<Vector2> expectedTextureCoordinates = processed->textureCoordinates2DAsArray();
+    for(std::size_t i = 0; i != quantized->vertexCount(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_WITH(positions[i], expectedPositions[i],
+            TestSuite::Compare::around(Vector3{1.0f/32767.0f}));
+        CORRADE_COMPARE_WITH(normals[i], expectedNormals[i],
+            TestSuite::Compare::around(Vector3{precision}));
+        CORRADE_COMPARE_WITH(textureCoordinates[i], expectedTextureCoordinates[i],
+            TestSuite::Compare::around(Vector2{1.0f/65535.0f}));
+    }
+}
+
+void MeshOptimizerSceneConverterTest::quantizeOutOfRange() {
+    /* Texture coordinates outside of the [0, 1] range */
+    MeshData plane = MeshTools::generateIndices(Primitives::planeSolid(Primitives::PlaneFlag::TextureCoordinates));
+    for(Vector2& i: plane.mutableAttribute<Vector2>(MeshAttribute::TextureCoordinates))
+        i *= 2.0f;
+
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MeshOptimizerSceneConverter");
+    converter->configuration().setValue("quantize", true);
+
+    Containers::Optional<MeshData> quantized = converter->convert(plane);
+    CORRADE_VERIFY(quantized);
+    CORRADE_COMPARE(quantized->attributeFormat(MeshAttribute::Position), VertexFormat::Vector3sNormalized);
+    CORRADE_COMPARE(quantized->attributeFormat(MeshAttribute::Normal), VertexFormat::Vector3bNormalized);
+    CORRADE_COMPARE(quantized->attributeFormat(MeshAttribute::TextureCoordinates), VertexFormat::Vector2);
+}
+
+void MeshOptimizerSceneConverterTest::quantizedPositionTransformation() {
+    const Matrix4 transformation = Matrix4::translation({5.0f, -2.0f, 1.0f})*Matrix4::scaling({3.0f, 1.0f, 2.0f});
+    const MeshData sphere = MeshTools::transform3D(Primitives::icosphereSolid(2), transformation);
+
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MeshOptimizerSceneConverter");
+    converter->configuration().setValue("quantize", true);
+
+    /* Identity if nothing was converted yet */
+    CORRADE_COMPARE(converter->configuration().value<Matrix4>("quantizedPositionTransformation"), Matrix4{});
+    #ifndef MESHOPTIMIZERSCENECONVERTER_PLUGIN_FILENAME
+    auto& meshOptimizerConverter = static_cast<MeshOptimizerSceneConverter&>(*converter);
+    CORRADE_COMPARE(meshOptimizerConverter.quantizedPositionTransformation(), Matrix4{});
+    #endif
+
+    Containers::Optional<MeshData> quantized = converter->convert(sphere);
+    CORRADE_VERIFY(quantized);
+    CORRADE_COMPARE(quantized->attributeFormat(MeshAttribute::Position), VertexFormat::Vector3sNormalized);
+
+    /* The scale is uniform, taken from the largest extent */
+    const Matrix4 quantizedPositionTransformation = converter->configuration().value<Matrix4>("quantizedPositionTransformation");
+    CORRADE_COMPARE(quantizedPositionTransformation, Matrix4::translation({5.0f, -2.0f, 1.0f})*Matrix4::scaling(Vector3{3.0f}));
+    #ifndef MESHOPTIMIZERSCENECONVERTER_PLUGIN_FILENAME
+    CORRADE_COMPARE(meshOptimizerConverter.quantizedPositionTransformation(), quantizedPositionTransformation);
+    #endif
+
+    Containers::Array<Vector3> positions = quantized->positions3DAsArray();
+    MeshTools::transformPointsInPlace(quantizedPositionTransformation, positions);
+    for(const Vector3& position: positions) {
+        const Vector3 unit = transformation.inverted().transformPoint(position);
+        CORRADE_COMPARE_WITH(unit.length(), 1.0f,
+            TestSuite::Compare::around(0.001f));
+    }
+
+    /* Converting without quantization resets it back */
+    converter->configuration().setValue("quantize", false);
+    CORRADE_VERIFY(converter->convert(sphere));
+    CORRADE_COMPARE(converter->configuration().value<Matrix4>("quantizedPositionTransformation"), Matrix4{});
+    #ifndef MESHOPTIMIZERSCENECONVERTER_PLUGIN_FILENAME
+    CORRADE_COMPARE(meshOptimizerConverter.quantizedPositionTransformation(), Matrix4{});
+    #endif
+}
+
+void MeshOptimizerSceneConverterTest::quantizedPositionTransformationFailed() {
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MeshOptimizerSceneConverter");
+    converter->configuration().setValue("quantize", true);
+    CORRADE_VERIFY(converter->convert(MeshTools::transform3D(Primitives::icosphereSolid(1), Matrix4::scaling(Vector3{2.0f}))));
+    CORRADE_VERIFY(converter->configuration().value<Matrix4>("quantizedPositionTransformation") != Matrix4{});
+
+    /* A failed conversion shouldn't leave a stale value */
+    converter->configuration().setValue("quantizeNormalBits", 7);
+    {
+        Containers::String out;
+        Error redirectError{&out};
+        CORRADE_VERIFY(!converter->convert(Primitives::icosphereSolid(1)));
+    }
+    CORRADE_COMPARE(converter->configuration().value<Matrix4>("quantizedPositionTransformation"), Matrix4{});
+}
+
+void MeshOptimizerSceneConverterTest::batch() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MeshOptimizerSceneConverter");
+    CORRADE_COMPARE(converter->features(), SceneConverterFeature::ConvertMeshInPlace|SceneConverterFeature::ConvertMesh|SceneConverterFeature::ConvertMultiple|SceneConverterFeature::AddMeshes);
+    converter->configuration().setValue("simplify", true);
+    converter->configuration().setValue("simplifyTargetIndexCountThreshold", 0.5f);
+    converter->configuration().setValue("simplifyTargetError", 0.25f);
+    converter->configuration().setValue("quantize", true);
+
+    /* The option should exist and autodetect by default */
+    CORRADE_COMPARE(converter->configuration().value<UnsignedInt>("batchThreads"), 0);
+    converter->configuration().setValue("batchThreads", data.threadCount);
+
+    /* The third mesh isn't indexed and fails */
+    const MeshData meshes[]{
+        Primitives::icosphereSolid(2),
+        Primitives::uvSphereSolid(4, 6, Primitives::UVSphereFlag::TextureCoordinates),
+        MeshData{MeshPrimitive::Triangles, 3},
+        MeshTools::transform3D(Primitives::icosphereSolid(1), Matrix4::translation(Vector3::xAxis(3.0f))),
+        Primitives::planeSolid(),
+    };
+
+    /* Through the generic interface. There a failure of any mesh makes the
+       whole end() fail, so the failing mesh isn't added. That's tested in
+       batchFailed() instead. */
+    const Containers::Pair<UnsignedInt, Containers::StringView> added[]{
+        {0, "icosphere"},
+        {1, "UV sphere"},
+        {3, "translated icosphere"},
+        {4, "plane"},
+    };
+    CORRADE_VERIFY(converter->begin());
+    for(const Containers::Pair<UnsignedInt, Containers::StringView>& i: added)
+        CORRADE_VERIFY(converter->add(meshes[i.first()], i.second()));
+    Containers::Pointer<AbstractImporter> importer = converter->end();
+    CORRADE_VERIFY(importer);
+    CORRADE_COMPARE(importer->meshCount(), Containers::arraySize(added));
+    CORRADE_COMPARE(importer->meshForName("translated icosphere"), 2);
+    CORRADE_COMPARE(importer->meshForName("cube"), -1);
+
+    /* The results should be the same as when converting each separately */
+    for(std::size_t i = 0; i != Containers::arraySize(added); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(importer->meshName(i), added[i].second());
+
+        Containers::Optional<MeshData> converted = importer->mesh(i);
+        CORRADE_VERIFY(converted);
+        Containers::Optional<MeshData> expected = converter->convert(meshes[added[i].first()]);
+        CORRADE_VERIFY(expected);
+
+        CORRADE_COMPARE(converted->primitive(), expected->primitive());
+        CORRADE_COMPARE(converted->vertexCount(), expected->vertexCount());
+        CORRADE_COMPARE(converted->attributeCount(), expected->attributeCount());
+        CORRADE_COMPARE_AS(converted->indexData(), expected->indexData(),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(converted->vertexData(), expected->vertexData(),
+            TestSuite::Compare::Container);
+
+        /* The importer state is the dequantization transformation */
+        CORRADE_VERIFY(converted->importerState());
+        CORRADE_COMPARE(*static_cast<const Matrix4*>(converted->importerState()), converter->configuration().value<Matrix4>("quantizedPositionTransformation"));
+    }
+
+    /* The batch conversion is available through the plugin-specific API as
+       well, where the failure of a particular mesh doesn't fail the rest */
+    #ifdef MESHOPTIMIZERSCENECONVERTER_PLUGIN_FILENAME
+    CORRADE_SKIP("MeshOptimizerSceneConverter::convertBatch() can be called only if the plugin is built as static");
+    #else
+    Matrix4 quantizedPositionTransformations[Containers::arraySize(meshes)];
+    Containers::Array<Containers::Optional<MeshData>> converted;
+    Containers::String out;
+    {
+        Error redirectError{&out};
+        converted = static_cast<MeshOptimizerSceneConverter&>(*converter).convertBatch(meshes, quantizedPositionTransformations);
+    }
+    CORRADE_COMPARE(converted.size(), Containers::arraySize(meshes));
+    CORRADE_COMPARE(out,
+        "Trade::MeshOptimizerSceneConverter::convert(): expected an indexed mesh\n"
+        "Trade::MeshOptimizerSceneConverter::convertBatch(): can't convert mesh 2\n");
+
+    for(std::size_t i = 0; i != Containers::arraySize(meshes); ++i) {
+        CORRADE_ITERATION(i);
+        Containers::Optional<MeshData> expected;
+        {
+            Error redirectError{nullptr};
+            expected = converter->convert(meshes[i]);
+        }
+        CORRADE_COMPARE(!!converted[i], !!expected);
+        if(!expected) continue;
+
+        CORRADE_COMPARE(converted[i]->primitive(), expected->primitive());
+        CORRADE_COMPARE(converted[i]->vertexCount(), expected->vertexCount());
+        CORRADE_COMPARE(converted[i]->attributeCount(), expected->attributeCount());
+        CORRADE_COMPARE_AS(converted[i]->indexData(), expected->indexData(),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(converted[i]->vertexData(), expected->vertexData(),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE(quantizedPositionTransformations[i], static_cast<MeshOptimizerSceneConverter&>(*converter).quantizedPositionTransformation());
+    }
+    #endif
+}
+
+void MeshOptimizerSceneConverterTest::batchFailed() {
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MeshOptimizerSceneConverter");
+    converter->configuration().setValue("batchThreads", 2);
+
+    CORRADE_VERIFY(converter->begin());
+    CORRADE_VERIFY(converter->add(Primitives::icosphereSolid(1)));
+    CORRADE_VERIFY(converter->add(Primitives::planeSolid()));
+    /* Not indexed, fails */
+    CORRADE_VERIFY(converter->add(MeshData{MeshPrimitive::Triangles, 3}));
+    CORRADE_VERIFY(converter->add(Primitives::icosphereSolid(2)));
+
+    Containers::String out;
+    {
+        Error redirectError{&out};
+        CORRADE_VERIFY(!converter->end());
+    }
+    CORRADE_COMPARE(out,
+        "Trade::MeshOptimizerSceneConverter::convert(): expected an indexed mesh\n"
+        "Trade::MeshOptimizerSceneConverter::end(): can't convert mesh 2\n");
+
+    /* A subsequent batch should start from scratch */
+    CORRADE_VERIFY(converter->begin());
+    CORRADE_VERIFY(converter->add(Primitives::icosphereSolid(1)));
+    Containers::Pointer<AbstractImporter> importer = converter->end();
+    CORRADE_VERIFY(importer);
+    CORRADE_COMPARE(importer->meshCount(), 1);
+}
+
+void MeshOptimizerSceneConverterTest::batchMoreMeshesThanThreads() {
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MeshOptimizerSceneConverter");
+    converter->configuration().setValue("batchThreads", 2);
+    converter->configuration().setValue("quantize", true);
+
+    /* The count of meshes waiting for conversion is limited to four times
+       the thread count, so this makes add() wait for the workers several
+       times. Each mesh is translated differently to verify they don't get
+       mixed up. */
+    CORRADE_VERIFY(converter->begin());
+    for(std::size_t i = 0; i != 32; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(converter->add(MeshTools::transform3D(Primitives::icosphereSolid(1), Matrix4::translation(Vector3::xAxis(Float(i))))));
+    }
+
+    /* Modifying the configuration after begin() doesn't affect the batch */
+    converter->configuration().setValue("quantize", false);
+
+    Containers::Pointer<AbstractImporter> importer = converter->end();
+    CORRADE_VERIFY(importer);
+    CORRADE_COMPARE(importer->meshCount(), 32);
+    for(UnsignedInt i = 0; i != importer->meshCount(); ++i) {
+        CORRADE_ITERATION(i);
+        Containers::Optional<MeshData> mesh = importer->mesh(i);
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE(mesh->attributeFormat(MeshAttribute::Position), VertexFormat::Vector3sNormalized);
+        CORRADE_COMPARE(static_cast<const Matrix4*>(mesh->importerState())->translation(), Vector3::xAxis(Float(i)));
+    }
+}
+
+void MeshOptimizerSceneConverterTest::batchInvalidOptions() {
+    auto&& data = BatchInvalidOptionsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MeshOptimizerSceneConverter");
+    converter->configuration().setValue(data.option, data.value);
+
+    /* The options are checked upfront */
+    {
+        Containers::String out;
+        Error redirectError{&out};
+        CORRADE_VERIFY(!converter->begin());
+        CORRADE_COMPARE(out, Utility::format("Trade::MeshOptimizerSceneConverter::begin(): {}\n", data.message));
+    }
+
+    /* The option checks are done in the plugin-specific API as well */
+    #ifdef MESHOPTIMIZERSCENECONVERTER_PLUGIN_FILENAME
+    CORRADE_SKIP("MeshOptimizerSceneConverter::convertBatch() can be called only if the plugin is built as static");
+    #else
+    const MeshData mesh = Primitives::icosphereSolid(1);
+    const MeshData* meshes[]{&mesh};
+    Containers::String out;
+    Error redirectError{&out};
+    Containers::Array<Containers::Optional<MeshData>> converted = static_cast<MeshOptimizerSceneConverter&>(*converter).convertBatch(Containers::arrayView(meshes));
+    CORRADE_COMPARE(converted.size(), 1);
+    CORRADE_VERIFY(!converted[0]);
+    CORRADE_COMPARE(out, Utility::format("Trade::MeshOptimizerSceneConverter::convertBatch(): {}\n", data.message));
+    #endif
+}
+
+void MeshOptimizerSceneConverterTest::batchVerbose() {
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MeshOptimizerSceneConverter");
+    converter->setFlags(SceneConverterFlag::Verbose);
+    converter->configuration().setValue("batchThreads", 2);
+
+    const MeshData icosphere = Primitives::icosphereSolid(2);
+
+    {
+        Containers::String out;
+        {
+            Debug redirectOutput{&out};
+            CORRADE_VERIFY(converter->begin());
+            CORRADE_VERIFY(converter->add(icosphere));
+            CORRADE_VERIFY(converter->add(icosphere));
+            Containers::Pointer<AbstractImporter> importer = converter->end();
+            CORRADE_VERIFY(importer);
+            CORRADE_COMPARE(importer->meshCount(), 2);
+        }
+        /* Not comparing the exact values as those depend on the meshoptimizer
+           version, just that there's a single summary */
+        CORRADE_COMPARE_AS(out,
+            "Trade::MeshOptimizerSceneConverter::end(): processing stats for 2 meshes:\n"
+            "  vertex cache:\n",
+            TestSuite::Compare::StringHasPrefix);
+        CORRADE_COMPARE_AS(out,
+            "processing stats:",
+            TestSuite::Compare::StringNotContains);
+    }
+
+    #ifdef MESHOPTIMIZERSCENECONVERTER_PLUGIN_FILENAME
+    CORRADE_SKIP("MeshOptimizerSceneConverter::convertBatch() can be called only if the plugin is built as static");
+    #else
+    /* Passing the same mesh twice, to verify the pointer variant of the
+       input as well */
+    const MeshData* meshes[]{&icosphere, &icosphere};
+
+    Containers::String out;
+    {
+        Debug redirectOutput{&out};
+        Containers::Array<Containers::Optional<MeshData>> converted = static_cast<MeshOptimizerSceneConverter&>(*converter).convertBatch(Containers::arrayView(meshes));
+        CORRADE_COMPARE(converted.size(), 2);
+        CORRADE_VERIFY(converted[0]);
+        CORRADE_VERIFY(converted[1]);
+    }
+    /* Not comparing the exact values as those depend on the meshoptimizer
+       version, just that there's a single summary */
+    CORRADE_COMPARE_AS(out,
+        "Trade::MeshOptimizerSceneConverter::convertBatch(): processing stats for 2 meshes:\n"
+        "  vertex cache:\n",
+        TestSuite::Compare::StringHasPrefix);
+    CORRADE_COMPARE_AS(out,
+        "  vertex fetch:\n",
+        TestSuite::Compare::StringContains);
+    CORRADE_COMPARE_AS(out,
+        "  overdraw:\n",
+        TestSuite::Compare::StringContains);
+    CORRADE_COMPARE_AS(out,
+        "processing stats:",
+        TestSuite::Compare::StringNotContains);
+    #endif
+}
+
+/* A 16x16x16 grid of points in a scrambled order, with a custom attribute
+   containing the original vertex ID */
+MeshData scrambledPointCloud() {
+    struct Point {
+        Vector3 position;
+        UnsignedInt id;
+    };
+
+    Containers::Array<char> vertexData{NoInit, 4096*sizeof(Point)};
+    Containers::StridedArrayView1D<Point> points = Containers::arrayCast<Point>(vertexData);
+    for(UnsignedInt i = 0; i != points.size(); ++i) {
+        /* 1031 is a prime, so this visits each grid cell exactly once */
+        const UnsignedInt j = i*1031 % 4096;
+        points[i].position = Vector3{Vector3ui{j % 16, j/16 % 16, j/256}};
+        points[i].id = i;
+    }
+
+    return MeshData{MeshPrimitive::Points, Utility::move(vertexData), {
+        MeshAttributeData{MeshAttribute::Position, points.slice(&Point::position)},
+        MeshAttributeData{meshAttributeCustom(0), points.slice(&Point::id)}
+    }};
+}
+
+Float consecutiveDistance(const Containers::StridedArrayView1D<const Vector3>& positions) {
+    Float distance = 0.0f;
+    for(std::size_t i = 1; i < positions.size(); ++i)
+        distance += (positions[i] - positions[i - 1]).length();
+    return distance;
+}
+
+void MeshOptimizerSceneConverterTest::spatialSortPointsInPlaceIndexed() {
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MeshOptimizerSceneConverter");
+    converter->configuration().setValue("spatialSortPoints", true);
+
+    UnsignedByte indexData[3]{};
+    MeshData mesh{MeshPrimitive::Points,
+        {}, indexData, MeshIndexData{indexData},
+        nullptr, {}, 1};
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convertInPlace(mesh));
+    CORRADE_COMPARE(out,
+        "Trade::MeshOptimizerSceneConverter::convertInPlace(): spatialSortPoints can be performed in-place only on non-indexed meshes, use convert() instead\n");
+}
+
+void MeshOptimizerSceneConverterTest::spatialSortPointsNoPositions() {
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MeshOptimizerSceneConverter");
+    converter->configuration().setValue("spatialSortPoints", true);
+
+    Containers::Array<char> vertexData{ValueInit, 3*4};
+    MeshData mesh{MeshPrimitive::Points, Utility::move(vertexData), {
+        MeshAttributeData{MeshAttribute::ObjectId, VertexFormat::UnsignedInt, 0, 3, 4}
+    }};
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convert(mesh));
+    CORRADE_VERIFY(!converter->convertInPlace(mesh));
+    CORRADE_COMPARE(out,
+        "Trade::MeshOptimizerSceneConverter::convert(): spatialSortPoints requires the mesh to have positions\n"
+        "Trade::MeshOptimizerSceneConverter::convertInPlace(): spatialSortPoints requires the mesh to have positions\n");
+}
+
+void MeshOptimizerSceneConverterTest::spatialSortPoints() {
+    auto&& data = SpatialSortPointsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    MeshData points = scrambledPointCloud();
+    const Containers::Array<Vector3> inputPositions = points.positions3DAsArray();
+
+    /* Reversed index buffer for the indexed variant, to verify it gets
+       remapped */
+    UnsignedShort indexData[4096];
+    for(UnsignedShort i = 0; i != 4096; ++i)
+        indexData[i] = 4095 - i;
+    if(data.indexed)
+        points = MeshData{MeshPrimitive::Points,
+            {}, indexData, MeshIndexData{indexData},
+            points.releaseVertexData(), points.releaseAttributeData()};
+
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MeshOptimizerSceneConverter");
+
+    /* The option should exist and be disabled by default, in which case the
+       point cloud is rejected */
+    CORRADE_COMPARE(converter->configuration().value<Containers::StringView>("spatialSortPoints"), "false");
+    {
+        Containers::String out;
+        Error redirectError{&out};
+        CORRADE_VERIFY(!converter->convert(points));
+        CORRADE_COMPARE(out, "Trade::MeshOptimizerSceneConverter::convert(): expected a triangle mesh, got MeshPrimitive::Points\n");
+    }
+
+    converter->configuration().setValue("spatialSortPoints", true);
+
+    Containers::Optional<MeshData> sorted;
+    if(data.inPlace) {
+        CORRADE_VERIFY(converter->convertInPlace(points));
+        sorted = Utility::move(points);
+    } else {
+        sorted = converter->convert(points);
+        CORRADE_VERIFY(sorted);
+    }
+
+    CORRADE_COMPARE(sorted->primitive(), MeshPrimitive::Points);
+    CORRADE_COMPARE(sorted->isIndexed(), data.indexed);
+    CORRADE_COMPARE(sorted->vertexCount(), 4096);
+
+    /* The vertices should be just reordered, each present exactly once */
+    const Containers::Array<Vector3> positions = sorted->positions3DAsArray();
+    const Containers::StridedArrayView1D<const UnsignedInt> ids = sorted->attribute<UnsignedInt>(meshAttributeCustom(0));
+    Containers::Array<bool> visited{ValueInit, 4096};
+    for(std::size_t i = 0; i != positions.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(!visited[ids[i]]);
+        visited[ids[i]] = true;
+        CORRADE_COMPARE(positions[i], inputPositions[ids[i]]);
+    }
+
+    /* The indices should still reference the same points as before */
+    if(data.indexed) {
+        const Containers::Array<UnsignedInt> indices = sorted->indicesAsArray();
+        for(std::size_t i = 0; i != indices.size(); ++i) {
+            CORRADE_ITERATION(i);
+            CORRADE_COMPARE(positions[indices[i]], inputPositions[indexData[i]]);
+        }
+    }
+
+    /* Not comparing the exact order as that depends on the meshoptimizer
+       version, but neighboring points should be significantly closer than in
+       the scrambled input */
+    CORRADE_COMPARE_AS(consecutiveDistance(positions), consecutiveDistance(inputPositions)*0.25f,
+        TestSuite::Compare::Less);
+}
+
+void MeshOptimizerSceneConverterTest::spatialSortPointsQuantize() {
+    const MeshData points = scrambledPointCloud();
+
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MeshOptimizerSceneConverter");
+    converter->configuration().setValue("spatialSortPoints", true);
+    converter->configuration().setValue("quantize", true);
+
+    Containers::Optional<MeshData> quantized = converter->convert(points);
+    CORRADE_VERIFY(quantized);
+    CORRADE_COMPARE(quantized->primitive(), MeshPrimitive::Points);
+    CORRADE_VERIFY(!quantized->isIndexed());
+    CORRADE_COMPARE(quantized->vertexCount(), 4096);
+    CORRADE_COMPARE(quantized->attributeFormat(MeshAttribute::Position), VertexFormat::Vector3sNormalized);
+    CORRADE_COMPARE(quantized->attributeFormat(meshAttributeCustom(0)), VertexFormat::UnsignedInt);
+    CORRADE_COMPARE(quantized->attributeStride(MeshAttribute::Position), 8 + 4);
+
+    /* The grid spans from 0 to 15 on all axes, so it's centered at 7.5 and
+       the positions should unpack to the original values with a 7.5 scale */
+    const Matrix4 quantizedPositionTransformation = converter->configuration().value<Matrix4>("quantizedPositionTransformation");
+    CORRADE_COMPARE(quantizedPositionTransformation, Matrix4::translation(Vector3{7.5f})*Matrix4::scaling(Vector3{7.5f}));
+    Containers::Array<Vector3> positions = quantized->positions3DAsArray();
+    MeshTools::transformPointsInPlace(quantizedPositionTransformation, positions);
+    const Containers::StridedArrayView1D<const UnsignedInt> ids = quantized->attribute<UnsignedInt>(meshAttributeCustom(0));
+    const Containers::Array<Vector3> inputPositions = points.positions3DAsArray();
+    for(std::size_t i = 0; i != positions.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_WITH(positions[i], inputPositions[ids[i]],
+            TestSuite::Compare::around(Vector3{0.001f}));
+    }
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::MeshOptimizerSceneConverterTest)
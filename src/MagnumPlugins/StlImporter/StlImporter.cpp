@@ -122,6 +122,10 @@ void StlImporter::doOpenData(Containers::Array<char>&& data, const DataFlags dat
         _in = Utility::move(data);
     else
         _in = Containers::Array<char>{InPlaceInit, data};
+
+    /* Remember whether the data are owned externally, in which case doMesh()
+       can reference them directly if zeroCopyNormals is enabled */
+    _inExternallyOwned = !!(dataFlags & DataFlag::ExternallyOwned);
 }
 
 UnsignedInt StlImporter::doMeshCount() const {
@@ -158,6 +162,21 @@ Containers::Optional<MeshData> StlImporter::doMesh(UnsignedInt id, UnsignedInt l
         reinterpret_cast<const Vector3*>(in.data() + sizeof(Vector3)),
         {triangleCount, 3}, {InputTriangleStride, sizeof(Vector3)}};
 
+    /* If the memory is owned externally and is thus guaranteed to stay in
+       scope, and zero-copy import is requested, reference the per-face
+       normals directly. The file stores normals in a layout that's directly
+       usable as a strided vertex attribute, so this is possible only for
+       the per-face level -- per-vertex normals and positions would need
+       data to be duplicated or reshuffled. Possible only on Little-Endian
+       systems where no endian swap is needed. */
+    #ifndef CORRADE_TARGET_BIG_ENDIAN
+    if(level == 1 && _inExternallyOwned && configuration().value<bool>("zeroCopyNormals")) {
+        Containers::StridedArrayView1D<const Vector3> normals = inputNormals.transposed<0, 1>()[0];
+        return MeshData{MeshPrimitive::Faces,
+            DataFlags{}, in, {MeshAttributeData{MeshAttribute::Normal, normals}}};
+    }
+    #endif
+
     /* Decide on output vertex stride and attribute count */
     std::size_t vertexCount;
     std::size_t attributeCount = 1;
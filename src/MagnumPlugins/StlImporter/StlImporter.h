@@ -117,6 +117,22 @@ positions and generate smooth normals from these.
 The [non-standard extensions for vertex colors](https://en.wikipedia.org/wiki/STL_(file_format)#Color_in_binary_STL)
 are not supported due to a lack of generally available files for testing.
 
+@subsection Trade-StlImporter-behavior-zero-copy Zero-copy normal import
+
+If the file is opened using @ref openMemory() and both the
+@cb{.ini} zeroCopyNormals @ce @ref Trade-StlImporter-configuration "configuration option"
+is enabled and @cb{.ini} perFaceToPerVertex @ce is disabled, the per-face
+normals in mesh level @cpp 1 @ce are not copied but instead directly reference
+the memory passed to @ref openMemory(), with a stride of 50 bytes. The
+returned @ref MeshData::vertexDataFlags() are then empty and it's the user
+responsibility to keep the memory in scope for as long as the mesh is used.
+This is useful for example with memory-mapped files, where it avoids
+allocating an extra copy of potentially huge data. Because the triangle vertex
+positions are interleaved with the normals in a way that can't be represented
+with a single strided view, positions in mesh level @cpp 0 @ce are always
+copied. On Big-Endian platforms the option has no effect as the data need to
+be endian-swapped.
+
 @subsection Trade-StlImporter-behavior-ascii ASCII files
 
 The plugin implements parsing of binary files only. If an ASCII file is
@@ -167,6 +183,7 @@ class MAGNUM_STLIMPORTER_EXPORT StlImporter: public AbstractImporter {
         MAGNUM_STLIMPORTER_LOCAL Containers::Optional<MeshData> doMesh(UnsignedInt id, UnsignedInt level) override;
 
         Containers::Optional<Containers::Array<char>> _in;
+        bool _inExternallyOwned = false;
         Containers::Pointer<AbstractImporter> _assimpImporter;
 };
 
@@ -53,6 +53,7 @@ struct StlImporterTest: TestSuite::Tester {
     void asciiDelegateAssimpFailed();
 
     void openMemory();
+    void zeroCopyNormals();
     void openTwice();
     void importTwice();
 
@@ -166,6 +167,9 @@ StlImporterTest::StlImporterTest() {
     addInstancedTests({&StlImporterTest::openMemory},
         Containers::arraySize(OpenMemoryData));
 
+    addInstancedTests({&StlImporterTest::zeroCopyNormals},
+        Containers::arraySize(OpenMemoryData));
+
     addTests({&StlImporterTest::openTwice,
               &StlImporterTest::importTwice});
 
@@ -460,6 +464,52 @@ void StlImporterTest::openMemory() {
         }), TestSuite::Compare::Container);
 }
 
+void StlImporterTest::zeroCopyNormals() {
+    auto&& data = OpenMemoryData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("StlImporter");
+    importer->configuration().setValue("perFaceToPerVertex", false);
+    /* The option should exist and be disabled by default */
+    CORRADE_VERIFY(!importer->configuration().value<bool>("zeroCopyNormals"));
+    importer->configuration().setValue("zeroCopyNormals", true);
+
+    Containers::Optional<Containers::Array<char>> memory = Utility::Path::read(Utility::Path::join(STLIMPORTER_TEST_DIR, "binary.stl"));
+    CORRADE_VERIFY(memory);
+    CORRADE_VERIFY(data.open(*importer, *memory));
+
+    /* Positions are always copied */
+    {
+        Containers::Optional<MeshData> mesh = importer->mesh(0, 0);
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE(mesh->vertexDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+        CORRADE_COMPARE(mesh->vertexCount(), 6);
+    }
+
+    Containers::Optional<MeshData> mesh = importer->mesh(0, 1);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Faces);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Normal),
+        Containers::arrayView<Vector3>({
+            {0.1f, 0.2f, 0.3f},
+            {0.4f, 0.5f, 0.6f}
+        }), TestSuite::Compare::Container);
+
+    /* Only memory passed to openMemory() is guaranteed to stay in scope and
+       thus gets referenced, the data are copied otherwise */
+    #ifndef CORRADE_TARGET_BIG_ENDIAN
+    if(testCaseInstanceId() == 1) {
+        CORRADE_COMPARE(mesh->vertexDataFlags(), DataFlags{});
+        CORRADE_COMPARE(mesh->attributeStride(MeshAttribute::Normal), 50);
+        CORRADE_COMPARE(mesh->attribute(MeshAttribute::Normal).data(), static_cast<const void*>(memory->data() + 84));
+    } else
+    #endif
+    {
+        CORRADE_COMPARE(mesh->vertexDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+        CORRADE_COMPARE(mesh->attributeStride(MeshAttribute::Normal), 12);
+    }
+}
+
 void StlImporterTest::openTwice() {
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("StlImporter");
 